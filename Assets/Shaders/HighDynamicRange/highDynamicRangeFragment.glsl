@@ -19,7 +19,7 @@ uniform vec3 cameraPosition;
 
 uniform vec2 screenSize;
 
-uniform float exposure;
+#include "HighDynamicRange/highDynamicRange.glsl"
 
 uniform sampler2D postProcessMap;
 
@@ -28,23 +28,6 @@ vec2 CalcTexCoord()
 	return gl_FragCoord.xy / screenSize;
 }
 
-vec3 ReinhardToneMapping (const vec3 color)
-{
-	return color / (color + vec3 (1.0));
-}
-
-vec3 ExposureToneMapping (vec3 color)
-{
-	vec3 ldrColor = vec3 (1.0) - exp (-color * exposure);
-
-	return ldrColor;
-}
-
-vec3 CalcHighDynamicRange (vec3 in_diffuse)
-{
-	return ExposureToneMapping (in_diffuse);
-}
-
 void main ()
 {
 	vec2 texCoord = CalcTexCoord();
@@ -9,6 +9,7 @@ uniform isampler3D volumeTextureR;
 uniform isampler3D volumeTextureG;
 uniform isampler3D volumeTextureB;
 uniform ivec3 volumeSize;
+uniform int lpvCascades;
 
 #define SH_I2F 0.001
 
@@ -22,7 +23,7 @@ void main()
 {
 	if (gl_GlobalInvocationID.x < volumeSize.x
 		&& gl_GlobalInvocationID.y < volumeSize.y
-		&& gl_GlobalInvocationID.z < volumeSize.z) {
+		&& gl_GlobalInvocationID.z < volumeSize.z * lpvCascades) {
 
 		ivec3 volumePos = ivec3(gl_GlobalInvocationID);
 
@@ -46,6 +46,8 @@ uniform ivec3 volumeSize;
 uniform int vplsCount;
 uniform int emissiveTextured;
 
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
+
 out vec3 geom_worldPosition;
 out vec3 geom_worldNormal;
 out vec2 geom_texcoord;
@@ -100,18 +102,37 @@ void GeometryInjection (in RSMSample rsmSample)
 
 	vec4 shCoefficients = evalCosineLobeToDir(rsmSample.worldSpaceNormal);// * blockingProbability;
 
-	imageAtomicMax(lpvGeometryVolume, ivec3(rsmSample.volumePos), packUnorm4x8 (shCoefficients));
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (!IsInCascade (cascade, rsmSample.worldSpacePosition)) {
+			continue;
+		}
+
+		ivec3 cell = GetCascadeCell (cascade, rsmSample.worldSpacePosition);
+
+		imageAtomicMax(lpvGeometryVolume, cell, packUnorm4x8 (shCoefficients));
+	}
 }
 
 void RadianceInjection (in RSMSample rsmSample)
 {
 	vec4 shCoefficients = evalCosineLobeToDir (rsmSample.worldSpaceNormal) / PI;
 
-	imgStoreAdd(lpvVolumeR, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.r));
-	imgStoreAdd(lpvVolumeG, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.g));
-	imgStoreAdd(lpvVolumeB, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.b));
-  imageAtomicAdd(lpvSampleCountVolume, ivec3 (rsmSample.volumePos), uint(1));
+	/*
+	 * Samples are averaged per cell, so every cascade gets the same flux
+	*/
 
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (!IsInCascade (cascade, rsmSample.worldSpacePosition)) {
+			continue;
+		}
+
+		ivec3 cell = GetCascadeCell (cascade, rsmSample.worldSpacePosition);
+
+		imgStoreAdd(lpvVolumeR, cell, (shCoefficients * rsmSample.flux.r));
+		imgStoreAdd(lpvVolumeG, cell, (shCoefficients * rsmSample.flux.g));
+		imgStoreAdd(lpvVolumeB, cell, (shCoefficients * rsmSample.flux.b));
+		imageAtomicAdd(lpvSampleCountVolume, cell, uint(1));
+	}
 }
 
 float rand(vec3 co){
@@ -0,0 +1,76 @@
+/*
+ * Light propagation volume cascades are stacked along the z axis of the
+ * volume textures, the finest one first. Requires the volumeSize uniform.
+*/
+
+#define MAX_LPV_CASCADES 4
+#define LPV_CASCADE_BLEND_CELLS 2.0
+
+uniform int lpvCascades;
+uniform vec3 lpvCascadeMinVertex[MAX_LPV_CASCADES];
+uniform vec3 lpvCascadeMaxVertex[MAX_LPV_CASCADES];
+
+float GetCascadeCellSize (int cascade)
+{
+	return (lpvCascadeMaxVertex [cascade].x - lpvCascadeMinVertex [cascade].x) / volumeSize.x;
+}
+
+bool IsInCascade (int cascade, vec3 position)
+{
+	return all (greaterThanEqual (position, lpvCascadeMinVertex [cascade])) &&
+		all (lessThan (position, lpvCascadeMaxVertex [cascade]));
+}
+
+int FindCascade (vec3 position)
+{
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (IsInCascade (cascade, position)) {
+			return cascade;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * Weight of the next cascade close to the border of this one
+*/
+
+float GetCascadeBlendWeight (int cascade, vec3 position)
+{
+	vec3 borderDistance = min (position - lpvCascadeMinVertex [cascade],
+		lpvCascadeMaxVertex [cascade] - position);
+
+	float cells = min (borderDistance.x, min (borderDistance.y, borderDistance.z)) /
+		GetCascadeCellSize (cascade);
+
+	return 1.0 - clamp (cells / LPV_CASCADE_BLEND_CELLS, 0.0, 1.0);
+}
+
+vec3 GetPositionInCascade (int cascade, vec3 position)
+{
+	return (position - lpvCascadeMinVertex [cascade]) / GetCascadeCellSize (cascade);
+}
+
+ivec3 GetCascadeCell (int cascade, vec3 position)
+{
+	ivec3 cell = ivec3 (floor (GetPositionInCascade (cascade, position)));
+
+	return cell + ivec3 (0, 0, cascade * volumeSize.z);
+}
+
+vec3 GetCascadeTexCoord (int cascade, vec3 position)
+{
+	vec3 texCoord = GetPositionInCascade (cascade, position) / vec3 (volumeSize);
+
+	/*
+	 * Keep the filtering inside the cascade slab
+	*/
+
+	float halfTexel = 0.5 / volumeSize.z;
+
+	texCoord.z = clamp (texCoord.z, halfTexel, 1.0 - halfTexel);
+	texCoord.z = (texCoord.z + cascade) / lpvCascades;
+
+	return texCoord;
+}
\ No newline at end of file
@@ -20,28 +20,13 @@ uniform ivec3 volumeSize;
 uniform vec3 lightDirection;
 
 #include "deferred.glsl"
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
 
 vec2 CalcTexCoordRSM()
 {
 	return gl_FragCoord.xy / (screenSize / 4);
 }
 
-float GetInterpolatedComp (float comp, float minValue, float maxValue)
-{
-	return ((comp - minValue) / (maxValue - minValue));
-}
-
-vec3 GetPositionInVolume (vec3 origin)
-{
-	vec3 positionInVolume;
-
-	positionInVolume.x = GetInterpolatedComp (origin.x, minVertex.x, maxVertex.x);
-	positionInVolume.y = GetInterpolatedComp (origin.y, minVertex.y, maxVertex.y);
-	positionInVolume.z = GetInterpolatedComp (origin.z, minVertex.z, maxVertex.z);
-
-	return positionInVolume * volumeSize.x;// + vec3 (1.0);
-}
-
 #define PI 3.1415926f
 
 /*Spherical harmonics coefficients - precomputed*/
@@ -79,13 +64,19 @@ void GeometryInjection (vec3 in_position, vec3 in_normal)
 	vec3 worldPosition = vec3 (inverseViewMatrix * vec4 (in_position, 1.0));
 	vec3 worldNormal = normalMatrix * inverseNormalWorldMatrix * in_normal;
 
-	vec3 volumePos = GetPositionInVolume (worldPosition);
-
 	float blockingProbability = calculateBlockingProbability(1, worldNormal);
 
 	vec4 shCoefficients = evalCosineLobeToDir(worldNormal);// * blockingProbability;
 
-	imageAtomicMax(lpvGeometryVolume, ivec3(volumePos), packUnorm4x8 (shCoefficients));
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (!IsInCascade (cascade, worldPosition)) {
+			continue;
+		}
+
+		ivec3 cell = GetCascadeCell (cascade, worldPosition);
+
+		imageAtomicMax(lpvGeometryVolume, cell, packUnorm4x8 (shCoefficients));
+	}
 }
 
 void main ()
@@ -18,26 +18,13 @@ uniform sampler3D volumeTextureG;
 uniform sampler3D volumeTextureB;
 uniform vec3 minVertex;
 uniform vec3 maxVertex;
+uniform ivec3 volumeSize;
 
 uniform float lpvIntensity;
 
 #include "deferred.glsl"
 
-float GetInterpolatedComp (float comp, float minValue, float maxValue)
-{
-	return ((comp - minValue) / (maxValue - minValue));
-}
-
-vec3 GetPositionInVolume (vec3 origin)
-{
-	vec3 positionInVolume;
-
-	positionInVolume.x = GetInterpolatedComp (origin.x, minVertex.x, maxVertex.x);
-	positionInVolume.y = GetInterpolatedComp (origin.y, minVertex.y, maxVertex.y);
-	positionInVolume.z = GetInterpolatedComp (origin.z, minVertex.z, maxVertex.z);
-
-	return positionInVolume;
-}
+#include "LightPropagationVolumes/lightPropagationVolumesSampling.glsl"
 
 /*Spherical harmonics coefficients - precomputed*/
 #define SH_C0 0.282094792f // 1 / 2sqrt(pi)
@@ -60,13 +47,7 @@ vec3 CalcIndirectDiffuseLight (vec3 in_position, vec3 in_normal)
 
 	vec4 SHintensity = evalSH_direct( -worldSpaceNormal );
 
-	vec3 volumePos = GetPositionInVolume (worldSpacePos);
-
-	vec3 indirectColor = vec3( 
-		dot( SHintensity, texture( volumeTextureR, volumePos) ),
-		dot( SHintensity, texture( volumeTextureG, volumePos ) ),
-		dot( SHintensity, texture( volumeTextureB, volumePos ) )
-	);
+	vec3 indirectColor = EvaluateLPV (worldSpacePos, SHintensity);
 
 	indirectColor = max (indirectColor, 0.0) / PI;
 
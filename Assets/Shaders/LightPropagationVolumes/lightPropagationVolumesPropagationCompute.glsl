@@ -5,6 +5,7 @@ uniform sampler3D volumeTextureR;
 uniform sampler3D volumeTextureG;
 uniform sampler3D volumeTextureB;
 uniform ivec3 volumeSize;
+uniform int lpvCascades;
 uniform int iteration;
 uniform int geometryOcclusion;
 // uniform float occlusionIntensity;
@@ -81,7 +82,13 @@ Contribution CalcPropagation (ivec3 volumePos)
 	const float directFaceSubtendedSolidAngle = 0.12753712; // 0.4006696846f / Pi;
 	const float sideFaceSubtendedSolidAngle = 0.13478556; // 0.4234413544f / Pi;
 
-	const vec3 volumeCellSize = 1.0f / volumeSize;
+	const vec3 volumeCellSize = 1.0f / vec3 (volumeSize.xy, volumeSize.z * lpvCascades);
+
+	/*
+	 * Light does not propagate between cascades
+	*/
+
+	int cascadeOffset = (volumePos.z / volumeSize.z) * volumeSize.z;
 
 	for(int neighbour = 0; neighbour < 6; neighbour++) {
 
@@ -93,7 +100,8 @@ Contribution CalcPropagation (ivec3 volumePos)
 
 		if (neighbourCellIndex.x >= volumeSize.x ||
 			neighbourCellIndex.y >= volumeSize.y ||
-			neighbourCellIndex.z >= volumeSize.z) {
+			neighbourCellIndex.z < cascadeOffset ||
+			neighbourCellIndex.z >= cascadeOffset + volumeSize.z) {
 			continue;
 		}
 
@@ -157,7 +165,7 @@ void main()
 {
 	if (gl_GlobalInvocationID.x < volumeSize.x
 		&& gl_GlobalInvocationID.y < volumeSize.y
-		&& gl_GlobalInvocationID.z < volumeSize.z) {
+		&& gl_GlobalInvocationID.z < volumeSize.z * lpvCascades) {
 
 		ivec3 volumePos = ivec3(gl_GlobalInvocationID);
 
@@ -34,6 +34,7 @@ uniform vec3 lightDirection;
 uniform float injectionBias;
 
 #include "ReflectiveShadowMapping/reflectiveShadowMapping.glsl"
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
 
 struct RSMSample
 {
@@ -188,17 +189,39 @@ void GeometryInjection (in RSMSample rsmSample)
 
 	vec4 shCoefficients = evalCosineLobeToDir(rsmSample.worldSpaceNormal);// * blockingProbability;
 
-	imageAtomicMax(lpvGeometryVolume, ivec3(rsmSample.volumePos), packUnorm4x8 (shCoefficients));
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (!IsInCascade (cascade, rsmSample.worldSpacePosition)) {
+			continue;
+		}
+
+		ivec3 cell = GetCascadeCell (cascade, rsmSample.worldSpacePosition);
+
+		imageAtomicMax(lpvGeometryVolume, cell, packUnorm4x8 (shCoefficients));
+	}
 }
 
 void RadianceInjection (in RSMSample rsmSample)
 {
 	vec4 shCoefficients = evalCosineLobeToDir (rsmSample.worldSpaceNormal) / PI;
 
-	imgStoreAdd(lpvVolumeR, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.r));
-	imgStoreAdd(lpvVolumeG, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.g));
-	imgStoreAdd(lpvVolumeB, ivec3 (rsmSample.volumePos), (shCoefficients * rsmSample.flux.b));
+	for (int cascade = 0; cascade < lpvCascades; cascade ++) {
+		if (!IsInCascade (cascade, rsmSample.worldSpacePosition)) {
+			continue;
+		}
 
+		ivec3 cell = GetCascadeCell (cascade, rsmSample.worldSpacePosition);
+
+		/*
+		 * A coarser cell gathers the samples of a larger surface
+		*/
+
+		float cellRatio = GetCascadeCellSize (0) / GetCascadeCellSize (cascade);
+		vec4 cascadeCoefficients = shCoefficients * cellRatio * cellRatio;
+
+		imgStoreAdd(lpvVolumeR, cell, (cascadeCoefficients * rsmSample.flux.r));
+		imgStoreAdd(lpvVolumeG, cell, (cascadeCoefficients * rsmSample.flux.g));
+		imgStoreAdd(lpvVolumeB, cell, (cascadeCoefficients * rsmSample.flux.b));
+	}
 }
 
 void main ()
@@ -0,0 +1,76 @@
+/*
+ * Reads the light propagation volume at a world position from the finest
+ * cascade that contains it, faded into the next cascade close to its
+ * border. Requires the volumeTextureR, volumeTextureG and volumeTextureB
+ * samplers and the volumeSize uniform.
+*/
+
+#include "LightPropagationVolumes/lightPropagationVolumesCascades.glsl"
+
+struct LPVSample
+{
+	vec4 R;
+	vec4 G;
+	vec4 B;
+};
+
+/*
+ * Positions outside every cascade read the border of the coarsest one
+*/
+
+int GetSampleCascade (vec3 position)
+{
+	int cascade = FindCascade (position);
+
+	return cascade == -1 ? lpvCascades - 1 : cascade;
+}
+
+LPVSample SampleCascade (int cascade, vec3 position)
+{
+	vec3 texCoord = GetCascadeTexCoord (cascade, position);
+
+	LPVSample result;
+
+	result.R = texture (volumeTextureR, texCoord);
+	result.G = texture (volumeTextureG, texCoord);
+	result.B = texture (volumeTextureB, texCoord);
+
+	return result;
+}
+
+LPVSample SampleLPV (vec3 position)
+{
+	int cascade = GetSampleCascade (position);
+
+	LPVSample result = SampleCascade (cascade, position);
+
+	if (cascade + 1 < lpvCascades) {
+		float blendWeight = GetCascadeBlendWeight (cascade, position);
+
+		if (blendWeight > 0.0) {
+			LPVSample next = SampleCascade (cascade + 1, position);
+
+			result.R = mix (result.R, next.R, blendWeight);
+			result.G = mix (result.G, next.G, blendWeight);
+			result.B = mix (result.B, next.B, blendWeight);
+		}
+	}
+
+	return result;
+}
+
+vec3 EvaluateLPV (vec3 position, vec4 SHintensity)
+{
+	LPVSample lpvSample = SampleLPV (position);
+
+	return vec3 (
+		dot (SHintensity, lpvSample.R),
+		dot (SHintensity, lpvSample.G),
+		dot (SHintensity, lpvSample.B)
+	);
+}
+
+float GetLPVCellSize (vec3 position)
+{
+	return GetCascadeCellSize (GetSampleCascade (position));
+}
\ No newline at end of file
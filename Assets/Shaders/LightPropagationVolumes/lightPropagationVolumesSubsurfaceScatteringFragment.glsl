@@ -27,21 +27,7 @@ uniform float lpvIndirectRefractiveIntensity;
 
 #include "deferred.glsl"
 
-float GetInterpolatedComp (float comp, float minValue, float maxValue)
-{
-	return ((comp - minValue) / (maxValue - minValue));
-}
-
-vec3 GetPositionInVolume (vec3 origin)
-{
-	vec3 positionInVolume;
-
-	positionInVolume.x = GetInterpolatedComp (origin.x, minVertex.x, maxVertex.x);
-	positionInVolume.y = GetInterpolatedComp (origin.y, minVertex.y, maxVertex.y);
-	positionInVolume.z = GetInterpolatedComp (origin.z, minVertex.z, maxVertex.z);
-
-	return positionInVolume;
-}
+#include "LightPropagationVolumes/lightPropagationVolumesSampling.glsl"
 
 /*Spherical harmonics coefficients - precomputed*/
 #define SH_C0 0.282094792f // 1 / 2sqrt(pi)
@@ -67,22 +53,17 @@ vec3 CalcIndirectRefractiveLight (vec3 in_position, vec3 in_normal, float in_ref
 
 	vec4 SHintensity = evalSH_direct( -refractiveDir );
 
-	vec3 refractiveStep = 1.0f / volumeSize * refractiveDir * 1.732;
-	vec3 volumePos = GetPositionInVolume (worldSpacePos);
+	vec3 samplePos = worldSpacePos;
 
 	vec3 subsurfaceScatteringColor = vec3 (0.0f);
 
 	for(float refractiveIndex = 0; refractiveIndex < lpvRefractiveIterations; refractiveIndex++) {
 
-		vec3 indirectColor = vec3( 
-			dot( SHintensity, texture( volumeTextureR, volumePos) ),
-			dot( SHintensity, texture( volumeTextureG, volumePos ) ),
-			dot( SHintensity, texture( volumeTextureB, volumePos ) )
-		);
+		vec3 indirectColor = EvaluateLPV (samplePos, SHintensity);
 
 		subsurfaceScatteringColor += max (indirectColor, 0.0) / PI / 5;
 
-		volumePos += refractiveStep;
+		samplePos += refractiveDir * GetLPVCellSize (samplePos) * 1.732;
 	}
 
 	return clamp (subsurfaceScatteringColor * lpvIndirectRefractiveIntensity, 0.0, 1.0);
@@ -0,0 +1,113 @@
+#version 330
+
+layout(location = 0) out vec4 out_color;
+layout(location = 1) out vec4 out_geometry;
+
+uniform mat4 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+uniform mat4 modelViewMatrix;
+uniform mat4 viewProjectionMatrix;
+uniform mat4 modelViewProjectionMatrix;
+uniform mat3 normalMatrix;
+uniform mat3 normalWorldMatrix;
+uniform mat4 inverseViewMatrix;
+uniform mat3 inverseNormalWorldMatrix;
+
+uniform vec3 cameraPosition;
+uniform vec2 cameraZLimits;
+
+uniform sampler2D temporalFilterMap;
+uniform sampler2D temporalGeometryMap;
+uniform sampler2D indirectDiffuseMap;
+
+uniform vec2 rsmResolution;
+uniform int rsmSubsetsCount;
+uniform int rsmHistoryValid;
+uniform float rsmHistoryMaxDistance;
+uniform float rsmHistoryMinAngle;
+uniform vec3 lastCameraPosition;
+
+#include "deferred.glsl"
+#include "TemporalFiltering/temporalFiltering.glsl"
+
+vec2 CalcTexCoordRSM ()
+{
+	return gl_FragCoord.xy / rsmResolution;
+}
+
+/*
+ * The history of a pixel is kept only if it was lit from the same
+ * surface, that is, with a close distance to the last camera position
+ * and a close normal
+*/
+
+bool IsHistoryValid (const in vec3 worldPosition, const in vec3 worldNormal, const in vec4 historyGeometry)
+{
+	float lastDistance = distance (worldPosition, lastCameraPosition);
+
+	if (abs (lastDistance - historyGeometry.w) > rsmHistoryMaxDistance * lastDistance) {
+		return false;
+	}
+
+	if (dot (worldNormal, historyGeometry.xyz) < rsmHistoryMinAngle) {
+		return false;
+	}
+
+	return true;
+}
+
+void main()
+{
+	vec2 texCoord = CalcTexCoordRSM();
+	vec3 in_position = textureLod (gPositionMap, texCoord, 0).xyz;
+	vec3 in_normal = textureLod (gNormalMap, texCoord, 0).xyz;
+
+	vec3 currentColor = texture (indirectDiffuseMap, texCoord).xyz;
+
+	if (dot (in_position, in_position) == 0) {
+		out_color = vec4 (currentColor, 0.0);
+		out_geometry = vec4 (0.0);
+		return;
+	}
+
+	vec3 worldPosition = (inverseViewMatrix * vec4 (in_position, 1.0)).xyz;
+	vec3 worldNormal = normalize (mat3 (inverseViewMatrix) * in_normal);
+
+	out_geometry = vec4 (worldNormal, length (in_position));
+
+	/*
+	 * Reproject pixel in last frame
+	*/
+
+	vec2 lastTexCoord = CalcReprojectedTexCoord (in_position, texCoord);
+
+	if (rsmHistoryValid == 0 || any (greaterThan (lastTexCoord, vec2 (1.0))) || any (lessThan (lastTexCoord, vec2 (0.0)))) {
+		out_color = vec4 (currentColor, 0.0);
+		return;
+	}
+
+	vec4 historyGeometry = texture (temporalGeometryMap, lastTexCoord);
+
+	if (IsHistoryValid (worldPosition, worldNormal, historyGeometry) == false) {
+		out_color = vec4 (currentColor, 0.0);
+		return;
+	}
+
+	vec4 historyColor = texture (temporalFilterMap, lastTexCoord);
+
+	if (isnan (historyColor.x) || isnan (historyColor.w)) {
+		out_color = vec4 (currentColor, 0.0);
+		return;
+	}
+
+	/*
+	 * Average over the last frames, one for each samples subset, so the
+	 * result converges to the full samples set
+	*/
+
+	float historyLength = min (historyColor.w + 1.0, float (rsmSubsetsCount - 1));
+	float weight = historyLength / (historyLength + 1.0);
+
+	out_color = vec4 (mix (currentColor, historyColor.xyz, weight), historyLength);
+}
\ No newline at end of file
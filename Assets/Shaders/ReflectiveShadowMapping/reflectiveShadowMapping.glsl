@@ -15,6 +15,27 @@ layout(std140) uniform rsmSamples
 
 uniform float rsmRadius;
 
+uniform int rsmSubsetsCount;
+uniform int rsmInterleaveSize;
+uniform int rsmFrameIndex;
+
+/*
+ * Pixels of an interleave pattern take different runs of the samples
+ * and move to the next run every frame
+*/
+
+ivec2 CalcRSMSamplesRange (in ivec2 pixel)
+{
+	ivec2 patternPixel = pixel % rsmInterleaveSize;
+
+	int subset = (patternPixel.y * rsmInterleaveSize + patternPixel.x + rsmFrameIndex) % rsmSubsetsCount;
+
+	int firstSample = subset * rsmSamplesCount / rsmSubsetsCount;
+	int lastSample = (subset + 1) * rsmSamplesCount / rsmSubsetsCount;
+
+	return ivec2 (firstSample, lastSample);
+}
+
 /*
  * Indirect Illumination Calculation
  * Thanks to: http://ericpolman.com/reflective-shadow-maps-part-2-the-implementation/
@@ -31,7 +52,9 @@ vec3 CalcViewIndirectDiffuseLight (in vec3 viewPosition, in vec3 viewNormal)
 	vec4 lightSpacePos = lightProjectionMatrix * vec4 (lightViewSpacePos, 1.0);
 	vec3 rsmProjCoords = (lightSpacePos.xyz / lightSpacePos.w) * 0.5 + 0.5;
 
-	for (int index = 0; index < rsmSamplesCount; index ++) {
+	ivec2 samplesRange = CalcRSMSamplesRange (ivec2 (gl_FragCoord.xy));
+
+	for (int index = samplesRange.x; index < samplesRange.y; index ++) {
 
 		vec2 rnd = rsmSample [index].xy;
 
@@ -53,7 +76,7 @@ vec3 CalcViewIndirectDiffuseLight (in vec3 viewPosition, in vec3 viewNormal)
 		indirectColor += result;
 	}
 
-	indirectColor /= rsmSamplesCount;
+	indirectColor /= float (max (samplesRange.y - samplesRange.x, 1));
 
 	return indirectColor;
 }
@@ -0,0 +1,15 @@
+#version 330 core
+
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec3 in_normal;
+layout(location = 2) in vec2 in_texcoord;
+layout(location = 8) in mat4 in_modelMatrix;
+
+uniform mat4 viewProjectionMatrix;
+
+out vec3 vert_position;
+
+void main()
+{
+	gl_Position = viewProjectionMatrix * in_modelMatrix * vec4 (in_position, 1);
+}
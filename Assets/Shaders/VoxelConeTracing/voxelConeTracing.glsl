@@ -1,3 +1,5 @@
+#define MAX_CLIPMAP_LEVELS 4
+
 uniform sampler3D voxelTexture;
 uniform sampler3D voxelMipmapTexture;
 
@@ -6,6 +8,16 @@ uniform vec3 maxVertex;
 uniform ivec3 volumeSize;
 uniform int volumeMipmapLevels;
 
+/*
+ * Clipmap levels are stacked along z. A volume fitted to the scene is
+ * a single level without offset.
+*/
+
+uniform int clipmapLevels;
+uniform vec3 clipmapMinVertex[MAX_CLIPMAP_LEVELS];
+uniform vec3 clipmapMaxVertex[MAX_CLIPMAP_LEVELS];
+uniform ivec3 clipmapOffset[MAX_CLIPMAP_LEVELS];
+
 uniform float originBias;
 
 float GetInterpolatedComp (float comp, float minValue, float maxValue)
@@ -29,6 +41,100 @@ float minVoxelDiameterInv = volumeSize.x;
 const float faceCount = 6.0;
 const float faceCountInv = 1.0 / faceCount;
 
+vec3 GetPositionInLevel (vec3 worldPosition, int level)
+{
+	return (worldPosition - clipmapMinVertex [level]) / (clipmapMaxVertex [level] - clipmapMinVertex [level]);
+}
+
+/*
+ * Voxel of a level in the stacked volume
+*/
+
+ivec3 GetClipmapVoxel (ivec3 voxelPos, int level)
+{
+	ivec3 clipmapVoxel = (voxelPos + clipmapOffset [level]) % volumeSize;
+	clipmapVoxel.z += level * volumeSize.z;
+
+	return clipmapVoxel;
+}
+
+/*
+ * Coarser levels hold the same resolution as the mipmaps of the finer
+ * ones over a larger area. Use the first level that has the needed
+ * resolution and contains the sample.
+*/
+
+int GetClipmapLevel (vec3 worldPosition, float sampleLOD, out vec3 levelPosition)
+{
+	int firstLevel = clamp (int (floor (sampleLOD)), 0, clipmapLevels - 1);
+
+	for (int level = firstLevel; level < clipmapLevels; level++) {
+		levelPosition = GetPositionInLevel (worldPosition, level);
+
+		if (all (greaterThanEqual (levelPosition, vec3 (0.0))) && all (lessThanEqual (levelPosition, vec3 (1.0)))) {
+			return level;
+		}
+	}
+
+	return -1;
+}
+
+// samplePos is in texture space of the first level
+// returns false when the sample is outside of the volume
+bool voxelSampleVolume(vec3 samplePos, ivec3 face, vec3 weight, float sampleLOD, out vec4 sampleValue)
+{
+	vec3 worldPosition = minVertex + samplePos * (maxVertex - minVertex);
+
+	vec3 levelPosition;
+	int level = GetClipmapLevel (worldPosition, sampleLOD, levelPosition);
+
+	if (level < 0) {
+		return false;
+	}
+
+	sampleLOD = max (sampleLOD - level, 0.0);
+
+	/*
+	 * Wrap around the toroidal offset and move to the level slice. Keep
+	 * the filter away from the neighbour levels.
+	*/
+
+	vec3 texturePos = fract (levelPosition + vec3 (clipmapOffset [level]) * minVoxelDiameter);
+
+	if (clipmapLevels > 1) {
+		float mipmapVoxelDiameter = minVoxelDiameter * exp2 (floor (sampleLOD));
+		texturePos.z = clamp (texturePos.z, 0.5 * mipmapVoxelDiameter, 1.0 - 0.5 * mipmapVoxelDiameter);
+	}
+
+	texturePos.z = (texturePos.z + level) / clipmapLevels;
+
+	vec3 mipmapSamplePos = (vec3 (face) + texturePos.x) * faceCountInv;
+
+	if (sampleLOD < 1) {
+		vec4 sampleValue1 = texture (voxelTexture, texturePos);
+
+		/*
+		 * Next mipmap level
+		*/
+
+		vec4 sampleValue2 =
+			weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, texturePos.yz), 0) +
+			weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, texturePos.yz), 0) +
+			weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, texturePos.yz), 0);
+
+		sampleValue = mix (sampleValue1, sampleValue2, fract(sampleLOD));
+	} else {
+		sampleLOD = min (sampleLOD - 1.0, volumeMipmapLevels - 1);
+
+		sampleValue =
+			weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, texturePos.yz), sampleLOD) +
+			weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, texturePos.yz), sampleLOD) +
+			weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, texturePos.yz), sampleLOD);
+	}
+
+	return true;
+}
+
 // origin, dir, and maxDist are in texture space
 // dir should be normalized
 // coneRatio is the cone diameter to height ratio (2.0 for 90-degree cone)
@@ -61,17 +167,6 @@ vec4 voxelTraceCone(vec3 origin, vec3 dir, float coneRatio, float maxDist)
 		
 		vec3 samplePos = origin + dir * dist;
 
-		/*
-		 * Check sampling position limits
-		*/
-
-		bvec3 a = greaterThan(samplePos, vec3(1.0));
-		bvec3 b = lessThan(samplePos, vec3(0.0));
-
-		if (any(bvec2(any(a), any(b)))) {
-			break;
-		}
-
 		ivec3 face = ivec3 (
 			dir.x > 0 ? 0 : 1,
 			dir.y > 0 ? 2 : 3,
@@ -81,37 +176,13 @@ vec4 voxelTraceCone(vec3 origin, vec3 dir, float coneRatio, float maxDist)
 		vec3 weight = dir * dir;
 
 		/*
-		 * Current mipmap level
+		 * Sample the volume, stop outside of it
 		*/
 
 		vec4 sampleValue = vec4 (0.0);
 
-		vec3 mipmapSamplePos = vec3 (
-			samplePos.x * faceCountInv + faceCountInv * face.x,
-			samplePos.x * faceCountInv + faceCountInv * face.y,
-			samplePos.x * faceCountInv + faceCountInv * face.z
-		);
-
-		if (sampleLOD < 1) {
-			vec4 sampleValue1 = texture (voxelTexture, samplePos);
-
-			/*
-			 * Next mipmap level
-			*/
-
-			vec4 sampleValue2 =
-				weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), 0) +
-				weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, samplePos.yz), 0) +
-				weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, samplePos.yz), 0);
-
-			sampleValue = mix (sampleValue1, sampleValue2, fract(sampleLOD));
-		} else {
-			sampleLOD -= 1.0;
-
-			sampleValue =
-				weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)) +
-				weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)) +
-				weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1));
+		if (!voxelSampleVolume (samplePos, face, weight, sampleLOD, sampleValue)) {
+			break;
 		}
 
 		/*
@@ -150,61 +221,24 @@ float voxelTraceConeOcclusion(vec3 origin, vec3 dir, float coneRatio, float maxD
 		
 		vec3 samplePos = origin + dir * dist;
 
-		/*
-		 * Check sampling position limits
-		*/
-
-		bvec3 a = greaterThan(samplePos, vec3(1.0));
-		bvec3 b = lessThan(samplePos, vec3(0.0));
-
-		if (any(bvec2(any(a), any(b)))) {
-			break;
-		}
-
 		ivec3 face = ivec3 (
 			dir.x > 0 ? 0 : 1,
 			dir.y > 0 ? 2 : 3,
 			dir.z > 0 ? 4 : 5
 		);
 
-		vec3 weight = dir * dir;
-
 		/*
-		 * Current mipmap level
+		 * Occlusion is sampled from the first direction only
 		*/
 
-		float sampleValue = 0.0;
-
-		vec3 mipmapSamplePos = vec3 (
-			samplePos.x * faceCountInv + faceCountInv * face.x,
-			samplePos.x * faceCountInv + faceCountInv * face.y,
-			samplePos.x * faceCountInv + faceCountInv * face.z
-		);
-
-		if (sampleLOD < 1) {
-			float sampleValue1 = texture (voxelTexture, samplePos).a;
-
-			/*
-			 * Next mipmap level
-			*/
+		vec4 sampleColor = vec4 (0.0);
 
-			// float sampleValue2 =
-			// 	weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), 0).a +
-			// 	weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, samplePos.yz), 0).a +
-			// 	weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, samplePos.yz), 0).a;
-			float sampleValue2 = textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), 0).a;
-
-			sampleValue = mix (sampleValue1, sampleValue2, fract(sampleLOD));
-		} else {
-			sampleLOD -= 1.0;
-
-			// sampleValue =
-			// 	weight.x * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)).a +
-			// 	weight.y * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.y, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)).a +
-			// 	weight.z * textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.z, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)).a;
-			sampleValue = textureLod (voxelMipmapTexture, vec3 (mipmapSamplePos.x, samplePos.yz), min (sampleLOD, volumeMipmapLevels - 1)).a;
+		if (!voxelSampleVolume (samplePos, face, vec3 (1.0, 0.0, 0.0), sampleLOD, sampleColor)) {
+			break;
 		}
 
+		float sampleValue = sampleColor.a;
+
 		/*
 		 * Mipmap filter
 		*/
@@ -13,6 +13,10 @@ uniform ivec3 volumeSize;
 
 uniform int volumeMipmapLevel;
 
+#define MAX_CLIPMAP_LEVELS 4
+
+uniform ivec3 clipmapOffset[MAX_CLIPMAP_LEVELS];
+
 uniform mat4 inverseViewProjectionMatrix;
 
 layout(location = 0) out vec3 outputColor;
@@ -133,14 +137,22 @@ void main ()
 
 	int face = 0;
 
+	/*
+	 * Show the first clipmap level, wrapped around its offset
+	*/
+
+	ivec3 mipmapOffset = clipmapOffset [0] >> volumeMipmapLevel;
+
 	while (all(greaterThanEqual(voxelPos, vec3(0.0))) && all(lessThan(voxelPos, mipmapVolumeSize)))
 	{
 		// Sample 3D texture at current position.
 		vec3 texCoords = voxelPos / mipmapVolumeSize;
 
+		ivec3 texelPos = (ivec3 (voxelPos) + mipmapOffset) % mipmapVolumeSize;
+
 		vec4 color = volumeMipmapLevel == 0 ?
-			texelFetch(voxelTexture, ivec3 (voxelPos), 0) :
-			texelFetch(voxelMipmapTexture, ivec3 (voxelPos.x + mipmapVolumeSize.x * face, voxelPos.y, voxelPos.z), volumeMipmapLevel - 1);
+			texelFetch(voxelTexture, texelPos, 0) :
+			texelFetch(voxelMipmapTexture, ivec3 (texelPos.x + mipmapVolumeSize.x * face, texelPos.y, texelPos.z), volumeMipmapLevel - 1);
 			// texture (voxelTexture, texCoords) :
 			// textureLod (voxelMipmapTexture, vec3 (texCoords.x / 6 + 1.0 / 6.0 * face, texCoords.y, texCoords.z), volumeMipmapLevel - 1);
 
@@ -11,6 +11,10 @@ layout (local_size_x = 4, local_size_y = 4, local_size_z = 4) in;
 
 uniform int DstMipRes;
 
+uniform ivec3 DstMipOffset;
+uniform ivec3 DstMipRegion;
+uniform int DstMipLevel;
+
 uniform sampler3D srcTextureMip;
 
 layout(binding = 0, rgba8) uniform writeonly image3D dstImageMip;
@@ -28,11 +32,17 @@ vec4[8] fetchTexels(ivec3 pos) {
 
 void main() 
 {
-	if (gl_GlobalInvocationID.x < DstMipRes
-		&& gl_GlobalInvocationID.y < DstMipRes
-		&& gl_GlobalInvocationID.z < DstMipRes) {
+	ivec3 dstPos = DstMipOffset + ivec3(gl_GlobalInvocationID);
+
+	if (all(lessThan(ivec3(gl_GlobalInvocationID), DstMipRegion))
+		&& all(lessThan(dstPos, ivec3(DstMipRes)))) {
+
+		/*
+		 * Clipmap levels are stacked along z
+		*/
+
+		dstPos.z += DstMipLevel * DstMipRes;
 
-		ivec3 dstPos = ivec3(gl_GlobalInvocationID);
 		ivec3 srcPos = dstPos * 2;
   
 		vec4 values[8] = fetchTexels(srcPos);
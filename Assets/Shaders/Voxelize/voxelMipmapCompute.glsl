@@ -11,6 +11,10 @@ layout (local_size_x = 24, local_size_y = 4, local_size_z = 4) in;
 
 uniform int DstMipRes;
 
+uniform ivec3 DstMipOffset;
+uniform ivec3 DstMipRegion;
+uniform int DstMipLevel;
+
 uniform int srcMipLevel;
 uniform sampler3D srcTextureMip;
 
@@ -29,11 +33,20 @@ vec4[8] fetchTexels(ivec3 pos) {
 
 void main() 
 {
-	if (gl_GlobalInvocationID.x < DstMipRes * 6
-		&& gl_GlobalInvocationID.y < DstMipRes
-		&& gl_GlobalInvocationID.z < DstMipRes) {
+	/*
+	 * The six directions are laid side by side on x, the region is
+	 * repeated for each of them
+	*/
+
+	int faceIndex = int(gl_GlobalInvocationID.x) / DstMipRegion.x;
+	ivec3 regionPos = ivec3(int(gl_GlobalInvocationID.x) % DstMipRegion.x, gl_GlobalInvocationID.yz);
+	ivec3 localPos = DstMipOffset + regionPos;
+
+	if (faceIndex < 6
+		&& all(lessThan(regionPos, DstMipRegion))
+		&& all(lessThan(localPos, ivec3(DstMipRes)))) {
 
-		ivec3 dstPos = ivec3(gl_GlobalInvocationID);
+		ivec3 dstPos = ivec3(localPos.x + DstMipRes * faceIndex, localPos.y, localPos.z + DstMipRes * DstMipLevel);
 		ivec3 srcPos = dstPos * 2;
   
 		vec4 values[8] = fetchTexels(srcPos);
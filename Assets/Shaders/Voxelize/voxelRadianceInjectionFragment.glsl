@@ -62,11 +62,25 @@ RSMSample GetRSMSample (vec2 texCoord)
 
 void RadianceInjection (in RSMSample rsmSample)
 {
-	vec4 voxelColor = texelFetch(voxelTexture, ivec3 (rsmSample.volumePos), 0);
+	/*
+	 * Inject in every clipmap level that contains the sample
+	*/
 
-	vec4 fragmentColor = vec4 (rsmSample.flux, voxelColor.a);
+	for (int level = 0; level < clipmapLevels; level++) {
+		vec3 levelPosition = GetPositionInLevel (rsmSample.worldSpacePosition, level);
 
-	imageStore (voxelVolume, ivec3 (rsmSample.volumePos), fragmentColor);
+		if (any (lessThan (levelPosition, vec3 (0.0))) || any (greaterThanEqual (levelPosition, vec3 (1.0)))) {
+			continue;
+		}
+
+		ivec3 voxelPos = GetClipmapVoxel (ivec3 (levelPosition * volumeSize), level);
+
+		vec4 voxelColor = texelFetch(voxelTexture, voxelPos, 0);
+
+		vec4 fragmentColor = vec4 (rsmSample.flux, voxelColor.a);
+
+		imageStore (voxelVolume, voxelPos, fragmentColor);
+	}
 }
 
 void main ()
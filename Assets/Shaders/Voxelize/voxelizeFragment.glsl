@@ -24,6 +24,8 @@ uniform vec3 minPosition;
 uniform vec3 maxPosition;
 
 uniform ivec3 volumeSize;
+uniform ivec3 volumeOffset;
+uniform int volumeLevel;
 
 in vec3 geom_worldPosition;
 in vec3 geom_worldNormal;
@@ -90,14 +92,28 @@ void main()
 	
 	vec3 coords = geom_swizzleMatrixInv * vec3(gl_FragCoord.xy, gl_FragCoord.z * volumeSize.z);
 
+	ivec3 voxelPos = ivec3 (coords);
+
+	if (any (lessThan (voxelPos, ivec3 (0))) || any (greaterThanEqual (voxelPos, volumeSize))) {
+		discard;
+	}
+
+	/*
+	 * Wrap around the toroidal offset of the level and move to its
+	 * place in the stacked volume
+	*/
+
+	voxelPos = (voxelPos + volumeOffset) % volumeSize;
+	voxelPos.z += volumeLevel * volumeSize.z;
+
 	/*
 	 * Save in texture
 	*/
 
 	if (dot (emissiveMap, emissiveMap) > 0) {
-		imageStore (voxelVolume, ivec3 (coords), vec4 (fragmentColor, 0.99));
+		imageStore (voxelVolume, voxelPos, vec4 (fragmentColor, 0.99));
 	} else {
-		imageStore (voxelVolume, ivec3 (coords), vec4 (fragmentColor, 1.0 - MaterialTransparency));
+		imageStore (voxelVolume, voxelPos, vec4 (fragmentColor, 1.0 - MaterialTransparency));
 	}
 
 	// ImageAtomicAverageRGBA8 (voxelVolume, ivec3 (coords), fragmentColor);
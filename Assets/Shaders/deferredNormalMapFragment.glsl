@@ -76,6 +76,13 @@ void main()
 		vec3 bitangent = normalize (cross (tangent, normal));
 
 		normalMap = 2.0 * normalMap - 1.0;
+
+		/*
+		 * Compressed normal maps only store X and Y
+		*/
+
+		normalMap.z = sqrt (max (0.0, 1.0 - dot (normalMap.xy, normalMap.xy)));
+
 		mat3 tnbMat = mat3 (tangent, bitangent, normal);
 
 		normal = normalize (tnbMat * normalMap);
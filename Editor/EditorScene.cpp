@@ -7,6 +7,7 @@
 
 #include "Renderer/RenderManager.h"
 #include "Renderer/RenderSystem.h"
+#include "Renderer/Readback/ReadbackManager.h"
 
 #include "RenderPasses/FramebufferRenderVolume.h"
 
@@ -25,6 +26,8 @@
 
 #include "Utils/Extensions/StringExtend.h"
 
+#include "Core/Console/Console.h"
+
 namespace fs = std::filesystem;
 
 EditorScene::EditorScene () :
@@ -36,7 +39,9 @@ EditorScene::EditorScene () :
 	_textureID (0),
 	_mousePosition (0),
 	_isHovered (false),
-	_targetFrameRate (-1)
+	_targetFrameRate (-1),
+	_isRecording (false),
+	_recordedFramesCount (0)
 {
 
 }
@@ -117,8 +122,21 @@ void EditorScene::Render ()
 
 	RenderProduct result = RenderManager::Instance ()->Render (_sceneCamera, *_renderSettings);
 
+	/*
+	 * Nothing is drawn while the shaders of the render module compile
+	*/
+
 	FramebufferRenderVolume* renderVolume = dynamic_cast<FramebufferRenderVolume*> (result.resultVolume);
+
+	if (renderVolume == nullptr) {
+		return;
+	}
+
 	_textureID = renderVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex ();
+
+	if (_isRecording == true) {
+		RecordFrame ();
+	}
 }
 
 Camera* EditorScene::GetCamera ()
@@ -160,6 +178,7 @@ void EditorScene::ShowSceneMenu ()
 {
 	bool saveVolume = false;
 	bool setFrameRate = false;
+	bool isRecording = _isRecording;
 
     // Menu Bar
     if (ImGui::BeginMenuBar())
@@ -167,6 +186,7 @@ void EditorScene::ShowSceneMenu ()
         if (ImGui::BeginMenu("Tools"))
         {
             saveVolume = ImGui::MenuItem("Take ScreenShot", "Ctrl+Shift+P");
+            ImGui::MenuItem("Record Frames", "", &isRecording);
             ImGui::Separator ();
 			setFrameRate = ImGui::MenuItem("Set Frame Rate", "Ctrl+Shift+Y");
             if (ImGui::MenuItem("Set Resolution", "Ctrl+Shift+U")) { }
@@ -187,6 +207,16 @@ void EditorScene::ShowSceneMenu ()
 		ImGui::EndMenuBar();
 	}
 
+	if (isRecording != _isRecording) {
+		_isRecording = isRecording;
+
+		if (_isRecording == true) {
+			StartRecording ();
+		} else {
+			Console::Log ("Recorded " + std::to_string (_recordedFramesCount) + " frames in " + _recordingPath);
+		}
+	}
+
 	static ImGuiFs::Dialog dialog = ImGuiFs::Dialog ();
 
 	std::time_t currentTime = std::time (nullptr);
@@ -201,14 +231,13 @@ void EditorScene::ShowSceneMenu ()
 
 		volumePath = FileSystem::Relative (volumePath, fs::current_path ().string ());
 
-		Resource<TextureView> textureView (new TextureView (), "temp");
-		textureView->SetGPUIndex (_textureID);
+		bool isRequested = ReadbackManager::Instance ()->ReadTexture (_textureID, [volumePath] (const Resource<Texture>& texture) {
+			Resources::SaveTexture (texture, volumePath);
+		});
 
-		Resource<Texture> texture = RenderSystem::SaveTexture (textureView);
-
-		textureView->SetGPUIndex (0);
-
-		Resources::SaveTexture (texture, volumePath);
+		if (isRequested == false) {
+			Console::LogWarning ("Screenshot could not be taken, too many captures in flight");
+		}
 	}
 
 	if (setFrameRate) {
@@ -222,3 +251,38 @@ void EditorScene::ShowSceneMenu ()
 		ImGui::EndPopup();
 	}
 }
+
+
+void EditorScene::StartRecording ()
+{
+	std::time_t currentTime = std::time (nullptr);
+	std::string directory = std::string (std::ctime (&currentTime));
+	directory.pop_back ();
+	Extensions::StringExtend::ReplaceAll (directory, ":", "-");
+
+	_recordingPath = "Recordings/" + directory + "/";
+	_recordedFramesCount = 0;
+
+	fs::create_directories (_recordingPath);
+}
+
+void EditorScene::RecordFrame ()
+{
+	/*
+	 * A frame that finds every readback buffer busy is skipped, the
+	 * recording never waits for the GPU
+	*/
+
+	std::string frameIndex = std::to_string (_recordedFramesCount);
+	frameIndex.insert (0, frameIndex.size () < 6 ? 6 - frameIndex.size () : 0, '0');
+
+	std::string framePath = _recordingPath + "frame_" + frameIndex + ".png";
+
+	bool isRequested = ReadbackManager::Instance ()->ReadTexture (_textureID, [framePath] (const Resource<Texture>& texture) {
+		Resources::SaveTexture (texture, framePath);
+	});
+
+	if (isRequested == true) {
+		++ _recordedFramesCount;
+	}
+}
\ No newline at end of file
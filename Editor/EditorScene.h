@@ -31,6 +31,10 @@ private:
 	float _targetFrameRate;
 	float _elapsedFrameTime;
 
+	bool _isRecording;
+	std::string _recordingPath;
+	std::size_t _recordedFramesCount;
+
 	// Change this
 	Scene* _lastScene;
 
@@ -58,6 +62,9 @@ private:
 	EditorScene& operator=(const EditorScene& other);
 
 	void ShowSceneMenu ();
+
+	void StartRecording ();
+	void RecordFrame ();
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "EditorConsole.h"
 
-#include <cstring>
+#include <vector>
 
 #include "Core/Console/Console.h"
 
@@ -10,6 +10,9 @@
 
 EditorConsole::EditorConsole () :
 	_editorConsoleSink (nullptr),
+	_showLogsMask (0),
+	_filteredLogsMask (0),
+	_isFilterDirty (true),
 	_selectedIndex (0)
 {
 
@@ -26,11 +29,15 @@ void EditorConsole::Show ()
 	_showLogsMask = SettingsManager::Instance ()->GetValue<int> ("Menu", "console_logs_mask", 30);
 
 	if (_editorConsoleSink == nullptr) {
-		_editorConsoleSink = new EditorConsoleSink ();
+		std::size_t capacity = SettingsManager::Instance ()->GetValue<int> ("Console", "editor_history", 100000);
+
+		_editorConsoleSink = new EditorConsoleSink (capacity);
 
 		Console::AttachSink (_editorConsoleSink);
 	}
 
+	_editorConsoleSink->Update ();
+
 	ShowConsoleWindow ();
 }
 
@@ -69,21 +76,23 @@ void EditorConsole::ShowConsoleSettings ()
 {
 	if (ImGui::BeginPopup("Options")) {
 
+		auto& logStore = _editorConsoleSink->GetLogStore ();
+
 		bool lastShowDebug = (_showLogsMask & (1 << LogPriority::LOG_DEBUG));
 		bool showDebug = lastShowDebug;
-		ImGui::Checkbox ("Debug", &showDebug);
+		ImGui::Checkbox (("Debug (" + std::to_string (logStore.GetCount (LOG_DEBUG)) + ")###Debug").c_str (), &showDebug);
 
 		bool lastShowInfo = (_showLogsMask & (1 << LogPriority::LOG_INFO));
 		bool showInfo = lastShowInfo;
-		ImGui::Checkbox ("Info", &showInfo);
+		ImGui::Checkbox (("Info (" + std::to_string (logStore.GetCount (LOG_INFO)) + ")###Info").c_str (), &showInfo);
 
 		bool lastShowWarning = (_showLogsMask & (1 << LogPriority::LOG_WARNING));
 		bool showWarning = lastShowWarning;
-		ImGui::Checkbox ("Warning", &showWarning);
+		ImGui::Checkbox (("Warning (" + std::to_string (logStore.GetCount (LOG_WARNING)) + ")###Warning").c_str (), &showWarning);
 
 		bool lastShowError = (_showLogsMask & (1 << LogPriority::LOG_ERROR));
 		bool showError = lastShowError;
-		ImGui::Checkbox ("Error", &showError);
+		ImGui::Checkbox (("Error (" + std::to_string (logStore.GetCount (LOG_ERROR)) + ")###Error").c_str (), &showError);
 
 		if (showDebug != lastShowDebug) {
 			_showLogsMask ^= (1 << LogPriority::LOG_DEBUG);
@@ -112,7 +121,9 @@ void EditorConsole::ShowConsoleSettings ()
 	ImGui::SameLine();
 	bool clear = ImGui::Button("Clear");
 	ImGui::SameLine();
-	_filter.Draw("Filter", -100.0f);
+	if (_filter.Draw("Filter", -100.0f)) {
+		_isFilterDirty = true;
+	}
 
 	if (clear == true) {
 		_editorConsoleSink->ClearLog ();
@@ -122,71 +133,98 @@ void EditorConsole::ShowConsoleSettings ()
 
 void EditorConsole::ShowConsoleLogs ()
 {
-	auto& consoleLogs = _editorConsoleSink->GetLog ();
+	UpdateFilter ();
 
-	for (std::size_t index = 0; index < consoleLogs.size (); index ++) {
+	auto& logStore = _editorConsoleSink->GetLogStore ();
 
-		if ((_showLogsMask & (1 << consoleLogs [index].Priority)) == 0) {
-			continue;
-		}
+	bool isScrolledToBottom = ImGui::GetScrollY () >= ImGui::GetScrollMaxY ();
 
-		if (!_filter.PassFilter (consoleLogs [index].Message.c_str ())) {
-			continue;
-		}
+	/*
+	 * Only the rows inside the scroll region are submitted
+	*/
 
-		if (consoleLogs [index].Priority == LogPriority::LOG_ERROR) {
-			ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (1, 0, 0, 1));
-		}
+	ImGuiListClipper clipper;
+	clipper.Begin ((int) logStore.GetMatchesCount ());
 
-		if (consoleLogs [index].Priority == LogPriority::LOG_WARNING) {
-			ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (1, 1, 0, 1));
-		}
+	while (clipper.Step ()) {
+		for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row ++) {
+			std::size_t index = logStore.GetMatch (row);
+			const ConsoleLog& consoleLog = logStore.GetLog (index);
 
-		if (consoleLogs [index].Priority == LogPriority::LOG_DEBUG) {
-			ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (0.5, 0, 0.5, 1));
-		}
+			if (consoleLog.Priority == LogPriority::LOG_ERROR) {
+				ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (1, 0, 0, 1));
+			}
 
-		bool selected = _selectedIndex == index;
+			if (consoleLog.Priority == LogPriority::LOG_WARNING) {
+				ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (1, 1, 0, 1));
+			}
 
-		ImGui::PushID (index);
-		ImGui::Selectable (consoleLogs [index].Message.c_str (), &selected);
-		ImGui::PopID ();
+			if (consoleLog.Priority == LogPriority::LOG_DEBUG) {
+				ImGui::PushStyleColor (ImGuiCol_Text, ImVec4 (0.5, 0, 0.5, 1));
+			}
 
-		if (selected == true) {
-			_selectedIndex = index;
-		}
+			bool selected = _selectedIndex == index;
 
-		if (consoleLogs [index].Priority == LogPriority::LOG_ERROR ||
-			consoleLogs [index].Priority == LogPriority::LOG_WARNING ||
-			consoleLogs [index].Priority == LogPriority::LOG_DEBUG) {
-			ImGui::PopStyleColor ();
-		}
+			ImGui::PushID ((int) index);
+			ImGui::Selectable (consoleLog.Message.c_str (), &selected);
+			ImGui::PopID ();
+
+			if (selected == true) {
+				_selectedIndex = index;
+			}
 
-		if (ImGui::GetScrollY () >= ImGui::GetScrollMaxY ()) {
-			ImGui::SetScrollHereY (1.0f);
+			if (consoleLog.Priority == LogPriority::LOG_ERROR ||
+				consoleLog.Priority == LogPriority::LOG_WARNING ||
+				consoleLog.Priority == LogPriority::LOG_DEBUG) {
+				ImGui::PopStyleColor ();
+			}
 		}
 	}
+
+	clipper.End ();
+
+	if (isScrolledToBottom == true) {
+		ImGui::SetScrollHereY (1.0f);
+	}
 }
 
 void EditorConsole::ShowConsoleLog ()
 {
-	auto& consoleLogs = _editorConsoleSink->GetLog ();
+	auto& logStore = _editorConsoleSink->GetLogStore ();
 
-	if (consoleLogs.size () == 0) {
+	if (!logStore.Contains (_selectedIndex)) {
 		return;
 	}
 
-	std::string message = consoleLogs [_selectedIndex].Message;
+	std::string message = logStore.GetLog (_selectedIndex).Message;
 	Extensions::StringExtend::Trim (message);
 
-	char text [1000];
-
-	std::memcpy (text, message.c_str (), message.size ());
-	text [message.size ()] = '\0';
+	std::vector<char> text (message.begin (), message.end ());
+	text.push_back ('\0');
 
 	std::size_t width = ImGui::GetWindowWidth ();
 
 	ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4 (0, 0, 0, 0));
-	ImGui::InputTextMultiline ("", text, message.size (), ImVec2(width, 100), ImGuiInputTextFlags_ReadOnly);
+	ImGui::InputTextMultiline ("", text.data (), text.size (), ImVec2(width, 100), ImGuiInputTextFlags_ReadOnly);
 	ImGui::PopStyleColor ();
 }
+
+void EditorConsole::UpdateFilter ()
+{
+	if (_isFilterDirty == false && _filteredLogsMask == _showLogsMask) {
+		return;
+	}
+
+	EditorConsoleLogStore::Filter filter = nullptr;
+
+	if (_filter.IsActive ()) {
+		filter = [this] (const ConsoleLog& consoleLog) {
+			return _filter.PassFilter (consoleLog.Message.c_str ());
+		};
+	}
+
+	_editorConsoleSink->GetLogStore ().SetFilter (_showLogsMask, filter);
+
+	_filteredLogsMask = _showLogsMask;
+	_isFilterDirty = false;
+}
\ No newline at end of file
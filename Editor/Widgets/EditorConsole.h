@@ -15,6 +15,8 @@ protected:
 	ImGuiTextFilter _filter;
 
 	int _showLogsMask;
+	int _filteredLogsMask;
+	bool _isFilterDirty;
 	std::size_t _selectedIndex;
 
 public:
@@ -27,6 +29,8 @@ protected:
 	void ShowConsoleSettings ();
 	void ShowConsoleLogs ();
 	void ShowConsoleLog ();
+
+	void UpdateFilter ();
 };
 
 REGISTER_EDITOR_WIDGET(EditorConsole)
@@ -0,0 +1,152 @@
+#include "EditorConsoleLogStore.h"
+
+#include <algorithm>
+
+EditorConsoleLogStore::EditorConsoleLogStore (std::size_t capacity) :
+	_capacity (std::max (capacity, (std::size_t) 1)),
+	_begin (0),
+	_end (0),
+	_mask (~0),
+	_filter (nullptr)
+{
+
+}
+
+void EditorConsoleLogStore::Add (ConsoleLog log)
+{
+	log.Priority = (LogPriority) std::min (std::max ((int) log.Priority, (int) LOG_DEBUG), (int) LOG_ERROR);
+
+	if (_end - _begin == _capacity) {
+		Evict ();
+	}
+
+	std::size_t id = _end ++;
+
+	_priorityIndices [log.Priority].push_back (id);
+
+	if (IsMatch (log)) {
+		_matches.push_back (id);
+	}
+
+	std::size_t slot = id % _capacity;
+
+	if (_logs.size () <= slot) {
+		_logs.resize (slot + 1);
+	}
+
+	_logs [slot] = std::move (log);
+}
+
+void EditorConsoleLogStore::Clear ()
+{
+	/*
+	 * Ids keep increasing, so a stale selection never points to a new log
+	*/
+
+	_logs.clear ();
+	_begin = _end;
+
+	for (auto& priorityIndices : _priorityIndices) {
+		priorityIndices.clear ();
+	}
+
+	_matches.clear ();
+}
+
+void EditorConsoleLogStore::SetFilter (int mask, const Filter& filter)
+{
+	_mask = mask;
+	_filter = filter;
+
+	_matches.clear ();
+
+	/*
+	 * Merge the indices of the shown priorities back in id order
+	*/
+
+	std::vector<std::pair<std::deque<std::size_t>::const_iterator,
+		std::deque<std::size_t>::const_iterator>> ranges;
+
+	for (int priority = LOG_DEBUG; priority <= LOG_ERROR; priority ++) {
+		if ((_mask & (1 << priority)) != 0 && _priorityIndices [priority].size () > 0) {
+			ranges.push_back (std::make_pair (_priorityIndices [priority].begin (), _priorityIndices [priority].end ()));
+		}
+	}
+
+	while (ranges.size () > 0) {
+		std::size_t next = 0;
+		for (std::size_t i=1;i<ranges.size ();i++) {
+			if (*ranges [i].first < *ranges [next].first) {
+				next = i;
+			}
+		}
+
+		std::size_t id = *ranges [next].first;
+
+		if (!_filter || _filter (GetLog (id))) {
+			_matches.push_back (id);
+		}
+
+		if (++ ranges [next].first == ranges [next].second) {
+			ranges.erase (ranges.begin () + next);
+		}
+	}
+}
+
+std::size_t EditorConsoleLogStore::GetMatchesCount () const
+{
+	return _matches.size ();
+}
+
+std::size_t EditorConsoleLogStore::GetMatch (std::size_t index) const
+{
+	return _matches [index];
+}
+
+bool EditorConsoleLogStore::Contains (std::size_t id) const
+{
+	return _begin <= id && id < _end;
+}
+
+const ConsoleLog& EditorConsoleLogStore::GetLog (std::size_t id) const
+{
+	return _logs [id % _capacity];
+}
+
+std::size_t EditorConsoleLogStore::GetCount () const
+{
+	return _end - _begin;
+}
+
+std::size_t EditorConsoleLogStore::GetCount (LogPriority priority) const
+{
+	if (priority < LOG_DEBUG || priority > LOG_ERROR) {
+		return 0;
+	}
+
+	return _priorityIndices [priority].size ();
+}
+
+bool EditorConsoleLogStore::IsMatch (const ConsoleLog& log) const
+{
+	if ((_mask & (1 << log.Priority)) == 0) {
+		return false;
+	}
+
+	return !_filter || _filter (log);
+}
+
+void EditorConsoleLogStore::Evict ()
+{
+	std::size_t id = _begin ++;
+
+	auto& priorityIndices = _priorityIndices [GetLog (id).Priority];
+
+	if (priorityIndices.size () > 0 && priorityIndices.front () == id) {
+		priorityIndices.pop_front ();
+	}
+
+	if (_matches.size () > 0 && _matches.front () == id) {
+		_matches.pop_front ();
+	}
+}
\ No newline at end of file
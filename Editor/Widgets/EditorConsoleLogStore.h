@@ -0,0 +1,56 @@
+#ifndef EDITORCONSOLELOGSTORE_H
+#define EDITORCONSOLELOGSTORE_H
+
+#include "Core/Console/ConsoleSink.h"
+
+#include <vector>
+#include <deque>
+#include <functional>
+
+#define EDITOR_CONSOLE_PRIORITIES_COUNT (LOG_ERROR + 1)
+
+/*
+ * Keeps the latest logs in a ring. Every log gets an increasing id, the
+ * ids are indexed by priority and by the current filter, so the console
+ * only walks the logs again when the filter itself changes.
+*/
+
+class EditorConsoleLogStore
+{
+public:
+	typedef std::function<bool (const ConsoleLog&)> Filter;
+
+protected:
+	std::vector<ConsoleLog> _logs;
+	std::size_t _capacity;
+	std::size_t _begin;
+	std::size_t _end;
+
+	std::deque<std::size_t> _priorityIndices [EDITOR_CONSOLE_PRIORITIES_COUNT];
+	std::deque<std::size_t> _matches;
+
+	int _mask;
+	Filter _filter;
+
+public:
+	EditorConsoleLogStore (std::size_t capacity);
+
+	void Add (ConsoleLog log);
+	void Clear ();
+
+	void SetFilter (int mask, const Filter& filter);
+
+	std::size_t GetMatchesCount () const;
+	std::size_t GetMatch (std::size_t index) const;
+
+	bool Contains (std::size_t id) const;
+	const ConsoleLog& GetLog (std::size_t id) const;
+
+	std::size_t GetCount () const;
+	std::size_t GetCount (LogPriority priority) const;
+protected:
+	bool IsMatch (const ConsoleLog& log) const;
+	void Evict ();
+};
+
+#endif
\ No newline at end of file
@@ -1,21 +1,58 @@
 #include "EditorConsoleSink.h"
 
-const std::vector<ConsoleLog>& EditorConsoleSink::GetLog () const
+#include <algorithm>
+
+EditorConsoleSink::EditorConsoleSink (std::size_t capacity) :
+	_logStore (capacity),
+	_capacity (std::max (capacity, (std::size_t) 1))
+{
+
+}
+
+void EditorConsoleSink::Update ()
+{
+	std::deque<ConsoleLog> pendingLogs;
+
+	{
+		std::lock_guard<std::mutex> lock (_pendingMutex);
+
+		std::swap (pendingLogs, _pendingLogs);
+	}
+
+	for (auto& log : pendingLogs) {
+		_logStore.Add (std::move (log));
+	}
+}
+
+EditorConsoleLogStore& EditorConsoleSink::GetLogStore ()
 {
-	return _logs;
+	return _logStore;
 }
 
 void EditorConsoleSink::ClearLog ()
 {
-	_logs.clear ();
+	std::lock_guard<std::mutex> lock (_pendingMutex);
+
+	_pendingLogs.clear ();
+	_logStore.Clear ();
 }
 
 void EditorConsoleSink::Sink (const ConsoleLog& message)
 {
-	_logs.push_back (message);
+	std::lock_guard<std::mutex> lock (_pendingMutex);
+
+	/*
+	 * The store would drop them anyway if the console is not shown for a while
+	*/
+
+	if (_pendingLogs.size () >= _capacity) {
+		_pendingLogs.pop_front ();
+	}
+
+	_pendingLogs.push_back (message);
 }
 
 void EditorConsoleSink::Flush ()
 {
 
-}
+}
\ No newline at end of file
@@ -3,15 +3,30 @@
 
 #include "Core/Console/ConsoleSink.h"
 
-#include <vector>
+#include <deque>
+#include <mutex>
+
+#include "EditorConsoleLogStore.h"
+
+/*
+ * Logs may arrive from the console writer thread, they are kept aside
+ * until the editor moves them into the store on the main thread
+*/
 
 class EditorConsoleSink : public ConsoleSink
 {
 protected:
-	std::vector<ConsoleLog> _logs;
+	EditorConsoleLogStore _logStore;
+	std::deque<ConsoleLog> _pendingLogs;
+	std::size_t _capacity;
+	std::mutex _pendingMutex;
 
 public:
-	const std::vector<ConsoleLog>& GetLog () const;
+	EditorConsoleSink (std::size_t capacity);
+
+	void Update ();
+
+	EditorConsoleLogStore& GetLogStore ();
 	void ClearLog ();
 
 	void Sink (const ConsoleLog& message);
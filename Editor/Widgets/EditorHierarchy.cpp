@@ -8,6 +8,14 @@
 
 #include "Managers/SceneManager.h"
 
+EditorHierarchy::EditorHierarchy () :
+	_scene (nullptr),
+	_hierarchyVersion (0),
+	_isDirty (true)
+{
+
+}
+
 void EditorHierarchy::Show ()
 {
 	bool isHierarchyVisible = SettingsManager::Instance ()->GetValue<bool> ("Menu", "show_hierarchy", false);
@@ -23,8 +31,20 @@ void EditorHierarchy::ShowHierarchy ()
 
 		Scene* scene = SceneManager::Instance ()->Current ();
 
+		UpdateHierarchy (scene);
+
 		bool isItemClicked = false;
-		ShowHierarchy (scene->GetRoot (), scene, &isItemClicked);
+
+		ImGuiListClipper clipper;
+		clipper.Begin ((int) _rows.size ());
+
+		while (clipper.Step ()) {
+			for (int index = clipper.DisplayStart; index < clipper.DisplayEnd; index ++) {
+				ShowHierarchy (_rows [index], scene, &isItemClicked);
+			}
+		}
+
+		clipper.End ();
 
 		if (isItemClicked == false) {
 			if (ImGui::IsMouseClicked (ImGuiMouseButton_Left) && ImGui::IsWindowHovered ()) {
@@ -36,17 +56,18 @@ void EditorHierarchy::ShowHierarchy ()
 	ImGui::End();
 }
 
-void EditorHierarchy::ShowHierarchy (SceneObject* sceneObject, Scene* scene, bool* isItemClicked)
+void EditorHierarchy::ShowHierarchy (const HierarchyRow& row, Scene* scene, bool* isItemClicked)
 {
+	SceneObject* sceneObject = row.sceneObject;
 	SceneObject* focusedObject = EditorSelection::Instance ()->GetActive ();
 
-	ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_DefaultOpen | ImGuiTreeNodeFlags_OpenOnArrow;
+	ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_NoTreePushOnOpen;
 
 	if (focusedObject == sceneObject) {
 		node_flags |= ImGuiTreeNodeFlags_Selected;
 	}
 
-	if (sceneObject->GetTransform ()->GetChildrenCount () == 0) {
+	if (row.isLeaf == true) {
 		node_flags |= ImGuiTreeNodeFlags_Leaf;
 	}
 
@@ -63,7 +84,18 @@ void EditorHierarchy::ShowHierarchy (SceneObject* sceneObject, Scene* scene, boo
 
 	ImGui::PushStyleColor (ImGuiCol_Text, col);
 
+	/*
+	 * Rows are not pushed as tree nodes, their depth is drawn as indentation
+	*/
+
+	float indent = row.depth * ImGui::GetStyle ().IndentSpacing;
+
+	if (indent > 0.0f) {
+		ImGui::Indent (indent);
+	}
+
 	ImGui::PushID (sceneObject);
+	ImGui::SetNextItemOpen (row.isExpanded, ImGuiCond_Always);
 	bool open = ImGui::TreeNodeEx (sceneObject->GetName ().c_str (), node_flags);
 
     if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_None))
@@ -89,6 +121,8 @@ void EditorHierarchy::ShowHierarchy (SceneObject* sceneObject, Scene* scene, boo
 
             if (parent->GetTransform ()->GetParent () == nullptr) {
 	            source->GetTransform ()->SetParent (sceneObject->GetTransform ());
+
+	            SetExpanded (sceneObject, true);
             }
         }
         ImGui::EndDragDropTarget();
@@ -102,16 +136,12 @@ void EditorHierarchy::ShowHierarchy (SceneObject* sceneObject, Scene* scene, boo
 
         	SceneObject* newSceneObject = new SceneObject ();
 
-        	std::size_t instanceID = 0;
-
-        	for (auto sceneObject : *scene) {
-        		instanceID = std::max (instanceID, sceneObject->GetInstanceID ());
-        	}
-
         	newSceneObject->SetName ("SceneObject");
-        	newSceneObject->SetInstanceID (instanceID + 1);
+        	newSceneObject->SetInstanceID (scene->AllocateInstanceID ());
         	scene->AttachObject (newSceneObject);
         	newSceneObject->GetTransform ()->SetParent (sceneObject->GetTransform ());
+
+        	SetExpanded (sceneObject, true);
         }
         if (ImGui::MenuItem("Detach Scene Object")) {
         	scene->DetachObject (sceneObject);
@@ -134,13 +164,81 @@ void EditorHierarchy::ShowHierarchy (SceneObject* sceneObject, Scene* scene, boo
 		}
 	}
 
-	if (open) {
+	if (row.isLeaf == false && open != row.isExpanded) {
+		SetExpanded (sceneObject, open);
+	}
+
+	if (indent > 0.0f) {
+		ImGui::Unindent (indent);
+	}
+
+	ImGui::PopStyleColor ();
+}
+
+void EditorHierarchy::UpdateHierarchy (Scene* scene)
+{
+	if (scene != _scene) {
+		_collapsedObjects.clear ();
+		_scene = scene;
+		_isDirty = true;
+	}
+
+	if (_isDirty == false && _hierarchyVersion == Transform::GetHierarchyVersion ()) {
+		return;
+	}
+
+	_rows.clear ();
+
+	/*
+	 * Depth first, children are pushed reversed to keep their order
+	*/
+
+	std::vector<std::pair<SceneObject*, std::size_t>> stack;
+	stack.push_back (std::make_pair (scene->GetRoot (), 0));
+
+	std::vector<SceneObject*> children;
+
+	while (stack.size () > 0) {
+		SceneObject* sceneObject = stack.back ().first;
+		std::size_t depth = stack.back ().second;
+
+		stack.pop_back ();
+
+		HierarchyRow row;
+
+		row.sceneObject = sceneObject;
+		row.depth = depth;
+		row.isLeaf = sceneObject->GetTransform ()->GetChildrenCount () == 0;
+		row.isExpanded = _collapsedObjects.find (sceneObject) == _collapsedObjects.end ();
+
+		_rows.push_back (row);
+
+		if (row.isLeaf == true || row.isExpanded == false) {
+			continue;
+		}
+
+		children.clear ();
+
 		for_each_type (Transform*, child, *sceneObject->GetTransform ()) {
-			ShowHierarchy (child->GetSceneObject (), scene, isItemClicked);
+			children.push_back (child->GetSceneObject ());
+		}
+
+		for (auto it = children.rbegin (); it != children.rend (); it ++) {
+			stack.push_back (std::make_pair (*it, depth + 1));
 		}
+	}
+
+	_hierarchyVersion = Transform::GetHierarchyVersion ();
+	_isDirty = false;
+}
 
-		ImGui::TreePop ();
+void EditorHierarchy::SetExpanded (SceneObject* sceneObject, bool isExpanded)
+{
+	if (isExpanded == true) {
+		_collapsedObjects.erase (sceneObject);
+	} else {
+		_collapsedObjects.insert (sceneObject);
 	}
 
-	ImGui::PopStyleColor ();
+	_isDirty = true;
 }
@@ -4,19 +4,49 @@
 #include "EditorWidget.h"
 #include "EditorManager.h"
 
+#include <vector>
+#include <unordered_set>
+
 #include "SceneGraph/Scene.h"
 #include "SceneGraph/SceneObject.h"
 
+/*
+ * The visible part of the scene tree is kept as a flat list of rows. It is
+ * only rebuilt when the hierarchy or the expanded nodes change, and only
+ * the rows inside the window are drawn.
+*/
+
 class EditorHierarchy : public EditorWidget
 {
+protected:
+	struct HierarchyRow
+	{
+		SceneObject* sceneObject;
+		std::size_t depth;
+		bool isLeaf;
+		bool isExpanded;
+	};
+
+	std::vector<HierarchyRow> _rows;
+	std::unordered_set<SceneObject*> _collapsedObjects;
+
+	Scene* _scene;
+	std::size_t _hierarchyVersion;
+	bool _isDirty;
+
 public:
+	EditorHierarchy ();
+
 	void Show ();
 protected:
 	void ShowHierarchy ();
 
-	void ShowHierarchy (SceneObject* sceneObject, Scene* scene, bool* isItemClicked);
+	void ShowHierarchy (const HierarchyRow& row, Scene* scene, bool* isItemClicked);
 
 	void ShowHierarchySettings (Scene* scene);
+
+	void UpdateHierarchy (Scene* scene);
+	void SetExpanded (SceneObject* sceneObject, bool isExpanded);
 };
 
 REGISTER_EDITOR_WIDGET(EditorHierarchy)
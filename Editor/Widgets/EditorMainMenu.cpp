@@ -12,8 +12,17 @@
 #include "Systems/Input/Input.h"
 #include "Systems/Settings/SettingsManager.h"
 
+#include "Resources/Resources.h"
 #include "Resources/SceneSaver.h"
 
+#include "Components/RenderObjectComponent.h"
+#include "Components/Lighting/DirectionalLightComponent.h"
+#include "SceneNodes/SceneLayer.h"
+
+#include "Utils/LightMapping/LightMapBaker.h"
+
+#include "Core/Console/Console.h"
+
 #include "Utils/Files/FileSystem.h"
 
 namespace fs = std::filesystem;
@@ -128,6 +137,7 @@ void EditorMainMenu::ShowMainMenuFile ()
 	bool openScene = false;
 	bool saveScene = false;
 	bool saveScene2 = false;
+	bool bakeLightMaps = false;
 
 	if (ImGui::BeginMenu("File"))
 	{
@@ -140,6 +150,8 @@ void EditorMainMenu::ShowMainMenuFile ()
 
 		ImGui::Separator();
 
+		bakeLightMaps = ImGui::MenuItem("Bake Light Maps");
+
 		ImGui::EndMenu();
 	}
 
@@ -149,6 +161,11 @@ void EditorMainMenu::ShowMainMenuFile ()
 		SceneManager::Instance ()->CreateScene ();
 	}
 
+	// Bake light maps
+	if (bakeLightMaps == true) {
+		BakeLightMaps ();
+	}
+
 	// Load scene
 	static ImGuiFs::Dialog dialog;
 
@@ -190,3 +207,96 @@ void EditorMainMenu::ShowMainMenuFile ()
 		SettingsManager::Instance ()->SetValue<std::string> ("Scene", "scene_path", scenePath);
 	}
 }
+
+void EditorMainMenu::BakeLightMaps ()
+{
+	Scene* scene = SceneManager::Instance ()->Current ();
+
+	LightMapBakeSettings settings;
+
+	settings.texelsPerUnit = SettingsManager::Instance ()->GetValue<float> ("LightMapping", "texels_per_unit", settings.texelsPerUnit);
+	settings.maxResolution = SettingsManager::Instance ()->GetValue<int> ("LightMapping", "max_resolution", (int) settings.maxResolution);
+	settings.padding = SettingsManager::Instance ()->GetValue<int> ("LightMapping", "padding", (int) settings.padding);
+	settings.samplesCount = SettingsManager::Instance ()->GetValue<int> ("LightMapping", "samples", (int) settings.samplesCount);
+	settings.bouncesCount = SettingsManager::Instance ()->GetValue<int> ("LightMapping", "bounces", (int) settings.bouncesCount);
+	settings.threadsCount = SettingsManager::Instance ()->GetValue<int> ("LightMapping", "threads", (int) settings.threadsCount);
+
+	std::string outputPath = SettingsManager::Instance ()->GetValue<std::string> ("LightMapping", "output_path", "Assets/LightMaps/");
+
+	/*
+	 * Only the static geometry and the directional lights are baked
+	*/
+
+	std::vector<LightMapBakeObject> objects;
+	std::vector<RenderObjectComponent*> components;
+	std::vector<LightMapBakeLight> lights;
+
+	for (SceneObject* sceneObject : *scene) {
+		if (sceneObject->IsActive () == false) {
+			continue;
+		}
+
+		auto renderObjectComponent = sceneObject->GetComponent<RenderObjectComponent> ();
+
+		if (renderObjectComponent != nullptr && renderObjectComponent->GetModel () != nullptr &&
+			!(renderObjectComponent->GetLayer () & (SceneLayer::ANIMATION | SceneLayer::DYNAMIC))) {
+
+			LightMapBakeObject object;
+
+			object.model = renderObjectComponent->GetModel ();
+			object.modelMatrix = sceneObject->GetTransform ()->GetModelMatrix ();
+			object.name = outputPath + scene->GetName () + "_" + std::to_string (objects.size ());
+
+			objects.push_back (object);
+			components.push_back (renderObjectComponent);
+		}
+
+		auto lightComponent = sceneObject->GetComponent<DirectionalLightComponent> ();
+
+		if (lightComponent != nullptr) {
+			LightMapBakeLight light;
+
+			light.direction = glm::normalize (sceneObject->GetTransform ()->GetRotation () * glm::vec3 (0, 0, -1));
+			light.radiance = lightComponent->GetColor ().ToVector3 () * lightComponent->GetIntensity ();
+
+			lights.push_back (light);
+		}
+	}
+
+	if (objects.empty ()) {
+		Console::LogWarning ("There are no static objects to bake light maps for");
+		return;
+	}
+
+	std::vector<LightMapBakeResult> results = LightMapBaker::Bake (objects, lights, settings);
+
+	/*
+	 * Save the baked assets and switch the objects to their light mapped
+	 * models, so the scene saves with them
+	*/
+
+	for (const LightMapBakeResult& result : results) {
+		std::string lightMapPath = objects [result.object].name + ".png";
+		std::string modelPath = objects [result.object].name + ".lmdl";
+
+		std::error_code error;
+		fs::create_directories (fs::path (lightMapPath).parent_path (), error);
+
+		Resource<Texture> lightMap (result.lightMap, lightMapPath);
+		Resources::SaveTexture (lightMap, lightMapPath);
+
+		result.model->SetName (modelPath);
+		result.model->SetLightMap (lightMap);
+
+		Resource<Model> model (result.model, modelPath);
+
+		if (!Resources::SaveLightMapModel (model, modelPath)) {
+			continue;
+		}
+
+		RenderObjectComponent* renderObjectComponent = components [result.object];
+
+		renderObjectComponent->SetModel (model);
+		renderObjectComponent->SetLayer ((renderObjectComponent->GetLayer () & ~SceneLayer::NORMAL_MAP) | SceneLayer::LIGHT_MAP);
+	}
+}
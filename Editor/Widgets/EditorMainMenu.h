@@ -18,6 +18,8 @@ protected:
 
 	void ShowMainMenuFile ();
 	void ShowMainMenuWindow ();
+
+	void BakeLightMaps ();
 };
 
 REGISTER_EDITOR_WIDGET(EditorMainMenu)
@@ -14,8 +14,12 @@
 
 #include "Renderer/RenderSystem.h"
 #include "Renderer/RenderManager.h"
+#include "Renderer/Readback/ReadbackManager.h"
 
 #include "RenderPasses/FramebufferRenderVolume.h"
+#include "RenderPasses/Voxelization/VoxelVolume.h"
+#include "RenderPasses/ReflectiveShadowMapping/RSMInterleavedSampling.h"
+#include "RenderPasses/LightPropagationVolumes/LPVCascades.h"
 
 #include "Utils/Files/FileSystem.h"
 
@@ -35,6 +39,7 @@
 #include "RenderPasses/TemporalAntialiasing/TAAStatisticsObject.h"
 #include "RenderPasses/VolumetricLighting/VolLightingStatisticsObject.h"
 #include "RenderPasses/LightShafts/LightShaftsStatisticsObject.h"
+#include "Renderer/RenderGovernorStatisticsObject.h"
 
 namespace fs = std::filesystem;
 
@@ -126,6 +131,63 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 	ImGui::Checkbox ("Enable Indirect Diffuse", &_settings->indirect_diffuse_enabled);
 	ImGui::Checkbox ("Enable Glossy Reflections", &_settings->indirect_specular_enabled);
 	ImGui::Checkbox ("Enable Subsurface Scattering", &_settings->subsurface_scattering_enabled);
+	ImGui::Checkbox ("Enable Instancing", &_settings->instancing_enabled);
+
+	ImGui::PushID ("LevelOfDetail");
+
+	if (ImGui::TreeNode ("Level Of Detail")) {
+		ImGui::Checkbox ("Enabled", &_settings->lod_enabled);
+		ImGui::InputFloat ("Pixel Error", &_settings->lod_pixel_error, 0.1);
+		ImGui::InputFloat ("Shadow Bias", &_settings->lod_shadow_bias, 0.1);
+		ImGui::InputFloat ("Global Illumination Bias", &_settings->lod_gi_bias, 0.1);
+
+		ImGui::TreePop();
+	}
+
+	ImGui::PopID ();
+
+	ImGui::PushID ("Shadows");
+
+	if (ImGui::TreeNode ("Shadows")) {
+		std::size_t step = 1;
+
+		ImGui::Checkbox ("Cache Static Casters", &_settings->shadow_cache_enabled);
+		ImGui::InputScalar ("Spot Light Updates", ImGuiDataType_U32, &_settings->shadow_spot_light_updates, &step);
+
+		ImGui::TreePop();
+	}
+
+	ImGui::PopID ();
+
+	ImGui::PushID ("Governor");
+
+	if (ImGui::TreeNode ("Frame Governor")) {
+		std::size_t step = 1;
+
+		ImGui::Checkbox ("Enabled", &_settings->governor_enabled);
+		ImGui::InputFloat ("Target Frame Time (ms)", &_settings->governor_target_frame_time, 0.1f);
+		ImGui::SliderFloat ("Hysteresis", &_settings->governor_hysteresis, 0.0f, 0.5f);
+		ImGui::InputScalar ("Cooldown Frames", ImGuiDataType_U32, &_settings->governor_cooldown_frames, &step);
+		ImGui::SliderFloat ("Min Resolution Scale", &_settings->governor_min_resolution_scale, 0.25f, 1.0f);
+		ImGui::SliderFloat ("Max Resolution Scale", &_settings->governor_max_resolution_scale, 0.25f, 1.0f);
+		ImGui::SliderFloat ("Resolution Step", &_settings->governor_resolution_step, 0.01f, 0.25f);
+		ImGui::SliderFloat ("Min Quality", &_settings->governor_min_quality, 0.05f, 1.0f);
+		ImGui::SliderFloat ("Quality Step", &_settings->governor_quality_step, 0.05f, 0.5f);
+
+		_settings->governor_max_resolution_scale = std::max (_settings->governor_max_resolution_scale,
+			_settings->governor_min_resolution_scale);
+
+		auto governorStat = StatisticsManager::Instance ()->GetStatisticsObject <RenderGovernorStatisticsObject> ();
+
+		if (governorStat->IsEnabled == true) {
+			ImGui::Text ("Frame Time: %.2f ms Resolution Scale: %.2f Quality: %.2f", governorStat->FrameTime,
+				governorStat->ResolutionScale, governorStat->Quality);
+		}
+
+		ImGui::TreePop();
+	}
+
+	ImGui::PopID ();
 
 	ImGui::PushID ("DeferredDebug");
 
@@ -202,6 +264,25 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 			ImGui::InputFloat ("Min Interpolation Distance", &_settings->rsm_min_interpolation_distance, 0.1);
 			ImGui::InputFloat ("Min Interpolation Angle (deg)", &_settings->rsm_min_interpolation_angle, 0.1);
 
+			ImGui::Separator();
+
+			ImGui::Text ("Interleaved Sampling");
+
+			ImGui::Checkbox ("Interleave Samples", &_settings->rsm_interleaved_sampling);
+
+			if (_settings->rsm_interleaved_sampling) {
+				std::size_t step = 1;
+
+				ImGui::InputScalar ("Interleave Size", ImGuiDataType_U32, &_settings->rsm_interleave_size, &step);
+				_settings->rsm_interleave_size = Extensions::MathExtend::Clamp (
+					_settings->rsm_interleave_size, (std::size_t) 1, (std::size_t) MAX_RSM_INTERLEAVE_SIZE);
+
+				ImGui::InputFloat ("History Max Distance", &_settings->rsm_history_max_distance, 0.01f);
+				ImGui::InputFloat ("History Min Angle (deg)", &_settings->rsm_history_min_angle, 0.1f);
+
+				ImGui::Text ("Samples Subsets: %lu", rsmStat->rsmSamplesSubsetsCount);
+			}
+
 			ImGui::Separator ();
 
 			if (ImGui::TreeNode ("Debug")) {
@@ -210,6 +291,8 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 				ShowImage ("Diffuse Indirect Illumination Map", rsmStat->rsmIndirectDiffuseMapVolume);
 
+				ShowImage ("Temporally Accumulated Diffuse Indirect Illumination Map", rsmStat->rsmTemporalAccumulationMapVolume);
+
 				ImGui::TreePop();
 			}
 
@@ -316,8 +399,38 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		ImGui::Checkbox ("Use Geometry Occlusion", &_settings->lpv_geometry_occlusion);
 
+		ImGui::Checkbox ("Center Cascades On Camera", &_settings->lpv_cascades_enabled);
+
+		if (_settings->lpv_cascades_enabled) {
+			std::size_t step = 1;
+
+			ImGui::InputScalar ("Cascades", ImGuiDataType_U32, &_settings->lpv_cascades_count, &step);
+			_settings->lpv_cascades_count = Extensions::MathExtend::Clamp (
+				_settings->lpv_cascades_count, (std::size_t) 1, (std::size_t) MAX_LPV_CASCADES);
+
+			ImGui::InputFloat ("Cascade Cell Size", &_settings->lpv_cascade_cell_size, 0.01f);
+			_settings->lpv_cascade_cell_size = std::max (_settings->lpv_cascade_cell_size, 0.001f);
+		}
+
 		ImGui::Separator ();
 
+		ImGui::PushID ("LPVPropagation");
+
+		if (ImGui::TreeNode ("Propagation")) {
+			std::size_t step = 1;
+
+			ImGui::Checkbox ("Skip Unchanged Injection", &_settings->lpv_propagation_cache);
+			ImGui::InputScalar ("Iterations/Frame (0 = all)", ImGuiDataType_U32, &_settings->lpv_propagation_budget, &step);
+
+			ImGui::Text ("Iterations: %lu/%lu Dispatched: %lu Restarts: %lu",
+				lpvStat->propagationCompletedIterations, _settings->lpv_iterations,
+				lpvStat->propagationDispatchesCount, lpvStat->propagationRestartsCount);
+
+			ImGui::TreePop();
+		}
+
+		ImGui::PopID ();
+
 		if (ImGui::TreeNode ("Diffuse Indirect Illumination")) {
 
 			ImGui::InputFloat ("Intensity", &_settings->lpv_indirect_diffuse_intensity, 0.1);
@@ -391,9 +504,12 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 		std::size_t lastVoxelVolumeSize = _settings->vct_voxels_size;
 		bool lastVoxelBordering = _settings->vct_bordering;
 		std::size_t lastVolumeMipmapLevels = _settings->vct_mipmap_levels;
+		bool lastClipmapEnabled = _settings->vct_clipmap_enabled;
+		std::size_t lastClipmapLevels = _settings->vct_clipmap_levels;
 
 		ImGui::InputScalar ("Voxels Resolution (^3)", ImGuiDataType_U32, &_settings->vct_voxels_size);
 		ImGui::Checkbox ("Use Continuous Voxelization", &_settings->vct_continuous_voxelization);
+		ImGui::Checkbox ("Voxelize Changed Objects Only", &_settings->vct_incremental_voxelization);
 		// ImGui::Checkbox ("Voxel Volume Bordering", &_settings->vct_bordering);
 
 		std::size_t speed = 1;
@@ -402,6 +518,17 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 			_settings->vct_mipmap_levels, (std::size_t) 1,
 			(std::size_t) std::log2 (_settings->vct_voxels_size));
 
+		ImGui::Checkbox ("Center Clipmap On Camera", &_settings->vct_clipmap_enabled);
+
+		if (_settings->vct_clipmap_enabled) {
+			ImGui::InputScalar ("Clipmap Levels", ImGuiDataType_U32, &_settings->vct_clipmap_levels, &speed);
+			_settings->vct_clipmap_levels = Extensions::MathExtend::Clamp (
+				_settings->vct_clipmap_levels, (std::size_t) 1, (std::size_t) MAX_CLIPMAP_LEVELS);
+
+			ImGui::InputFloat ("Clipmap Voxel Size", &_settings->vct_clipmap_voxel_size, 0.01f);
+			_settings->vct_clipmap_voxel_size = std::max (_settings->vct_clipmap_voxel_size, 0.001f);
+		}
+
 		ImGui::Separator ();
 
 		if (ImGui::TreeNode ("Diffuse Indirect Illumination")) {
@@ -504,7 +631,9 @@ void EditorRenderingSettings::ShowRenderingSettingsWindow ()
 
 		if (lastVoxelVolumeSize != _settings->vct_voxels_size ||
 			lastVoxelBordering != _settings->vct_bordering ||
-			lastVolumeMipmapLevels != _settings->vct_mipmap_levels) {
+			lastVolumeMipmapLevels != _settings->vct_mipmap_levels ||
+			lastClipmapEnabled != _settings->vct_clipmap_enabled ||
+			lastClipmapLevels != _settings->vct_clipmap_levels) {
 			_lastContinuousVoxelization = _settings->vct_continuous_voxelization;
 			_continuousVoxelizationReset = true;
 
@@ -845,14 +974,9 @@ void EditorRenderingSettings::ShowImage (unsigned int textureID, const glm::ivec
 
 		volumePath = FileSystem::Relative (volumePath, fs::current_path ().string ());
 
-		Resource<TextureView> textureView (new TextureView (), "temp");
-		textureView->SetGPUIndex (textureID);
-
-		Resource<Texture> texture = RenderSystem::SaveTexture (textureView);
-
-		textureView->SetGPUIndex (0);
-
-		Resources::SaveTexture (texture, volumePath);
+		ReadbackManager::Instance ()->ReadTexture (textureID, [volumePath] (const Resource<Texture>& texture) {
+			Resources::SaveTexture (texture, volumePath);
+		});
 	}
 
 	ImGui::PopID ();
@@ -11,6 +11,12 @@
 
 #include "Debug/Statistics/StatisticsManager.h"
 #include "RenderPasses/RenderStatisticsObject.h"
+#include "RenderPasses/GUI/GizmoStatisticsObject.h"
+#include "Renderer/RenderTargets/RenderTargetStatisticsObject.h"
+#include "Renderer/Readback/ReadbackStatisticsObject.h"
+#include "Audio/AudioStatisticsObject.h"
+#include "Core/Resources/ResidencyStatisticsObject.h"
+#include "RenderPasses/ShadowMap/ShadowMapStatisticsObject.h"
 
 EditorStats::EditorStats () :
 	_timeElapsed (0.0f),
@@ -72,6 +78,7 @@ void EditorStats::ShowStatistics ()
 		std::size_t drawnVerticesCount = renderStatisticsObject->DrawnVerticesCount;
 		std::size_t drawnPolygonsCount = renderStatisticsObject->DrawnPolygonsCount;
 		std::size_t drawnObjectsCount = renderStatisticsObject->DrawnObjectsCount;
+		std::size_t drawCallsCount = renderStatisticsObject->DrawCallsCount;
 
 		std::string verticesCount = std::to_string (drawnVerticesCount % 1000);
 		while (drawnVerticesCount /= 1000) {
@@ -84,7 +91,58 @@ void EditorStats::ShowStatistics ()
 		}
 
 		ImGui::Text ("Vertices: %s Triangles: %s", verticesCount.c_str (), polygonsCount.c_str ());
-		ImGui::Text ("Objects: %lu", drawnObjectsCount);
+		ImGui::Text ("Objects: %lu Draw Calls: %lu", drawnObjectsCount, drawCallsCount);
+
+		auto gizmoStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <GizmoStatisticsObject> ();
+
+		ImGui::Text ("Gizmo Lines: %lu Culled: %lu Dropped: %lu", gizmoStatisticsObject->DrawnLinesCount,
+			gizmoStatisticsObject->CulledLinesCount, gizmoStatisticsObject->DroppedLinesCount);
+		ImGui::Text ("Gizmo Upload: %lu KB Allocations: %lu", gizmoStatisticsObject->UploadedBytesCount / 1024,
+			gizmoStatisticsObject->BufferAllocationsCount);
+
+		auto renderTargetStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RenderTargetStatisticsObject> ();
+
+		std::size_t allocatedMemory = renderTargetStatisticsObject->AllocatedMemory / (1024 * 1024);
+		std::size_t peakMemory = renderTargetStatisticsObject->PeakMemory / (1024 * 1024);
+		std::size_t savedMemory = renderTargetStatisticsObject->RequestedMemory > renderTargetStatisticsObject->AllocatedMemory ?
+			(renderTargetStatisticsObject->RequestedMemory - renderTargetStatisticsObject->AllocatedMemory) / (1024 * 1024) : 0;
+
+		ImGui::Text ("Render Targets: %lu (%lu MB, peak %lu MB, saved %lu MB)", renderTargetStatisticsObject->TargetsCount,
+			allocatedMemory, peakMemory, savedMemory);
+
+		auto readbackStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ReadbackStatisticsObject> ();
+
+		ImGui::Text ("Readbacks: %lu pending, %lu done, %lu dropped (%lu frames)", readbackStatisticsObject->PendingCount,
+			readbackStatisticsObject->CompletedCount, readbackStatisticsObject->DroppedCount, readbackStatisticsObject->LatencyFrames);
+
+		auto audioStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <AudioStatisticsObject> ();
+
+		ImGui::Text ("Audio Sources: %lu Playing: %lu Voices: %lu Virtual: %lu Streams: %lu", audioStatisticsObject->SourcesCount,
+			audioStatisticsObject->PlayingCount, audioStatisticsObject->RealVoicesCount, audioStatisticsObject->VirtualVoicesCount,
+			audioStatisticsObject->StreamsCount);
+
+		auto residencyStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ResidencyStatisticsObject> ();
+
+		const char* residencyGroupNames [RESIDENCY_GROUPS_COUNT] = { "Models", "Textures", "Shaders", "Audio" };
+
+		for (std::size_t group = 0; group < RESIDENCY_GROUPS_COUNT; group ++) {
+			ImGui::Text ("%s: %lu (CPU %lu MB, GPU %lu MB, cached %lu MB / %lu MB)", residencyGroupNames [group],
+				residencyStatisticsObject->ResidentCount [group], residencyStatisticsObject->CPUMemory [group] / (1024 * 1024),
+				residencyStatisticsObject->GPUMemory [group] / (1024 * 1024), residencyStatisticsObject->CachedMemory [group] / (1024 * 1024),
+				residencyStatisticsObject->BudgetMemory [group] / (1024 * 1024));
+		}
+
+		ImGui::Text ("Resource Cache: %lu MB / %lu MB Reused: %lu Evicted: %lu", residencyStatisticsObject->CacheMemory / (1024 * 1024),
+			residencyStatisticsObject->CacheBudgetMemory / (1024 * 1024), residencyStatisticsObject->ReusesCount,
+			residencyStatisticsObject->EvictionsCount);
+
+		auto shadowMapStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ShadowMapStatisticsObject> ();
+
+		ImGui::Text ("Shadow Cascades: %lu Rendered: %lu Static: %lu", shadowMapStatisticsObject->CascadesCount,
+			shadowMapStatisticsObject->CascadeCompositionsCount, shadowMapStatisticsObject->CascadeStaticUpdatesCount);
+		ImGui::Text ("Spot Shadows: %lu Rendered: %lu Static: %lu Postponed: %lu", shadowMapStatisticsObject->SpotLightMapsCount,
+			shadowMapStatisticsObject->SpotLightUpdatesCount, shadowMapStatisticsObject->SpotLightStaticUpdatesCount,
+			shadowMapStatisticsObject->SpotLightPostponedCount);
 
 		ImGui::Spacing ();
 
@@ -0,0 +1,155 @@
+#include "ALAudioBackend.h"
+
+#include "Wrappers/OpenAL/AL.h"
+
+unsigned int ALAudioBackend::CreateSource ()
+{
+	ALuint source;
+
+	AL::GenSources ((ALuint)1, &source);
+
+	AL::Sourcef (source, AL_PITCH, 1);
+	AL::Sourcef (source, AL_GAIN, 1);
+	AL::Source3f (source, AL_POSITION, 0, 0, 0);
+	AL::Source3f (source, AL_VELOCITY, 0, 0, 0);
+	AL::Sourcei (source, AL_LOOPING, AL_FALSE);
+
+	return source;
+}
+
+void ALAudioBackend::DeleteSource (unsigned int source)
+{
+	ALuint sourceID = source;
+
+	AL::DeleteSources (1, &sourceID);
+}
+
+unsigned int ALAudioBackend::CreateBuffer ()
+{
+	ALuint buffer;
+
+	AL::GenBuffers ((ALuint)1, &buffer);
+
+	return buffer;
+}
+
+void ALAudioBackend::DeleteBuffer (unsigned int buffer)
+{
+	ALuint bufferID = buffer;
+
+	AL::DeleteBuffers (1, &bufferID);
+}
+
+bool ALAudioBackend::BufferData (unsigned int buffer, const AudioFormat& format,
+	const unsigned char* data, std::size_t size)
+{
+	int alFormat = GetFormat (format);
+
+	if (alFormat == AL_NONE) {
+		return false;
+	}
+
+	AL::BufferData (buffer, alFormat, data, size, format.sampleRate);
+
+	return true;
+}
+
+void ALAudioBackend::SetSourceBuffer (unsigned int source, unsigned int buffer)
+{
+	AL::Sourcei (source, AL_BUFFER, buffer);
+}
+
+void ALAudioBackend::QueueBuffer (unsigned int source, unsigned int buffer)
+{
+	ALuint bufferID = buffer;
+
+	AL::SourceQueueBuffers (source, 1, &bufferID);
+}
+
+std::vector<unsigned int> ALAudioBackend::UnqueueProcessedBuffers (unsigned int source)
+{
+	ALint processedCount = 0;
+
+	AL::GetSourcei (source, AL_BUFFERS_PROCESSED, &processedCount);
+
+	std::vector<ALuint> bufferIDs (processedCount);
+
+	if (processedCount > 0) {
+		AL::SourceUnqueueBuffers (source, processedCount, bufferIDs.data ());
+	}
+
+	return std::vector<unsigned int> (bufferIDs.begin (), bufferIDs.end ());
+}
+
+void ALAudioBackend::SetSourceGain (unsigned int source, float gain)
+{
+	AL::Sourcef (source, AL_GAIN, gain);
+}
+
+void ALAudioBackend::SetSourceLooping (unsigned int source, bool loop)
+{
+	AL::Sourcei (source, AL_LOOPING, loop ? AL_TRUE : AL_FALSE);
+}
+
+void ALAudioBackend::SetSourcePosition (unsigned int source, const glm::vec3& position)
+{
+	AL::Source3f (source, AL_POSITION, position.x, position.y, position.z);
+}
+
+void ALAudioBackend::SetSourceOffset (unsigned int source, float seconds)
+{
+	AL::Sourcef (source, AL_SEC_OFFSET, seconds);
+}
+
+void ALAudioBackend::Play (unsigned int source)
+{
+	AL::SourcePlay (source);
+}
+
+void ALAudioBackend::Pause (unsigned int source)
+{
+	AL::SourcePause (source);
+}
+
+void ALAudioBackend::Stop (unsigned int source)
+{
+	AL::SourceStop (source);
+}
+
+bool ALAudioBackend::IsPlaying (unsigned int source)
+{
+	ALint state;
+
+	AL::GetSourcei (source, AL_SOURCE_STATE, &state);
+
+	return state == AL_PLAYING;
+}
+
+void ALAudioBackend::SetListener (const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up)
+{
+	ALfloat orientation [6] = { forward.x, forward.y, forward.z, up.x, up.y, up.z };
+
+	AL::Listener3f (AL_POSITION, position.x, position.y, position.z);
+	AL::Listenerfv (AL_ORIENTATION, orientation);
+}
+
+int ALAudioBackend::GetFormat (const AudioFormat& format)
+{
+	if (format.channels == 1 && format.bitsPerSample == 8) {
+		return AL_FORMAT_MONO8;
+	}
+
+	if (format.channels == 1 && format.bitsPerSample == 16) {
+		return AL_FORMAT_MONO16;
+	}
+
+	if (format.channels == 2 && format.bitsPerSample == 8) {
+		return AL_FORMAT_STEREO8;
+	}
+
+	if (format.channels == 2 && format.bitsPerSample == 16) {
+		return AL_FORMAT_STEREO16;
+	}
+
+	return AL_NONE;
+}
\ No newline at end of file
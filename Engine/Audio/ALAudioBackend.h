@@ -0,0 +1,36 @@
+#ifndef ALAUDIOBACKEND_H
+#define ALAUDIOBACKEND_H
+
+#include "AudioBackendI.h"
+
+class ENGINE_API ALAudioBackend : public AudioBackendI
+{
+public:
+	unsigned int CreateSource ();
+	void DeleteSource (unsigned int source);
+
+	unsigned int CreateBuffer ();
+	void DeleteBuffer (unsigned int buffer);
+	bool BufferData (unsigned int buffer, const AudioFormat& format,
+		const unsigned char* data, std::size_t size);
+
+	void SetSourceBuffer (unsigned int source, unsigned int buffer);
+	void QueueBuffer (unsigned int source, unsigned int buffer);
+	std::vector<unsigned int> UnqueueProcessedBuffers (unsigned int source);
+
+	void SetSourceGain (unsigned int source, float gain);
+	void SetSourceLooping (unsigned int source, bool loop);
+	void SetSourcePosition (unsigned int source, const glm::vec3& position);
+	void SetSourceOffset (unsigned int source, float seconds);
+
+	void Play (unsigned int source);
+	void Pause (unsigned int source);
+	void Stop (unsigned int source);
+	bool IsPlaying (unsigned int source);
+
+	void SetListener (const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up);
+protected:
+	static int GetFormat (const AudioFormat& format);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef AUDIOBACKENDI_H
+#define AUDIOBACKENDI_H
+
+#include <vector>
+#include <glm/vec3.hpp>
+
+#include "AudioFormat.h"
+
+/*
+ * The calls the audio sources, streams and voice pool need from the
+ * audio API, so that their logic runs without a device
+*/
+
+class ENGINE_API AudioBackendI
+{
+public:
+	virtual ~AudioBackendI () {}
+
+	virtual unsigned int CreateSource () = 0;
+	virtual void DeleteSource (unsigned int source) = 0;
+
+	virtual unsigned int CreateBuffer () = 0;
+	virtual void DeleteBuffer (unsigned int buffer) = 0;
+	virtual bool BufferData (unsigned int buffer, const AudioFormat& format,
+		const unsigned char* data, std::size_t size) = 0;
+
+	virtual void SetSourceBuffer (unsigned int source, unsigned int buffer) = 0;
+	virtual void QueueBuffer (unsigned int source, unsigned int buffer) = 0;
+	virtual std::vector<unsigned int> UnqueueProcessedBuffers (unsigned int source) = 0;
+
+	virtual void SetSourceGain (unsigned int source, float gain) = 0;
+	virtual void SetSourceLooping (unsigned int source, bool loop) = 0;
+	virtual void SetSourcePosition (unsigned int source, const glm::vec3& position) = 0;
+	virtual void SetSourceOffset (unsigned int source, float seconds) = 0;
+
+	virtual void Play (unsigned int source) = 0;
+	virtual void Pause (unsigned int source) = 0;
+	virtual void Stop (unsigned int source) = 0;
+	virtual bool IsPlaying (unsigned int source) = 0;
+
+	virtual void SetListener (const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up) = 0;
+};
+
+#endif
\ No newline at end of file
@@ -4,7 +4,9 @@ AudioClip::AudioClip () :
 	_name (),
 	_data (nullptr),
 	_size (0),
-	_sampleRate (0)
+	_sampleRate (0),
+	_format (),
+	_isStreamed (false)
 {
 
 }
@@ -26,6 +28,22 @@ void AudioClip::SetData (unsigned char* data, std::size_t size, std::size_t samp
 	_sampleRate = sampleRate;
 }
 
+void AudioClip::SetFormat (const AudioFormat& format)
+{
+	_format = format;
+	_sampleRate = format.sampleRate;
+}
+
+void AudioClip::SetStreamed (std::size_t size)
+{
+	/*
+	 * The samples stay on the disk, the clip only knows how many there are
+	*/
+
+	_isStreamed = true;
+	_size = size;
+}
+
 std::string AudioClip::GetName () const
 {
 	return _name;
@@ -45,3 +63,36 @@ std::size_t AudioClip::GetSampleRate () const
 {
 	return _sampleRate;
 }
+
+const AudioFormat& AudioClip::GetFormat () const
+{
+	return _format;
+}
+
+bool AudioClip::IsStreamed () const
+{
+	return _isStreamed;
+}
+
+float AudioClip::GetDuration () const
+{
+	if (_format.GetBytesPerSecond () == 0) {
+		return 0.0f;
+	}
+
+	return (float) _size / _format.GetBytesPerSecond ();
+}
+
+RESIDENCY_GROUP AudioClip::GetResidencyGroup () const
+{
+	return RESIDENCY_AUDIO;
+}
+
+ResidencyMemory AudioClip::GetResidencyMemory () const
+{
+	/*
+	 * Streamed clips keep no samples in memory
+	*/
+
+	return ResidencyMemory { _data != nullptr ? _size : 0, 0 };
+}
@@ -2,14 +2,19 @@
 #define AUDIOCLIP_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
-class ENGINE_API AudioClip : public Object
+#include "AudioFormat.h"
+
+class ENGINE_API AudioClip : public Object, public ResidentObjectI
 {
 protected:
 	std::string _name;
 	unsigned char* _data;
 	std::size_t _size;
 	std::size_t _sampleRate;
+	AudioFormat _format;
+	bool _isStreamed;
 
 public:
 	AudioClip ();
@@ -17,12 +22,19 @@ public:
 
 	void SetName (const std::string& name);
 	void SetData (unsigned char* data, std::size_t size, std::size_t sampleRate);
-	
+	void SetFormat (const AudioFormat& format);
+	void SetStreamed (std::size_t size);
+
 	std::string GetName () const;
 	unsigned char* GetData () const;
 	std::size_t GetSize () const;
 	std::size_t GetSampleRate () const;
+	const AudioFormat& GetFormat () const;
+	bool IsStreamed () const;
 	float GetDuration () const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 };
 
 #endif
\ No newline at end of file
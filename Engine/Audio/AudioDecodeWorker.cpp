@@ -0,0 +1,88 @@
+#include "AudioDecodeWorker.h"
+
+AudioDecodeWorker::AudioDecodeWorker () :
+	_isRunning (false)
+{
+
+}
+
+AudioDecodeWorker::~AudioDecodeWorker ()
+{
+	Stop ();
+}
+
+void AudioDecodeWorker::Start ()
+{
+	if (_isRunning == true) {
+		return;
+	}
+
+	_isRunning = true;
+
+	_thread = std::thread (&AudioDecodeWorker::ProcessJobs, this);
+}
+
+void AudioDecodeWorker::Stop ()
+{
+	{
+		std::lock_guard<std::mutex> lock (_jobsMutex);
+
+		if (_isRunning == false) {
+			return;
+		}
+
+		_isRunning = false;
+		_jobs.clear ();
+	}
+
+	_jobsCondition.notify_all ();
+
+	_thread.join ();
+}
+
+void AudioDecodeWorker::EnqueueJob (const std::function<void ()>& job)
+{
+	{
+		std::unique_lock<std::mutex> lock (_jobsMutex);
+
+		/*
+		 * Without the thread the job runs right away
+		*/
+
+		if (_isRunning == false) {
+			lock.unlock ();
+
+			job ();
+
+			return;
+		}
+
+		_jobs.push_back (job);
+	}
+
+	_jobsCondition.notify_one ();
+}
+
+void AudioDecodeWorker::ProcessJobs ()
+{
+	while (true) {
+		std::function<void ()> job;
+
+		{
+			std::unique_lock<std::mutex> lock (_jobsMutex);
+
+			_jobsCondition.wait (lock, [this] () {
+				return _isRunning == false || !_jobs.empty ();
+			});
+
+			if (_isRunning == false) {
+				return;
+			}
+
+			job = std::move (_jobs.front ());
+			_jobs.pop_front ();
+		}
+
+		job ();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef AUDIODECODEWORKER_H
+#define AUDIODECODEWORKER_H
+
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <deque>
+#include <mutex>
+
+/*
+ * A thread of its own for the refills of the audio streams. The loader
+ * threads may be busy with a scene for seconds, a stream waiting behind
+ * them would run out of queued buffers.
+*/
+
+class ENGINE_API AudioDecodeWorker
+{
+protected:
+	std::thread _thread;
+
+	std::deque<std::function<void ()>> _jobs;
+
+	std::mutex _jobsMutex;
+	std::condition_variable _jobsCondition;
+
+	bool _isRunning;
+
+public:
+	AudioDecodeWorker ();
+	~AudioDecodeWorker ();
+
+	void Start ();
+	void Stop ();
+
+	void EnqueueJob (const std::function<void ()>& job);
+protected:
+	void ProcessJobs ();
+};
+
+#endif
\ No newline at end of file
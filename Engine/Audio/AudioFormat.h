@@ -0,0 +1,29 @@
+#ifndef AUDIOFORMAT_H
+#define AUDIOFORMAT_H
+
+#include <cstddef>
+
+struct ENGINE_API AudioFormat
+{
+	std::size_t channels;
+	std::size_t bitsPerSample;
+	std::size_t sampleRate;
+
+	std::size_t GetFrameSize () const
+	{
+		return channels * (bitsPerSample / 8);
+	}
+
+	std::size_t GetBytesPerSecond () const
+	{
+		return GetFrameSize () * sampleRate;
+	}
+
+	bool IsSupported () const
+	{
+		return (channels == 1 || channels == 2) &&
+			(bitsPerSample == 8 || bitsPerSample == 16) && sampleRate > 0;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,266 @@
+#include "AudioManager.h"
+
+#include <algorithm>
+#include <glm/geometric.hpp>
+
+#include "AudioSystem.h"
+#include "Decoders/WAVFileDecoder.h"
+#include "Decoders/AudioClipDecoder.h"
+
+#include "Managers/CameraManager.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "AudioStatisticsObject.h"
+
+#include "Core/Console/Console.h"
+
+AudioManager::AudioManager () :
+	_voiceAllocator (0, AUDIO_MIN_AUDIBILITY, AUDIO_VOICE_HYSTERESIS),
+	_streamMinDuration (0.0f),
+	_streamChunkDuration (0.0f)
+{
+
+}
+
+AudioManager::~AudioManager ()
+{
+
+}
+
+SPECIALIZE_SINGLETON(AudioManager)
+
+void AudioManager::Init ()
+{
+	int maxVoices = SettingsManager::Instance ()->GetValue<int> ("Audio", "max_voices", 32);
+
+	_voiceAllocator.SetMaxVoices (std::max (maxVoices, 1));
+
+	_streamMinDuration = SettingsManager::Instance ()->GetValue<float> ("Audio", "stream_min_duration", 10.0f);
+	_streamChunkDuration = SettingsManager::Instance ()->GetValue<float> ("Audio", "stream_chunk_ms", 250.0f) / 1000.0f;
+
+	_decodeWorker.Start ();
+}
+
+void AudioManager::Attach (AudioSource* audioSource)
+{
+	_audioSources.push_back (audioSource);
+}
+
+void AudioManager::Detach (AudioSource* audioSource)
+{
+	auto it = std::find (_audioSources.begin (), _audioSources.end (), audioSource);
+
+	if (it == _audioSources.end ()) {
+		return;
+	}
+
+	if (audioSource->HasVoice () == true) {
+		ReleaseVoice (audioSource->DetachVoice ());
+	}
+
+	_audioSources.erase (it);
+}
+
+bool AudioManager::IsStreamed (const Resource<AudioClip>& audioClip) const
+{
+	/*
+	 * Long clips loaded in memory are streamed too, so they do not take
+	 * a second copy in the audio device
+	*/
+
+	return audioClip->IsStreamed () || audioClip->GetDuration () >= _streamMinDuration;
+}
+
+Resource<AudioClipView> AudioManager::GetAudioClipView (const Resource<AudioClip>& audioClip)
+{
+	auto it = _audioClipViews.find (audioClip->GetName ());
+
+	if (it != _audioClipViews.end ()) {
+		return it->second;
+	}
+
+	Resource<AudioClipView> audioClipView = AudioSystem::LoadAudioClip (audioClip);
+
+	_audioClipViews [audioClip->GetName ()] = audioClipView;
+
+	return audioClipView;
+}
+
+AudioStream* AudioManager::CreateAudioStream (const Resource<AudioClip>& audioClip)
+{
+	AudioDecoderI* decoder = nullptr;
+
+	if (audioClip->IsStreamed () == true) {
+		WAVFileDecoder* fileDecoder = new WAVFileDecoder ();
+
+		if (fileDecoder->Open (audioClip->GetName ()) == false) {
+			Console::LogError ("Unable to stream \"" + audioClip->GetName () + "\"!");
+
+			delete fileDecoder;
+
+			return nullptr;
+		}
+
+		decoder = fileDecoder;
+	}
+
+	if (audioClip->IsStreamed () == false) {
+		decoder = new AudioClipDecoder (audioClip);
+	}
+
+	std::size_t chunkSize = _streamChunkDuration * decoder->GetFormat ().GetBytesPerSecond ();
+
+	return new AudioStream (&_backend, decoder, chunkSize, [this] (const std::function<void ()>& job) {
+		_decodeWorker.EnqueueJob (job);
+	});
+}
+
+AudioBackendI* AudioManager::GetBackend ()
+{
+	return &_backend;
+}
+
+void AudioManager::Update ()
+{
+	glm::vec3 listenerPosition = UpdateListener ();
+
+	/*
+	 * Only the playing sources compete for a voice
+	*/
+
+	std::vector<VoiceRequest> requests;
+
+	for (std::size_t index = 0; index < _audioSources.size (); index ++) {
+		AudioSource* audioSource = _audioSources [index];
+
+		if (audioSource->IsPlaying () == false) {
+			if (audioSource->HasVoice () == true) {
+				ReleaseVoice (audioSource->DetachVoice ());
+			}
+
+			continue;
+		}
+
+		float distance = glm::distance (listenerPosition, audioSource->GetPosition ());
+
+		VoiceRequest request;
+
+		request.id = index;
+		request.priority = audioSource->GetPriority ();
+		request.audibility = VoiceAllocator::GetAudibility (audioSource->GetVolume (), distance);
+		request.isReal = audioSource->HasVoice ();
+
+		requests.push_back (request);
+	}
+
+	_voiceAllocator.Allocate (requests);
+
+	/*
+	 * Free the voices first, so that they could be taken in the same frame
+	*/
+
+	for (const VoiceRequest& request : requests) {
+		AudioSource* audioSource = _audioSources [request.id];
+
+		if (request.isReal == false && audioSource->HasVoice () == true) {
+			ReleaseVoice (audioSource->DetachVoice ());
+		}
+	}
+
+	for (const VoiceRequest& request : requests) {
+		AudioSource* audioSource = _audioSources [request.id];
+
+		if (request.isReal == true && audioSource->HasVoice () == false) {
+			unsigned int voice = AcquireVoice ();
+
+			if (voice != 0) {
+				audioSource->AttachVoice (voice);
+			}
+		}
+	}
+
+	UpdateStatistics (requests.size ());
+}
+
+void AudioManager::Clear ()
+{
+	_decodeWorker.Stop ();
+
+	for (AudioSource* audioSource : _audioSources) {
+		if (audioSource->HasVoice () == true) {
+			ReleaseVoice (audioSource->DetachVoice ());
+		}
+	}
+
+	for (unsigned int voice : _voices) {
+		_backend.DeleteSource (voice);
+	}
+
+	_voices.clear ();
+	_freeVoices.clear ();
+
+	_audioClipViews.clear ();
+}
+
+unsigned int AudioManager::AcquireVoice ()
+{
+	if (_freeVoices.empty () == false) {
+		unsigned int voice = _freeVoices.back ();
+		_freeVoices.pop_back ();
+
+		return voice;
+	}
+
+	/*
+	 * Voices are created on demand, up to the limit
+	*/
+
+	if (_voices.size () >= _voiceAllocator.GetMaxVoices ()) {
+		return 0;
+	}
+
+	unsigned int voice = _backend.CreateSource ();
+
+	_voices.push_back (voice);
+
+	return voice;
+}
+
+void AudioManager::ReleaseVoice (unsigned int voice)
+{
+	_freeVoices.push_back (voice);
+}
+
+glm::vec3 AudioManager::UpdateListener ()
+{
+	Camera* camera = CameraManager::Instance ()->GetActive ();
+
+	if (camera == nullptr) {
+		return glm::vec3 (0.0f);
+	}
+
+	_backend.SetListener (camera->GetPosition (), camera->GetForward (), camera->GetUp ());
+
+	return camera->GetPosition ();
+}
+
+void AudioManager::UpdateStatistics (std::size_t playingCount)
+{
+	auto audioStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <AudioStatisticsObject> ();
+
+	std::size_t realVoicesCount = _voices.size () - _freeVoices.size ();
+
+	audioStatisticsObject->SourcesCount = _audioSources.size ();
+	audioStatisticsObject->PlayingCount = playingCount;
+	audioStatisticsObject->RealVoicesCount = realVoicesCount;
+	audioStatisticsObject->VirtualVoicesCount = playingCount - std::min (playingCount, realVoicesCount);
+	audioStatisticsObject->StreamsCount = 0;
+
+	for (AudioSource* audioSource : _audioSources) {
+		if (audioSource->IsStreamed () == true && audioSource->HasVoice () == true) {
+			audioStatisticsObject->StreamsCount ++;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef AUDIOMANAGER_H
+#define AUDIOMANAGER_H
+
+#include "Core/Singleton/Singleton.h"
+
+#include <vector>
+#include <string>
+#include <map>
+
+#include "ALAudioBackend.h"
+#include "VoiceAllocator.h"
+#include "AudioStream.h"
+#include "AudioDecodeWorker.h"
+#include "AudioSource.h"
+
+/*
+ * Sources quieter than this never take a real voice
+*/
+
+#define AUDIO_MIN_AUDIBILITY 0.001f
+
+/*
+ * How much louder a virtual source has to be to take the voice of a
+ * real source with the same priority
+*/
+
+#define AUDIO_VOICE_HYSTERESIS 1.25f
+
+/*
+ * Owns the real voices and hands them to the playing sources that are
+ * heard the most, every frame. Clips are shared between the sources
+ * that play them, long clips are streamed.
+*/
+
+class ENGINE_API AudioManager : public Singleton<AudioManager>
+{
+	friend Singleton<AudioManager>;
+
+	DECLARE_SINGLETON(AudioManager)
+
+protected:
+	ALAudioBackend _backend;
+	VoiceAllocator _voiceAllocator;
+	AudioDecodeWorker _decodeWorker;
+
+	std::vector<AudioSource*> _audioSources;
+
+	std::vector<unsigned int> _voices;
+	std::vector<unsigned int> _freeVoices;
+
+	std::map<std::string, Resource<AudioClipView>> _audioClipViews;
+
+	float _streamMinDuration;
+	float _streamChunkDuration;
+
+public:
+	void Init ();
+
+	void Attach (AudioSource* audioSource);
+	void Detach (AudioSource* audioSource);
+
+	bool IsStreamed (const Resource<AudioClip>& audioClip) const;
+
+	Resource<AudioClipView> GetAudioClipView (const Resource<AudioClip>& audioClip);
+	AudioStream* CreateAudioStream (const Resource<AudioClip>& audioClip);
+
+	AudioBackendI* GetBackend ();
+
+	void Update ();
+
+	void Clear ();
+protected:
+	unsigned int AcquireVoice ();
+	void ReleaseVoice (unsigned int voice);
+
+	glm::vec3 UpdateListener ();
+
+	void UpdateStatistics (std::size_t playingCount);
+private:
+	AudioManager ();
+	~AudioManager ();
+	AudioManager (const AudioManager&);
+	AudioManager& operator=(const AudioManager&);
+};
+
+#endif
\ No newline at end of file
@@ -1,40 +1,90 @@
 #include "AudioSource.h"
 
-#include "AudioSystem.h"
+#include <cmath>
 
-#include "Wrappers/OpenAL/AL.h"
+#include "AudioManager.h"
+
+#include "Systems/Time/Time.h"
 
 AudioSource::AudioSource (Transform* transform) :
 	_transform (transform),
 	_audioClip (nullptr),
 	_audioClipView (nullptr),
-	_sourceID (0)
+	_audioStream (nullptr),
+	_volume (1.0f),
+	_loop (false),
+	_priority (0),
+	_isPlaying (false),
+	_isPaused (false),
+	_playbackTime (0.0f),
+	_voice (0)
+{
+	AudioManager::Instance ()->Attach (this);
+}
+
+AudioSource::~AudioSource ()
 {
-	AL::GenSources((ALuint)1, &_sourceID);
+	AudioManager::Instance ()->Detach (this);
 
-	AL::Sourcef(_sourceID, AL_PITCH, 1);
-	AL::Sourcef(_sourceID, AL_GAIN, 1);
-	AL::Source3f(_sourceID, AL_POSITION, 0, 0, 0);
-	AL::Source3f(_sourceID, AL_VELOCITY, 0, 0, 0);
-	AL::Sourcei(_sourceID, AL_LOOPING, AL_FALSE);
+	delete _audioStream;
 }
 
 void AudioSource::SetAudioClip (const Resource<AudioClip>& audioClip)
 {
+	Stop ();
+
+	delete _audioStream;
+
 	_audioClip = audioClip;
-	_audioClipView = AudioSystem::LoadAudioClip (audioClip);
+	_audioClipView = nullptr;
+	_audioStream = nullptr;
+
+	if (_audioClip == nullptr) {
+		return;
+	}
+
+	if (AudioManager::Instance ()->IsStreamed (_audioClip) == true) {
+		_audioStream = AudioManager::Instance ()->CreateAudioStream (_audioClip);
+	}
 
-	AL::Sourcei(_sourceID, AL_BUFFER, _audioClipView->GetBufferID ());
+	if (AudioManager::Instance ()->IsStreamed (_audioClip) == false) {
+		_audioClipView = AudioManager::Instance ()->GetAudioClipView (_audioClip);
+	}
+
+	if (_audioStream != nullptr) {
+		_audioStream->SetLoop (_loop);
+	}
 }
 
 void AudioSource::SetVolume (float volume)
 {
-	AL::Sourcef(_sourceID, AL_GAIN, volume);
+	_volume = volume;
+
+	if (_voice != 0) {
+		AudioManager::Instance ()->GetBackend ()->SetSourceGain (_voice, _volume);
+	}
 }
 
 void AudioSource::SetLoop (bool loop)
 {
-	AL::Sourcei(_sourceID, AL_LOOPING, loop);
+	_loop = loop;
+
+	if (_audioStream != nullptr) {
+		_audioStream->SetLoop (_loop);
+	}
+
+	/*
+	 * A streamed voice never loops itself, the stream does
+	*/
+
+	if (_voice != 0 && _audioStream == nullptr) {
+		AudioManager::Instance ()->GetBackend ()->SetSourceLooping (_voice, _loop);
+	}
+}
+
+void AudioSource::SetPriority (int priority)
+{
+	_priority = priority;
 }
 
 Resource<AudioClip> AudioSource::GetAudioClip () const
@@ -42,37 +92,169 @@ Resource<AudioClip> AudioSource::GetAudioClip () const
 	return _audioClip;
 }
 
+float AudioSource::GetVolume () const
+{
+	return _volume;
+}
+
+int AudioSource::GetPriority () const
+{
+	return _priority;
+}
+
+glm::vec3 AudioSource::GetPosition () const
+{
+	return _transform->GetPosition ();
+}
+
 bool AudioSource::IsPlaying () const
 {
-    ALenum state;
-    
-    AL::GetSourcei(_sourceID, AL_SOURCE_STATE, &state);
-    
-    return (state == AL_PLAYING);
+	return _isPlaying && !_isPaused;
+}
+
+bool AudioSource::IsStreamed () const
+{
+	return _audioStream != nullptr;
+}
+
+bool AudioSource::IsVirtual () const
+{
+	return IsPlaying () && _voice == 0;
 }
 
 void AudioSource::Update ()
 {
-	if (_audioClip == nullptr) {
+	if (_audioClip == nullptr || IsPlaying () == false) {
 		return;
 	}
 
-	glm::vec3 position = _transform->GetPosition ();
+	/*
+	 * Keep the playback time while virtual, so that the clip resumes
+	 * where it would have been
+	*/
+
+	float duration = _audioClip->GetDuration ();
 
-	AL::Source3f(_sourceID, AL_POSITION, position.x, position.y, position.z);
+	_playbackTime += Time::GetDeltaTime ();
+
+	if (_playbackTime >= duration) {
+		_playbackTime = (_loop && duration > 0.0f) ? std::fmod (_playbackTime, duration) : duration;
+	}
+
+	if (_voice == 0) {
+		if (_loop == false && _playbackTime >= duration) {
+			_isPlaying = false;
+		}
+
+		return;
+	}
+
+	AudioBackendI* backend = AudioManager::Instance ()->GetBackend ();
+
+	backend->SetSourcePosition (_voice, GetPosition ());
+
+	bool isPlaying = _audioStream != nullptr ? _audioStream->Update () : backend->IsPlaying (_voice);
+
+	if (isPlaying == false) {
+		_isPlaying = false;
+		_playbackTime = 0.0f;
+	}
 }
 
 void AudioSource::Play ()
 {
-	AL::SourcePlay (_sourceID);
+	if (IsPlaying () == true) {
+		return;
+	}
+
+	/*
+	 * The voice, if any, is given by the audio manager
+	*/
+
+	_isPlaying = true;
+	_isPaused = false;
 }
 
 void AudioSource::Stop ()
 {
-	AL::SourceStop (_sourceID);
+	_isPlaying = false;
+	_isPaused = false;
+	_playbackTime = 0.0f;
+
+	if (_voice != 0 && _audioStream != nullptr) {
+		_audioStream->Stop ();
+	}
+
+	if (_voice != 0 && _audioStream == nullptr) {
+		AudioManager::Instance ()->GetBackend ()->Stop (_voice);
+	}
 }
 
 void AudioSource::Pause ()
 {
-	AL::SourcePause (_sourceID);
+	/*
+	 * A paused source lets its voice go, it keeps the playback time
+	*/
+
+	_isPaused = true;
+}
+
+bool AudioSource::HasVoice () const
+{
+	return _voice != 0;
+}
+
+void AudioSource::AttachVoice (unsigned int voice)
+{
+	_voice = voice;
+
+	AudioBackendI* backend = AudioManager::Instance ()->GetBackend ();
+
+	backend->SetSourceGain (_voice, _volume);
+	backend->SetSourcePosition (_voice, GetPosition ());
+
+	StartVoice ();
+}
+
+unsigned int AudioSource::DetachVoice ()
+{
+	unsigned int voice = _voice;
+
+	if (_audioStream != nullptr) {
+		_audioStream->Stop ();
+	}
+
+	if (_audioStream == nullptr) {
+		AudioBackendI* backend = AudioManager::Instance ()->GetBackend ();
+
+		backend->Stop (_voice);
+		backend->SetSourceBuffer (_voice, 0);
+	}
+
+	_voice = 0;
+
+	return voice;
+}
+
+void AudioSource::StartVoice ()
+{
+	AudioBackendI* backend = AudioManager::Instance ()->GetBackend ();
+
+	if (_audioStream != nullptr) {
+		backend->SetSourceLooping (_voice, false);
+
+		_audioStream->Start (_voice, _playbackTime * _audioStream->GetFormat ().GetBytesPerSecond ());
+		_audioStream->Update ();
+
+		return;
+	}
+
+	if (_audioClipView == nullptr || _audioClipView->GetBufferID () == 0) {
+		return;
+	}
+
+	backend->SetSourceLooping (_voice, _loop);
+	backend->SetSourceBuffer (_voice, _audioClipView->GetBufferID ());
+	backend->SetSourceOffset (_voice, _playbackTime);
+	backend->Play (_voice);
 }
\ No newline at end of file
@@ -8,6 +8,13 @@
 #include "Core/Resources/Resource.h"
 #include "AudioViews/AudioClipView.h"
 #include "AudioClip.h"
+#include "AudioStream.h"
+
+/*
+ * A source only plays through a real voice while the audio manager
+ * gives it one. Without a voice it is virtual, it keeps its playback
+ * time and resumes from there once it gets a voice back.
+*/
 
 class ENGINE_API AudioSource : public Object
 {
@@ -15,24 +22,46 @@ protected:
 	Transform* _transform;
 	Resource<AudioClip> _audioClip;
 	Resource<AudioClipView> _audioClipView;
+	AudioStream* _audioStream;
+
+	float _volume;
+	bool _loop;
+	int _priority;
+
+	bool _isPlaying;
+	bool _isPaused;
+	float _playbackTime;
 
-	unsigned int _sourceID;
+	unsigned int _voice;
 
 public:
 	AudioSource (Transform* transform);
+	~AudioSource ();
 
 	void SetAudioClip (const Resource<AudioClip>& audioClip);
 	void SetVolume (float volume);
 	void SetLoop (bool loop);
+	void SetPriority (int priority);
 
 	Resource<AudioClip> GetAudioClip () const;
+	float GetVolume () const;
+	int GetPriority () const;
+	glm::vec3 GetPosition () const;
 	bool IsPlaying () const;
+	bool IsStreamed () const;
+	bool IsVirtual () const;
 
 	void Update ();
 
 	void Play ();
 	void Stop ();
 	void Pause ();
+
+	bool HasVoice () const;
+	void AttachVoice (unsigned int voice);
+	unsigned int DetachVoice ();
+protected:
+	void StartVoice ();
 };
 
 #endif
\ No newline at end of file
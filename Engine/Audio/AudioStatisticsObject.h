@@ -0,0 +1,17 @@
+#ifndef AUDIOSTATISTICSOBJECT_H
+#define AUDIOSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API AudioStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(AudioStatisticsObject)
+
+	std::size_t SourcesCount;
+	std::size_t PlayingCount;
+	std::size_t RealVoicesCount;
+	std::size_t VirtualVoicesCount;
+	std::size_t StreamsCount;
+};
+
+#endif
\ No newline at end of file
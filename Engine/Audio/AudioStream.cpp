@@ -0,0 +1,267 @@
+#include "AudioStream.h"
+
+#include <algorithm>
+
+AudioStream::AudioStream (AudioBackendI* backend, AudioDecoderI* decoder,
+	std::size_t chunkSize, const AudioJobExecutor& executor) :
+	_backend (backend),
+	_executor (executor),
+	_state (new DecodeState ()),
+	_queuedCount (0),
+	_source (0),
+	_streamedBytes (0)
+{
+	/*
+	 * Chunks hold whole frames
+	*/
+
+	std::size_t frameSize = std::max (decoder->GetFormat ().GetFrameSize (), (std::size_t) 1);
+
+	_state->decoder.reset (decoder);
+	_state->chunkSize = std::max (chunkSize - chunkSize % frameSize, frameSize);
+	_state->chunksCapacity = AUDIO_STREAM_BUFFERS;
+	_state->seekOffset = 0;
+	_state->isSeekRequested = false;
+	_state->isDecoding = false;
+	_state->isEnded = false;
+	_state->loop = false;
+
+	for (std::size_t index = 0; index < AUDIO_STREAM_BUFFERS; index ++) {
+		_buffers.push_back (_backend->CreateBuffer ());
+	}
+
+	_freeBuffers = _buffers;
+}
+
+AudioStream::~AudioStream ()
+{
+	Stop ();
+
+	/*
+	 * A decode job still running keeps its own reference to the state
+	*/
+
+	for (unsigned int buffer : _buffers) {
+		_backend->DeleteBuffer (buffer);
+	}
+}
+
+void AudioStream::SetLoop (bool loop)
+{
+	std::lock_guard<std::mutex> lock (_state->mutex);
+
+	_state->loop = loop;
+}
+
+void AudioStream::Start (unsigned int source, std::size_t offset)
+{
+	Stop ();
+
+	_source = source;
+
+	/*
+	 * The decode job seeks before its next read, a chunk it is reading
+	 * meanwhile is dropped
+	*/
+
+	{
+		std::lock_guard<std::mutex> lock (_state->mutex);
+
+		std::size_t frameSize = std::max (_state->decoder->GetFormat ().GetFrameSize (), (std::size_t) 1);
+
+		_state->chunks.clear ();
+		_state->isEnded = false;
+		_state->seekOffset = offset - offset % frameSize;
+		_state->isSeekRequested = true;
+	}
+
+	RequestChunks ();
+}
+
+bool AudioStream::Update ()
+{
+	if (_source == 0) {
+		return false;
+	}
+
+	/*
+	 * Take back the buffers the voice already played
+	*/
+
+	std::vector<unsigned int> processedBuffers = _backend->UnqueueProcessedBuffers (_source);
+
+	_queuedCount -= std::min (_queuedCount, processedBuffers.size ());
+	_freeBuffers.insert (_freeBuffers.end (), processedBuffers.begin (), processedBuffers.end ());
+
+	bool isEnded = false;
+
+	{
+		std::unique_lock<std::mutex> lock (_state->mutex, std::try_to_lock);
+
+		if (lock.owns_lock () == true) {
+			while (_freeBuffers.empty () == false && _state->chunks.empty () == false) {
+				Chunk& chunk = _state->chunks.front ();
+
+				unsigned int buffer = _freeBuffers.back ();
+				_freeBuffers.pop_back ();
+
+				_backend->BufferData (buffer, _state->decoder->GetFormat (), chunk.data.data (), chunk.data.size ());
+				_backend->QueueBuffer (_source, buffer);
+
+				_queuedCount ++;
+				_streamedBytes += chunk.data.size ();
+
+				_state->chunks.pop_front ();
+			}
+
+			isEnded = _state->isEnded && _state->chunks.empty ();
+		}
+	}
+
+	RequestChunks ();
+
+	/*
+	 * Restart the voice after it ran out of buffers
+	*/
+
+	if (_queuedCount > 0 && _backend->IsPlaying (_source) == false) {
+		_backend->Play (_source);
+	}
+
+	return !(isEnded && _queuedCount == 0);
+}
+
+void AudioStream::Stop ()
+{
+	if (_source == 0) {
+		return;
+	}
+
+	/*
+	 * Detaching the buffers of a stopped voice empties its queue
+	*/
+
+	_backend->Stop (_source);
+	_backend->SetSourceBuffer (_source, 0);
+
+	_freeBuffers = _buffers;
+	_queuedCount = 0;
+	_source = 0;
+}
+
+const AudioFormat& AudioStream::GetFormat () const
+{
+	return _state->decoder->GetFormat ();
+}
+
+std::size_t AudioStream::GetQueuedCount () const
+{
+	return _queuedCount;
+}
+
+std::size_t AudioStream::GetStreamedBytes () const
+{
+	return _streamedBytes;
+}
+
+void AudioStream::RequestChunks ()
+{
+	{
+		std::unique_lock<std::mutex> lock (_state->mutex, std::try_to_lock);
+
+		if (lock.owns_lock () == false || _state->isDecoding == true || _state->isEnded == true ||
+			_state->chunks.size () >= _state->chunksCapacity) {
+			return;
+		}
+
+		_state->isDecoding = true;
+	}
+
+	std::shared_ptr<DecodeState> state = _state;
+
+	_executor ([state] () {
+		DecodeChunks (state);
+	});
+}
+
+void AudioStream::DecodeChunks (const std::shared_ptr<DecodeState>& state)
+{
+	std::unique_lock<std::mutex> lock (state->mutex);
+
+	while (true) {
+		if (state->isSeekRequested == true) {
+			std::size_t offset = state->seekOffset;
+			state->isSeekRequested = false;
+
+			lock.unlock ();
+
+			state->decoder->Seek (std::min (offset, state->decoder->GetSize ()));
+
+			lock.lock ();
+
+			continue;
+		}
+
+		if (state->chunks.size () >= state->chunksCapacity || state->isEnded == true) {
+			break;
+		}
+
+		std::size_t chunkSize = state->chunkSize;
+		bool loop = state->loop;
+
+		/*
+		 * Read without the lock, so that the update and the stream
+		 * controls never wait for the disk
+		*/
+
+		lock.unlock ();
+
+		Chunk chunk;
+		chunk.data.resize (chunkSize);
+
+		std::size_t filledSize = 0;
+		bool isEnded = false;
+
+		while (filledSize < chunkSize) {
+			std::size_t readSize = state->decoder->Read (chunk.data.data () + filledSize, chunkSize - filledSize);
+
+			filledSize += readSize;
+
+			if (readSize > 0) {
+				continue;
+			}
+
+			/*
+			 * End of the clip, a looping stream goes on from the start
+			*/
+
+			if (loop == false || state->decoder->GetSize () == 0) {
+				isEnded = true;
+
+				break;
+			}
+
+			state->decoder->Seek (0);
+		}
+
+		chunk.data.resize (filledSize);
+
+		lock.lock ();
+
+		/*
+		 * The stream was restarted while the chunk was read
+		*/
+
+		if (state->isSeekRequested == true) {
+			continue;
+		}
+
+		if (filledSize > 0) {
+			state->chunks.push_back (std::move (chunk));
+		}
+
+		state->isEnded = isEnded;
+	}
+
+	state->isDecoding = false;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef AUDIOSTREAM_H
+#define AUDIOSTREAM_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+#include "AudioBackendI.h"
+#include "Decoders/AudioDecoderI.h"
+
+/*
+ * Buffers queued on a streaming voice, a chunk plays while the next
+ * ones are waiting
+*/
+
+#define AUDIO_STREAM_BUFFERS 4
+
+typedef std::function<void (const std::function<void ()>&)> AudioJobExecutor;
+
+/*
+ * Plays a long clip through a few queued buffers instead of a single
+ * buffer holding every sample. Decoding runs as a job on the executor,
+ * the render thread only swaps the played buffers for decoded chunks.
+ * The update never waits for the decoder, a chunk that is not ready yet
+ * is picked up the next frame.
+*/
+
+class ENGINE_API AudioStream
+{
+protected:
+	struct Chunk
+	{
+		std::vector<unsigned char> data;
+	};
+
+	/*
+	 * Only the decode job touches the decoder. The mutex guards the
+	 * other fields and is never held while the decoder reads
+	*/
+
+	struct DecodeState
+	{
+		std::mutex mutex;
+		std::unique_ptr<AudioDecoderI> decoder;
+		std::deque<Chunk> chunks;
+		std::size_t chunkSize;
+		std::size_t chunksCapacity;
+		std::size_t seekOffset;
+		bool isSeekRequested;
+		bool isDecoding;
+		bool isEnded;
+		bool loop;
+	};
+
+protected:
+	AudioBackendI* _backend;
+	AudioJobExecutor _executor;
+	std::shared_ptr<DecodeState> _state;
+
+	std::vector<unsigned int> _buffers;
+	std::vector<unsigned int> _freeBuffers;
+	std::size_t _queuedCount;
+
+	unsigned int _source;
+
+	std::size_t _streamedBytes;
+
+public:
+	AudioStream (AudioBackendI* backend, AudioDecoderI* decoder,
+		std::size_t chunkSize, const AudioJobExecutor& executor);
+	~AudioStream ();
+
+	void SetLoop (bool loop);
+
+	void Start (unsigned int source, std::size_t offset);
+	bool Update ();
+	void Stop ();
+
+	const AudioFormat& GetFormat () const;
+	std::size_t GetQueuedCount () const;
+	std::size_t GetStreamedBytes () const;
+protected:
+	void RequestChunks ();
+
+	static void DecodeChunks (const std::shared_ptr<DecodeState>& state);
+};
+
+#endif
\ No newline at end of file
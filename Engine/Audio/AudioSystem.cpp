@@ -1,21 +1,29 @@
 #include "AudioSystem.h"
 
-#include "Wrappers/OpenAL/AL.h"
+#include "ALAudioBackend.h"
+
+#include "Core/Console/Console.h"
 
 Resource<AudioClipView> AudioSystem::LoadAudioClip (const Resource<AudioClip>& audioClip)
 {
 	AudioClipView* audioClipView = new AudioClipView ();
 
-	ALuint buffer;
+	if (audioClip->GetData () == nullptr || audioClip->GetFormat ().IsSupported () == false) {
+		Console::LogError ("Unable to load \"" + audioClip->GetName () + "\" into an audio buffer!");
+
+		return Resource<AudioClipView> (audioClipView, audioClip->GetName ());
+	}
+
+	ALAudioBackend backend;
 
-	AL::GenBuffers ((ALuint)1, &buffer);
+	unsigned int buffer = backend.CreateBuffer ();
 
-	AL::BufferData (buffer, AL_FORMAT_STEREO16,
+	backend.BufferData (buffer, audioClip->GetFormat (),
 		audioClip->GetData (),
-		audioClip->GetSize (),
-		audioClip->GetSampleRate ());
+		audioClip->GetSize ());
 
 	audioClipView->SetBufferID (buffer);
+	audioClipView->SetBufferSize (audioClip->GetSize ());
 
 	return Resource<AudioClipView> (audioClipView, audioClip->GetName ());
 }
\ No newline at end of file
@@ -3,14 +3,17 @@
 #include "Wrappers/OpenAL/AL.h"
 
 AudioClipView::AudioClipView () :
-	_bufferID (0)
+	_bufferID (0),
+	_bufferSize (0)
 {
 
 }
 
 AudioClipView::~AudioClipView ()
 {
-	AL::DeleteBuffers (1, &_bufferID);
+	if (_bufferID != 0) {
+		AL::DeleteBuffers (1, &_bufferID);
+	}
 }
 
 void AudioClipView::SetBufferID (unsigned int bufferID)
@@ -18,7 +21,22 @@ void AudioClipView::SetBufferID (unsigned int bufferID)
 	_bufferID = bufferID;
 }
 
+void AudioClipView::SetBufferSize (std::size_t bufferSize)
+{
+	_bufferSize = bufferSize;
+}
+
 unsigned int AudioClipView::GetBufferID () const
 {
 	return _bufferID;
 }
+
+RESIDENCY_GROUP AudioClipView::GetResidencyGroup () const
+{
+	return RESIDENCY_AUDIO;
+}
+
+ResidencyMemory AudioClipView::GetResidencyMemory () const
+{
+	return ResidencyMemory { 0, _bufferSize };
+}
@@ -2,17 +2,24 @@
 #define AUDIOCLIPVIEW_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
-class AudioClipView : public Object
+class AudioClipView : public Object, public ResidentObjectI
 {
 protected:
 	unsigned int _bufferID;
+	std::size_t _bufferSize;
 public:
 	AudioClipView ();
 	~AudioClipView ();
 
 	void SetBufferID (unsigned int bufferID);
+	void SetBufferSize (std::size_t bufferSize);
+
 	unsigned int GetBufferID () const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "AudioClipDecoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+AudioClipDecoder::AudioClipDecoder (const Resource<AudioClip>& audioClip) :
+	_audioClip (audioClip),
+	_format (audioClip->GetFormat ()),
+	_position (0)
+{
+
+}
+
+const AudioFormat& AudioClipDecoder::GetFormat () const
+{
+	return _format;
+}
+
+std::size_t AudioClipDecoder::GetSize () const
+{
+	return _audioClip->GetData () == nullptr ? 0 : _audioClip->GetSize ();
+}
+
+std::size_t AudioClipDecoder::Read (unsigned char* data, std::size_t size)
+{
+	size = std::min (size, GetSize () - _position);
+
+	std::memcpy (data, _audioClip->GetData () + _position, size);
+
+	_position += size;
+
+	return size;
+}
+
+bool AudioClipDecoder::Seek (std::size_t offset)
+{
+	if (offset > GetSize ()) {
+		return false;
+	}
+
+	_position = offset;
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef AUDIOCLIPDECODER_H
+#define AUDIOCLIPDECODER_H
+
+#include "AudioDecoderI.h"
+
+#include "Core/Resources/Resource.h"
+#include "Audio/AudioClip.h"
+
+/*
+ * Reads the samples of a clip already loaded in memory
+*/
+
+class ENGINE_API AudioClipDecoder : public AudioDecoderI
+{
+protected:
+	Resource<AudioClip> _audioClip;
+	AudioFormat _format;
+	std::size_t _position;
+
+public:
+	AudioClipDecoder (const Resource<AudioClip>& audioClip);
+
+	const AudioFormat& GetFormat () const;
+	std::size_t GetSize () const;
+
+	std::size_t Read (unsigned char* data, std::size_t size);
+	bool Seek (std::size_t offset);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef AUDIODECODERI_H
+#define AUDIODECODERI_H
+
+#include "Audio/AudioFormat.h"
+
+/*
+ * Produces the PCM samples of a clip, a chunk at a time
+*/
+
+class ENGINE_API AudioDecoderI
+{
+public:
+	virtual ~AudioDecoderI () {}
+
+	virtual const AudioFormat& GetFormat () const = 0;
+	virtual std::size_t GetSize () const = 0;
+
+	virtual std::size_t Read (unsigned char* data, std::size_t size) = 0;
+	virtual bool Seek (std::size_t offset) = 0;
+};
+
+#endif
\ No newline at end of file
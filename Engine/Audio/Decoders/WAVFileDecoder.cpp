@@ -0,0 +1,164 @@
+#include "WAVFileDecoder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Wave files are little endian
+*/
+
+static std::uint32_t ReadUInt32 (const unsigned char* data)
+{
+	return data [0] | (data [1] << 8) | (data [2] << 16) | ((std::uint32_t) data [3] << 24);
+}
+
+static std::uint16_t ReadUInt16 (const unsigned char* data)
+{
+	return data [0] | (data [1] << 8);
+}
+
+WAVFileDecoder::WAVFileDecoder () :
+	_format (),
+	_dataOffset (0),
+	_dataSize (0),
+	_position (0)
+{
+
+}
+
+bool WAVFileDecoder::Open (const std::string& filename)
+{
+	_file.open (filename, std::ios::binary);
+
+	if (!_file.is_open ()) {
+		return false;
+	}
+
+	if (ReadHeader () == false) {
+		_file.close ();
+
+		return false;
+	}
+
+	return Seek (0);
+}
+
+const AudioFormat& WAVFileDecoder::GetFormat () const
+{
+	return _format;
+}
+
+std::size_t WAVFileDecoder::GetSize () const
+{
+	return _dataSize;
+}
+
+std::size_t WAVFileDecoder::Read (unsigned char* data, std::size_t size)
+{
+	size = std::min (size, _dataSize - _position);
+
+	if (size == 0) {
+		return 0;
+	}
+
+	_file.read ((char*) data, size);
+
+	std::size_t readSize = _file.gcount ();
+
+	_position += readSize;
+
+	return readSize;
+}
+
+bool WAVFileDecoder::Seek (std::size_t offset)
+{
+	if (offset > _dataSize) {
+		return false;
+	}
+
+	_file.clear ();
+	_file.seekg (_dataOffset + offset);
+
+	_position = offset;
+
+	return _file.good ();
+}
+
+bool WAVFileDecoder::ReadHeader ()
+{
+	unsigned char header [12];
+
+	_file.read ((char*) header, 12);
+
+	if (_file.gcount () != 12 || std::memcmp (header, "RIFF", 4) != 0 || std::memcmp (header + 8, "WAVE", 4) != 0) {
+		return false;
+	}
+
+	bool hasFormat = false;
+
+	/*
+	 * Walk the chunks until the samples, unknown chunks are skipped
+	*/
+
+	while (true) {
+		unsigned char chunkHeader [8];
+
+		_file.read ((char*) chunkHeader, 8);
+
+		if (_file.gcount () != 8) {
+			return false;
+		}
+
+		std::size_t chunkSize = ReadUInt32 (chunkHeader + 4);
+		std::size_t chunkStart = _file.tellg ();
+
+		if (std::memcmp (chunkHeader, "fmt ", 4) == 0) {
+			unsigned char formatChunk [16];
+
+			if (chunkSize < 16) {
+				return false;
+			}
+
+			_file.read ((char*) formatChunk, 16);
+
+			/*
+			 * Only uncompressed samples could be streamed as they are
+			*/
+
+			if (ReadUInt16 (formatChunk) != 1) {
+				return false;
+			}
+
+			_format.channels = ReadUInt16 (formatChunk + 2);
+			_format.sampleRate = ReadUInt32 (formatChunk + 4);
+			_format.bitsPerSample = ReadUInt16 (formatChunk + 14);
+
+			hasFormat = true;
+		}
+
+		if (std::memcmp (chunkHeader, "data", 4) == 0) {
+			if (hasFormat == false || _format.IsSupported () == false) {
+				return false;
+			}
+
+			_dataOffset = chunkStart;
+
+			/*
+			 * Keep whole frames, the size of a truncated file is trusted
+			 * only up to its end
+			*/
+
+			_file.seekg (0, std::ios::end);
+
+			std::size_t fileSize = _file.tellg ();
+
+			_dataSize = std::min (chunkSize, fileSize - chunkStart);
+			_dataSize -= _dataSize % _format.GetFrameSize ();
+
+			return true;
+		}
+
+		_file.seekg (chunkStart + chunkSize + (chunkSize & 1));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef WAVFILEDECODER_H
+#define WAVFILEDECODER_H
+
+#include "AudioDecoderI.h"
+
+#include <fstream>
+#include <string>
+
+/*
+ * Reads the samples of an uncompressed PCM wave file straight from the
+ * disk, only the header is kept in memory
+*/
+
+class ENGINE_API WAVFileDecoder : public AudioDecoderI
+{
+protected:
+	std::ifstream _file;
+	AudioFormat _format;
+	std::size_t _dataOffset;
+	std::size_t _dataSize;
+	std::size_t _position;
+
+public:
+	WAVFileDecoder ();
+
+	bool Open (const std::string& filename);
+
+	const AudioFormat& GetFormat () const;
+	std::size_t GetSize () const;
+
+	std::size_t Read (unsigned char* data, std::size_t size);
+	bool Seek (std::size_t offset);
+protected:
+	bool ReadHeader ();
+};
+
+#endif
\ No newline at end of file
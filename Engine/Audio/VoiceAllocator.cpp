@@ -0,0 +1,82 @@
+#include "VoiceAllocator.h"
+
+#include <algorithm>
+
+VoiceAllocator::VoiceAllocator (std::size_t maxVoices, float minAudibility, float hysteresis) :
+	_maxVoices (maxVoices),
+	_minAudibility (minAudibility),
+	_hysteresis (hysteresis)
+{
+
+}
+
+std::size_t VoiceAllocator::Allocate (std::vector<VoiceRequest>& requests) const
+{
+	std::vector<std::size_t> order (requests.size ());
+
+	for (std::size_t index = 0; index < requests.size (); index ++) {
+		order [index] = index;
+	}
+
+	auto GetScore = [this] (const VoiceRequest& request) {
+		return request.isReal ? request.audibility * _hysteresis : request.audibility;
+	};
+
+	std::sort (order.begin (), order.end (), [&] (std::size_t left, std::size_t right) {
+		const VoiceRequest& leftRequest = requests [left];
+		const VoiceRequest& rightRequest = requests [right];
+
+		if (leftRequest.priority != rightRequest.priority) {
+			return leftRequest.priority > rightRequest.priority;
+		}
+
+		float leftScore = GetScore (leftRequest);
+		float rightScore = GetScore (rightRequest);
+
+		if (leftScore != rightScore) {
+			return leftScore > rightScore;
+		}
+
+		return leftRequest.id < rightRequest.id;
+	});
+
+	std::size_t realVoicesCount = 0;
+
+	for (std::size_t index : order) {
+		VoiceRequest& request = requests [index];
+
+		/*
+		 * A source that could not be heard never takes a voice
+		*/
+
+		request.isReal = realVoicesCount < _maxVoices && request.audibility >= _minAudibility;
+
+		if (request.isReal == true) {
+			realVoicesCount ++;
+		}
+	}
+
+	return realVoicesCount;
+}
+
+void VoiceAllocator::SetMaxVoices (std::size_t maxVoices)
+{
+	_maxVoices = maxVoices;
+}
+
+std::size_t VoiceAllocator::GetMaxVoices () const
+{
+	return _maxVoices;
+}
+
+float VoiceAllocator::GetAudibility (float gain, float distance,
+	float referenceDistance, float rolloffFactor)
+{
+	/*
+	 * Same attenuation as the default inverse distance clamped model
+	*/
+
+	distance = std::max (distance, referenceDistance);
+
+	return gain * referenceDistance / (referenceDistance + rolloffFactor * (distance - referenceDistance));
+}
\ No newline at end of file
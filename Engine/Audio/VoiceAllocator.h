@@ -0,0 +1,42 @@
+#ifndef VOICEALLOCATOR_H
+#define VOICEALLOCATOR_H
+
+#include <vector>
+#include <cstddef>
+
+struct ENGINE_API VoiceRequest
+{
+	std::size_t id;
+	int priority;
+	float audibility;
+	bool isReal;
+};
+
+/*
+ * Decides which playing sources get one of the few real voices, the
+ * rest keep playing virtually, without a voice. Higher priorities go
+ * first, then the louder sources. A source that already has a voice is
+ * favored, so two sources of about the same loudness do not swap their
+ * voices every frame.
+*/
+
+class ENGINE_API VoiceAllocator
+{
+protected:
+	std::size_t _maxVoices;
+	float _minAudibility;
+	float _hysteresis;
+
+public:
+	VoiceAllocator (std::size_t maxVoices, float minAudibility, float hysteresis);
+
+	std::size_t Allocate (std::vector<VoiceRequest>& requests) const;
+
+	void SetMaxVoices (std::size_t maxVoices);
+	std::size_t GetMaxVoices () const;
+
+	static float GetAudibility (float gain, float distance,
+		float referenceDistance = 1.0f, float rolloffFactor = 1.0f);
+};
+
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "AudioSourceComponent.h"
 
 AudioSourceComponent::AudioSourceComponent () :
+	_priority (0),
 	_audioSource (nullptr)
 {
 
@@ -18,6 +19,7 @@ void AudioSourceComponent::Awake ()
 	_audioSource->SetAudioClip (_audioClip);
 	_audioSource->SetVolume (_volume);
 	_audioSource->SetLoop (_loop);
+	_audioSource->SetPriority (_priority);
 }
 
 void AudioSourceComponent::Update ()
@@ -41,3 +43,10 @@ void AudioSourceComponent::SetLoop (bool loop)
 {
 	_audioSource->SetLoop (loop);
 }
+
+void AudioSourceComponent::SetPriority (int priority)
+{
+	_priority = priority;
+
+	_audioSource->SetPriority (priority);
+}
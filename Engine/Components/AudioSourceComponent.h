@@ -16,6 +16,8 @@ protected:
 	float _volume;
 	ATTRIBUTE(EditAnywhere, Meta)
 	bool _loop;
+	ATTRIBUTE(EditAnywhere, Meta)
+	int _priority;
 
 	AudioSource* _audioSource;
 
@@ -30,6 +32,7 @@ public:
 	void SetAudioClip (const Resource<AudioClip>& audioClip);
 	void SetVolume (float volume);
 	void SetLoop (bool loop);
+	void SetPriority (int priority);
 };
 
 #endif
\ No newline at end of file
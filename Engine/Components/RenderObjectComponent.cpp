@@ -147,6 +147,11 @@ void RenderObjectComponent::SetLayer (int sceneLayers)
 	OnAttachedToScene ();
 }
 
+int RenderObjectComponent::GetLayer () const
+{
+	return _layer;
+}
+
 const Resource<Model>& RenderObjectComponent::GetModel () const
 {
 	return _model;
@@ -40,6 +40,7 @@ public:
 	void SetRenderStage (int renderStage);
 	void SetLayer (int sceneLayers);
 
+	int GetLayer () const;
 	const Resource<Model>& GetModel () const;
 	const AABBVolume& GetBoundingBox () const;
 };
@@ -1,16 +1,29 @@
 #include "Console.h"
 
+#include <algorithm>
+
 #include <spdlog/spdlog.h>
+#include <spdlog/async.h>
 #include <spdlog/sinks/dist_sink.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
 #include "ConsoleSinkContainer.h"
 
+#include "Systems/Settings/SettingsManager.h"
+
 static std::shared_ptr<ConsoleSinkContainer> _sinkContainer (nullptr);
+static spdlog::logger* _logger (nullptr);
 
 void Console::Init ()
 {
-	auto sink = std::make_shared<spdlog::sinks::dist_sink_st>();
+	bool isAsync = SettingsManager::Instance ()->GetValue<bool> ("Console", "async", true);
+	std::size_t queueSize = SettingsManager::Instance ()->GetValue<int> ("Console", "queue_size", 8192);
+	std::string overflow = SettingsManager::Instance ()->GetValue<std::string> ("Console", "overflow", "block");
+	std::string levelName = SettingsManager::Instance ()->GetValue<std::string> ("Console", "level", "info");
+	bool flushOnError = SettingsManager::Instance ()->GetValue<bool> ("Console", "flush_on_error", true);
+	int flushInterval = SettingsManager::Instance ()->GetValue<int> ("Console", "flush_interval", 1);
+
+	auto sink = std::make_shared<spdlog::sinks::dist_sink_mt>();
 
 	auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("Console.log", true);
 
@@ -19,36 +32,90 @@ void Console::Init ()
 	sink->add_sink (file_sink);
 	sink->add_sink (_sinkContainer);
 
-	std::shared_ptr<spdlog::logger> logger = std::shared_ptr<spdlog::logger> (new spdlog::logger ("logger", sink));
+	std::shared_ptr<spdlog::logger> logger (nullptr);
+
+	/*
+	 * A single writer keeps the messages in the order they were queued
+	*/
+
+	if (isAsync == true) {
+		spdlog::init_thread_pool (std::max (queueSize, (std::size_t) 1), 1);
+
+		auto overflowPolicy = overflow == "drop" ?
+			spdlog::async_overflow_policy::overrun_oldest : spdlog::async_overflow_policy::block;
+
+		logger = std::make_shared<spdlog::async_logger> ("logger", sink, spdlog::thread_pool (), overflowPolicy);
+	} else {
+		logger = std::make_shared<spdlog::logger> ("logger", sink);
+	}
 
 	spdlog::set_default_logger (logger);
 
+	spdlog::level::level_enum level = spdlog::level::from_str (levelName);
+	if (level == spdlog::level::off && levelName != "off") {
+		level = spdlog::level::info;
+	}
+
 	spdlog::set_pattern ("[%H:%M:%S] [%l] %v");
-	spdlog::set_level (spdlog::level::trace);
-	spdlog::flush_on(spdlog::level::trace);
+	spdlog::set_level (level);
+	spdlog::flush_on (flushOnError == true ? spdlog::level::err : spdlog::level::off);
+
+	if (flushInterval > 0) {
+		spdlog::flush_every (std::chrono::seconds (flushInterval));
+	}
+
+	_logger = logger.get ();
 }
 
 void Console::Quit ()
 {
+	if (_logger == nullptr) {
+		return;
+	}
 
+	/*
+	 * Shutdown drains the queue before joining the writer
+	*/
+
+	_logger = nullptr;
+
+	spdlog::shutdown ();
+}
+
+bool Console::IsEnabled (LogPriority priority)
+{
+	return _logger != nullptr && _logger->should_log ((spdlog::level::level_enum) priority);
 }
 
 void Console::Log (const std::string& message)
 {
-	spdlog::info (message);
+	if (_logger != nullptr) {
+		_logger->info (message);
+	}
 }
 
 void Console::LogError (const std::string& message)
 {
-	spdlog::error (message);
+	if (_logger != nullptr) {
+		_logger->error (message);
+	}
 }
 
 void Console::LogWarning (const std::string& message)
 {
-	spdlog::warn (message);
+	if (_logger != nullptr) {
+		_logger->warn (message);
+	}
+}
+
+void Console::Flush ()
+{
+	if (_logger != nullptr) {
+		_logger->flush ();
+	}
 }
 
 void Console::AttachSink (ConsoleSink* consoleSink)
 {
 	_sinkContainer->AttachSink (consoleSink);
-}
+}
\ No newline at end of file
@@ -2,20 +2,62 @@
 #define CONSOLE_H
 
 #include <string>
+#include <spdlog/fmt/fmt.h>
 
 #include "ConsoleSink.h"
 
+/*
+ * Messages can be written synchronously, or handed to a bounded queue
+ * drained by a background writer. The format overloads check the level
+ * before building the message, so filtered logs cost nothing to callers.
+*/
+
 class ENGINE_API Console
 {
 public:
 	static void Init ();
 	static void Quit ();
 
+	static bool IsEnabled (LogPriority priority);
+
 	static void Log (const std::string& message);
 	static void LogError (const std::string& message);
 	static void LogWarning (const std::string& message);
 
+	template <typename Arg, typename... Args>
+	static void Log (const char* format, const Arg& arg, const Args&... args);
+	template <typename Arg, typename... Args>
+	static void LogError (const char* format, const Arg& arg, const Args&... args);
+	template <typename Arg, typename... Args>
+	static void LogWarning (const char* format, const Arg& arg, const Args&... args);
+
+	static void Flush ();
+
 	static void AttachSink (ConsoleSink* consoleSink);
 };
 
+template <typename Arg, typename... Args>
+void Console::Log (const char* format, const Arg& arg, const Args&... args)
+{
+	if (IsEnabled (LOG_INFO)) {
+		Log (fmt::format (format, arg, args...));
+	}
+}
+
+template <typename Arg, typename... Args>
+void Console::LogError (const char* format, const Arg& arg, const Args&... args)
+{
+	if (IsEnabled (LOG_ERROR)) {
+		LogError (fmt::format (format, arg, args...));
+	}
+}
+
+template <typename Arg, typename... Args>
+void Console::LogWarning (const char* format, const Arg& arg, const Args&... args)
+{
+	if (IsEnabled (LOG_WARNING)) {
+		LogWarning (fmt::format (format, arg, args...));
+	}
+}
+
 #endif
\ No newline at end of file
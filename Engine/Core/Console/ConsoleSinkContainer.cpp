@@ -2,6 +2,8 @@
 
 void ConsoleSinkContainer::AttachSink (ConsoleSink* sink)
 {
+	std::lock_guard<std::mutex> lock (mutex_);
+
 	_sinks.push_back (sink);
 }
 
@@ -9,17 +9,19 @@
 template <class T>
 class ObjectsFactory : public Object
 {
+public:
+	typedef T* (*CreateCompFn) ();
+
 private:
 	static ObjectsFactory* _instance;
 
-	typedef T* (*CreateCompFn) ();
-
 	std::map<std::string, CreateCompFn> _workers;
 
 public:
 	static ObjectsFactory* Instance ();
 
 	T* Create (const std::string& name);
+	CreateCompFn GetCreateFn (const std::string& name) const;
 
 	void RegCreateFn (const std::string& name, CreateCompFn fptr);
 
@@ -68,6 +70,18 @@ T* ObjectsFactory<T>::Create (const std::string& name)
 	return (it->second) ();
 }
 
+template <class T>
+typename ObjectsFactory<T>::CreateCompFn ObjectsFactory<T>::GetCreateFn (const std::string& name) const
+{
+	auto it = _workers.find (name);
+
+	if (it == _workers.end ()) {
+		return nullptr;
+	}
+
+	return it->second;
+}
+
 template <class T>
 void ObjectsFactory<T>::RegCreateFn (const std::string& name, CreateCompFn fptr)
 {
@@ -0,0 +1,263 @@
+#include "ResidencyCache.h"
+
+#include <limits>
+
+ResidencyCache::ResidencyCache () :
+	_cacheBudget (std::numeric_limits<std::size_t>::max ()),
+	_cacheCapacity (std::numeric_limits<std::size_t>::max ()),
+	_reusesCount (0),
+	_evictionsCount (0)
+{
+	for (std::size_t group = 0; group < RESIDENCY_GROUPS_COUNT; group ++) {
+		_residentMemory [group] = ResidencyMemory { 0, 0 };
+		_cachedMemory [group] = ResidencyMemory { 0, 0 };
+		_residentCount [group] = 0;
+		_cachedCount [group] = 0;
+		_budgets [group] = std::numeric_limits<std::size_t>::max ();
+	}
+}
+
+void ResidencyCache::SetBudget (RESIDENCY_GROUP group, std::size_t budget)
+{
+	_budgets [group] = budget;
+}
+
+void ResidencyCache::SetCacheBudget (std::size_t cacheBudget)
+{
+	_cacheBudget = cacheBudget;
+}
+
+void ResidencyCache::SetCacheCapacity (std::size_t cacheCapacity)
+{
+	_cacheCapacity = cacheCapacity;
+}
+
+void ResidencyCache::Track (const void* object, RESIDENCY_GROUP group, const ResidencyMemory& memory)
+{
+	Untrack (object);
+
+	Entry& entry = _entries [object];
+
+	entry.group = group;
+	entry.memory = memory;
+	entry.isCached = false;
+	entry.isDiscarded = false;
+
+	AddMemory (_residentMemory [group], memory);
+	_residentCount [group] ++;
+}
+
+void ResidencyCache::Untrack (const void* object)
+{
+	auto itEntry = _entries.find (object);
+
+	if (itEntry == _entries.end ()) {
+		return;
+	}
+
+	Entry& entry = itEntry->second;
+
+	if (entry.isCached == true) {
+		SubtractMemory (_cachedMemory [entry.group], entry.memory);
+		_cachedCount [entry.group] --;
+
+		_cachedEntries.erase (entry.cachedIterator);
+	} else {
+		SubtractMemory (_residentMemory [entry.group], entry.memory);
+		_residentCount [entry.group] --;
+	}
+
+	_entries.erase (itEntry);
+}
+
+bool ResidencyCache::Release (const void* object, const ResidencyEviction& eviction)
+{
+	auto itEntry = _entries.find (object);
+
+	if (itEntry == _entries.end () || itEntry->second.isCached == true) {
+		return false;
+	}
+
+	Entry& entry = itEntry->second;
+
+	SubtractMemory (_residentMemory [entry.group], entry.memory);
+	_residentCount [entry.group] --;
+
+	AddMemory (_cachedMemory [entry.group], entry.memory);
+	_cachedCount [entry.group] ++;
+
+	entry.isCached = true;
+	entry.eviction = eviction;
+	entry.cachedIterator = _cachedEntries.insert (_cachedEntries.end (), object);
+
+	return true;
+}
+
+bool ResidencyCache::Reuse (const void* object)
+{
+	auto itEntry = _entries.find (object);
+
+	if (itEntry == _entries.end () || itEntry->second.isCached == false) {
+		return false;
+	}
+
+	Entry& entry = itEntry->second;
+
+	SubtractMemory (_cachedMemory [entry.group], entry.memory);
+	_cachedCount [entry.group] --;
+
+	AddMemory (_residentMemory [entry.group], entry.memory);
+	_residentCount [entry.group] ++;
+
+	_cachedEntries.erase (entry.cachedIterator);
+
+	entry.isCached = false;
+	entry.isDiscarded = false;
+	entry.eviction = nullptr;
+
+	_reusesCount ++;
+
+	return true;
+}
+
+void ResidencyCache::Discard (const void* object)
+{
+	auto itEntry = _entries.find (object);
+
+	if (itEntry == _entries.end () || itEntry->second.isCached == false) {
+		return;
+	}
+
+	itEntry->second.isDiscarded = true;
+}
+
+std::vector<ResidencyEviction> ResidencyCache::Evict ()
+{
+	std::vector<ResidencyEviction> evictions;
+
+	/*
+	 * Walk from the least recently released, a group over its budget
+	 * gives back its oldest entries even when the cache itself fits
+	*/
+
+	auto itCached = _cachedEntries.begin ();
+
+	while (itCached != _cachedEntries.end ()) {
+		auto itEntry = _entries.find (*itCached);
+
+		++ itCached;
+
+		const Entry& entry = itEntry->second;
+
+		if (entry.isDiscarded == false && _cachedEntries.size () <= _cacheCapacity &&
+			GetCacheMemory () <= _cacheBudget && GetGroupMemory (entry.group) <= _budgets [entry.group]) {
+			continue;
+		}
+
+		evictions.push_back (EvictEntry (itEntry));
+	}
+
+	return evictions;
+}
+
+std::vector<ResidencyEviction> ResidencyCache::EvictAll ()
+{
+	std::vector<ResidencyEviction> evictions;
+
+	while (_cachedEntries.empty () == false) {
+		evictions.push_back (EvictEntry (_entries.find (_cachedEntries.front ())));
+	}
+
+	return evictions;
+}
+
+std::size_t ResidencyCache::GetBudget (RESIDENCY_GROUP group) const
+{
+	return _budgets [group];
+}
+
+std::size_t ResidencyCache::GetCacheBudget () const
+{
+	return _cacheBudget;
+}
+
+std::size_t ResidencyCache::GetCacheCapacity () const
+{
+	return _cacheCapacity;
+}
+
+const ResidencyMemory& ResidencyCache::GetResidentMemory (RESIDENCY_GROUP group) const
+{
+	return _residentMemory [group];
+}
+
+const ResidencyMemory& ResidencyCache::GetCachedMemory (RESIDENCY_GROUP group) const
+{
+	return _cachedMemory [group];
+}
+
+std::size_t ResidencyCache::GetResidentCount (RESIDENCY_GROUP group) const
+{
+	return _residentCount [group];
+}
+
+std::size_t ResidencyCache::GetCachedCount (RESIDENCY_GROUP group) const
+{
+	return _cachedCount [group];
+}
+
+std::size_t ResidencyCache::GetGroupMemory (RESIDENCY_GROUP group) const
+{
+	return _residentMemory [group].cpuMemory + _residentMemory [group].gpuMemory +
+		_cachedMemory [group].cpuMemory + _cachedMemory [group].gpuMemory;
+}
+
+std::size_t ResidencyCache::GetCacheMemory () const
+{
+	std::size_t cacheMemory = 0;
+
+	for (std::size_t group = 0; group < RESIDENCY_GROUPS_COUNT; group ++) {
+		cacheMemory += _cachedMemory [group].cpuMemory + _cachedMemory [group].gpuMemory;
+	}
+
+	return cacheMemory;
+}
+
+std::size_t ResidencyCache::GetReusesCount () const
+{
+	return _reusesCount;
+}
+
+std::size_t ResidencyCache::GetEvictionsCount () const
+{
+	return _evictionsCount;
+}
+
+void ResidencyCache::AddMemory (ResidencyMemory& total, const ResidencyMemory& memory)
+{
+	total.cpuMemory += memory.cpuMemory;
+	total.gpuMemory += memory.gpuMemory;
+}
+
+void ResidencyCache::SubtractMemory (ResidencyMemory& total, const ResidencyMemory& memory)
+{
+	total.cpuMemory -= memory.cpuMemory;
+	total.gpuMemory -= memory.gpuMemory;
+}
+
+ResidencyEviction ResidencyCache::EvictEntry (std::unordered_map<const void*, Entry>::iterator itEntry)
+{
+	Entry& entry = itEntry->second;
+
+	ResidencyEviction eviction = entry.eviction;
+
+	SubtractMemory (_cachedMemory [entry.group], entry.memory);
+	_cachedCount [entry.group] --;
+
+	_cachedEntries.erase (entry.cachedIterator);
+	_entries.erase (itEntry);
+
+	_evictionsCount ++;
+
+	return eviction;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef RESIDENCYCACHE_H
+#define RESIDENCYCACHE_H
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <list>
+
+#include "ResidentObjectI.h"
+
+typedef std::function<void ()> ResidencyEviction;
+
+/*
+ * Accounts the memory of the loaded resources per group and keeps the
+ * released ones in least recently used order. A released resource is
+ * reused as it is when it is loaded again. It is only evicted when the
+ * cache grows past its budget or its capacity, or when its group does
+ * not fit its own budget anymore. Resources still in use are never evicted, they are
+ * only counted. The cache does not destroy anything by itself, the
+ * evictions are handed back to the caller.
+*/
+
+class ENGINE_API ResidencyCache
+{
+protected:
+	struct Entry
+	{
+		RESIDENCY_GROUP group;
+		ResidencyMemory memory;
+		bool isCached;
+		bool isDiscarded;
+		ResidencyEviction eviction;
+		std::list<const void*>::iterator cachedIterator;
+	};
+
+protected:
+	std::unordered_map<const void*, Entry> _entries;
+	std::list<const void*> _cachedEntries;
+
+	ResidencyMemory _residentMemory [RESIDENCY_GROUPS_COUNT];
+	ResidencyMemory _cachedMemory [RESIDENCY_GROUPS_COUNT];
+	std::size_t _residentCount [RESIDENCY_GROUPS_COUNT];
+	std::size_t _cachedCount [RESIDENCY_GROUPS_COUNT];
+	std::size_t _budgets [RESIDENCY_GROUPS_COUNT];
+	std::size_t _cacheBudget;
+	std::size_t _cacheCapacity;
+
+	std::size_t _reusesCount;
+	std::size_t _evictionsCount;
+
+public:
+	ResidencyCache ();
+
+	void SetBudget (RESIDENCY_GROUP group, std::size_t budget);
+	void SetCacheBudget (std::size_t cacheBudget);
+	void SetCacheCapacity (std::size_t cacheCapacity);
+
+	void Track (const void* object, RESIDENCY_GROUP group, const ResidencyMemory& memory);
+	void Untrack (const void* object);
+
+	bool Release (const void* object, const ResidencyEviction& eviction);
+	bool Reuse (const void* object);
+	void Discard (const void* object);
+
+	std::vector<ResidencyEviction> Evict ();
+	std::vector<ResidencyEviction> EvictAll ();
+
+	std::size_t GetBudget (RESIDENCY_GROUP group) const;
+	std::size_t GetCacheBudget () const;
+	std::size_t GetCacheCapacity () const;
+	const ResidencyMemory& GetResidentMemory (RESIDENCY_GROUP group) const;
+	const ResidencyMemory& GetCachedMemory (RESIDENCY_GROUP group) const;
+	std::size_t GetResidentCount (RESIDENCY_GROUP group) const;
+	std::size_t GetCachedCount (RESIDENCY_GROUP group) const;
+	std::size_t GetGroupMemory (RESIDENCY_GROUP group) const;
+	std::size_t GetCacheMemory () const;
+	std::size_t GetReusesCount () const;
+	std::size_t GetEvictionsCount () const;
+protected:
+	void AddMemory (ResidencyMemory& total, const ResidencyMemory& memory);
+	void SubtractMemory (ResidencyMemory& total, const ResidencyMemory& memory);
+
+	ResidencyEviction EvictEntry (std::unordered_map<const void*, Entry>::iterator itEntry);
+};
+
+#endif
\ No newline at end of file
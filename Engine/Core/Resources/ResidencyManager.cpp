@@ -0,0 +1,151 @@
+#include "ResidencyManager.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "ResidencyStatisticsObject.h"
+
+ResidencyManager::ResidencyManager () :
+	_isCaching (false)
+{
+
+}
+
+ResidencyManager::~ResidencyManager ()
+{
+
+}
+
+SPECIALIZE_SINGLETON(ResidencyManager)
+
+void ResidencyManager::Init ()
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	_isCaching = SettingsManager::Instance ()->GetValue<bool> ("Resources", "residency_cache", true);
+
+	/*
+	 * Budgets are given in megabytes
+	*/
+
+	std::size_t megabyte = 1024 * 1024;
+
+	_cache.SetCacheBudget (megabyte * SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_cache_mb", 256));
+	_cache.SetCacheCapacity (SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_cache_entries", 1024));
+
+	_cache.SetBudget (RESIDENCY_MODELS, megabyte * SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_models_mb", 1024));
+	_cache.SetBudget (RESIDENCY_TEXTURES, megabyte * SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_textures_mb", 2048));
+	_cache.SetBudget (RESIDENCY_SHADERS, megabyte * SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_shaders_mb", 64));
+	_cache.SetBudget (RESIDENCY_AUDIO, megabyte * SettingsManager::Instance ()->GetValue<int> ("Resources", "residency_audio_mb", 256));
+}
+
+void ResidencyManager::Track (const void* object, const ResidentObjectI* resident)
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	_cache.Track (object, resident->GetResidencyGroup (), resident->GetResidencyMemory ());
+}
+
+void ResidencyManager::Untrack (const void* object)
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	_cache.Untrack (object);
+}
+
+bool ResidencyManager::Release (const void* object, const ResidencyEviction& eviction)
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	if (_isCaching == false) {
+		return false;
+	}
+
+	return _cache.Release (object, eviction);
+}
+
+void ResidencyManager::Reuse (const void* object, const ResidentObjectI* resident)
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	/*
+	 * The entry is gone when the resource was picked for eviction but
+	 * was loaded again before it got destroyed
+	*/
+
+	if (_cache.Reuse (object) == false) {
+		_cache.Track (object, resident->GetResidencyGroup (), resident->GetResidencyMemory ());
+	}
+}
+
+void ResidencyManager::Discard (const void* object)
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	_cache.Discard (object);
+}
+
+void ResidencyManager::Update ()
+{
+	std::vector<ResidencyEviction> evictions;
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		evictions = _cache.Evict ();
+	}
+
+	/*
+	 * Destroying a resource releases the ones it holds, which come back
+	 * here, so the evictions run without the lock
+	*/
+
+	for (const ResidencyEviction& eviction : evictions) {
+		eviction ();
+	}
+
+	UpdateStatistics ();
+}
+
+void ResidencyManager::Clear ()
+{
+	std::vector<ResidencyEviction> evictions;
+
+	{
+		std::lock_guard<std::mutex> lock (_mutex);
+
+		_isCaching = false;
+
+		evictions = _cache.EvictAll ();
+	}
+
+	for (const ResidencyEviction& eviction : evictions) {
+		eviction ();
+	}
+
+	UpdateStatistics ();
+}
+
+void ResidencyManager::UpdateStatistics ()
+{
+	std::lock_guard<std::mutex> lock (_mutex);
+
+	auto residencyStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ResidencyStatisticsObject> ();
+
+	for (std::size_t index = 0; index < RESIDENCY_GROUPS_COUNT; index ++) {
+		RESIDENCY_GROUP group = (RESIDENCY_GROUP) index;
+
+		residencyStatisticsObject->CPUMemory [group] = _cache.GetResidentMemory (group).cpuMemory;
+		residencyStatisticsObject->GPUMemory [group] = _cache.GetResidentMemory (group).gpuMemory;
+		residencyStatisticsObject->CachedMemory [group] = _cache.GetCachedMemory (group).cpuMemory +
+			_cache.GetCachedMemory (group).gpuMemory;
+		residencyStatisticsObject->BudgetMemory [group] = _cache.GetBudget (group);
+		residencyStatisticsObject->ResidentCount [group] = _cache.GetResidentCount (group);
+		residencyStatisticsObject->CachedCount [group] = _cache.GetCachedCount (group);
+	}
+
+	residencyStatisticsObject->CacheMemory = _cache.GetCacheMemory ();
+	residencyStatisticsObject->CacheBudgetMemory = _cache.GetCacheBudget ();
+	residencyStatisticsObject->ReusesCount = _cache.GetReusesCount ();
+	residencyStatisticsObject->EvictionsCount = _cache.GetEvictionsCount ();
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef RESIDENCYMANAGER_H
+#define RESIDENCYMANAGER_H
+
+#include "Core/Singleton/Singleton.h"
+
+#include <mutex>
+
+#include "ResidencyCache.h"
+
+/*
+ * Keeps count of the memory held by the loaded resources and decides
+ * when the released ones are destroyed. Released resources stay in the
+ * resource registry until the cache needs their memory, so switching
+ * back and forth between scenes reloads nothing. Evictions run once a
+ * frame on the render thread, where the views may delete their device
+ * objects.
+*/
+
+class ENGINE_API ResidencyManager : public Singleton<ResidencyManager>
+{
+	friend Singleton<ResidencyManager>;
+
+	DECLARE_SINGLETON(ResidencyManager)
+
+protected:
+	std::mutex _mutex;
+	ResidencyCache _cache;
+	bool _isCaching;
+
+public:
+	void Init ();
+
+	void Track (const void* object, const ResidentObjectI* resident);
+	void Untrack (const void* object);
+
+	bool Release (const void* object, const ResidencyEviction& eviction);
+	void Reuse (const void* object, const ResidentObjectI* resident);
+	void Discard (const void* object);
+
+	void Update ();
+
+	void Clear ();
+protected:
+	void UpdateStatistics ();
+private:
+	ResidencyManager ();
+	~ResidencyManager ();
+	ResidencyManager (const ResidencyManager&);
+	ResidencyManager& operator=(const ResidencyManager&);
+};
+
+#endif
\ No newline at end of file
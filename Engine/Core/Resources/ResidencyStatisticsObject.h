@@ -0,0 +1,24 @@
+#ifndef RESIDENCYSTATISTICSOBJECT_H
+#define RESIDENCYSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+#include "ResidentObjectI.h"
+
+struct ENGINE_API ResidencyStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(ResidencyStatisticsObject)
+
+	std::size_t CPUMemory [RESIDENCY_GROUPS_COUNT];
+	std::size_t GPUMemory [RESIDENCY_GROUPS_COUNT];
+	std::size_t CachedMemory [RESIDENCY_GROUPS_COUNT];
+	std::size_t BudgetMemory [RESIDENCY_GROUPS_COUNT];
+	std::size_t ResidentCount [RESIDENCY_GROUPS_COUNT];
+	std::size_t CachedCount [RESIDENCY_GROUPS_COUNT];
+	std::size_t CacheMemory;
+	std::size_t CacheBudgetMemory;
+	std::size_t ReusesCount;
+	std::size_t EvictionsCount;
+};
+
+#endif
\ No newline at end of file
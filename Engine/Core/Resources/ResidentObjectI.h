@@ -0,0 +1,36 @@
+#ifndef RESIDENTOBJECTI_H
+#define RESIDENTOBJECTI_H
+
+#include <cstddef>
+
+enum RESIDENCY_GROUP
+{
+	RESIDENCY_MODELS = 0,
+	RESIDENCY_TEXTURES,
+	RESIDENCY_SHADERS,
+	RESIDENCY_AUDIO,
+	RESIDENCY_GROUPS_COUNT
+};
+
+struct ENGINE_API ResidencyMemory
+{
+	std::size_t cpuMemory;
+	std::size_t gpuMemory;
+};
+
+/*
+ * A resource that reports the memory it holds, on the CPU side and in
+ * device allocations. Its handles are accounted by the residency manager
+ * and, once the last one is released, it may be kept around for reuse.
+*/
+
+class ENGINE_API ResidentObjectI
+{
+public:
+	virtual ~ResidentObjectI () {}
+
+	virtual RESIDENCY_GROUP GetResidencyGroup () const = 0;
+	virtual ResidencyMemory GetResidencyMemory () const = 0;
+};
+
+#endif
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include "Core/Interfaces/Object.h"
 
 #include <map>
+#include <mutex>
+#include <type_traits>
+
+#include "ResidencyManager.h"
 
 template <class T>
 class Resource : public Object
@@ -15,6 +19,22 @@ private:
 	static std::map<T*, std::pair<std::string, std::size_t*>> _sources;
 	static std::map<std::string, T*> _paths;
 
+	/*
+	 * Handles are created and released from the loader threads as well,
+	 * every access to the registry and to the counters is guarded
+	*/
+
+	static std::recursive_mutex _mutex;
+
+	/*
+	 * Resources that report their memory are accounted by the residency
+	 * manager. When their last handle is released they stay registered
+	 * with a zero counter, so a later load of the same path gets them
+	 * back, until the manager evicts them.
+	*/
+
+	static constexpr bool IsResident = std::is_base_of<ResidentObjectI, T>::value;
+
 public:
 	Resource (T* = nullptr, const std::string& path = "");
 	~Resource ();
@@ -33,6 +53,10 @@ public:
 
 	const std::string& GetPath () const;
 	static Resource<T> GetResource (const std::string& path);
+private:
+	void Release ();
+
+	static void Evict (T* source);
 };
 
 template <class T>
@@ -41,6 +65,9 @@ std::map<T*, std::pair<std::string, std::size_t*>> Resource<T>::_sources;
 template <class T>
 std::map<std::string, T*> Resource<T>::_paths;
 
+template <class T>
+std::recursive_mutex Resource<T>::_mutex;
+
 template <class T>
 Resource<T>::Resource (T* source, const std::string& path) :
 	_source (source),
@@ -50,18 +77,42 @@ Resource<T>::Resource (T* source, const std::string& path) :
 		return;
 	}
 
+	std::lock_guard<std::recursive_mutex> lock (_mutex);
+
 	auto itSource = _sources.find (source);
 
 	if (itSource == _sources.end ()) {
 		_counter = new std::size_t (0);
 		_sources [_source] = std::pair<std::string, std::size_t*> (path, _counter);
 
+		if constexpr (IsResident) {
+
+			/*
+			 * A released copy of the same path can not be reached anymore
+			*/
+
+			auto itPaths = _paths.find (path);
+			auto itReleased = itPaths != _paths.end () ? _sources.find (itPaths->second) : _sources.end ();
+
+			if (itReleased != _sources.end () && *itReleased->second.second == 0) {
+				ResidencyManager::Instance ()->Discard (itReleased->first);
+			}
+
+			ResidencyManager::Instance ()->Track (_source, _source);
+		}
+
 		//TODO: Fix this
 		_paths [path] = _source;
 	}
 
 	if (itSource != _sources.end ()) {
 		_counter = itSource->second.second;
+
+		if constexpr (IsResident) {
+			if (*_counter == 0) {
+				ResidencyManager::Instance ()->Reuse (_source, _source);
+			}
+		}
 	}
 
 	(*_counter) ++;
@@ -76,31 +127,15 @@ Resource<T>::Resource (const Resource& other) :
 		return;
 	}
 
+	std::lock_guard<std::recursive_mutex> lock (_mutex);
+
 	(*_counter) ++;
 }
 
 template <class T>
 Resource<T>::~Resource ()
 {
-	if (_source == nullptr) {
-		return;
-	}
-
-	(*_counter) --;
-
-	if (*_counter == 0) {
-		auto itSource = _sources.find (_source);
-
-		if (itSource == _sources.end ()) {
-			//TODO: Fix this
-		}
-
-		_paths.erase (itSource->second.first);
-		_sources.erase (_source);
-
-		delete _source;
-		delete _counter;
-	}
+	Release ();
 }
 
 template <class T>
@@ -134,23 +169,9 @@ Resource<T>& Resource<T>::operator= (const Resource<T>& other)
 		return *this;
 	}
 
-	if (_source != nullptr) {
-		(*_counter) --;
+	Release ();
 
-		if (*_counter == 0) {
-			auto itSource = _sources.find (_source);
-
-			if (itSource == _sources.end ()) {
-				//TODO: Fix this
-			}
-
-			_paths.erase (itSource->second.first);
-			_sources.erase (_source);
-
-			delete _source;
-			delete _counter;
-		}
-	}
+	std::lock_guard<std::recursive_mutex> lock (_mutex);
 
 	_source = other._source;
 	_counter = other._counter;
@@ -195,6 +216,8 @@ bool Resource<T>::operator!= (std::nullptr_t check) const
 template <class T>
 Resource<T> Resource<T>::GetResource (const std::string& path)
 {
+	std::lock_guard<std::recursive_mutex> lock (_mutex);
+
 	auto itPaths = _paths.find (path);
 
 	if (itPaths == _paths.end ()) {
@@ -207,6 +230,8 @@ Resource<T> Resource<T>::GetResource (const std::string& path)
 template <class T>
 const std::string& Resource<T>::GetPath () const
 {
+	std::lock_guard<std::recursive_mutex> lock (_mutex);
+
 	auto itResource = _sources.find (_source);
 
 	// if (itResource == _sources.end ()) {
@@ -216,4 +241,94 @@ const std::string& Resource<T>::GetPath () const
 	return itResource->second.first;
 }
 
+template <class T>
+void Resource<T>::Release ()
+{
+	if (_source == nullptr) {
+		return;
+	}
+
+	T* source = _source;
+	std::size_t* counter = _counter;
+
+	_source = nullptr;
+	_counter = nullptr;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock (_mutex);
+
+		(*counter) --;
+
+		if (*counter > 0) {
+			return;
+		}
+
+		auto itSource = _sources.find (source);
+
+		/*
+		 * Two threads may have loaded the same path, keep the entry when
+		 * it already points to the other copy
+		*/
+
+		auto itPaths = _paths.find (itSource->second.first);
+
+		if constexpr (IsResident) {
+			if (itSource->second.first != std::string () && itPaths != _paths.end () && itPaths->second == source &&
+				ResidencyManager::Instance ()->Release (source, [source] () { Evict (source); })) {
+				return;
+			}
+		}
+
+		if (itPaths != _paths.end () && itPaths->second == source) {
+			_paths.erase (itPaths);
+		}
+
+		_sources.erase (itSource);
+	}
+
+	if constexpr (IsResident) {
+		ResidencyManager::Instance ()->Untrack (source);
+	}
+
+	/*
+	 * Destroy outside of the lock, the resource may release others
+	*/
+
+	delete source;
+	delete counter;
+}
+
+template <class T>
+void Resource<T>::Evict (T* source)
+{
+	std::size_t* counter = nullptr;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock (_mutex);
+
+		auto itSource = _sources.find (source);
+
+		/*
+		 * Loaded again since it was picked for eviction
+		*/
+
+		if (itSource == _sources.end () || *itSource->second.second > 0) {
+			return;
+		}
+
+		counter = itSource->second.second;
+
+		auto itPaths = _paths.find (itSource->second.first);
+
+		if (itPaths != _paths.end () && itPaths->second == source) {
+			_paths.erase (itPaths);
+		}
+
+		_sources.erase (itSource);
+	}
+
+	delete source;
+	delete counter;
+}
+
 #endif
\ No newline at end of file
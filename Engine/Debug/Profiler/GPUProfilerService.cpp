@@ -21,7 +21,8 @@ void GPUProfilerEntry::Evaluate ()
 }
 
 GPUProfilerService::GPUProfilerService () :
-	_startFrameQuery (0)
+	_startFrameQuery (0),
+	_isRequired (false)
 {
 	GL::GenQueries (1, &_lastStartFrameQuery);
 	GL::GenQueries (1, &_startFrameQuery);
@@ -35,7 +36,7 @@ GPUProfilerService::~GPUProfilerService ()
 
 void GPUProfilerService::StartFrame ()
 {
-	_isActive = _nextActive;
+	_isActive = _nextActive || _isRequired;
 
 	/*
 	 * Clear last frame queue
@@ -72,6 +73,11 @@ void GPUProfilerService::StartFrame ()
 	GL::QueryCounter (_startFrameQuery, GL_TIMESTAMP);
 }
 
+void GPUProfilerService::SetRequired (bool isRequired)
+{
+	_isRequired = isRequired;
+}
+
 const std::vector<ProfilerEntry*>& GPUProfilerService::GetLastFrameEvents () const
 {
 	return _lastFrameQueue2;
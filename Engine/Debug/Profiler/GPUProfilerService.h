@@ -26,12 +26,21 @@ protected:
 
 	float _lastFrameTime;
 
+	bool _isRequired;
+
 public:
 	GPUProfilerService ();
 	~GPUProfilerService ();
 
 	void StartFrame ();
 
+	/*
+	 * Keeps the timings recorded while something depends on them,
+	 * even if the profiler itself is paused
+	*/
+
+	void SetRequired (bool isRequired);
+
 	const std::vector<ProfilerEntry*>& GetLastFrameEvents () const;
 
 	uint64_t GetStartTime () const;
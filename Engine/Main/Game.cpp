@@ -13,12 +13,16 @@
 #include "Arguments/ArgumentsAnalyzer.h"
 
 #include "Renderer/RenderManager.h"
+#include "Renderer/Readback/ReadbackManager.h"
 
 #include "Managers/SceneManager.h"
+#include "Managers/ResourceStreamer.h"
+#include "Audio/AudioManager.h"
 #include "Managers/CameraManager.h"
 #include "Managers/RenderSettingsManager.h"
 
 #include "Core/Console/Console.h"
+#include "Core/Resources/ResidencyManager.h"
 
 #include "GameModule.h"
 
@@ -114,6 +118,8 @@ void Game::UpdateScene()
 {
 	PROFILER_LOGGER("Update")
 
+	ResourceStreamer::Instance ()->Update ();
+	ReadbackManager::Instance ()->Update ();
 	SceneManager::Instance ()->Update ();
 
 	SceneManager::Instance ()->Current ()->Update ();
@@ -121,7 +127,9 @@ void Game::UpdateScene()
 	_gameModule->UpdateScene ();
 
 	ComponentManager::Instance ()->Update ();
+	AudioManager::Instance ()->Update ();
 	PhysicsManager::Instance ()->Update ();
+	ResidencyManager::Instance ()->Update ();
 	//SettingsManager::Instance ()->Update ();
 }
 
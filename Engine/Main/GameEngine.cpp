@@ -10,12 +10,17 @@
 #include "Systems/GUI/GUI.h"
 
 #include "Managers/SceneManager.h"
+#include "Managers/ResourceStreamer.h"
+#include "Audio/AudioManager.h"
 #include "Renderer/RenderManager.h"
 #include "Renderer/RenderModuleManager.h"
+#include "Renderer/RenderTargets/RenderTargetPool.h"
+#include "Renderer/Readback/ReadbackManager.h"
 
 #include "Arguments/ArgumentsAnalyzer.h"
 
 #include "Core/Console/Console.h"
+#include "Core/Resources/ResidencyManager.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -60,14 +65,25 @@ void GameEngine::Init ()
 
 	Pipeline::Init ();
 
+	ResidencyManager::Instance ()->Init ();
+
+	ResourceStreamer::Instance ()->Init ();
+
+	AudioManager::Instance ()->Init ();
+
 	InitScene ();
 }
 
 void GameEngine::Clear ()
 {
+	ResourceStreamer::Instance ()->Clear ();
 	SceneManager::Instance()->Clear();
+	AudioManager::Instance ()->Clear ();
 	RenderManager::Instance()->Clear();
 	RenderModuleManager::Instance ()->Clear ();
+	RenderTargetPool::Instance ()->Clear ();
+	ReadbackManager::Instance ()->Clear ();
+	ResidencyManager::Instance ()->Clear ();
 
 	Pipeline::Clear ();
 
@@ -130,6 +146,16 @@ void GameEngine::InitOpenGL ()
 	} else {
 		Console::LogError ("OpenGL 4.5 not supported");
 	}
+
+	/*
+	 * Let the driver compile shaders on as many threads as it wants
+	*/
+
+	if (GLEW_ARB_parallel_shader_compile) {
+		GL::MaxShaderCompilerThreads (0xFFFFFFFF);
+
+		Console::Log ("Parallel shader compilation enabled");
+	}
 }
 
 void GameEngine::InitScene ()
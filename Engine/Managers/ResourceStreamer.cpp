@@ -0,0 +1,275 @@
+#include "ResourceStreamer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Resources/Resources.h"
+#include "Renderer/RenderSystem.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
+#include "Core/Console/Console.h"
+
+#define MAX_LOADER_THREADS 4
+
+ResourceStreamer::ResourceStreamer () :
+	_runningJobs (0),
+	_isRunning (false),
+	_uploadBudget (0.0f)
+{
+
+}
+
+ResourceStreamer::~ResourceStreamer ()
+{
+	Clear ();
+}
+
+SPECIALIZE_SINGLETON(ResourceStreamer)
+
+void ResourceStreamer::Init ()
+{
+	if (_isRunning == true) {
+		return;
+	}
+
+	/*
+	 * Leave a core for the render thread
+	*/
+
+	int defaultThreadsCount = std::max (1, std::min ((int) std::thread::hardware_concurrency () - 1, MAX_LOADER_THREADS));
+
+	int threadsCount = SettingsManager::Instance ()->GetValue<int> ("Resources", "loader_threads", defaultThreadsCount);
+	threadsCount = std::max (1, threadsCount);
+
+	_uploadBudget = SettingsManager::Instance ()->GetValue<float> ("Resources", "upload_budget_ms", 2.0f);
+
+	_isRunning = true;
+
+	for (int i=0;i<threadsCount;i++) {
+		_workers.push_back (std::thread (&ResourceStreamer::ProcessJobs, this));
+	}
+
+	Console::Log ("Resource streamer started with " + std::to_string (threadsCount) + " loader threads");
+}
+
+std::shared_future<Resource<Model>> ResourceStreamer::LoadModelAsync (const std::string& filename)
+{
+	auto it = _models.find (filename);
+
+	if (it != _models.end ()) {
+		return it->second;
+	}
+
+	auto promise = std::make_shared<std::promise<Resource<Model>>> ();
+	std::shared_future<Resource<Model>> future = promise->get_future ().share ();
+
+	_models [filename] = future;
+
+	EnqueueJob ([this, filename, promise] () {
+		Resource<Model> model = Resources::LoadModel (filename);
+
+		/*
+		 * Queue the uploads before the future is ready, so that a ready
+		 * model always has its textures on the way to the GPU
+		*/
+
+		EnqueueMaterialUploads (model);
+
+		/*
+		 * Drop the entry on the render thread, which owns the map. A load
+		 * that failed is tried again on the next request
+		*/
+
+		EnqueueUpload ([this, filename] () {
+			_models.erase (filename);
+		});
+
+		promise->set_value (model);
+	});
+
+	return future;
+}
+
+void ResourceStreamer::EnqueueJob (const std::function<void ()>& job)
+{
+	/*
+	 * Without loader threads the job runs right away
+	*/
+
+	if (_isRunning == false) {
+		job ();
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock (_jobsMutex);
+
+		_jobs.push_back (job);
+	}
+
+	_jobsCondition.notify_one ();
+}
+
+void ResourceStreamer::EnqueueUpload (const std::function<void ()>& upload)
+{
+	std::lock_guard<std::mutex> lock (_uploadsMutex);
+
+	_uploads.push_back (upload);
+}
+
+void ResourceStreamer::Update ()
+{
+	auto startTime = std::chrono::high_resolution_clock::now ();
+
+	/*
+	 * Run at least one upload every frame, so that a budget smaller than
+	 * a single upload doesn't stall the streaming
+	*/
+
+	while (true) {
+		std::function<void ()> upload;
+
+		{
+			std::lock_guard<std::mutex> lock (_uploadsMutex);
+
+			if (_uploads.empty ()) {
+				break;
+			}
+
+			upload = std::move (_uploads.front ());
+			_uploads.pop_front ();
+		}
+
+		upload ();
+
+		std::chrono::duration<float, std::milli> elapsedTime = std::chrono::high_resolution_clock::now () - startTime;
+
+		if (elapsedTime.count () >= _uploadBudget) {
+			break;
+		}
+	}
+}
+
+bool ResourceStreamer::IsIdle ()
+{
+	{
+		std::lock_guard<std::mutex> lock (_jobsMutex);
+
+		if (!_jobs.empty () || _runningJobs > 0) {
+			return false;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock (_uploadsMutex);
+
+	return _uploads.empty ();
+}
+
+void ResourceStreamer::Release ()
+{
+	_models.clear ();
+
+	_textureViews.clear ();
+}
+
+void ResourceStreamer::Clear ()
+{
+	{
+		std::lock_guard<std::mutex> lock (_jobsMutex);
+
+		_isRunning = false;
+		_jobs.clear ();
+	}
+
+	_jobsCondition.notify_all ();
+
+	for (std::thread& worker : _workers) {
+		worker.join ();
+	}
+
+	_workers.clear ();
+
+	{
+		std::lock_guard<std::mutex> lock (_uploadsMutex);
+
+		_uploads.clear ();
+	}
+
+	Release ();
+}
+
+void ResourceStreamer::ProcessJobs ()
+{
+	while (true) {
+		std::function<void ()> job;
+
+		{
+			std::unique_lock<std::mutex> lock (_jobsMutex);
+
+			_jobsCondition.wait (lock, [this] () {
+				return _isRunning == false || !_jobs.empty ();
+			});
+
+			if (_isRunning == false) {
+				return;
+			}
+
+			job = std::move (_jobs.front ());
+			_jobs.pop_front ();
+
+			_runningJobs ++;
+		}
+
+		job ();
+
+		std::lock_guard<std::mutex> lock (_jobsMutex);
+
+		_runningJobs --;
+	}
+}
+
+void ResourceStreamer::EnqueueTextureUpload (const Resource<Texture>& texture)
+{
+	if (texture == nullptr) {
+		return;
+	}
+
+	/*
+	 * The texture views are kept until the scene takes its own references,
+	 * later lookups by path find them already on the GPU
+	*/
+
+	EnqueueUpload ([this, texture] () {
+		_textureViews.push_back (RenderSystem::LoadTexture (texture));
+	});
+}
+
+void ResourceStreamer::EnqueueMaterialUploads (const Resource<Model>& model)
+{
+	if (model == nullptr) {
+		return;
+	}
+
+	for_each_type (ObjectModel*, objModel, *model) {
+		for (PolygonGroup* polyGroup : *objModel) {
+			Resource<Material> material = polyGroup->GetMaterial ();
+
+			if (material == nullptr) {
+				continue;
+			}
+
+			Resource<Texture> textures [] = {
+				material->ambientTexture, material->diffuseTexture,
+				material->specularTexture, material->emissiveTexture,
+				material->specularHighlight, material->alphaTexture,
+				material->bumpTexture
+			};
+
+			for (const Resource<Texture>& texture : textures) {
+				EnqueueTextureUpload (texture);
+			}
+		}
+	}
+}
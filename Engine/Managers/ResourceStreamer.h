@@ -0,0 +1,84 @@
+#ifndef RESOURCESTREAMER_H
+#define RESOURCESTREAMER_H
+
+#include "Core/Singleton/Singleton.h"
+
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <future>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <map>
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Mesh/Model.h"
+#include "Renderer/Render/Texture/Texture.h"
+#include "Renderer/RenderViews/TextureView.h"
+
+/*
+ * Reading and decoding of resources runs on a small pool of loader
+ * threads. Everything that touches the GL context is queued back and
+ * drained on the render thread, a few milliseconds every frame.
+*/
+
+class ENGINE_API ResourceStreamer : public Singleton<ResourceStreamer>
+{
+	friend Singleton<ResourceStreamer>;
+
+	DECLARE_SINGLETON(ResourceStreamer)
+
+private:
+	std::vector<std::thread> _workers;
+
+	std::deque<std::function<void ()>> _jobs;
+	std::deque<std::function<void ()>> _uploads;
+
+	std::mutex _jobsMutex;
+	std::mutex _uploadsMutex;
+	std::condition_variable _jobsCondition;
+
+	std::size_t _runningJobs;
+	bool _isRunning;
+
+	float _uploadBudget;
+
+	/*
+	 * Only the loads in flight are kept, a finished one is forgotten so
+	 * that the callers alone own the model
+	*/
+
+	std::map<std::string, std::shared_future<Resource<Model>>> _models;
+
+	std::vector<Resource<TextureView>> _textureViews;
+
+public:
+	void Init ();
+
+	std::shared_future<Resource<Model>> LoadModelAsync (const std::string& filename);
+
+	void EnqueueJob (const std::function<void ()>& job);
+	void EnqueueUpload (const std::function<void ()>& upload);
+
+	void Update ();
+
+	bool IsIdle ();
+
+	void Release ();
+
+	void Clear ();
+private:
+	ResourceStreamer ();
+	~ResourceStreamer ();
+	ResourceStreamer (const ResourceStreamer&);
+	ResourceStreamer& operator=(const ResourceStreamer&);
+
+	void ProcessJobs ();
+
+	void EnqueueTextureUpload (const Resource<Texture>& texture);
+	void EnqueueMaterialUploads (const Resource<Model>& model);
+};
+
+#endif
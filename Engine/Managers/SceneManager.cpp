@@ -1,7 +1,13 @@
 #include "SceneManager.h"
 
+#include <algorithm>
+
 #include "Resources/SceneLoader.h"
 
+#include "ResourceStreamer.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
 #include "Core/Console/Console.h"
 
 #define SCENE_LOADING_ERROR_CODE 10
@@ -9,7 +15,9 @@
 SceneManager::SceneManager () :
 	_current (nullptr),
 	_needCreateNewScene (false),
-	_needToLoad (false)
+	_needToLoad (false),
+	_isStreaming (false),
+	_worstFrameTime (0.0f)
 {
 
 }
@@ -39,9 +47,23 @@ void SceneManager::Update ()
 	}
 
 	if (_needToLoad == true) {
-		LoadNextScene (_nextSceneName);
+		if (_isStreaming == false) {
+			StreamNextScene (_nextSceneName);
+		}
+
+		if (UpdateStreaming () == true) {
+			LoadNextScene (_nextSceneName);
+
+			/*
+			 * The scene holds its own references from now on
+			*/
 
-		_needToLoad = false;
+			_streamedModels.clear ();
+			ResourceStreamer::Instance ()->Release ();
+
+			_isStreaming = false;
+			_needToLoad = false;
+		}
 	}
 }
 
@@ -49,6 +71,9 @@ void SceneManager::Load (const std::string& sceneName)
 {
 	_needToLoad = true;
 	_nextSceneName = sceneName;
+
+	_isStreaming = false;
+	_streamedModels.clear ();
 }
 
 void SceneManager::Clear ()
@@ -90,4 +115,66 @@ void SceneManager::LoadNextScene (const std::string& sceneName)
 		Console::LogError ("An error occured while tryng to load " + sceneName);
 		std::exit(SCENE_LOADING_ERROR_CODE);
 	}
-}
\ No newline at end of file
+}
+
+void SceneManager::StreamNextScene (const std::string& sceneName)
+{
+	_isStreaming = true;
+
+	_streamStart = std::chrono::high_resolution_clock::now ();
+	_lastFrame = _streamStart;
+	_worstFrameTime = 0.0f;
+
+	bool asyncLoading = SettingsManager::Instance ()->GetValue<bool> ("Resources", "async_loading", false);
+
+	if (asyncLoading == false) {
+		return;
+	}
+
+	/*
+	 * Prefetch the models of the scene in the background, the old scene
+	 * keeps running until everything is resident
+	*/
+
+	std::vector<std::string> modelPaths = SceneLoader::Instance ().GetModelPaths (sceneName);
+
+	for (const std::string& modelPath : modelPaths) {
+		_streamedModels.push_back (ResourceStreamer::Instance ()->LoadModelAsync (modelPath));
+	}
+
+	if (_current == nullptr) {
+		CreateNewScene ();
+	}
+}
+
+bool SceneManager::UpdateStreaming ()
+{
+	if (_streamedModels.empty ()) {
+		return true;
+	}
+
+	auto currentFrame = std::chrono::high_resolution_clock::now ();
+
+	std::chrono::duration<float, std::milli> frameTime = currentFrame - _lastFrame;
+	_worstFrameTime = std::max (_worstFrameTime, frameTime.count ());
+
+	_lastFrame = currentFrame;
+
+	for (const auto& model : _streamedModels) {
+		if (model.wait_for (std::chrono::seconds (0)) != std::future_status::ready) {
+			return false;
+		}
+	}
+
+	if (ResourceStreamer::Instance ()->IsIdle () == false) {
+		return false;
+	}
+
+	std::chrono::duration<float, std::milli> streamTime = currentFrame - _streamStart;
+
+	Console::Log ("Scene \"" + _nextSceneName + "\" streamed " + std::to_string (_streamedModels.size ()) +
+		" models in " + std::to_string (streamTime.count ()) + " ms, worst frame " +
+		std::to_string (_worstFrameTime) + " ms");
+
+	return true;
+}
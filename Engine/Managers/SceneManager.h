@@ -4,9 +4,15 @@
 #include "Core/Singleton/Singleton.h"
 
 #include <string>
+#include <vector>
+#include <future>
+#include <chrono>
 
 #include "SceneGraph/Scene.h"
 
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Mesh/Model.h"
+
 class ENGINE_API SceneManager : public Singleton<SceneManager>
 {
 	friend Singleton<SceneManager>;
@@ -20,6 +26,12 @@ private:
 	bool _needToLoad;
 	std::string _nextSceneName;
 
+	bool _isStreaming;
+	std::vector<std::shared_future<Resource<Model>>> _streamedModels;
+	std::chrono::time_point<std::chrono::high_resolution_clock> _streamStart;
+	std::chrono::time_point<std::chrono::high_resolution_clock> _lastFrame;
+	float _worstFrameTime;
+
 public:
 	void Update ();
 
@@ -37,6 +49,9 @@ private:
 
 	void CreateNewScene ();
 	void LoadNextScene (const std::string&);
+
+	void StreamNextScene (const std::string&);
+	bool UpdateStreaming ();
 };
 
 #endif
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include "RenderPasses/ReflectiveShadowMapping/RSMSamplesGenerationRenderPass.h"
 #include "RenderPasses/ReflectiveShadowMapping/RSMInterpolatedIndirectDiffuseLightRenderPass.h"
 #include "RenderPasses/ReflectiveShadowMapping/RSMIndirectDiffuseLightRenderPass.h"
+#include "RenderPasses/ReflectiveShadowMapping/RSMTemporalAccumulationRenderPass.h"
 #include "RenderPasses/ReflectiveShadowMapping/RSMIndirectSpecularLightRenderPass.h"
 #include "RenderPasses/ReflectiveShadowMapping/RSMSubsurfaceScatteringRenderPass.h"
 #include "RenderPasses/ReflectiveShadowMapping/RSMDirectionalLightRenderPass.h"
@@ -69,6 +70,7 @@ void ReflectiveShadowMappingRenderModule::Init ()
 		.Attach (new RSMSamplesGenerationRenderPass ())
 		.Attach (new RSMInterpolatedIndirectDiffuseLightRenderPass ())
 		.Attach (new RSMIndirectDiffuseLightRenderPass ())
+		.Attach (new RSMTemporalAccumulationRenderPass ())
 		.Attach (new RSMIndirectSpecularLightRenderPass ())
 		.Attach (new RSMSubsurfaceScatteringRenderPass ())
 		.Attach (new RSMDirectionalLightRenderPass ())
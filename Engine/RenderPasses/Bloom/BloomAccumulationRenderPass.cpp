@@ -25,7 +25,7 @@ glm::ivec2 BloomAccumulationRenderPass::GetPostProcessVolumeResolution (const Re
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* BloomAccumulationRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> BloomAccumulationRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	/*
 	 * Create bloom accumulation framebuffer
@@ -47,7 +47,12 @@ FramebufferRenderVolume* BloomAccumulationRenderPass::CreatePostProcessVolume (c
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool BloomAccumulationRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
 
 std::vector<PipelineAttribute> BloomAccumulationRenderPass::GetCustomAttributes (const Camera* camera,
@@ -25,7 +25,7 @@ glm::ivec2 BrightExtractionRenderPass::GetPostProcessVolumeResolution (const Ren
 	return glm::ivec2 (glm::vec2 (settings.resolution.width, settings.resolution.height) * settings.bloom_scale);
 }
 
-FramebufferRenderVolume* BrightExtractionRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> BrightExtractionRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("blurMap"));
 
@@ -43,7 +43,12 @@ FramebufferRenderVolume* BrightExtractionRenderPass::CreatePostProcessVolume (co
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool BrightExtractionRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
 
 std::vector<PipelineAttribute> BrightExtractionRenderPass::GetCustomAttributes (const Camera* camera,
@@ -14,7 +14,8 @@ protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;	
 	glm::ivec2 GetPostProcessVolumeResolution (const RenderSettings& settings) const;
-	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+	Resource<Framebuffer> CreatePostProcessFramebuffer (const RenderSettings& settings) const;
+	bool IsPostProcessVolumeTransient () const;
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
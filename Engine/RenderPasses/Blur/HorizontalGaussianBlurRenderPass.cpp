@@ -10,7 +10,7 @@ std::string HorizontalGaussianBlurRenderPass::GetPostProcessVolumeName () const
 	return "BlurMapVolume";
 }
 
-FramebufferRenderVolume* HorizontalGaussianBlurRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> HorizontalGaussianBlurRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("blurMap"));
 
@@ -28,7 +28,12 @@ FramebufferRenderVolume* HorizontalGaussianBlurRenderPass::CreatePostProcessVolu
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool HorizontalGaussianBlurRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
 
 std::vector<PipelineAttribute> HorizontalGaussianBlurRenderPass::GetCustomAttributes (const Camera* camera,
@@ -10,7 +10,7 @@ std::string VerticalGaussianBlurRenderPass::GetPostProcessVolumeName () const
 	return "BlurMapVolume";
 }
 
-FramebufferRenderVolume* VerticalGaussianBlurRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> VerticalGaussianBlurRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("blurMap"));
 
@@ -28,7 +28,12 @@ FramebufferRenderVolume* VerticalGaussianBlurRenderPass::CreatePostProcessVolume
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool VerticalGaussianBlurRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
 
 std::vector<PipelineAttribute> VerticalGaussianBlurRenderPass::GetCustomAttributes (const Camera* camera,
@@ -8,7 +8,8 @@ class ENGINE_API VerticalGaussianBlurRenderPass : public PostProcessRenderPass
 protected:
 	std::string GetPostProcessFragmentShaderPath () const;
 	std::string GetPostProcessVolumeName () const;	
-	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+	Resource<Framebuffer> CreatePostProcessFramebuffer (const RenderSettings& settings) const;
+	bool IsPostProcessVolumeTransient () const;
 
 	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
@@ -1,5 +1,9 @@
 #include "ContainerRenderPass.h"
 
+#include "RenderPasses/PostProcess/FusedPostProcessRenderPass.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
 #include "Debug/Profiler/Profiler.h"
 
 ContainerRenderPass::ContainerRenderPass (
@@ -37,6 +41,16 @@ void ContainerRenderPass::Init (const RenderSettings& settings)
 	for (auto renderSubPass : _renderSubPasses) {
 		renderSubPass->Init (settings);
 	}
+
+	/*
+	 * Group adjacent per pixel post process passes
+	*/
+
+	bool postProcessFusion = SettingsManager::Instance ()->GetValue<bool> ("Engine", "post_process_fusion", true);
+
+	if (postProcessFusion == true) {
+		FusePostProcessSubPasses (settings);
+	}
 }
 
 RenderVolumeCollection* ContainerRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -78,6 +92,17 @@ bool ContainerRenderPass::IsAvailable (const RenderScene* renderScene, const Cam
 	return true;
 }
 
+bool ContainerRenderPass::IsPending () const
+{
+	for (auto renderSubPass : _renderSubPasses) {
+		if (renderSubPass->IsPending ()) {
+			return true;
+		}
+	}
+
+	return ContainerRenderSubPassI::IsPending ();
+}
+
 void ContainerRenderPass::Clear ()
 {
 	/*
@@ -89,6 +114,39 @@ void ContainerRenderPass::Clear ()
 	}
 }
 
+void ContainerRenderPass::FusePostProcessSubPasses (const RenderSettings& settings)
+{
+	std::vector<PostProcessFusionStage> stages;
+
+	for (auto renderSubPass : _renderSubPasses) {
+		PostProcessRenderPass* postProcessRenderPass = dynamic_cast<PostProcessRenderPass*> (renderSubPass);
+
+		stages.push_back (postProcessRenderPass != nullptr ?
+			postProcessRenderPass->GetPostProcessFusionStage (settings) : PostProcessFusionStage ());
+	}
+
+	auto groups = PostProcessFusion::Plan (stages);
+
+	/*
+	 * Replace every group with a single sub pass at its position
+	*/
+
+	for (auto group = groups.rbegin (); group != groups.rend (); group++) {
+		std::vector<PostProcessRenderPass*> renderSubPasses;
+		std::vector<PostProcessFusionStage> groupStages;
+
+		for (std::size_t index : *group) {
+			renderSubPasses.push_back ((PostProcessRenderPass*) _renderSubPasses [index]);
+			groupStages.push_back (stages [index]);
+		}
+
+		_renderSubPasses.erase (_renderSubPasses.begin () + group->front (),
+			_renderSubPasses.begin () + group->back () + 1);
+		_renderSubPasses.insert (_renderSubPasses.begin () + group->front (),
+			new FusedPostProcessRenderPass (renderSubPasses, groupStages));
+	}
+}
+
 ContainerRenderPassBuilder ContainerRenderPass::Builder ()
 {
 	ContainerRenderPassBuilder builder;
@@ -117,10 +175,10 @@ RenderVolumeCollection* ContainerRenderPass::IterateOverSubPasses (
 		PROFILER_GPU_LOGGER(renderSubPass->GetName ())
 
 		/*
-		 * Check if sub pass admits current volume
+		 * Check if sub pass shaders are built and it admits current volume
 		*/
 
-		if (!renderSubPass->IsAvailable (renderScene, camera, settings, rvc)) {
+		if (!renderSubPass->IsReady () || !renderSubPass->IsAvailable (renderScene, camera, settings, rvc)) {
 			continue;
 		}
 
@@ -31,6 +31,8 @@ public:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
 
+	bool IsPending () const;
+
 	void Clear ();
 
 	static ContainerRenderPassBuilder Builder ();
@@ -41,6 +43,8 @@ protected:
 
 	RenderVolumeCollection* IterateOverSubPasses (RenderVolumeI*, const RenderScene*, 
 		const Camera*, const RenderSettings&, RenderVolumeCollection*);
+
+	void FusePostProcessSubPasses (const RenderSettings& settings);
 };
 
 #endif
\ No newline at end of file
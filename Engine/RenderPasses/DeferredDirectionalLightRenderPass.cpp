@@ -16,7 +16,7 @@ void DeferredDirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredDirVolLightFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
 	 * Shader for directional light with shadow casting
@@ -27,7 +27,7 @@ void DeferredDirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredDirVolShadowMapLightFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shadowShader);
+	_shadowShaderView = LoadShader (shadowShader);
 }
 
 void DeferredDirectionalLightRenderPass::Clear ()
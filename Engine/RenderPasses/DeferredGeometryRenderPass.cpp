@@ -10,6 +10,7 @@
 #include "Core/Intersections/Intersection.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -47,7 +48,7 @@ void DeferredGeometryRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredGeometry.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
 	 * Shader for not animated normal mapped objects
@@ -59,7 +60,7 @@ void DeferredGeometryRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredNormalMapGeometry.glsl"
 	});
 
-	_normalMapShaderView = RenderSystem::LoadShader (normalMapShader);
+	_normalMapShaderView = LoadShader (normalMapShader);
 
 	/*
 	 * Shader for not animated light mapped objects
@@ -71,7 +72,7 @@ void DeferredGeometryRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredLightMapGeometry.glsl"
 	});
 
-	_lightMapShaderView = RenderSystem::LoadShader (lightMapShader);
+	_lightMapShaderView = LoadShader (lightMapShader);
 
 	/*
 	 * Shader for animations
@@ -83,7 +84,31 @@ void DeferredGeometryRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredGeometry.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
+
+	/*
+	 * Shader for instanced not animated objects
+	*/
+
+	Resource<Shader> instancedShader = Resources::LoadShader ({
+		"Assets/Shaders/deferredInstancedVertex.glsl",
+		"Assets/Shaders/deferredFragment.glsl",
+		"Assets/Shaders/deferredGeometry.glsl"
+	});
+
+	_instancedShaderView = LoadShader (instancedShader);
+
+	/*
+	 * Shader for instanced not animated normal mapped objects
+	*/
+
+	Resource<Shader> instancedNormalMapShader = Resources::LoadShader ({
+		"Assets/Shaders/deferredNormalMapInstancedVertex.glsl",
+		"Assets/Shaders/deferredNormalMapFragment.glsl",
+		"Assets/Shaders/deferredNormalMapGeometry.glsl"
+	});
+
+	_instancedNormalMapShaderView = LoadShader (instancedNormalMapShader);
 
 	/*
 	 * Initialize GBuffer volume
@@ -242,6 +267,9 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 	std::size_t drawnVerticesCount = 0;
 	std::size_t drawnPolygonsCount = 0;
 	std::size_t drawnObjectsCount = 0;
+	std::size_t drawCallsCount = 0;
+
+	_renderBatches.Clear ();
 
 	for_each_type (RenderObject*, renderObject, *renderScene) {
 
@@ -266,10 +294,27 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 			continue;
 		}
 
+		/*
+		 * Select level of detail by projected size
+		*/
+
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, camera,
+			settings.resolution.height, settings);
+
 		drawnVerticesCount += renderObject->GetModelView ()->GetVerticesCount ();
-		drawnPolygonsCount += renderObject->GetModelView ()->GetPolygonsCount ();
+		drawnPolygonsCount += renderObject->GetModelView ()->GetPolygonsCount (levelOfDetail);
 		drawnObjectsCount++;
 
+		/*
+		 * Postpone objects that can be drawn together with others
+		*/
+
+		if (IsInstanceable (renderObject, settings)) {
+			_renderBatches.AddRenderObject (renderObject, levelOfDetail);
+
+			continue;
+		}
+
 		/*
 		* Deferred Rendering: Prepare for rendering
 		*/
@@ -286,14 +331,24 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 		 * Draw object on geometry buffer
 		*/
 
-		renderObject->Draw ();
+		renderObject->Draw (levelOfDetail);
+
+		auto modelView = renderObject->GetModelView ();
+		drawCallsCount += std::distance (modelView->begin (), modelView->end ());
 	}
 
+	/*
+	 * Draw objects that share the same model in batches
+	*/
+
+	drawCallsCount += BatchesPass (settings);
+
 	auto renderStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RenderStatisticsObject> ();
 
 	renderStatisticsObject->DrawnVerticesCount = drawnVerticesCount;
 	renderStatisticsObject->DrawnPolygonsCount = drawnPolygonsCount;
 	renderStatisticsObject->DrawnObjectsCount = drawnObjectsCount;
+	renderStatisticsObject->DrawCallsCount = drawCallsCount;
 
 	/*
 	* Disable Stecil Test for further rendering
@@ -302,6 +357,37 @@ void DeferredGeometryRenderPass::GeometryPass (const RenderScene* renderScene, c
 	GL::Disable (GL_STENCIL_TEST);
 }
 
+std::size_t DeferredGeometryRenderPass::BatchesPass (const RenderSettings& settings)
+{
+	for (auto& renderBatchIt : _renderBatches) {
+		RenderBatch* renderBatch = renderBatchIt.second;
+
+		if (renderBatch->GetRenderObjectsCount () == 0) {
+			continue;
+		}
+
+		BindFrameBuffer (renderBatch->GetSceneLayers (), settings);
+
+		/*
+		 * A single object doesn't need instancing
+		*/
+
+		if (renderBatch->GetRenderObjectsCount () == 1) {
+			LockShader (renderBatch->GetSceneLayers ());
+
+			renderBatch->GetRenderObject (0)->Draw (renderBatch->GetLevelOfDetail ());
+
+			continue;
+		}
+
+		LockInstancedShader (renderBatch->GetSceneLayers ());
+
+		renderBatch->Draw ();
+	}
+
+	return _renderBatches.GetDrawCallsCount ();
+}
+
 void DeferredGeometryRenderPass::EndDrawing ()
 {
 	/*
@@ -387,6 +473,54 @@ void DeferredGeometryRenderPass::LockShader (int sceneLayers)
 	}
 }
 
+void DeferredGeometryRenderPass::LockInstancedShader (int sceneLayers)
+{
+	/*
+	 * Unlock last shader
+	*/
+
+	Pipeline::UnlockShader ();
+
+	/*
+	 * Lock the shader for instanced normal mapped objects
+	*/
+
+	if (sceneLayers & SceneLayer::NORMAL_MAP) {
+		Pipeline::LockShader (_instancedNormalMapShaderView);
+	}
+
+	/*
+	 * Lock general shader for instanced objects
+	*/
+
+	if (!(sceneLayers & SceneLayer::NORMAL_MAP)) {
+		Pipeline::LockShader (_instancedShaderView);
+	}
+}
+
+bool DeferredGeometryRenderPass::IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const
+{
+	if (settings.instancing_enabled == false) {
+		return false;
+	}
+
+	/*
+	 * There are instanced shaders only for not animated, not light mapped objects
+	*/
+
+	int sceneLayers = renderObject->GetSceneLayers ();
+
+	if ((sceneLayers & SceneLayer::ANIMATION) || (sceneLayers & SceneLayer::LIGHT_MAP)) {
+		return false;
+	}
+
+	if (!(sceneLayers & (SceneLayer::STATIC | SceneLayer::DYNAMIC))) {
+		return false;
+	}
+
+	return renderObject->IsInstanceable ();
+}
+
 /*
 * TODO: Move this part somewhere else because it belongs to another
 * abstraction layer. This class only work with objects rendering, not
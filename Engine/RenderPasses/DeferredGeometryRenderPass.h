@@ -5,6 +5,7 @@
 
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/ShaderView.h"
+#include "Renderer/RenderBatchCollection.h"
 
 #include "GBuffer.h"
 
@@ -19,9 +20,12 @@ protected:
 	Resource<ShaderView> _normalMapShaderView;
 	Resource<ShaderView> _lightMapShaderView;
 	Resource<ShaderView> _animationShaderView;
+	Resource<ShaderView> _instancedShaderView;
+	Resource<ShaderView> _instancedNormalMapShaderView;
 	GBuffer* _framebuffer;
 	GBuffer* _translucencyFramebuffer;
 	HaltonGenerator _haltonGenerator;
+	RenderBatchCollection _renderBatches;
 
 public:
 	DeferredGeometryRenderPass ();
@@ -39,12 +43,16 @@ protected:
 
 	void PrepareDrawing (const Camera* camera);
 	void GeometryPass (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings);
+	std::size_t BatchesPass (const RenderSettings& settings);
 	void EndDrawing ();
 
 	void GenerateMipmaps ();
 
 	void BindFrameBuffer (int sceneLayers, const RenderSettings& settings);
 	void LockShader (int sceneLayers);
+	void LockInstancedShader (int sceneLayers);
+
+	bool IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const;
 
 	void UpdateVolumes (const RenderSettings& settings, RenderVolumeCollection* rvc);
 
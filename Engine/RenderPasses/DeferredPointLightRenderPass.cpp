@@ -22,7 +22,7 @@ void DeferredPointLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredPointVolLightFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
 	 * Shader for directional light with shadow casting
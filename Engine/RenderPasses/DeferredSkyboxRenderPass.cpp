@@ -20,6 +20,14 @@ void DeferredSkyboxRenderPass::Init (const RenderSettings& settings)
 RenderVolumeCollection* DeferredSkyboxRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
 	const RenderSettings& settings, RenderVolumeCollection* rvc)
 {
+	/*
+	 * Skybox is drawn behind the geometry buffer, skip it when there is none
+	*/
+
+	if (rvc->GetRenderVolume ("GBuffer") == nullptr) {
+		return rvc;
+	}
+
 	/*
 	 * Start skybox pass
 	*/
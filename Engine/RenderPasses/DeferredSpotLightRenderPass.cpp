@@ -24,7 +24,7 @@ void DeferredSpotLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredSpotVolLightFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
 	 * Shader for directional light with shadow casting
@@ -35,7 +35,7 @@ void DeferredSpotLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredSpotVolShadowMapLightFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shadowShader);
+	_shadowShaderView = LoadShader (shadowShader);
 }
 
 void DeferredSpotLightRenderPass::Clear ()
@@ -34,6 +34,21 @@ RenderVolumeCollection* DirectionalVolumetricLightRenderPass::Execute (const Ren
 	return rvc;
 }
 
+bool DirectionalVolumetricLightRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Lights are drawn with the projection of the geometry buffer, skip
+	 * them when there is none
+	*/
+
+	if (rvc->GetRenderVolume ("GBuffer") == nullptr) {
+		return false;
+	}
+
+	return VolumetricLightRenderPassI::IsAvailable (renderScene, camera, settings, rvc);
+}
+
 bool DirectionalVolumetricLightRenderPass::IsAvailable (const RenderLightObject*) const
 {
 	/*
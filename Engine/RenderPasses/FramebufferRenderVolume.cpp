@@ -12,9 +12,26 @@ FramebufferRenderVolume::FramebufferRenderVolume (const Resource<Framebuffer>& f
 	_framebufferView = RenderSystem::LoadFramebuffer (_framebuffer);
 
 	/*
-	 * Creature attributes
+	 * Create attributes
 	*/
 
+	InitAttributes ();
+}
+
+FramebufferRenderVolume::FramebufferRenderVolume (const Resource<Framebuffer>& framebuffer,
+	const Resource<FramebufferView>& framebufferView) :
+	_framebuffer (framebuffer),
+	_framebufferView (framebufferView)
+{
+	/*
+	 * The framebuffer only names the textures of a view loaded elsewhere
+	*/
+
+	InitAttributes ();
+}
+
+void FramebufferRenderVolume::InitAttributes ()
+{
 	std::size_t index = 0;
 
 	for_each_type (Resource<Texture>, texture, *_framebuffer) {
@@ -17,11 +17,15 @@ protected:
 
 public:
 	FramebufferRenderVolume (const Resource<Framebuffer>& framebuffer);
+	FramebufferRenderVolume (const Resource<Framebuffer>& framebuffer,
+		const Resource<FramebufferView>& framebufferView);
 
 	const std::vector<PipelineAttribute>& GetCustomAttributes () const;
 
 	Resource<Framebuffer>& GetFramebuffer ();
 	Resource<FramebufferView>& GetFramebufferView ();
+protected:
+	void InitAttributes ();
 };
 
 #endif
\ No newline at end of file
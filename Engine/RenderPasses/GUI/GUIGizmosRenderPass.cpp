@@ -1,5 +1,11 @@
 #include "GUIGizmosRenderPass.h"
 
+#include <glm/gtc/packing.hpp>
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
 #include "Systems/GUI/Gizmo/Gizmo.h"
 
 #include "Resources/Resources.h"
@@ -9,6 +15,9 @@
 
 #include "Renderer/Pipeline.h"
 
+#include "Debug/Statistics/StatisticsManager.h"
+#include "GizmoStatisticsObject.h"
+
 #include "Wrappers/OpenGL/GL.h"
 
 void GUIGizmosRenderPass::Init (const RenderSettings& settings)
@@ -22,7 +31,28 @@ void GUIGizmosRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/GUI/guiGizmosFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
+
+	/*
+	 * Create the stream buffer once, the lines are written in it
+	 * every frame one after another
+	*/
+
+	GL::GenVertexArrays (1, &_VAO_ID);
+	GL::BindVertexArray (_VAO_ID);
+
+	GL::GenBuffers (1, &_VBO_ID);
+	GL::BindBuffer (GL_ARRAY_BUFFER, _VBO_ID);
+	GL::BufferData (GL_ARRAY_BUFFER, GIZMO_STREAM_BUFFER_SIZE * sizeof (GizmoVertex), nullptr, GL_STREAM_DRAW);
+
+	GL::EnableVertexAttribArray (0);
+	GL::EnableVertexAttribArray (1);
+	GL::VertexAttribPointer (0, 3, GL_FLOAT, GL_FALSE, sizeof (GizmoVertex), (GLvoid*) offsetof (GizmoVertex, position));
+	GL::VertexAttribPointer (1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof (GizmoVertex), (GLvoid*) offsetof (GizmoVertex, color));
+
+	GL::BindVertexArray (0);
+
+	_bufferOffset = 0;
 }
 
 RenderVolumeCollection* GUIGizmosRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -73,98 +103,85 @@ void GUIGizmosRenderPass::DrawLines (const Camera* camera, const RenderSettings&
 {
 	const std::vector<GizmoLine>& lines = Gizmo::GetLines ();
 
-	if (lines.size () == 0) {
-		return;
-	}
+	_drawCallsCount = 0;
+	_allocationsCount = 0;
+	_uploadedBytesCount = 0;
 
-	std::size_t dataSize = 0;
-	std::size_t depthDataSize = 0;
+	_vertices.clear ();
+	_depthVertices.clear ();
 
-	for (auto line : lines) {
-		if (line.depthTest == true) {
-			depthDataSize ++;
-		}
+	/*
+	 * Split visible lines by depth test
+	*/
 
-		if (line.depthTest == false) {
-			dataSize ++;
-		}
-	}
+	FrustumVolume frustum = camera->GetFrustumVolume ();
 
-	std::vector<float> renderData (dataSize * 3 * 2 * 2);
-	std::vector<float> depthRenderData (depthDataSize * 3 * 2 * 2);
-	std::vector<unsigned int> indices (dataSize * 2);
-	std::vector<unsigned int> depthIndices (depthDataSize * 2);
+	std::size_t culledLinesCount = 0;
 
-	std::size_t linesCount = 0;
-	std::size_t depthLinesCount = 0;
+	for (const GizmoLine& line : lines) {
 
-	for (std::size_t lineIndex = 0; lineIndex < lines.size (); lineIndex ++) {
+		if (!IsVisible (frustum, line)) {
+			++ culledLinesCount;
+			continue;
+		}
 
-		if (lines [lineIndex].depthTest == true) {
-			std::size_t stride = depthLinesCount * 3 * 2 * 2;
+		AddLine (line.depthTest ? _depthVertices : _vertices, line);
+	}
 
-			AddLine (depthRenderData, stride, lines [lineIndex]);
-			
-			depthIndices [depthLinesCount * 2] = depthLinesCount * 2;
-			depthIndices [depthLinesCount * 2 + 1] = depthLinesCount * 2 + 1;
+	DrawData (_vertices, camera, settings);
+	DrawData (_depthVertices, camera, settings, true);
 
-			++ depthLinesCount;
-		}
+	/*
+	 * Update statistics
+	*/
 
-		if (lines [lineIndex].depthTest == false) {
-			std::size_t stride = linesCount * 3 * 2 * 2;
+	auto gizmoStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <GizmoStatisticsObject> ();
 
-			AddLine (renderData, stride, lines [lineIndex]);
+	gizmoStatisticsObject->DrawnLinesCount = (_vertices.size () + _depthVertices.size ()) / 2;
+	gizmoStatisticsObject->CulledLinesCount = culledLinesCount;
+	gizmoStatisticsObject->DroppedLinesCount = Gizmo::GetDroppedLinesCount ();
+	gizmoStatisticsObject->DrawCallsCount = _drawCallsCount;
+	gizmoStatisticsObject->BufferAllocationsCount = _allocationsCount;
+	gizmoStatisticsObject->UploadedBytesCount = _uploadedBytesCount;
+}
 
-			indices [linesCount * 2] = linesCount * 2;
-			indices [linesCount * 2 + 1] = linesCount * 2 + 1;
+bool GUIGizmosRenderPass::IsVisible (const FrustumVolume& frustum, const GizmoLine& line) const
+{
+	/*
+	 * Lines are drawn with depth clamp, so only the side planes
+	 * could hide them. A line is outside when both of its ends
+	 * are behind the same plane.
+	*/
+
+	for (std::size_t i=0;i<4;i++) {
+		const glm::vec4& plane = frustum.plane [i];
 
-			++ linesCount;
+		float firstDistance = glm::dot (glm::vec3 (plane), line.first) + plane.w;
+		float lastDistance = glm::dot (glm::vec3 (plane), line.last) + plane.w;
+
+		if (firstDistance < 0.0f && lastDistance < 0.0f) {
+			return false;
 		}
 	}
 
-	DrawData (renderData, indices, camera, settings);
-	DrawData (depthRenderData, depthIndices, camera, settings, true);
+	return true;
 }
 
-void GUIGizmosRenderPass::AddLine (std::vector<float>& renderData, std::size_t stride, const GizmoLine& line)
+void GUIGizmosRenderPass::AddLine (std::vector<GizmoVertex>& vertices, const GizmoLine& line)
 {
-	renderData [stride] = line.first.x;
-	renderData [stride + 1] = line.first.y;
-	renderData [stride + 2] = line.first.z;
-	renderData [stride + 3] = line.color.x;
-	renderData [stride + 4] = line.color.y;
-	renderData [stride + 5] = line.color.z;
-
-	renderData [stride + 6] = line.last.x;
-	renderData [stride + 7] = line.last.y;
-	renderData [stride + 8] = line.last.z;
-	renderData [stride + 9] = line.color.x;
-	renderData [stride + 10] = line.color.y;
-	renderData [stride + 11] = line.color.z;
+	std::uint32_t color = glm::packUnorm4x8 (glm::vec4 (line.color, 1.0f));
+
+	vertices.push_back ({ line.first, color });
+	vertices.push_back ({ line.last, color });
 }
 
-void GUIGizmosRenderPass::DrawData (const std::vector<float>& renderData, const std::vector<unsigned int>& indices,
+void GUIGizmosRenderPass::DrawData (const std::vector<GizmoVertex>& vertices,
 	const Camera* camera, const RenderSettings& settings, bool depthTest)
 {
-	if (renderData.size () == 0) {
+	if (vertices.size () == 0) {
 		return;
 	}
 
-	unsigned int VAO;
-	GL::GenVertexArrays(1 , &VAO);
-	GL::BindVertexArray(VAO);
-
-	unsigned int VBO;
-	GL::GenBuffers (1, &VBO);
-	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
-	GL::BufferData (GL_ARRAY_BUFFER, sizeof(float) * renderData.size (), renderData.data (), GL_STATIC_DRAW);
-
-	unsigned int IBO;
-	GL::GenBuffers (1, &IBO);
-	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof(float) * indices.size (), indices.data (), GL_STATIC_DRAW);
-
 	/*
 	 * Set viewport
 	*/
@@ -199,24 +216,75 @@ void GUIGizmosRenderPass::DrawData (const std::vector<float>& renderData, const
 	GL::Enable (GL_BLEND);
 	GL::BlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-	GL::EnableVertexAttribArray(0);
-	GL::VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof (float) * 6, (void*) 0);
-	GL::EnableVertexAttribArray(1);
-	GL::VertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof (float) * 6, (void*)(sizeof(float) * 3));
+	GL::BindVertexArray (_VAO_ID);
+	GL::BindBuffer (GL_ARRAY_BUFFER, _VBO_ID);
+
+	/*
+	 * Batches larger than the stream buffer are drawn in pieces
+	*/
+
+	for (std::size_t first = 0; first < vertices.size (); first += GIZMO_STREAM_BUFFER_SIZE) {
+		std::size_t verticesCount = std::min (vertices.size () - first, (std::size_t) GIZMO_STREAM_BUFFER_SIZE);
+
+		StreamData (vertices.data () + first, verticesCount);
 
-	GL::DrawElements(GL_LINES, indices.size (), GL_UNSIGNED_INT, 0);
+		GL::DrawArrays (GL_LINES, _bufferOffset, verticesCount);
+
+		_bufferOffset += verticesCount;
+		++ _drawCallsCount;
+	}
+
+	GL::BindVertexArray (0);
 
 	GL::Disable (GL_DEPTH_CLAMP);
 
 	Pipeline::UnlockShader ();
+}
+
+void GUIGizmosRenderPass::StreamData (const GizmoVertex* vertices, std::size_t verticesCount)
+{
+	/*
+	 * Orphan the buffer when it is full, the driver hands out a new
+	 * storage while the previous one is still read by the GPU
+	*/
+
+	if (_bufferOffset + verticesCount > GIZMO_STREAM_BUFFER_SIZE) {
+		GL::BufferData (GL_ARRAY_BUFFER, GIZMO_STREAM_BUFFER_SIZE * sizeof (GizmoVertex), nullptr, GL_STREAM_DRAW);
+
+		_bufferOffset = 0;
+		++ _allocationsCount;
+	}
+
+	/*
+	 * The range was never written since the last orphan, so it
+	 * could be mapped without waiting for the previous draws
+	*/
+
+	std::size_t offset = _bufferOffset * sizeof (GizmoVertex);
+	std::size_t size = verticesCount * sizeof (GizmoVertex);
 
-	GL::DeleteBuffers (1, &VBO);
-	GL::DeleteVertexArrays (1, &VAO);
+	void* data = GL::MapBufferRange (GL_ARRAY_BUFFER, offset, size,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+	if (data != nullptr) {
+		std::memcpy (data, vertices, size);
+
+		GL::UnmapBuffer (GL_ARRAY_BUFFER);
+	}
+
+	if (data == nullptr) {
+		GL::BufferSubData (GL_ARRAY_BUFFER, offset, size, vertices);
+	}
+
+	_uploadedBytesCount += size;
 }
 
 void GUIGizmosRenderPass::Clear ()
 {
 	/*
-	 * Do nothing
+	 * Delete stream buffer
 	*/
+
+	GL::DeleteBuffers (1, &_VBO_ID);
+	GL::DeleteVertexArrays (1, &_VAO_ID);
 }
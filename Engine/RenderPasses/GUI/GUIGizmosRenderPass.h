@@ -3,18 +3,46 @@
 
 #include "RenderPasses/Container/ContainerRenderSubPassI.h"
 
+#include <vector>
+#include <cstdint>
+
 #include "Core/Resources/Resource.h"
+#include "Core/Intersections/FrustumVolume.h"
 #include "Renderer/RenderViews/ShaderView.h"
 
 #include "Systems/GUI/Gizmo/Gizmo.h"
 
+/*
+ * Vertices the stream buffer could hold before it is orphaned
+*/
+
+#define GIZMO_STREAM_BUFFER_SIZE 131072
+
 class ENGINE_API GUIGizmosRenderPass : public ContainerRenderSubPassI
 {
 	DECLARE_RENDER_PASS(GUIGizmosRenderPass)
 
+protected:
+	struct GizmoVertex
+	{
+		glm::vec3 position;
+		std::uint32_t color;
+	};
+
 protected:
 	Resource<ShaderView> _shaderView;
 
+	unsigned int _VAO_ID;
+	unsigned int _VBO_ID;
+	std::size_t _bufferOffset;
+
+	std::vector<GizmoVertex> _vertices;
+	std::vector<GizmoVertex> _depthVertices;
+
+	std::size_t _drawCallsCount;
+	std::size_t _allocationsCount;
+	std::size_t _uploadedBytesCount;
+
 public:
 	virtual void Init (const RenderSettings& settings);
 	virtual RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
@@ -29,10 +57,12 @@ protected:
 	void DrawGizmos (const Camera* camera, const RenderSettings& settings);
 	void DrawLines (const Camera* camera, const RenderSettings& settings);
 
-	void AddLine (std::vector<float>&, std::size_t stride, const GizmoLine& line);
+	bool IsVisible (const FrustumVolume& frustum, const GizmoLine& line) const;
+	void AddLine (std::vector<GizmoVertex>& vertices, const GizmoLine& line);
 
-	void DrawData (const std::vector<float>& data, const std::vector<unsigned int>& indices,
-		const Camera* camera, const RenderSettings& settings, bool depth = false);
+	void DrawData (const std::vector<GizmoVertex>& vertices,
+		const Camera* camera, const RenderSettings& settings, bool depthTest = false);
+	void StreamData (const GizmoVertex* vertices, std::size_t verticesCount);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -20,7 +20,7 @@ void GUIRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/GUI/guiFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
 	 * Load font texture
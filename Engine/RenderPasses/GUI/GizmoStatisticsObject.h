@@ -0,0 +1,18 @@
+#ifndef GIZMOSTATISTICSOBJECT_H
+#define GIZMOSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API GizmoStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(GizmoStatisticsObject)
+
+	std::size_t DrawnLinesCount;
+	std::size_t CulledLinesCount;
+	std::size_t DroppedLinesCount;
+	std::size_t DrawCallsCount;
+	std::size_t BufferAllocationsCount;
+	std::size_t UploadedBytesCount;
+};
+
+#endif
@@ -25,7 +25,7 @@ glm::ivec2 GammaCorrectionRenderPass::GetPostProcessVolumeResolution (const Rend
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* GammaCorrectionRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> GammaCorrectionRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("postProcessMap"));
 
@@ -43,5 +43,22 @@ FramebufferRenderVolume* GammaCorrectionRenderPass::CreatePostProcessVolume (con
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool GammaCorrectionRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
+}
+
+PostProcessFusionSnippet GammaCorrectionRenderPass::GetPostProcessFusionSnippet () const
+{
+	PostProcessFusionSnippet snippet;
+
+	snippet.path = "Assets/Shaders/GammaCorrection/gammaCorrection.glsl";
+	snippet.function = "CalcGammaCorrection";
+	snippet.inputVolume = "PostProcessMapVolume";
+	snippet.inputMap = "postProcessMap";
+
+	return snippet;
 }
@@ -25,7 +25,7 @@ glm::ivec2 HDRRenderPass::GetPostProcessVolumeResolution (const RenderSettings&
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* HDRRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> HDRRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("postProcessMap"));
 
@@ -43,7 +43,24 @@ FramebufferRenderVolume* HDRRenderPass::CreatePostProcessVolume (const RenderSet
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool HDRRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
+}
+
+PostProcessFusionSnippet HDRRenderPass::GetPostProcessFusionSnippet () const
+{
+	PostProcessFusionSnippet snippet;
+
+	snippet.path = "Assets/Shaders/HighDynamicRange/highDynamicRange.glsl";
+	snippet.function = "CalcHighDynamicRange";
+	snippet.inputVolume = "PostProcessMapVolume";
+	snippet.inputMap = "postProcessMap";
+
+	return snippet;
 }
 
 std::vector<PipelineAttribute> HDRRenderPass::GetCustomAttributes (const Camera* camera,
@@ -19,7 +19,7 @@ void HGIDirectLightDirectionalRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/HybridGlobalIllumination/hybridGlobalIlluminationDirectLightDirectionalFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shader);
+	_shadowShaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* HGIDirectLightDirectionalRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -27,7 +27,7 @@ void HGIIndirectSpecularLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/HybridGlobalIllumination/hybridGlobalIlluminationIndirectSpecularFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* HGIIndirectSpecularLightRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
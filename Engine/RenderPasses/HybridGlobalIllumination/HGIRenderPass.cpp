@@ -18,7 +18,7 @@ void HGIRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/HybridGlobalIllumination/hybridGlobalIlluminationFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void HGIRenderPass::Clear ()
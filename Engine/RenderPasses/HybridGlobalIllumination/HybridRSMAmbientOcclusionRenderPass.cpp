@@ -23,7 +23,7 @@ void HybridRSMAmbientOcclusionRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/HybridGlobalIllumination/hybridRSMAmbientOcclusionFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void HybridRSMAmbientOcclusionRenderPass::Clear ()
@@ -3,6 +3,7 @@
 #include "Core/Intersections/Intersection.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -99,7 +100,10 @@ void HybridRSMDirectionalLightViewAccumulationRenderPass::ShadowMapGeometryPass
 		* Render object on shadow map
 		*/
 
-		renderObject->Draw ();
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, lightCamera,
+			shadow.resolution.y, settings, settings.lod_gi_bias);
+
+		renderObject->Draw (levelOfDetail);
 	}
 }
 
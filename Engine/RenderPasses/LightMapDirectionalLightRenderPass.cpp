@@ -16,7 +16,7 @@ void LightMapDirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightMap/lightMapDirVolLightFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void LightMapDirectionalLightRenderPass::Clear ()
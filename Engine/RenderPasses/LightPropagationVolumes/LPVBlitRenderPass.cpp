@@ -28,7 +28,7 @@ void LPVBlitRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesBlitCompute.glsl"
 	);
 
-	_shaderView = RenderSystem::LoadComputeShader (shader);
+	_shaderView = LoadComputeShader (shader);
 
 	/*
 	 * Initialize light propagation volume
@@ -102,14 +102,15 @@ void LPVBlitRenderPass::PostProcessPass (const RenderScene* renderScene, const C
 {
 	LPVVolume* lpvVolume = (LPVVolume*) rvc->GetRenderVolume ("LightPropagationVolume");
 
-	_lpvPropagationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
+	_lpvPropagationVolume->CopyBounds (lpvVolume);
 
 	_lpvPropagationVolume->BindForWriting ();
 
 	Pipeline::SendCustomAttributes (_shaderView, lpvVolume->GetCustomAttributes ());
 
 	int numWorkGroups = (int) std::ceil (settings.lpv_volume_size / 4.0);
-	GL::DispatchCompute (numWorkGroups, numWorkGroups, numWorkGroups);
+	int numDepthWorkGroups = (int) std::ceil (settings.lpv_volume_size * lpvVolume->GetCascadesCount () / 4.0);
+	GL::DispatchCompute (numWorkGroups, numWorkGroups, numDepthWorkGroups);
 
 	GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
 }
@@ -125,7 +126,7 @@ void LPVBlitRenderPass::EndPostProcessPass ()
 
 void LPVBlitRenderPass::InitLPVVolume (const RenderSettings& settings)
 {
-	if (!_lpvPropagationVolume->Init (settings.lpv_volume_size)) {
+	if (!_lpvPropagationVolume->Init (settings.lpv_volume_size, LPVCascades::GetCascadesCount (settings))) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
@@ -135,7 +136,8 @@ void LPVBlitRenderPass::InitLPVVolume (const RenderSettings& settings)
 
 void LPVBlitRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 {
-	if (_lpvPropagationVolume->GetVolumeSize () != settings.lpv_volume_size) {
+	if (_lpvPropagationVolume->GetVolumeSize () != settings.lpv_volume_size ||
+		_lpvPropagationVolume->GetCascadesCount () != LPVCascades::GetCascadesCount (settings)) {
 
 		/*
 		 * Clear voxel volume
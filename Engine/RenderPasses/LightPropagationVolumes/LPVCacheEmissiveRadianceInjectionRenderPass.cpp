@@ -27,14 +27,14 @@ void LPVCacheEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& se
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionCompute.glsl"
 	);
 
-	_staticShaderView = RenderSystem::LoadComputeShader (staticShader);
+	_staticShaderView = LoadComputeShader (staticShader);
 
 	// Resource<Shader> staticShader = Resources::LoadShader ({
 	// 	"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionVertex.glsl",
 	// 	"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionFragment.glsl"
 	// });
 
-	// _staticShaderView = RenderSystem::LoadShader (staticShader);
+	// _staticShaderView = LoadShader (staticShader);
 
 	///*
 	// * Shader for animated objects
@@ -46,7 +46,7 @@ void LPVCacheEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& se
 	//	"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionGeometry.glsl"
 	//});
 
-	//_animationShaderView = RenderSystem::LoadShader (animationShader);
+	//_animationShaderView = LoadShader (animationShader);
 }
 
 RenderVolumeCollection* LPVCacheEmissiveRadianceInjectionRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -41,7 +41,7 @@ void LPVCacheEmissiveRadianceRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceGeometry.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* LPVCacheEmissiveRadianceRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
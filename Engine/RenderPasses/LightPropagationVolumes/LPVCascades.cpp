@@ -0,0 +1,78 @@
+#include "LPVCascades.h"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+
+std::size_t LPVCascades::GetCascadesCount (const RenderSettings& settings)
+{
+	if (settings.lpv_cascades_enabled == false) {
+		return 1;
+	}
+
+	return std::max ((std::size_t) 1, std::min (settings.lpv_cascades_count, (std::size_t) MAX_LPV_CASCADES));
+}
+
+LPVCascade LPVCascades::GetCascade (const glm::vec3& center, float cellSize,
+	std::size_t volumeSize, std::size_t cascade)
+{
+	float cascadeCellSize = cellSize * (1 << cascade);
+	float halfExtent = cascadeCellSize * (volumeSize / 2);
+
+	LPVCascade result;
+
+	result.minVertex = glm::floor (center / cascadeCellSize) * cascadeCellSize - glm::vec3 (halfExtent);
+	result.maxVertex = result.minVertex + glm::vec3 (cascadeCellSize * volumeSize);
+
+	return result;
+}
+
+float LPVCascades::GetCellSize (const LPVCascade& cascade, std::size_t volumeSize)
+{
+	return (cascade.maxVertex.x - cascade.minVertex.x) / volumeSize;
+}
+
+int LPVCascades::FindCascade (const std::vector<LPVCascade>& cascades, std::size_t volumeSize,
+	const glm::vec3& position)
+{
+	for (std::size_t index = 0; index < cascades.size (); index ++) {
+		const LPVCascade& cascade = cascades [index];
+
+		if (glm::all (glm::greaterThanEqual (position, cascade.minVertex)) &&
+			glm::all (glm::lessThan (position, cascade.maxVertex))) {
+			return (int) index;
+		}
+	}
+
+	return -1;
+}
+
+float LPVCascades::GetBlendWeight (const LPVCascade& cascade, std::size_t volumeSize,
+	const glm::vec3& position)
+{
+	glm::vec3 borderDistance = glm::min (position - cascade.minVertex, cascade.maxVertex - position);
+
+	float cells = std::min (borderDistance.x, std::min (borderDistance.y, borderDistance.z)) /
+		GetCellSize (cascade, volumeSize);
+
+	return 1.0f - glm::clamp (cells / LPV_CASCADE_BLEND_CELLS, 0.0f, 1.0f);
+}
+
+bool LPVCascades::GetCell (const LPVCascade& cascade, std::size_t volumeSize, std::size_t cascadeIndex,
+	const glm::vec3& position, glm::ivec3& cell)
+{
+	glm::vec3 cellPosition = glm::floor ((position - cascade.minVertex) / GetCellSize (cascade, volumeSize));
+
+	if (glm::any (glm::lessThan (cellPosition, glm::vec3 (0.0f))) ||
+		glm::any (glm::greaterThanEqual (cellPosition, glm::vec3 ((float) volumeSize)))) {
+		return false;
+	}
+
+	/*
+	 * Cascades are stacked along the z axis of the volume textures
+	*/
+
+	cell = glm::ivec3 (cellPosition);
+	cell.z += (int) (cascadeIndex * volumeSize);
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#ifndef LPVCASCADES_H
+#define LPVCASCADES_H
+
+#include <cstddef>
+#include <vector>
+#include <glm/vec3.hpp>
+
+#include "Renderer/RenderSettings.h"
+
+#define MAX_LPV_CASCADES 4
+
+/*
+ * Width of the band, in cells, where a cascade fades into the next one
+*/
+
+#define LPV_CASCADE_BLEND_CELLS 2.0f
+
+struct ENGINE_API LPVCascade
+{
+	glm::vec3 minVertex;
+	glm::vec3 maxVertex;
+};
+
+/*
+ * Cascades are nested grids around the camera with the same number of
+ * cells, each one twice as large as the previous. A cascade moves by
+ * whole cells of its own, so a world position keeps falling in the same
+ * cell while the camera moves and the injected light does not flicker.
+ *
+ * The selection and blending mirror the light propagation volumes
+ * shaders: a position is read from the finest cascade that contains it
+ * and fades into the next one close to the border.
+*/
+
+class ENGINE_API LPVCascades
+{
+public:
+	static std::size_t GetCascadesCount (const RenderSettings& settings);
+
+	static LPVCascade GetCascade (const glm::vec3& center, float cellSize,
+		std::size_t volumeSize, std::size_t cascade);
+
+	static float GetCellSize (const LPVCascade& cascade, std::size_t volumeSize);
+
+	static int FindCascade (const std::vector<LPVCascade>& cascades, std::size_t volumeSize,
+		const glm::vec3& position);
+	static float GetBlendWeight (const LPVCascade& cascade, std::size_t volumeSize,
+		const glm::vec3& position);
+
+	static bool GetCell (const LPVCascade& cascade, std::size_t volumeSize, std::size_t cascadeIndex,
+		const glm::vec3& position, glm::ivec3& cell);
+};
+
+#endif
\ No newline at end of file
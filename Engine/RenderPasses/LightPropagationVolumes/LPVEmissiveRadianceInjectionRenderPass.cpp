@@ -27,7 +27,7 @@ void LPVEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& setting
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesEmissiveRadianceInjectionGeometry.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -39,7 +39,7 @@ void LPVEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& setting
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesEmissiveRadianceInjectionGeometry.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 RenderVolumeCollection* LPVEmissiveRadianceInjectionRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
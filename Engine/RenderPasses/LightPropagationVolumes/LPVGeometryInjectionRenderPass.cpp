@@ -20,7 +20,7 @@ void LPVGeometryInjectionRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesGeometryInjectionFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void LPVGeometryInjectionRenderPass::Clear ()
@@ -6,13 +6,15 @@
 
 #include "Core/Console/Console.h"
 
-bool LPVGeometryVolume::Init(std::size_t volumeSize)
+bool LPVGeometryVolume::Init(std::size_t volumeSize, std::size_t cascadesCount)
 {
 	/*
 	 * Keep new current volume size
 	*/
 
 	_volumeSize = volumeSize;
+	_cascadesCount = cascadesCount;
+	_cascades.resize (_cascadesCount, LPVCascade { _minVertex, _maxVertex });
 
 	/*
 	 * Create an fbo for clearing the 3D texture.
@@ -29,7 +31,7 @@ bool LPVGeometryVolume::Init(std::size_t volumeSize)
 	GL::GenTextures (1, _volumeTextures);
 
 	GL::BindTexture (GL_TEXTURE_3D, _volumeTextures [0]);
-	GL::TexImage3D (GL_TEXTURE_3D, 0, GL_RGBA8, _volumeSize, _volumeSize, _volumeSize,
+	GL::TexImage3D (GL_TEXTURE_3D, 0, GL_RGBA8, _volumeSize, _volumeSize, _volumeSize * _cascadesCount,
 		0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
 	GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -59,29 +61,16 @@ bool LPVGeometryVolume::Init(std::size_t volumeSize)
 	_attributes.clear ();
 
 	PipelineAttribute geometryTexture;
-	PipelineAttribute minVertex;
-	PipelineAttribute maxVertex;
-	PipelineAttribute volumeSizeAttribute;
 
 	geometryTexture.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
-	minVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	maxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	volumeSizeAttribute.type = PipelineAttribute::AttrType::ATTR_3I;
 
 	geometryTexture.name = "geometryTexture";
-	minVertex.name = "minVertex";
-	maxVertex.name = "maxVertex";
-	volumeSizeAttribute.name = "volumeSize";
 
 	geometryTexture.value.x = _volumeTextures [0];
-	minVertex.value = _minVertex;
-	maxVertex.value = _maxVertex;
-	volumeSizeAttribute.value = glm::vec3 ((float) _volumeSize);
 
 	_attributes.push_back (geometryTexture);
-	_attributes.push_back (minVertex);
-	_attributes.push_back (maxVertex);
-	_attributes.push_back (volumeSizeAttribute);
+
+	AddVolumeAttributes ();
 
 	return true;
 }
@@ -8,7 +8,7 @@
 class LPVGeometryVolume : public LPVVolume
 {
 public:
-	virtual bool Init (std::size_t size);
+	virtual bool Init (std::size_t size, std::size_t cascadesCount = 1);
 
 	virtual void BindForWriting ();
 
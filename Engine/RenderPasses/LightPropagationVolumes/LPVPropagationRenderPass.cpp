@@ -5,13 +5,20 @@
 
 #include "LPVGeometryVolume.h"
 
+#include "RenderPasses/VolumetricLightVolume.h"
+#include "SceneNodes/SceneLayer.h"
+
 #include "Renderer/Pipeline.h"
 
 #include "Core/Console/Console.h"
 
+#include "Debug/Statistics/StatisticsManager.h"
+#include "LPVStatisticsObject.h"
+
 LPVPropagationRenderPass::LPVPropagationRenderPass () :
-	_lpvPropagationVolume (new LPVPropagationVolume ()),
-	_lpvAccumulationVolume (new LPVPropagationVolume ())
+	_lpvPropagationVolumes { new LPVPropagationVolume (), new LPVPropagationVolume () },
+	_lpvAccumulationVolume (new LPVPropagationVolume ()),
+	_renderLightObject (nullptr)
 {
 
 }
@@ -19,7 +26,8 @@ LPVPropagationRenderPass::LPVPropagationRenderPass () :
 LPVPropagationRenderPass::~LPVPropagationRenderPass ()
 {
 	delete _lpvAccumulationVolume;
-	delete _lpvPropagationVolume;
+	delete _lpvPropagationVolumes [1];
+	delete _lpvPropagationVolumes [0];
 }
 
 void LPVPropagationRenderPass::Init (const RenderSettings& settings)
@@ -32,7 +40,7 @@ void LPVPropagationRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesPropagationCompute.glsl"
 	);
 
-	_shaderView = RenderSystem::LoadComputeShader (shader);
+	_shaderView = LoadComputeShader (shader);
 
 	/*
 	 * Initialize light propagation volume
@@ -48,7 +56,10 @@ void LPVPropagationRenderPass::Clear ()
 	*/
 
 	_lpvAccumulationVolume->Clear ();
-	_lpvPropagationVolume->Clear ();
+	_lpvPropagationVolumes [1]->Clear ();
+	_lpvPropagationVolumes [0]->Clear ();
+
+	_scheduler.Invalidate ();
 }
 
 RenderVolumeCollection* LPVPropagationRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -61,22 +72,41 @@ RenderVolumeCollection* LPVPropagationRenderPass::Execute (const RenderScene* re
 	UpdateLPVVolume (settings);
 
 	/*
-	 * Start screen space ambient occlusion generation pass
+	 * Find the propagation iterations left for this frame
 	*/
 
-	StartPostProcessPass ();
+	LPVPropagationStep step = SchedulePropagation (renderScene, camera, settings, rvc);
 
-	/*
-	 * Screen space ambient occlusion generation pass
-	*/
+	auto lpvStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <LPVStatisticsObject> ();
 
-	PostProcessPass (renderScene, camera, settings, rvc);
+	lpvStatisticsObject->propagationDispatchesCount = step.iterationsCount;
+	lpvStatisticsObject->propagationCompletedIterations = _scheduler.GetCompletedIterations ();
+	lpvStatisticsObject->propagationRestartsCount = _scheduler.GetRestartsCount ();
 
 	/*
-	 * End screen space ambient occlusion generation pass
+	 * The accumulation volume of a converged propagation is still valid
 	*/
 
-	EndPostProcessPass ();
+	if (step.iterationsCount > 0 || step.isRestart == true) {
+
+		/*
+		 * Start light propagation pass
+		*/
+
+		StartPostProcessPass (step);
+
+		/*
+		 * Light propagation pass
+		*/
+
+		PostProcessPass (renderScene, camera, settings, rvc, step);
+
+		/*
+		 * End light propagation pass
+		*/
+
+		EndPostProcessPass ();
+	}
 
 	return rvc->Insert ("LightPropagationVolume", _lpvAccumulationVolume);
 }
@@ -91,10 +121,16 @@ bool LPVPropagationRenderPass::IsAvailable (const RenderScene* renderScene, cons
 	return true;
 }
 
-void LPVPropagationRenderPass::StartPostProcessPass ()
+void LPVPropagationRenderPass::StartPostProcessPass (const LPVPropagationStep& step)
 {
-	_lpvPropagationVolume->ClearVolume ();
-	_lpvAccumulationVolume->ClearVolume ();
+	/*
+	 * Keep the accumulation of the previous frames if propagation
+	 * continues. Propagation volumes are always written before read.
+	*/
+
+	if (step.isRestart == true) {
+		_lpvAccumulationVolume->ClearVolume ();
+	}
 
 	/*
 	 * Bind screen space ambient occlusion volume for writing
@@ -104,35 +140,43 @@ void LPVPropagationRenderPass::StartPostProcessPass ()
 }
 
 void LPVPropagationRenderPass::PostProcessPass (const RenderScene* renderScene, const Camera* camera,
-	const RenderSettings& settings, RenderVolumeCollection* rvc)
+	const RenderSettings& settings, RenderVolumeCollection* rvc, const LPVPropagationStep& step)
 {
 	LPVPropagationVolume* lpvVolume = (LPVPropagationVolume*) rvc->GetRenderVolume ("LightPropagationVolume");
 	LPVGeometryVolume* lpvGeometryVolume = (LPVGeometryVolume*) rvc->GetRenderVolume ("LPVGeometryVolume");
 
-	_lpvPropagationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
-	_lpvAccumulationVolume->UpdateBoundingBox (lpvVolume->GetMinVertex (), lpvVolume->GetMaxVertex ());
+	_lpvPropagationVolumes [0]->CopyBounds (lpvVolume);
+	_lpvPropagationVolumes [1]->CopyBounds (lpvVolume);
+	_lpvAccumulationVolume->CopyBounds (lpvVolume);
+
+	int numWorkGroups = (int) std::ceil (settings.lpv_volume_size / 4.0);
+	int numDepthWorkGroups = (int) std::ceil (settings.lpv_volume_size * lpvVolume->GetCascadesCount () / 4.0);
+
+	/*
+	 * The first iteration starts from the injected volume, the next ones
+	 * ping pong between two volumes of their own, so the wavefront
+	 * survives until the following frame
+	*/
+
+	std::size_t lastIteration = step.firstIteration + step.iterationsCount;
 
-	for (std::size_t index = 0; index < settings.lpv_iterations; index ++) {
+	for (std::size_t index = step.firstIteration; index < lastIteration; index ++) {
 
 		Pipeline::SendCustomAttributes (_shaderView, lpvGeometryVolume->GetCustomAttributes ());
 
 		_lpvAccumulationVolume->BindForWriting (3);
+		_lpvPropagationVolumes [index & 1]->BindForWriting ();
 
-		if ((index & 1) == 0) {
-			_lpvPropagationVolume->BindForWriting ();
-
+		if (index == 0) {
 			Pipeline::SendCustomAttributes (_shaderView, lpvVolume->GetCustomAttributes ());
 		} else {
-			lpvVolume->BindForWriting ();
-
-			Pipeline::SendCustomAttributes (_shaderView, _lpvPropagationVolume->GetCustomAttributes ());
+			Pipeline::SendCustomAttributes (_shaderView, _lpvPropagationVolumes [(index - 1) & 1]->GetCustomAttributes ());
 		}
 
 		GL::Uniform1i (_shaderView->GetUniformLocation ("iteration"), index);
 		GL::Uniform1i (_shaderView->GetUniformLocation ("geometryOcclusion"), settings.lpv_geometry_occlusion);
 
-		int numWorkGroups = (int) std::ceil (settings.lpv_volume_size / 4.0);
-		GL::DispatchCompute (numWorkGroups, numWorkGroups, numWorkGroups);
+		GL::DispatchCompute (numWorkGroups, numWorkGroups, numDepthWorkGroups);
 
 		GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
 	}
@@ -149,14 +193,18 @@ void LPVPropagationRenderPass::EndPostProcessPass ()
 
 void LPVPropagationRenderPass::InitLPVVolume (const RenderSettings& settings)
 {
-	if (!_lpvPropagationVolume->Init (settings.lpv_volume_size)) {
-		Console::LogError (std::string () +
-			"Light propagation volume texture cannot be initialized!" +
-			" It is not possible to continue the process. End now!");
-		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
+	std::size_t cascadesCount = LPVCascades::GetCascadesCount (settings);
+
+	for (LPVPropagationVolume* lpvPropagationVolume : _lpvPropagationVolumes) {
+		if (!lpvPropagationVolume->Init (settings.lpv_volume_size, cascadesCount)) {
+			Console::LogError (std::string () +
+				"Light propagation volume texture cannot be initialized!" +
+				" It is not possible to continue the process. End now!");
+			exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
+		}
 	}
 
-	if (!_lpvAccumulationVolume->Init (settings.lpv_volume_size)) {
+	if (!_lpvAccumulationVolume->Init (settings.lpv_volume_size, cascadesCount)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
@@ -166,14 +214,14 @@ void LPVPropagationRenderPass::InitLPVVolume (const RenderSettings& settings)
 
 void LPVPropagationRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 {
-	if (_lpvPropagationVolume->GetVolumeSize () != settings.lpv_volume_size) {
+	if (_lpvAccumulationVolume->GetVolumeSize () != settings.lpv_volume_size ||
+		_lpvAccumulationVolume->GetCascadesCount () != LPVCascades::GetCascadesCount (settings)) {
 
 		/*
 		 * Clear voxel volume
 		*/
 
-		_lpvAccumulationVolume->Clear ();
-		_lpvPropagationVolume->Clear ();
+		Clear ();
 
 		/*
 		 * Initialize voxel volume
@@ -182,3 +230,123 @@ void LPVPropagationRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 		InitLPVVolume (settings);
 	}
 }
+
+LPVPropagationStep LPVPropagationRenderPass::SchedulePropagation (const RenderScene* renderScene,
+	const Camera* camera, const RenderSettings& settings, const RenderVolumeCollection* rvc)
+{
+	VolumetricLightVolume* volume = (VolumetricLightVolume*) rvc->GetRenderVolume ("SubpassVolume");
+	const RenderLightObject* renderLightObject = volume->GetRenderLightObject ();
+
+	std::size_t budget = settings.lpv_propagation_budget;
+
+	/*
+	 * With more directional lights the volumes are shared between them
+	 * and every light starts over, so each one propagates in full
+	*/
+
+	if (_renderLightObject != renderLightObject) {
+		_renderLightObject = renderLightObject;
+
+		budget = 0;
+	}
+
+	if (settings.lpv_propagation_cache == false) {
+		_scheduler.Invalidate ();
+	}
+
+	LPVVolume* lpvVolume = (LPVVolume*) rvc->GetRenderVolume ("LightPropagationVolume");
+
+	LPVInjectionState state = GetInjectionState (renderScene, camera, settings, renderLightObject, lpvVolume);
+
+	return _scheduler.Schedule (state, settings.lpv_iterations, budget);
+}
+
+LPVInjectionState LPVPropagationRenderPass::GetInjectionState (const RenderScene* renderScene,
+	const Camera* camera, const RenderSettings& settings, const RenderLightObject* renderLightObject,
+	const LPVVolume* lpvVolume) const
+{
+	LPVInjectionState state;
+
+	/*
+	 * Injection settings
+	*/
+
+	state.Add (settings.lpv_injection_bias);
+	state.Add ((std::size_t) settings.lpv_geometry_occlusion);
+	state.Add ((std::size_t) settings.lpv_emissive_voxelization);
+	state.Add ((std::size_t) settings.lpv_emissive_cache);
+	state.Add ((std::size_t) settings.lpv_emissive_textured);
+	state.Add (settings.lpv_emissive_normal_angle_step);
+	state.Add (settings.lpv_emissive_vpls);
+	state.Add ((std::size_t) settings.lod_enabled);
+	state.Add (settings.lod_pixel_error);
+	state.Add (settings.lod_gi_bias);
+
+	/*
+	 * Light and its reflective shadow map
+	*/
+
+	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
+
+	state.Add (renderLightObject);
+	state.Add (renderLightObject->GetTransform ()->GetRotation ());
+	state.Add (renderLightObject->GetLightColor ().ToVector4 ());
+	state.Add (renderLightObject->GetLightIntensity ());
+	state.Add ((std::size_t) shadow.resolution.x);
+	state.Add ((std::size_t) shadow.resolution.y);
+
+	/*
+	 * Geometry occlusion is injected from the camera view
+	*/
+
+	if (settings.lpv_geometry_occlusion == true) {
+		state.Add (camera->GetPosition ());
+		state.Add (camera->GetRotation ());
+		state.Add ((std::size_t) settings.resolution.width);
+		state.Add ((std::size_t) settings.resolution.height);
+	}
+
+	/*
+	 * Scene bounds place both the volume and the light camera
+	*/
+
+	auto& boundingBox = renderScene->GetBoundingBox ();
+
+	state.Add (boundingBox.minVertex);
+	state.Add (boundingBox.maxVertex);
+
+	/*
+	 * Cascades move with the camera by whole cells
+	*/
+
+	for (std::size_t cascade = 0; cascade < lpvVolume->GetCascadesCount (); cascade++) {
+		state.Add (lpvVolume->GetCascade (cascade).minVertex);
+		state.Add (lpvVolume->GetCascade (cascade).maxVertex);
+	}
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		if (renderObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+			continue;
+		}
+
+		const Transform* transform = renderObject->GetTransform ();
+		Resource<ModelView> modelView = renderObject->GetModelView ();
+
+		state.Add (renderObject);
+		state.Add (&*modelView);
+		state.Add (transform->GetPosition ());
+		state.Add (transform->GetRotation ());
+		state.Add (transform->GetScale ());
+
+		if (renderObject->GetSceneLayers () & SceneLayer::ANIMATION) {
+			state.SetAnimated ();
+		}
+	}
+
+	return state;
+}
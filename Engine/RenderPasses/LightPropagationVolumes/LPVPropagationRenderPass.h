@@ -7,6 +7,9 @@
 #include "Renderer/RenderViews/ShaderView.h"
 
 #include "LPVPropagationVolume.h"
+#include "LPVPropagationScheduler.h"
+
+#include "Renderer/RenderLightObject.h"
 
 class ENGINE_API LPVPropagationRenderPass : public ContainerRenderSubPassI
 {
@@ -14,9 +17,12 @@ class ENGINE_API LPVPropagationRenderPass : public ContainerRenderSubPassI
 
 protected:
 	Resource<ShaderView> _shaderView;
-	LPVPropagationVolume* _lpvPropagationVolume;
+	LPVPropagationVolume* _lpvPropagationVolumes [2];
 	LPVPropagationVolume* _lpvAccumulationVolume;
 
+	LPVPropagationScheduler _scheduler;
+	const RenderLightObject* _renderLightObject;
+
 public:
 	LPVPropagationRenderPass ();
 	~LPVPropagationRenderPass ();
@@ -30,13 +36,19 @@ protected:
 	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
 
-	void StartPostProcessPass ();
+	void StartPostProcessPass (const LPVPropagationStep& step);
 	void PostProcessPass (const RenderScene* renderScene, const Camera* camera,
-		const RenderSettings& settings, RenderVolumeCollection* rvc);
+		const RenderSettings& settings, RenderVolumeCollection* rvc, const LPVPropagationStep& step);
 	void EndPostProcessPass ();
 
 	void InitLPVVolume (const RenderSettings& settings);
 	void UpdateLPVVolume (const RenderSettings& settings);
+
+	LPVPropagationStep SchedulePropagation (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc);
+	LPVInjectionState GetInjectionState (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderLightObject* renderLightObject,
+		const LPVVolume* lpvVolume) const;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "LPVPropagationScheduler.h"
+
+#include <algorithm>
+#include <functional>
+
+LPVInjectionState::LPVInjectionState () :
+	_hash (0),
+	_isAnimated (false)
+{
+
+}
+
+void LPVInjectionState::Add (std::size_t value)
+{
+	_hash ^= value + 0x9e3779b9 + (_hash << 6) + (_hash >> 2);
+}
+
+void LPVInjectionState::Add (float value)
+{
+	Add (std::hash<float> () (value));
+}
+
+void LPVInjectionState::Add (const void* pointer)
+{
+	Add (std::hash<const void*> () (pointer));
+}
+
+void LPVInjectionState::Add (const glm::vec3& value)
+{
+	for (std::size_t i=0;i<3;i++) {
+		Add (value [i]);
+	}
+}
+
+void LPVInjectionState::Add (const glm::vec4& value)
+{
+	for (std::size_t i=0;i<4;i++) {
+		Add (value [i]);
+	}
+}
+
+void LPVInjectionState::Add (const glm::quat& value)
+{
+	Add (glm::vec4 (value.x, value.y, value.z, value.w));
+}
+
+void LPVInjectionState::SetAnimated ()
+{
+	_isAnimated = true;
+}
+
+std::size_t LPVInjectionState::GetHash () const
+{
+	return _hash;
+}
+
+bool LPVInjectionState::IsAnimated () const
+{
+	return _isAnimated;
+}
+
+LPVPropagationScheduler::LPVPropagationScheduler () :
+	_injectionHash (0),
+	_iterationsCount (0),
+	_completedIterations (0),
+	_restartsCount (0),
+	_isValid (false)
+{
+
+}
+
+LPVPropagationStep LPVPropagationScheduler::Schedule (const LPVInjectionState& state,
+	std::size_t iterationsCount, std::size_t budget)
+{
+	/*
+	 * More iterations continue the propagation already started, fewer
+	 * need it to start over since the accumulation went too far
+	*/
+
+	bool isRestart = _isValid == false || state.IsAnimated () == true ||
+		state.GetHash () != _injectionHash || iterationsCount < _completedIterations;
+
+	if (isRestart == true) {
+		_injectionHash = state.GetHash ();
+		_completedIterations = 0;
+		_isValid = true;
+
+		++ _restartsCount;
+	}
+
+	_iterationsCount = iterationsCount;
+
+	std::size_t remainingIterations = _iterationsCount - _completedIterations;
+
+	/*
+	 * A budget of zero runs the whole propagation at once
+	*/
+
+	if (budget > 0) {
+		remainingIterations = std::min (remainingIterations, budget);
+	}
+
+	LPVPropagationStep step = { _completedIterations, remainingIterations, isRestart };
+
+	_completedIterations += remainingIterations;
+
+	/*
+	 * The pose of the last animated frame is not known by the hash
+	*/
+
+	if (state.IsAnimated () == true) {
+		_isValid = false;
+	}
+
+	return step;
+}
+
+void LPVPropagationScheduler::Invalidate ()
+{
+	_isValid = false;
+}
+
+std::size_t LPVPropagationScheduler::GetCompletedIterations () const
+{
+	return _completedIterations;
+}
+
+std::size_t LPVPropagationScheduler::GetRestartsCount () const
+{
+	return _restartsCount;
+}
+
+bool LPVPropagationScheduler::IsConverged () const
+{
+	return _isValid == true && _completedIterations == _iterationsCount;
+}
\ No newline at end of file
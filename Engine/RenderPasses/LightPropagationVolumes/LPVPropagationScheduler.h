@@ -0,0 +1,80 @@
+#ifndef LPVPROPAGATIONSCHEDULER_H
+#define LPVPROPAGATIONSCHEDULER_H
+
+#include <cstddef>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/*
+ * Fingerprint of everything the injected volumes are built from: lights,
+ * the objects seen by the reflective shadow map, the scene bounds and the
+ * injection settings. Skinned meshes change without any of these, so they
+ * mark the state as animated instead.
+*/
+
+class ENGINE_API LPVInjectionState
+{
+protected:
+	std::size_t _hash;
+	bool _isAnimated;
+
+public:
+	LPVInjectionState ();
+
+	void Add (std::size_t value);
+	void Add (float value);
+	void Add (const void* pointer);
+	void Add (const glm::vec3& value);
+	void Add (const glm::vec4& value);
+	void Add (const glm::quat& value);
+
+	void SetAnimated ();
+
+	std::size_t GetHash () const;
+	bool IsAnimated () const;
+};
+
+/*
+ * Propagation iterations to dispatch on the current frame, the ones
+ * before firstIteration were dispatched on previous frames
+*/
+
+struct ENGINE_API LPVPropagationStep
+{
+	std::size_t firstIteration;
+	std::size_t iterationsCount;
+	bool isRestart;
+};
+
+/*
+ * Propagation is a fixed point of the injected volumes. While they stay
+ * the same, the wavefront and the accumulation volume are kept between
+ * frames and the remaining iterations are spread over the next frames, at
+ * most budget per frame. Once all of them are done nothing is dispatched
+ * until the injection changes again. Keeps no GPU state.
+*/
+
+class ENGINE_API LPVPropagationScheduler
+{
+protected:
+	std::size_t _injectionHash;
+	std::size_t _iterationsCount;
+	std::size_t _completedIterations;
+	std::size_t _restartsCount;
+	bool _isValid;
+
+public:
+	LPVPropagationScheduler ();
+
+	LPVPropagationStep Schedule (const LPVInjectionState& state,
+		std::size_t iterationsCount, std::size_t budget);
+
+	void Invalidate ();
+
+	std::size_t GetCompletedIterations () const;
+	std::size_t GetRestartsCount () const;
+	bool IsConverged () const;
+};
+
+#endif
\ No newline at end of file
@@ -4,13 +4,15 @@
 
 #include "Core/Console/Console.h"
 
-bool LPVPropagationVolume::Init(std::size_t volumeSize)
+bool LPVPropagationVolume::Init(std::size_t volumeSize, std::size_t cascadesCount)
 {
 	/*
 	 * Keep new current volume size
 	*/
 
 	_volumeSize = volumeSize;
+	_cascadesCount = cascadesCount;
+	_cascades.resize (_cascadesCount, LPVCascade { _minVertex, _maxVertex });
 
 	/*
 	 * Create an fbo for clearing the 3D texture.
@@ -28,7 +30,7 @@ bool LPVPropagationVolume::Init(std::size_t volumeSize)
 
 	for (std::size_t index = 0; index < 3; index ++) {
 		GL::BindTexture (GL_TEXTURE_3D, _volumeTextures [index]);
-		GL::TexImage3D (GL_TEXTURE_3D, 0, GL_RGBA32F, _volumeSize, _volumeSize, _volumeSize,
+		GL::TexImage3D (GL_TEXTURE_3D, 0, GL_RGBA32F, _volumeSize, _volumeSize, _volumeSize * _cascadesCount,
 			0, GL_RGBA,  GL_FLOAT, 0);
 		GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -61,35 +63,24 @@ bool LPVPropagationVolume::Init(std::size_t volumeSize)
 	PipelineAttribute volumeTextureR;
 	PipelineAttribute volumeTextureG;
 	PipelineAttribute volumeTextureB;
-	PipelineAttribute minVertex;
-	PipelineAttribute maxVertex;
-	PipelineAttribute volumeSizeAttribute;
 
 	volumeTextureR.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
 	volumeTextureG.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
 	volumeTextureB.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
-	minVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	maxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	volumeSizeAttribute.type = PipelineAttribute::AttrType::ATTR_3I;
 
 	volumeTextureR.name = "volumeTextureR";
 	volumeTextureG.name = "volumeTextureG";
 	volumeTextureB.name = "volumeTextureB";
-	minVertex.name = "minVertex";
-	maxVertex.name = "maxVertex";
-	volumeSizeAttribute.name = "volumeSize";
 
 	volumeTextureR.value.x = _volumeTextures [0];
 	volumeTextureG.value.x = _volumeTextures [1];
 	volumeTextureB.value.x = _volumeTextures [2];
-	volumeSizeAttribute.value = glm::vec3 ((float) _volumeSize);
 
 	_attributes.push_back (volumeTextureR);
 	_attributes.push_back (volumeTextureG);
 	_attributes.push_back (volumeTextureB);
-	_attributes.push_back (minVertex);
-	_attributes.push_back (maxVertex);
-	_attributes.push_back (volumeSizeAttribute);
+
+	AddVolumeAttributes ();
 
 	return true;
 }
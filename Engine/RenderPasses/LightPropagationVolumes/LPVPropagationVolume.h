@@ -8,7 +8,7 @@
 class LPVPropagationVolume : public LPVVolume
 {
 public:
-	virtual bool Init (std::size_t size);
+	virtual bool Init (std::size_t size, std::size_t cascadesCount = 1);
 
 	virtual void BindForWriting (std::size_t index = 0);
 };
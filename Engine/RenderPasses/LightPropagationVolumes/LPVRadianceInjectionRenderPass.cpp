@@ -19,7 +19,7 @@ void LPVRadianceInjectionRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesRadianceInjectionFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void LPVRadianceInjectionRenderPass::Clear ()
@@ -6,13 +6,14 @@
 
 #include "Core/Console/Console.h"
 
-bool LPVSampleCountVolume::Init(std::size_t volumeSize)
+bool LPVSampleCountVolume::Init(std::size_t volumeSize, std::size_t cascadesCount)
 {
 	/*
 	 * Keep new current volume size
 	*/
 
 	_volumeSize = volumeSize;
+	_cascadesCount = cascadesCount;
 
 	/*
 	 * Create an fbo for clearing the 3D texture.
@@ -29,7 +30,7 @@ bool LPVSampleCountVolume::Init(std::size_t volumeSize)
 	GL::GenTextures (1, _volumeTextures);
 
 	GL::BindTexture (GL_TEXTURE_3D, _volumeTextures [0]);
-	GL::TexImage3D (GL_TEXTURE_3D, 0, GL_R32UI, _volumeSize, _volumeSize, _volumeSize,
+	GL::TexImage3D (GL_TEXTURE_3D, 0, GL_R32UI, _volumeSize, _volumeSize, _volumeSize * _cascadesCount,
 		0, GL_RED_INTEGER,  GL_UNSIGNED_INT, 0);
 	GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
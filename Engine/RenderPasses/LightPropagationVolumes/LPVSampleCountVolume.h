@@ -6,7 +6,7 @@
 class LPVSampleCountVolume : public LPVGeometryVolume
 {
 public:
-	virtual bool Init (std::size_t size);
+	virtual bool Init (std::size_t size, std::size_t cascadesCount = 1);
 
 	virtual void BindForWriting ();
 };
@@ -25,7 +25,7 @@ void LPVSampleEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& s
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionGeometry.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -37,7 +37,7 @@ void LPVSampleEmissiveRadianceInjectionRenderPass::Init (const RenderSettings& s
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesCacheEmissiveRadianceInjectionGeometry.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 RenderVolumeCollection* LPVSampleEmissiveRadianceInjectionRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -18,7 +18,7 @@ void LPVSampleWeightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightPropagationVolumes/lightPropagationVolumesSampleWeightCompute.glsl"
 	);
 
-	_shaderView = RenderSystem::LoadComputeShader (shader);
+	_shaderView = LoadComputeShader (shader);
 }
 
 void LPVSampleWeightRenderPass::Clear ()
@@ -83,7 +83,8 @@ void LPVSampleWeightRenderPass::PostProcessPass (const RenderScene* renderScene,
 	Pipeline::SendCustomAttributes (_shaderView, lpvSampleCountVolume->GetCustomAttributes ());
 
 	int numWorkGroups = (int) std::ceil (settings.lpv_volume_size / 4.0);
-	GL::DispatchCompute (numWorkGroups, numWorkGroups, numWorkGroups);
+	int numDepthWorkGroups = (int) std::ceil (settings.lpv_volume_size * lpvVolume->GetCascadesCount () / 4.0);
+	GL::DispatchCompute (numWorkGroups, numWorkGroups, numDepthWorkGroups);
 
 	GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
 }
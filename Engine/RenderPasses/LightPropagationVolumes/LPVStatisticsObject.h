@@ -13,6 +13,10 @@ struct ENGINE_API LPVStatisticsObject : public StatisticsObject
 	FramebufferRenderVolume* lpvIndirectSpecularMapVolume;
 	FramebufferRenderVolume* lpvSubsurfaceScatteringMapVolume;
 	FramebufferRenderVolume* lpvAmbientOcclusionMapVolume;
+
+	std::size_t propagationDispatchesCount;
+	std::size_t propagationCompletedIterations;
+	std::size_t propagationRestartsCount;
 };
 
 #endif
\ No newline at end of file
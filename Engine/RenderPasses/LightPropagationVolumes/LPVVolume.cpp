@@ -8,7 +8,11 @@
 
 LPVVolume::LPVVolume() :
 	_volumeFbo(0),
-	_volumeSize(0)
+	_volumeSize(0),
+	_cascadesCount(1),
+	_minVertex(0.0f),
+	_maxVertex(0.0f),
+	_volumeAttributesIndex(0)
 {
 
 }
@@ -18,13 +22,15 @@ LPVVolume::~LPVVolume()
 
 }
 
-bool LPVVolume::Init(std::size_t volumeSize)
+bool LPVVolume::Init(std::size_t volumeSize, std::size_t cascadesCount)
 {
 	/*
 	 * Keep new current volume size
 	*/
 
 	_volumeSize = volumeSize;
+	_cascadesCount = cascadesCount;
+	_cascades.resize (_cascadesCount, LPVCascade { _minVertex, _maxVertex });
 
 	/*
 	 * Create an fbo for clearing the 3D texture.
@@ -42,7 +48,7 @@ bool LPVVolume::Init(std::size_t volumeSize)
 
 	for (std::size_t index = 0; index < 3; index ++) {
 		GL::BindTexture (GL_TEXTURE_3D, _volumeTextures [index]);
-		GL::TexImage3D (GL_TEXTURE_3D, 0, GL_R32I, _volumeSize * 4, _volumeSize, _volumeSize,
+		GL::TexImage3D (GL_TEXTURE_3D, 0, GL_R32I, _volumeSize * 4, _volumeSize, _volumeSize * _cascadesCount,
 			0, GL_RED_INTEGER,  GL_INT, 0);
 		GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		GL::TexParameteri (GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -75,37 +81,81 @@ bool LPVVolume::Init(std::size_t volumeSize)
 	PipelineAttribute volumeTextureR;
 	PipelineAttribute volumeTextureG;
 	PipelineAttribute volumeTextureB;
-	PipelineAttribute minVertex;
-	PipelineAttribute maxVertex;
-	PipelineAttribute volumeSizeAttribute;
 
 	volumeTextureR.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
 	volumeTextureG.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
 	volumeTextureB.type = PipelineAttribute::AttrType::ATTR_TEXTURE_3D;
-	minVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	maxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
-	volumeSizeAttribute.type = PipelineAttribute::AttrType::ATTR_3I;
 
 	volumeTextureR.name = "volumeTextureR";
 	volumeTextureG.name = "volumeTextureG";
 	volumeTextureB.name = "volumeTextureB";
-	minVertex.name = "minVertex";
-	maxVertex.name = "maxVertex";
-	volumeSizeAttribute.name = "volumeSize";
 
 	volumeTextureR.value.x = _volumeTextures [0];
 	volumeTextureG.value.x = _volumeTextures [1];
 	volumeTextureB.value.x = _volumeTextures [2];
-	volumeSizeAttribute.value = glm::vec3 ((float) _volumeSize);
 
 	_attributes.push_back (volumeTextureR);
 	_attributes.push_back (volumeTextureG);
 	_attributes.push_back (volumeTextureB);
+
+	AddVolumeAttributes ();
+
+	return true;
+}
+
+void LPVVolume::AddVolumeAttributes ()
+{
+	_volumeAttributesIndex = _attributes.size ();
+
+	PipelineAttribute minVertex;
+	PipelineAttribute maxVertex;
+	PipelineAttribute volumeSizeAttribute;
+	PipelineAttribute cascadesCount;
+
+	minVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+	maxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+	volumeSizeAttribute.type = PipelineAttribute::AttrType::ATTR_3I;
+	cascadesCount.type = PipelineAttribute::AttrType::ATTR_1I;
+
+	minVertex.name = "minVertex";
+	maxVertex.name = "maxVertex";
+	volumeSizeAttribute.name = "volumeSize";
+	cascadesCount.name = "lpvCascades";
+
+	volumeSizeAttribute.value = glm::vec3 ((float) _volumeSize);
+	cascadesCount.value.x = _cascadesCount;
+
 	_attributes.push_back (minVertex);
 	_attributes.push_back (maxVertex);
 	_attributes.push_back (volumeSizeAttribute);
+	_attributes.push_back (cascadesCount);
 
-	return true;
+	for (std::size_t cascade = 0; cascade < _cascadesCount; cascade++) {
+		PipelineAttribute cascadeMinVertex;
+		PipelineAttribute cascadeMaxVertex;
+
+		cascadeMinVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+		cascadeMaxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+
+		cascadeMinVertex.name = "lpvCascadeMinVertex[" + std::to_string (cascade) + "]";
+		cascadeMaxVertex.name = "lpvCascadeMaxVertex[" + std::to_string (cascade) + "]";
+
+		_attributes.push_back (cascadeMinVertex);
+		_attributes.push_back (cascadeMaxVertex);
+	}
+
+	UpdateVolumeAttributes ();
+}
+
+void LPVVolume::UpdateVolumeAttributes ()
+{
+	_attributes [_volumeAttributesIndex].value = _minVertex;
+	_attributes [_volumeAttributesIndex + 1].value = _maxVertex;
+
+	for (std::size_t cascade = 0; cascade < _cascadesCount; cascade++) {
+		_attributes [_volumeAttributesIndex + 4 + cascade * 2].value = _cascades [cascade].minVertex;
+		_attributes [_volumeAttributesIndex + 5 + cascade * 2].value = _cascades [cascade].maxVertex;
+	}
 }
 
 void LPVVolume::BindForWriting ()
@@ -168,12 +218,44 @@ void LPVVolume::UpdateBoundingBox(const glm::vec3& minVertex, const glm::vec3& m
 	_minVertex -= glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
 	_maxVertex += glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
 
+	for (LPVCascade& cascade : _cascades) {
+		cascade.minVertex = _minVertex;
+		cascade.maxVertex = _maxVertex;
+	}
+
 	/*
 	 * Update attributes
 	*/
 
-	_attributes [3].value = _minVertex;
-	_attributes [4].value = _maxVertex;
+	UpdateVolumeAttributes ();
+}
+
+void LPVVolume::UpdateCascades (const glm::vec3& center, float cellSize)
+{
+	for (std::size_t cascade = 0; cascade < _cascadesCount; cascade++) {
+		_cascades [cascade] = LPVCascades::GetCascade (center, cellSize, _volumeSize, cascade);
+	}
+
+	/*
+	 * The volume bounds are the bounds of the finest cascade
+	*/
+
+	_minVertex = _cascades [0].minVertex;
+	_maxVertex = _cascades [0].maxVertex;
+
+	UpdateVolumeAttributes ();
+}
+
+void LPVVolume::CopyBounds (const LPVVolume* volume)
+{
+	_minVertex = volume->_minVertex;
+	_maxVertex = volume->_maxVertex;
+
+	for (std::size_t cascade = 0; cascade < _cascadesCount; cascade++) {
+		_cascades [cascade] = volume->GetCascade (std::min (cascade, volume->GetCascadesCount () - 1));
+	}
+
+	UpdateVolumeAttributes ();
 }
 
 std::size_t LPVVolume::GetVolumeSize () const
@@ -181,6 +263,11 @@ std::size_t LPVVolume::GetVolumeSize () const
 	return _volumeSize;
 }
 
+std::size_t LPVVolume::GetCascadesCount () const
+{
+	return _cascadesCount;
+}
+
 glm::vec3 LPVVolume::GetMinVertex () const
 {
 	return _minVertex;
@@ -191,6 +278,11 @@ glm::vec3 LPVVolume::GetMaxVertex () const
 	return _maxVertex;
 }
 
+const LPVCascade& LPVVolume::GetCascade (std::size_t cascade) const
+{
+	return _cascades [cascade];
+}
+
 void LPVVolume::Clear()
 {
 	/*
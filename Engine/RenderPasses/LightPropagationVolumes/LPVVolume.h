@@ -8,37 +8,55 @@
 
 #include "Renderer/PipelineAttribute.h"
 
+#include "LPVCascades.h"
+
 #define LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT 390
 
+/*
+ * Cascades are stacked along the z axis of the volume textures. A volume
+ * fitted to the scene is a single cascade.
+*/
+
 class LPVVolume : public RenderVolumeI
 {
 protected:
 	unsigned int _volumeTextures [3];
 	unsigned int _volumeFbo;
 	std::size_t _volumeSize;
+	std::size_t _cascadesCount;
 
 	glm::vec3 _minVertex;
 	glm::vec3 _maxVertex;
 
+	std::vector<LPVCascade> _cascades;
+
 	std::vector<PipelineAttribute> _attributes;
+	std::size_t _volumeAttributesIndex;
 
 public:
 	LPVVolume ();
 	~LPVVolume ();
 
-	virtual bool Init (std::size_t size);
+	virtual bool Init (std::size_t size, std::size_t cascadesCount = 1);
 
 	virtual void BindForWriting ();
 	virtual const std::vector<PipelineAttribute>& GetCustomAttributes () const;
 
 	virtual void ClearVolume();
 	virtual void UpdateBoundingBox (const glm::vec3& minVertex, const glm::vec3& maxVertex);
+	virtual void UpdateCascades (const glm::vec3& center, float cellSize);
+	void CopyBounds (const LPVVolume* volume);
 
 	std::size_t GetVolumeSize () const;
+	std::size_t GetCascadesCount () const;
 	glm::vec3 GetMinVertex () const;
 	glm::vec3 GetMaxVertex () const;
+	const LPVCascade& GetCascade (std::size_t cascade) const;
 
 	virtual void Clear ();
+protected:
+	void AddVolumeAttributes ();
+	void UpdateVolumeAttributes ();
 };
 
 #endif
\ No newline at end of file
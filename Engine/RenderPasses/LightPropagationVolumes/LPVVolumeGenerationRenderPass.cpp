@@ -52,10 +52,15 @@ RenderVolumeCollection* LPVVolumeGenerationRenderPass::Execute (const RenderScen
 	UpdateLPVVolume (settings);
 
 	/*
-	 * Update voxel volume based on scene bounding box
+	 * Update light propagation volume based on scene bounding box, or
+	 * center the cascades on the camera
 	*/
 
-	UpdateLPVVolumeBoundingBox (renderScene);
+	if (settings.lpv_cascades_enabled == true) {
+		UpdateLPVVolumeCascades (camera, settings);
+	} else {
+		UpdateLPVVolumeBoundingBox (renderScene);
+	}
 
 	_lpvSampleCountVolume->ClearVolume ();
 	_lpvGeometryVolume->ClearVolume ();
@@ -86,23 +91,35 @@ void LPVVolumeGenerationRenderPass::UpdateLPVVolumeBoundingBox (const RenderScen
 	_lpvGeometryVolume->UpdateBoundingBox (minVertex, maxVertex);
 }
 
+void LPVVolumeGenerationRenderPass::UpdateLPVVolumeCascades (const Camera* camera, const RenderSettings& settings)
+{
+	_lpvVolume->UpdateCascades (camera->GetPosition (), settings.lpv_cascade_cell_size);
+	_lpvGeometryVolume->CopyBounds (_lpvVolume);
+}
+
 void LPVVolumeGenerationRenderPass::InitLPVVolume (const RenderSettings& settings)
 {
-	if (!_lpvVolume->Init (settings.lpv_volume_size)) {
+	/*
+	 * Cascades are stacked along z
+	*/
+
+	std::size_t cascadesCount = LPVCascades::GetCascadesCount (settings);
+
+	if (!_lpvVolume->Init (settings.lpv_volume_size, cascadesCount)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
 		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
 	}
 
-	if (!_lpvGeometryVolume->Init (settings.lpv_volume_size)) {
+	if (!_lpvGeometryVolume->Init (settings.lpv_volume_size, cascadesCount)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
 		exit (LIGHT_PROPAGATION_VOLUME_TEXTURE_NOT_INIT);
 	}
 
-	if (!_lpvSampleCountVolume->Init (settings.lpv_volume_size)) {
+	if (!_lpvSampleCountVolume->Init (settings.lpv_volume_size, cascadesCount)) {
 		Console::LogError (std::string () +
 			"Light propagation volume texture cannot be initialized!" +
 			" It is not possible to continue the process. End now!");
@@ -112,7 +129,8 @@ void LPVVolumeGenerationRenderPass::InitLPVVolume (const RenderSettings& setting
 
 void LPVVolumeGenerationRenderPass::UpdateLPVVolume (const RenderSettings& settings)
 {
-	if (_lpvVolume->GetVolumeSize () != settings.lpv_volume_size) {
+	if (_lpvVolume->GetVolumeSize () != settings.lpv_volume_size ||
+		_lpvVolume->GetCascadesCount () != LPVCascades::GetCascadesCount (settings)) {
 
 		/*
 		 * Clear voxel volume
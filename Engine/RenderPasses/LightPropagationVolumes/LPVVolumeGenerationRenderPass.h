@@ -29,6 +29,7 @@ protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
 	void UpdateLPVVolumeBoundingBox (const RenderScene* renderScene);
+	void UpdateLPVVolumeCascades (const Camera* camera, const RenderSettings& settings);
 	void InitLPVVolume (const RenderSettings& settings);
 	void UpdateLPVVolume (const RenderSettings& settings);
 };
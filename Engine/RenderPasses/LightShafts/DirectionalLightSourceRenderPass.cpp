@@ -19,7 +19,7 @@ void DirectionalLightSourceRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightShafts/dirLightSourceFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shader);
+	_shadowShaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* DirectionalLightSourceRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -25,7 +25,7 @@ glm::ivec2 LightShaftsAccumulationRenderPass::GetPostProcessVolumeResolution (co
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* LightShaftsAccumulationRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> LightShaftsAccumulationRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	/*
 	 * Create bloom accumulation framebuffer
@@ -47,5 +47,10 @@ FramebufferRenderVolume* LightShaftsAccumulationRenderPass::CreatePostProcessVol
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool LightShaftsAccumulationRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
@@ -21,7 +21,7 @@ void LightShaftsRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/LightShafts/lightShaftsFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shader);
+	_shadowShaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* LightShaftsRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -0,0 +1,264 @@
+#include "FusedPostProcessRenderPass.h"
+
+#include <set>
+
+#include "RenderPasses/GBuffer.h"
+
+#include "Renderer/Pipeline.h"
+
+#include "Resources/Resources.h"
+#include "Renderer/RenderSystem.h"
+
+#include "Renderer/Render/Shader/DrawingShader.h"
+
+#include "Debug/Profiler/Profiler.h"
+
+FusedPostProcessRenderPass::FusedPostProcessRenderPass (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+	const std::vector<PostProcessFusionStage>& stages) :
+	_renderSubPasses (renderSubPasses),
+	_stages (stages)
+{
+
+}
+
+FusedPostProcessRenderPass::~FusedPostProcessRenderPass ()
+{
+	/*
+	 * Free memory of all fused passes
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		delete renderSubPass;
+	}
+}
+
+void FusedPostProcessRenderPass::Init (const RenderSettings& settings)
+{
+	/*
+	 * Fused passes are initialized by the container before they are grouped
+	*/
+}
+
+bool FusedPostProcessRenderPass::IsPending () const
+{
+	for (auto renderSubPass : _renderSubPasses) {
+		if (renderSubPass->IsPending ()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+RenderVolumeCollection* FusedPostProcessRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Collect enabled passes, the combination identifies the shader
+	*/
+
+	std::vector<PostProcessRenderPass*> renderSubPasses;
+	std::vector<PostProcessFusionStage> stages;
+	std::size_t combination = 0;
+
+	for (std::size_t i=0;i<_renderSubPasses.size ();i++) {
+		if (!_renderSubPasses [i]->IsReady () || !_renderSubPasses [i]->IsAvailable (renderScene, camera, settings, rvc)) {
+			continue;
+		}
+
+		PostProcessFusionStage stage = _stages [i];
+		stage.resolution = _renderSubPasses [i]->GetPostProcessVolumeResolution (settings);
+
+		renderSubPasses.push_back (_renderSubPasses [i]);
+		stages.push_back (stage);
+
+		combination |= (std::size_t) 1 << i;
+	}
+
+	/*
+	 * Check that enabled passes still form a single group
+	*/
+
+	auto groups = PostProcessFusion::Plan (stages);
+
+	if (groups.size () != 1 || groups.front ().size () != stages.size ()) {
+		return ExecuteSeparately (renderSubPasses, renderScene, camera, settings, rvc);
+	}
+
+	Resource<ShaderView> shaderView = GetShaderView (combination, stages);
+
+	if (!shaderView->IsReady ()) {
+		return ExecuteSeparately (renderSubPasses, renderScene, camera, settings, rvc);
+	}
+
+	return ExecuteFused (renderSubPasses, shaderView, camera, settings, rvc);
+}
+
+bool FusedPostProcessRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	for (auto renderSubPass : _renderSubPasses) {
+		if (renderSubPass->IsAvailable (renderScene, camera, settings, rvc)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FusedPostProcessRenderPass::Clear ()
+{
+	/*
+	 * Clear every fused pass
+	*/
+
+	for (auto renderSubPass : _renderSubPasses) {
+		renderSubPass->Clear ();
+	}
+
+	_shaderViews.clear ();
+}
+
+RenderVolumeCollection* FusedPostProcessRenderPass::ExecuteSeparately (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+	const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	for (auto renderSubPass : renderSubPasses) {
+		PROFILER_LOGGER(renderSubPass->GetName ())
+		PROFILER_GPU_LOGGER(renderSubPass->GetName ())
+
+		rvc = renderSubPass->Execute (renderScene, camera, settings, rvc);
+	}
+
+	return rvc;
+}
+
+RenderVolumeCollection* FusedPostProcessRenderPass::ExecuteFused (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+	const Resource<ShaderView>& shaderView, const Camera* camera, const RenderSettings& settings,
+	RenderVolumeCollection* rvc)
+{
+	PostProcessRenderPass* lastRenderSubPass = renderSubPasses.back ();
+
+	/*
+	 * Only the last pass of the group writes its volume
+	*/
+
+	lastRenderSubPass->PreparePostProcessVolume (settings, rvc);
+
+	lastRenderSubPass->StartPostProcessPass ();
+
+	/*
+	 * Set viewport
+	*/
+
+	glm::ivec2 volumeResolution = lastRenderSubPass->GetPostProcessVolumeResolution (settings);
+
+	GL::Viewport (0, 0, volumeResolution.x, volumeResolution.y);
+
+	/*
+	 * Enable color blending
+	*/
+
+	GL::Enable (GL_BLEND);
+	GL::BlendFunc (GL_ONE, GL_ZERO);
+
+	/*
+	 * Disable face culling
+	*/
+
+	GL::Disable (GL_CULL_FACE);
+
+	/*
+	 * Lock fused shader
+	*/
+
+	Pipeline::LockShader (shaderView);
+
+	/*
+	 * Update matrices
+	*/
+
+	Pipeline::CreateProjection (((GBuffer*) rvc->GetRenderVolume ("GBuffer"))->GetProjectionMatrix ());
+	Pipeline::SendCamera (camera);
+	Pipeline::SetObjectTransform (Transform::Default ());
+
+	Pipeline::UpdateMatrices (nullptr);
+
+	/*
+	 * Send the uniforms of every fused pass
+	*/
+
+	Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (renderSubPasses, camera, settings, rvc));
+
+	/*
+	 * Draw a screen covering triangle
+	*/
+
+	GL::DrawArrays (GL_TRIANGLES, 0, 3);
+
+	lastRenderSubPass->EndPostProcessPass ();
+
+	return rvc->Insert (lastRenderSubPass->GetPostProcessVolumeName (), lastRenderSubPass->_postProcessMapVolume);
+}
+
+Resource<ShaderView> FusedPostProcessRenderPass::GetShaderView (std::size_t combination,
+	const std::vector<PostProcessFusionStage>& stages)
+{
+	auto it = _shaderViews.find (combination);
+
+	if (it != _shaderViews.end ()) {
+		return it->second;
+	}
+
+	std::string name = GetName ();
+
+	for (const PostProcessFusionStage& stage : stages) {
+		name += ":" + stage.snippet.function;
+	}
+
+	/*
+	 * Other modules could fuse the same passes
+	*/
+
+	Resource<Shader> shader = Resource<Shader>::GetResource (name);
+
+	if (shader == nullptr) {
+		Resource<ShaderContent> fragmentShaderContent = Resource<ShaderContent> (new ShaderContent (), name);
+
+		fragmentShaderContent->SetFilename (name);
+		fragmentShaderContent->SetContent (PostProcessFusion::GenerateSource (stages));
+
+		DrawingShader* drawingShader = new DrawingShader (name);
+
+		drawingShader->SetVertexShaderContent (Resources::LoadShaderContent ("Assets/Shaders/PostProcess/postProcessVertex.glsl"));
+		drawingShader->SetFragmentShaderContent (fragmentShaderContent);
+
+		shader = Resource<Shader> (drawingShader, name);
+	}
+
+	Resource<ShaderView> shaderView = RenderSystem::LoadShader (shader);
+
+	_shaderViews [combination] = shaderView;
+
+	return shaderView;
+}
+
+std::vector<PipelineAttribute> FusedPostProcessRenderPass::GetCustomAttributes (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+	const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Every pass repeats the volume attributes, keep the first of each name
+	*/
+
+	std::vector<PipelineAttribute> attributes;
+	std::set<std::string> names;
+
+	for (auto renderSubPass : renderSubPasses) {
+		for (const PipelineAttribute& attribute : renderSubPass->GetCustomAttributes (camera, settings, rvc)) {
+			if (names.insert (attribute.name).second == true) {
+				attributes.push_back (attribute);
+			}
+		}
+	}
+
+	return attributes;
+}
@@ -0,0 +1,54 @@
+#ifndef FUSEDPOSTPROCESSRENDERPASS_H
+#define FUSEDPOSTPROCESSRENDERPASS_H
+
+#include "RenderPasses/Container/ContainerRenderSubPassI.h"
+
+#include <vector>
+#include <map>
+
+#include "PostProcessRenderPass.h"
+#include "PostProcessFusion.h"
+
+/*
+ * Runs a group of adjacent per pixel post process passes with a generated
+ * shader in a single draw. Only the output of the last enabled pass is
+ * written, the group falls back to separate passes while the shader of
+ * the current combination is not ready.
+*/
+
+class ENGINE_API FusedPostProcessRenderPass : public ContainerRenderSubPassI
+{
+	DECLARE_RENDER_PASS(FusedPostProcessRenderPass)
+
+protected:
+	std::vector<PostProcessRenderPass*> _renderSubPasses;
+	std::vector<PostProcessFusionStage> _stages;
+	std::map<std::size_t, Resource<ShaderView>> _shaderViews;
+
+public:
+	FusedPostProcessRenderPass (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+		const std::vector<PostProcessFusionStage>& stages);
+	~FusedPostProcessRenderPass ();
+
+	void Init (const RenderSettings& settings);
+	bool IsPending () const;
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+
+	void Clear ();
+protected:
+	RenderVolumeCollection* ExecuteSeparately (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+		const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc);
+	RenderVolumeCollection* ExecuteFused (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+		const Resource<ShaderView>& shaderView, const Camera* camera, const RenderSettings& settings,
+		RenderVolumeCollection* rvc);
+
+	Resource<ShaderView> GetShaderView (std::size_t combination, const std::vector<PostProcessFusionStage>& stages);
+	std::vector<PipelineAttribute> GetCustomAttributes (const std::vector<PostProcessRenderPass*>& renderSubPasses,
+		const Camera* camera, const RenderSettings& settings, RenderVolumeCollection* rvc);
+};
+
+#endif
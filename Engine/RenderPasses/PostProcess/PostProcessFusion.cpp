@@ -0,0 +1,151 @@
+#include "PostProcessFusion.h"
+
+std::vector<std::vector<std::size_t>> PostProcessFusion::Plan (const std::vector<PostProcessFusionStage>& stages)
+{
+	std::vector<std::vector<std::size_t>> groups;
+	std::vector<std::size_t> group;
+
+	for (std::size_t i=0;i<stages.size ();i++) {
+
+		/*
+		 * Close current group when the stage cannot follow its predecessor
+		*/
+
+		if (group.size () > 0 && !CanFuse (stages [group.back ()], stages [i])) {
+			if (group.size () > 1) {
+				groups.push_back (group);
+			}
+
+			group.clear ();
+		}
+
+		if (IsFusable (stages [i])) {
+			group.push_back (i);
+		}
+	}
+
+	if (group.size () > 1) {
+		groups.push_back (group);
+	}
+
+	return groups;
+}
+
+bool PostProcessFusion::CanFuse (const PostProcessFusionStage& previous, const PostProcessFusionStage& next)
+{
+	if (!IsFusable (previous) || !IsFusable (next)) {
+		return false;
+	}
+
+	/*
+	 * Both passes need to cover the same pixels
+	*/
+
+	if (previous.resolution != next.resolution) {
+		return false;
+	}
+
+	/*
+	 * Next pass should only read what previous one wrote. Previous
+	 * output replaces the same volume, so nothing after the group
+	 * could miss the skipped intermediate result.
+	*/
+
+	return next.snippet.inputVolume == previous.outputVolume &&
+		next.outputVolume == previous.outputVolume;
+}
+
+bool PostProcessFusion::IsFusable (const PostProcessFusionStage& stage)
+{
+	return stage.snippet.function != std::string () &&
+		stage.snippet.inputMap != std::string () &&
+		stage.content != std::string ();
+}
+
+std::string PostProcessFusion::GenerateSource (const std::vector<PostProcessFusionStage>& stages)
+{
+	std::string source;
+
+	source += "#version 420 core\n\n";
+	source += "layout(location = 0) out vec3 out_color;\n\n";
+	source += "uniform vec2 screenSize;\n\n";
+	source += "uniform sampler2D " + stages.front ().snippet.inputMap + ";\n\n";
+
+	source += "vec2 CalcTexCoord()\n{\n\treturn gl_FragCoord.xy / screenSize;\n}\n\n";
+
+	/*
+	 * Only the store functions of the used formats are emitted
+	*/
+
+	for (POST_PROCESS_FUSION_STORAGE storage : { STORAGE_HALF, STORAGE_UNORM8 }) {
+		for (std::size_t i=0;i+1<stages.size ();i++) {
+			if (stages [i].storage == storage) {
+				source += GetStoreFunction (storage);
+
+				break;
+			}
+		}
+	}
+
+	for (const PostProcessFusionStage& stage : stages) {
+		source += "// " + stage.snippet.path + "\n";
+		source += stage.content + "\n";
+	}
+
+	source += "void main ()\n{\n";
+	source += "\tvec2 texCoord = CalcTexCoord();\n";
+	source += "\tvec3 in_diffuse = texture (" + stages.front ().snippet.inputMap + ", texCoord).xyz;\n\n";
+
+	for (std::size_t i=0;i<stages.size ();i++) {
+		const PostProcessFusionStage& stage = stages [i];
+
+		/*
+		 * Last stage is written to its target like a separate pass
+		*/
+
+		if (i + 1 == stages.size ()) {
+			source += "\tout_color = " + stage.snippet.function + " (in_diffuse);\n";
+
+			break;
+		}
+
+		std::string store;
+
+		switch (stage.storage) {
+			case STORAGE_HALF:
+				store = "StoreHalf";
+				break;
+			case STORAGE_UNORM8:
+				store = "StoreUnorm8";
+				break;
+			default:
+				break;
+		}
+
+		if (store == std::string ()) {
+			source += "\tin_diffuse = " + stage.snippet.function + " (in_diffuse);\n";
+		} else {
+			source += "\tin_diffuse = " + store + " (" + stage.snippet.function + " (in_diffuse));\n";
+		}
+	}
+
+	source += "}\n";
+
+	return source;
+}
+
+std::string PostProcessFusion::GetStoreFunction (POST_PROCESS_FUSION_STORAGE storage)
+{
+	switch (storage) {
+		case STORAGE_HALF:
+			return "vec3 StoreHalf (vec3 color)\n{\n"
+				"\treturn vec3 (unpackHalf2x16 (packHalf2x16 (color.xy)), unpackHalf2x16 (packHalf2x16 (vec2 (color.z, 0.0))).x);\n"
+				"}\n\n";
+		case STORAGE_UNORM8:
+			return "vec3 StoreUnorm8 (vec3 color)\n{\n"
+				"\treturn unpackUnorm4x8 (packUnorm4x8 (vec4 (color, 0.0))).xyz;\n"
+				"}\n\n";
+		default:
+			return std::string ();
+	}
+}
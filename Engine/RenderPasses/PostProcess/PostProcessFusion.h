@@ -0,0 +1,57 @@
+#ifndef POSTPROCESSFUSION_H
+#define POSTPROCESSFUSION_H
+
+#include <string>
+#include <vector>
+#include <glm/vec2.hpp>
+
+enum POST_PROCESS_FUSION_STORAGE
+{
+	STORAGE_FLOAT = 0,
+	STORAGE_HALF,
+	STORAGE_UNORM8
+};
+
+/*
+ * Per pixel function of a post process pass. The function reads one
+ * texel of the input map at the fragment position and returns the color
+ * the pass would write, it must not sample its neighbours.
+*/
+
+struct ENGINE_API PostProcessFusionSnippet
+{
+	std::string path;
+	std::string function;
+	std::string inputVolume;
+	std::string inputMap;
+};
+
+struct ENGINE_API PostProcessFusionStage
+{
+	PostProcessFusionSnippet snippet;
+	std::string content;
+	std::string outputVolume;
+	glm::ivec2 resolution;
+	POST_PROCESS_FUSION_STORAGE storage;
+};
+
+/*
+ * Groups adjacent per pixel passes and generates the fragment shader
+ * that runs a group in a single draw. Intermediate colors are rounded
+ * to the format of the target they would have been written to, so a
+ * fused chain gives the same result as the separate passes.
+*/
+
+class ENGINE_API PostProcessFusion
+{
+public:
+	static std::vector<std::vector<std::size_t>> Plan (const std::vector<PostProcessFusionStage>& stages);
+	static bool CanFuse (const PostProcessFusionStage& previous, const PostProcessFusionStage& next);
+	static bool IsFusable (const PostProcessFusionStage& stage);
+
+	static std::string GenerateSource (const std::vector<PostProcessFusionStage>& stages);
+protected:
+	static std::string GetStoreFunction (POST_PROCESS_FUSION_STORAGE storage);
+};
+
+#endif
@@ -7,10 +7,13 @@
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
+#include "Renderer/RenderTargets/RenderTargetPool.h"
+
 #include "Core/Console/Console.h"
 
 PostProcessRenderPass::PostProcessRenderPass () :
-	_postProcessMapVolume (nullptr)
+	_postProcessMapVolume (nullptr),
+	_postProcessFramebuffer (nullptr)
 {
 
 }
@@ -26,21 +29,34 @@ void PostProcessRenderPass::Init (const RenderSettings& settings)
 		GetPostProcessFragmentShaderPath ()
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 
 	/*
-	 * Create post processing volume
+	 * Create post processing volume, a transient one is taken
+	 * from the render target pool every frame
 	*/
 
+	if (IsPostProcessVolumeTransient () == true) {
+		_postProcessFramebuffer = CreatePostProcessFramebuffer (settings);
+
+		return;
+	}
+
 	_postProcessMapVolume = CreatePostProcessVolume (settings);
 }
 
 void PostProcessRenderPass::Clear ()
 {
 	/*
-	 * Clear post processing volume
+	 * Clear post processing volume, the pool owns transient ones
 	*/
 
+	if (IsPostProcessVolumeTransient () == true) {
+		_postProcessFramebuffer = nullptr;
+
+		return;
+	}
+
 	delete _postProcessMapVolume;
 }
 
@@ -51,7 +67,7 @@ RenderVolumeCollection* PostProcessRenderPass::Execute (const RenderScene* rende
 	 * Update settings
 	*/
 
-	UpdatePostProcessSettings (settings);
+	PreparePostProcessVolume (settings, rvc);
 
 	/*
 	 * Start screen space ambient occlusion generation pass
@@ -74,6 +90,17 @@ RenderVolumeCollection* PostProcessRenderPass::Execute (const RenderScene* rende
 	return rvc->Insert (GetPostProcessVolumeName (), _postProcessMapVolume);
 }
 
+void PostProcessRenderPass::PreparePostProcessVolume (const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	if (IsPostProcessVolumeTransient () == true) {
+		UpdateTransientPostProcessVolume (settings, rvc);
+	}
+
+	if (IsPostProcessVolumeTransient () == false) {
+		UpdatePostProcessSettings (settings);
+	}
+}
+
 void PostProcessRenderPass::StartPostProcessPass ()
 {
 	/*
@@ -171,6 +198,111 @@ void PostProcessRenderPass::UpdatePostProcessSettings (const RenderSettings& set
 	}
 }
 
+void PostProcessRenderPass::UpdateTransientPostProcessVolume (const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	glm::ivec2 volumeResolution = GetPostProcessVolumeResolution (settings);
+
+	auto framebufferSize = _postProcessFramebuffer->GetTexture (0)->GetSize ();
+
+	/*
+	 * Only the description is recreated on resize, the pool keeps
+	 * the targets of the previous resolution for a while
+	*/
+
+	if ((std::size_t) volumeResolution.x != framebufferSize.width ||
+		(std::size_t) volumeResolution.y != framebufferSize.height) {
+
+		_postProcessFramebuffer = CreatePostProcessFramebuffer (settings);
+	}
+
+	_postProcessMapVolume = RenderTargetPool::Instance ()->Acquire (_postProcessFramebuffer, rvc);
+}
+
+FramebufferRenderVolume* PostProcessRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+{
+	return new FramebufferRenderVolume (CreatePostProcessFramebuffer (settings));
+}
+
+Resource<Framebuffer> PostProcessRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
+{
+	/*
+	 * Passes override either this or the volume creation
+	*/
+
+	return nullptr;
+}
+
+bool PostProcessRenderPass::IsPostProcessVolumeTransient () const
+{
+	/*
+	 * Volumes are kept by default, a pass could read its previous
+	 * output or expose it through the statistics
+	*/
+
+	return false;
+}
+
+PostProcessFusionSnippet PostProcessRenderPass::GetPostProcessFusionSnippet () const
+{
+	/*
+	 * Passes are not fused unless they provide their per pixel function
+	*/
+
+	return PostProcessFusionSnippet ();
+}
+
+PostProcessFusionStage PostProcessRenderPass::GetPostProcessFusionStage (const RenderSettings& settings) const
+{
+	PostProcessFusionStage stage;
+
+	stage.snippet = GetPostProcessFusionSnippet ();
+	stage.outputVolume = GetPostProcessVolumeName ();
+	stage.resolution = GetPostProcessVolumeResolution (settings);
+	stage.storage = STORAGE_FLOAT;
+
+	if (stage.snippet.path != std::string ()) {
+		stage.content = Resources::LoadShaderContent (stage.snippet.path)->GetContent ();
+	}
+
+	/*
+	 * Intermediate colors are rounded the way the target stores them
+	*/
+
+	Resource<Framebuffer> framebuffer = IsPostProcessVolumeTransient () == true ?
+		_postProcessFramebuffer : _postProcessMapVolume->GetFramebuffer ();
+
+	Resource<Texture> texture = framebuffer->GetTexture (0);
+
+	switch (texture->GetSizedInternalFormat ()) {
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_R8:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RG8:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGB8:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA8:
+			stage.storage = STORAGE_UNORM8;
+			break;
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RG16F:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGB16:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA16:
+			stage.storage = STORAGE_HALF;
+			break;
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RG32F:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGB32:
+		case TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA32:
+			stage.storage = STORAGE_FLOAT;
+			break;
+		default:
+
+			/*
+			 * There is no exact rounding for other formats, keep the pass apart
+			*/
+
+			stage.content = std::string ();
+			break;
+	}
+
+	return stage;
+}
+
 std::vector<PipelineAttribute> PostProcessRenderPass::GetCustomAttributes (const Camera* camera,
 	const RenderSettings& settings, RenderVolumeCollection* rvc)
 {
@@ -10,14 +10,18 @@
 #include "Renderer/RenderViews/ShaderView.h"
 
 #include "RenderPasses/FramebufferRenderVolume.h"
+#include "RenderPasses/PostProcess/PostProcessFusion.h"
 
 #include "Renderer/PipelineAttribute.h"
 
 class ENGINE_API PostProcessRenderPass : public ContainerRenderSubPassI
 {
+	friend class FusedPostProcessRenderPass;
+
 protected:
 	Resource<ShaderView> _shaderView;
 	FramebufferRenderVolume* _postProcessMapVolume;
+	Resource<Framebuffer> _postProcessFramebuffer;
 
 public:
 	PostProcessRenderPass ();
@@ -27,7 +31,11 @@ public:
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	void Clear ();
+
+	PostProcessFusionStage GetPostProcessFusionStage (const RenderSettings& settings) const;
 protected:
+	void PreparePostProcessVolume (const RenderSettings& settings, RenderVolumeCollection* rvc);
+
 	virtual void StartPostProcessPass ();
 	virtual void PostProcessPass (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
@@ -37,11 +45,17 @@ protected:
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	virtual void UpdatePostProcessSettings (const RenderSettings& settings);
+	void UpdateTransientPostProcessVolume (const RenderSettings& settings, RenderVolumeCollection* rvc);
 
 	virtual std::string GetPostProcessFragmentShaderPath () const = 0;
 	virtual std::string GetPostProcessVolumeName () const = 0;
 	virtual glm::ivec2 GetPostProcessVolumeResolution (const RenderSettings& settings) const = 0;
-	virtual FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const = 0;
+	virtual FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+	virtual Resource<Framebuffer> CreatePostProcessFramebuffer (const RenderSettings& settings) const;
+
+	virtual bool IsPostProcessVolumeTransient () const;
+
+	virtual PostProcessFusionSnippet GetPostProcessFusionSnippet () const;
 };
 
 #endif
\ No newline at end of file
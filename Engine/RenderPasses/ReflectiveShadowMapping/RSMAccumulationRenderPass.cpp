@@ -1,6 +1,7 @@
 #include "RSMAccumulationRenderPass.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
 
 #include "Core/Intersections/Intersection.h"
 
@@ -176,7 +177,10 @@ void RSMAccumulationRenderPass::ShadowMapGeometryPass (const RenderScene* render
 		* Render object on shadow map
 		*/
 
-		renderObject->Draw ();
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, lightCamera,
+			shadow.resolution.y, settings, settings.lod_gi_bias);
+
+		renderObject->Draw (levelOfDetail);
 	}
 }
 
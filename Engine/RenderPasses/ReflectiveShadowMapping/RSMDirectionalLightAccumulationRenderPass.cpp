@@ -24,7 +24,7 @@ void RSMDirectionalLightAccumulationRenderPass::Init (const RenderSettings& sett
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapAccumulationFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -35,7 +35,7 @@ void RSMDirectionalLightAccumulationRenderPass::Init (const RenderSettings& sett
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapAccumulationFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 Camera* RSMDirectionalLightAccumulationRenderPass::GetLightCamera (const RenderScene* renderScene, const RenderLightObject* renderLightObject)
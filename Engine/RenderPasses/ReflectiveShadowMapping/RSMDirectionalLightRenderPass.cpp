@@ -16,7 +16,7 @@ void RSMDirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveDeferredDirVolShadowMapLightFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shadowShader);
+	_shadowShaderView = LoadShader (shadowShader);
 }
 
 void RSMDirectionalLightRenderPass::Clear ()
@@ -14,7 +14,7 @@ void RSMDirectionalLightViewAccumulationRenderPass::Init (const RenderSettings&
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapAccumulationFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -25,7 +25,7 @@ void RSMDirectionalLightViewAccumulationRenderPass::Init (const RenderSettings&
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapAccumulationFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 void RSMDirectionalLightViewAccumulationRenderPass::StartShadowMapPass (const Camera* lightCamera)
@@ -0,0 +1,79 @@
+#include "RSMInterleavedSampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+
+#include "Utils/Sequences/HaltonGenerator.h"
+
+std::vector<glm::vec2> RSMInterleavedSampling::GenerateSamples (std::size_t samplesCount)
+{
+	std::vector<glm::vec2> samples;
+
+	HaltonGenerator haltonGenerator (2, 3);
+
+	for (std::size_t index = 0; index < samplesCount; index++) {
+		samples.push_back (haltonGenerator.Next () * 2.0f - 1.0f);
+	}
+
+	return samples;
+}
+
+std::size_t RSMInterleavedSampling::GetSubsetsCount (std::size_t interleaveSize, std::size_t samplesCount)
+{
+	interleaveSize = std::max ((std::size_t) 1, std::min (interleaveSize, (std::size_t) MAX_RSM_INTERLEAVE_SIZE));
+
+	/*
+	 * Every subset keeps at least one sample
+	*/
+
+	return std::max ((std::size_t) 1, std::min (interleaveSize * interleaveSize, samplesCount));
+}
+
+RSMSampleRange RSMInterleavedSampling::GetSubsetRange (std::size_t samplesCount, std::size_t subsetsCount,
+	std::size_t subset)
+{
+	RSMSampleRange range;
+
+	range.first = subset * samplesCount / subsetsCount;
+	range.count = (subset + 1) * samplesCount / subsetsCount - range.first;
+
+	return range;
+}
+
+std::size_t RSMInterleavedSampling::GetPixelSubset (const glm::ivec2& pixel, std::size_t interleaveSize,
+	std::size_t subsetsCount, std::size_t frameIndex)
+{
+	std::size_t patternX = (std::size_t) pixel.x % interleaveSize;
+	std::size_t patternY = (std::size_t) pixel.y % interleaveSize;
+
+	return (patternY * interleaveSize + patternX + frameIndex) % subsetsCount;
+}
+
+bool RSMInterleavedSampling::IsHistoryValid (float distance, const glm::vec3& normal,
+	float historyDistance, const glm::vec3& historyNormal,
+	float maxDistance, float minAngleCos)
+{
+	/*
+	 * The history keeps the distance of each pixel to the camera of its
+	 * frame and the current position is measured from that same camera,
+	 * so a disoccluded surface shows up as a jump in distance
+	*/
+
+	if (std::abs (distance - historyDistance) > maxDistance * distance) {
+		return false;
+	}
+
+	return glm::dot (normal, historyNormal) >= minAngleCos;
+}
+
+float RSMInterleavedSampling::GetHistoryWeight (float historyLength, std::size_t subsetsCount)
+{
+	/*
+	 * A running average over the frames of one subsets rotation
+	*/
+
+	float frames = std::min (historyLength, (float) subsetsCount - 1.0f);
+
+	return frames / (frames + 1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef RSMINTERLEAVEDSAMPLING_H
+#define RSMINTERLEAVEDSAMPLING_H
+
+#include <cstddef>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#define MAX_RSM_INTERLEAVE_SIZE 4
+
+struct ENGINE_API RSMSampleRange
+{
+	std::size_t first;
+	std::size_t count;
+};
+
+/*
+ * The sample set is split into contiguous runs of the Halton sequence,
+ * so every subset still covers the whole sampling disk. Pixels of an
+ * interleave pattern take different subsets and move to the next one
+ * every frame, so after as many frames as subsets each pixel has seen
+ * the whole set.
+ *
+ * The same math is used by the reflective shadow mapping shaders.
+*/
+
+class ENGINE_API RSMInterleavedSampling
+{
+public:
+	static std::vector<glm::vec2> GenerateSamples (std::size_t samplesCount);
+
+	static std::size_t GetSubsetsCount (std::size_t interleaveSize, std::size_t samplesCount);
+	static RSMSampleRange GetSubsetRange (std::size_t samplesCount, std::size_t subsetsCount,
+		std::size_t subset);
+	static std::size_t GetPixelSubset (const glm::ivec2& pixel, std::size_t interleaveSize,
+		std::size_t subsetsCount, std::size_t frameIndex);
+
+	static bool IsHistoryValid (float distance, const glm::vec3& normal,
+		float historyDistance, const glm::vec3& historyNormal,
+		float maxDistance, float minAngleCos);
+	static float GetHistoryWeight (float historyLength, std::size_t subsetsCount);
+};
+
+#endif
\ No newline at end of file
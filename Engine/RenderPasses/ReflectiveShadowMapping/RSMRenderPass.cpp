@@ -18,7 +18,7 @@ void RSMRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void RSMRenderPass::Clear ()
@@ -1,9 +1,13 @@
 #include "RSMSamplesGenerationRenderPass.h"
 
+#include "RenderPasses/VolumetricLightVolume.h"
+
 #include "Core/Console/Console.h"
 
 RSMSamplesGenerationRenderPass::RSMSamplesGenerationRenderPass () :
-	_rsmSamplesVolume (nullptr)
+	_rsmSamplesVolume (nullptr),
+	_renderLightObject (nullptr),
+	_frameIndex (0)
 {
 
 }
@@ -26,6 +30,12 @@ RenderVolumeCollection* RSMSamplesGenerationRenderPass::Execute (const RenderSce
 
 	UpdateRSMSamplesVolume (settings);
 
+	/*
+	 * Pick the samples subsets of this frame
+	*/
+
+	UpdateRSMSamplesInterleaving (settings, rvc);
+
 	return rvc->Insert ("ReflectiveShadowMapSamplesVolume", _rsmSamplesVolume);
 }
 
@@ -62,3 +72,28 @@ void RSMSamplesGenerationRenderPass::UpdateRSMSamplesVolume (const RenderSetting
 		_rsmSamplesVolume = new RSMSamplesVolume (settings.rsm_samples);
 	}
 }
+
+
+void RSMSamplesGenerationRenderPass::UpdateRSMSamplesInterleaving (const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	VolumetricLightVolume* volume = (VolumetricLightVolume*) rvc->GetRenderVolume ("SubpassVolume");
+	const RenderLightObject* renderLightObject = volume->GetRenderLightObject ();
+
+	/*
+	 * The indirect light of a subset is only complete once it is
+	 * accumulated over frames. With more directional lights there is no
+	 * history for each one, so every light takes all the samples.
+	*/
+
+	bool isLightShared = _renderLightObject != nullptr && _renderLightObject != renderLightObject;
+
+	_renderLightObject = renderLightObject;
+
+	std::size_t interleaveSize = 1;
+
+	if (settings.rsm_interleaved_sampling == true && isLightShared == false) {
+		interleaveSize = settings.rsm_interleave_size;
+	}
+
+	_rsmSamplesVolume->SetInterleaving (interleaveSize, ++ _frameIndex);
+}
\ No newline at end of file
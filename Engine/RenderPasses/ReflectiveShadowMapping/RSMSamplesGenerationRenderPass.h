@@ -5,6 +5,8 @@
 
 #include "RSMSamplesVolume.h"
 
+#include "Renderer/RenderLightObject.h"
+
 class RSMSamplesGenerationRenderPass : public VolumetricLightRenderPassI
 {
 	DECLARE_RENDER_PASS(RSMSamplesGenerationRenderPass)
@@ -12,6 +14,9 @@ class RSMSamplesGenerationRenderPass : public VolumetricLightRenderPassI
 protected:
 	RSMSamplesVolume* _rsmSamplesVolume;
 
+	const RenderLightObject* _renderLightObject;
+	std::size_t _frameIndex;
+
 public:
 	RSMSamplesGenerationRenderPass ();
 
@@ -24,6 +29,7 @@ public:
 	void Clear ();
 protected:
 	virtual void UpdateRSMSamplesVolume (const RenderSettings& settings);
+	virtual void UpdateRSMSamplesInterleaving (const RenderSettings& settings, RenderVolumeCollection* rvc);
 };
 
 #endif
@@ -5,27 +5,28 @@
 #include "RSMSamplesVolume.h"
 
 #include <cstring>
+#include <algorithm>
 
 #include "Wrappers/OpenGL/GL.h"
 
 #include "Core/Random/Random.h"
 
-#include "Utils/Sequences/HaltonGenerator.h"
+#include "RSMInterleavedSampling.h"
 
 RSMSamplesVolume::RSMSamplesVolume (std::size_t samplesCount) :
-	_samplesUBO (0)
+	_samplesUBO (0),
+	_subsetsCount (1),
+	_frameIndex (0)
 {
 	std::memset (&_samples, 0, sizeof (_samples));
 
 	_samples.samplesCount = samplesCount;
 
-	HaltonGenerator haltonGenerator (2, 3);
+	std::vector<glm::vec2> samples = RSMInterleavedSampling::GenerateSamples (samplesCount);
 
 	for (std::size_t index = 0; index < samplesCount; index++) {
-		glm::vec2 sample = haltonGenerator.Next () * 2.0f - 1.0f;
-
-		_samples.samples [index * 4] = sample.x;
-		_samples.samples [index * 4 + 1] = sample.y;
+		_samples.samples [index * 4] = samples [index].x;
+		_samples.samples [index * 4 + 1] = samples [index].y;
 	}
 
 	GL::GenBuffers (1, &_samplesUBO);
@@ -40,14 +41,29 @@ RSMSamplesVolume::RSMSamplesVolume (std::size_t samplesCount) :
 	std::vector<PipelineAttribute> attributes;
 
 	PipelineAttribute rsmSamples;
+	PipelineAttribute rsmSubsetsCount;
+	PipelineAttribute rsmInterleaveSize;
+	PipelineAttribute rsmFrameIndex;
 
 	rsmSamples.type = PipelineAttribute::AttrType::ATTR_BLOCK;
+	rsmSubsetsCount.type = PipelineAttribute::AttrType::ATTR_1I;
+	rsmInterleaveSize.type = PipelineAttribute::AttrType::ATTR_1I;
+	rsmFrameIndex.type = PipelineAttribute::AttrType::ATTR_1I;
 
 	rsmSamples.name = "rsmSamples";
+	rsmSubsetsCount.name = "rsmSubsetsCount";
+	rsmInterleaveSize.name = "rsmInterleaveSize";
+	rsmFrameIndex.name = "rsmFrameIndex";
 
 	rsmSamples.value.x = _samplesUBO;
+	rsmSubsetsCount.value.x = 1;
+	rsmInterleaveSize.value.x = 1;
+	rsmFrameIndex.value.x = 0;
 
 	_attributes.push_back (rsmSamples);
+	_attributes.push_back (rsmSubsetsCount);
+	_attributes.push_back (rsmInterleaveSize);
+	_attributes.push_back (rsmFrameIndex);
 }
 
 RSMSamplesVolume::~RSMSamplesVolume ()
@@ -60,7 +76,34 @@ const std::vector<PipelineAttribute>& RSMSamplesVolume::GetCustomAttributes () c
 	return _attributes;
 }
 
+void RSMSamplesVolume::SetInterleaving (std::size_t interleaveSize, std::size_t frameIndex)
+{
+	_subsetsCount = RSMInterleavedSampling::GetSubsetsCount (interleaveSize, _samples.samplesCount);
+	_frameIndex = frameIndex;
+
+	interleaveSize = std::min (interleaveSize, (std::size_t) MAX_RSM_INTERLEAVE_SIZE);
+
+	_attributes [1].value.x = _subsetsCount;
+	_attributes [2].value.x = _subsetsCount > 1 ? interleaveSize : 1;
+
+	/*
+	 * The frame index only rotates the subsets, so keep it small
+	*/
+
+	_attributes [3].value.x = _frameIndex % _subsetsCount;
+}
+
 std::size_t RSMSamplesVolume::GetSize () const
 {
 	return _samples.samplesCount;
 }
+
+std::size_t RSMSamplesVolume::GetSubsetsCount () const
+{
+	return _subsetsCount;
+}
+
+std::size_t RSMSamplesVolume::GetFrameIndex () const
+{
+	return _frameIndex;
+}
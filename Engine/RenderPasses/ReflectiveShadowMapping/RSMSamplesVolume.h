@@ -20,6 +20,9 @@ protected:
 	RSMSamples _samples;
 	unsigned int _samplesUBO;
 
+	std::size_t _subsetsCount;
+	std::size_t _frameIndex;
+
 	std::vector<PipelineAttribute> _attributes;
 
 public:
@@ -28,7 +31,11 @@ public:
 
 	const std::vector<PipelineAttribute>& GetCustomAttributes () const;
 
+	void SetInterleaving (std::size_t interleaveSize, std::size_t frameIndex);
+
 	std::size_t GetSize () const;
+	std::size_t GetSubsetsCount () const;
+	std::size_t GetFrameIndex () const;
 };
 
 #endif
@@ -26,7 +26,7 @@ void RSMSpotLightAccumulationRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapSpotLightAccumulationFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -37,7 +37,7 @@ void RSMSpotLightAccumulationRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapSpotLightAccumulationFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 Camera* RSMSpotLightAccumulationRenderPass::GetLightCamera (const RenderScene* renderScene, const RenderLightObject* renderLightObject)
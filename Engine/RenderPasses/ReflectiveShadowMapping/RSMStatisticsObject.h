@@ -17,6 +17,9 @@ struct ENGINE_API RSMStatisticsObject : public StatisticsObject
 	FramebufferRenderVolume* rsmAmbientOcclusionMapVolume;
 
 	FramebufferRenderVolume* rsmInterpolatedIndirectDiffuseMapVolume;
+	FramebufferRenderVolume* rsmTemporalAccumulationMapVolume;
+
+	std::size_t rsmSamplesSubsetsCount;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "RSMTemporalAccumulationRenderPass.h"
+
+#include "RSMSamplesVolume.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "RSMStatisticsObject.h"
+
+#include "Utils/Extensions/MathExtend.h"
+
+RSMTemporalAccumulationRenderPass::RSMTemporalAccumulationRenderPass () :
+	_lastCameraPosition (0.0f),
+	_lastResolution (0),
+	_lastFrameIndex (0),
+	_isHistoryValid (false)
+{
+
+}
+
+RenderVolumeCollection* RSMTemporalAccumulationRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	auto rsmSamplesVolume = (RSMSamplesVolume*) rvc->GetRenderVolume ("ReflectiveShadowMapSamplesVolume");
+
+	/*
+	 * History is only kept between consecutive interleaved frames of the
+	 * same size
+	*/
+
+	glm::ivec2 resolution = GetPostProcessVolumeResolution (settings);
+
+	_isHistoryValid = rsmSamplesVolume->GetFrameIndex () == _lastFrameIndex + 1 &&
+		resolution == _lastResolution;
+
+	_lastFrameIndex = rsmSamplesVolume->GetFrameIndex ();
+	_lastResolution = resolution;
+
+	rvc = TemporalFilterRenderPass::Execute (renderScene, camera, settings, rvc);
+
+	_lastCameraPosition = camera->GetPosition ();
+
+	return rvc;
+}
+
+bool RSMTemporalAccumulationRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	auto rsmSamplesVolume = (RSMSamplesVolume*) rvc->GetRenderVolume ("ReflectiveShadowMapSamplesVolume");
+
+	/*
+	 * Accumulate only when each pixel takes a part of the samples
+	*/
+
+	return settings.indirect_diffuse_enabled && rsmSamplesVolume->GetSubsetsCount () > 1;
+}
+
+std::string RSMTemporalAccumulationRenderPass::GetPostProcessFragmentShaderPath () const
+{
+	return "Assets/Shaders/ReflectiveShadowMapping/reflectiveShadowMapTemporalAccumulationFragment.glsl";
+}
+
+std::string RSMTemporalAccumulationRenderPass::GetPostProcessVolumeName () const
+{
+	return "IndirectDiffuseMap";
+}
+
+glm::ivec2 RSMTemporalAccumulationRenderPass::GetPostProcessVolumeResolution (const RenderSettings& settings) const
+{
+	return glm::ivec2 (glm::vec2 (settings.resolution.width, settings.resolution.height) * settings.rsm_scale);
+}
+
+FramebufferRenderVolume* RSMTemporalAccumulationRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+{
+	/*
+	 * Create reflective shadow mapping temporal accumulation framebuffer,
+	 * the history length is kept in the alpha channel
+	*/
+
+	Resource<Texture> texture = Resource<Texture> (new Texture ("indirectDiffuseMap"));
+
+	glm::ivec2 size = GetPostProcessVolumeResolution (settings);
+
+	texture->SetSize (Size (size.x, size.y));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA16);
+	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
+	texture->SetAnisotropicFiltering (false);
+
+	/*
+	 * World normal and distance to the camera of every pixel, to reject
+	 * the history of another surface
+	*/
+
+	Resource<Texture> geometryTexture = Resource<Texture> (new Texture ("rsmHistoryGeometryMap"));
+
+	geometryTexture->SetSize (Size (size.x, size.y));
+	geometryTexture->SetMipmapGeneration (false);
+	geometryTexture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA16);
+	geometryTexture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
+	geometryTexture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	geometryTexture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	geometryTexture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	geometryTexture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	geometryTexture->SetAnisotropicFiltering (false);
+
+	std::vector<Resource<Texture>> textures;
+
+	textures.push_back (texture);
+	textures.push_back (geometryTexture);
+
+	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (textures));
+
+	FramebufferRenderVolume* renderVolume = new FramebufferRenderVolume (framebuffer);
+
+	/*
+	 * Update statistics object
+	*/
+
+	auto rsmStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RSMStatisticsObject> ();
+
+	rsmStatisticsObject->rsmTemporalAccumulationMapVolume = renderVolume;
+
+	return renderVolume;
+}
+
+std::vector<PipelineAttribute> RSMTemporalAccumulationRenderPass::GetCustomAttributes (const Camera* camera,
+	const RenderSettings& settings, RenderVolumeCollection* rvc)
+{
+	/*
+	 * Attach temporal filter attributes to pipeline
+	*/
+
+	std::vector<PipelineAttribute> attributes = TemporalFilterRenderPass::GetCustomAttributes (camera, settings, rvc);
+
+	/*
+	 * Attach reflective shadow mapping temporal accumulation attributes to pipeline
+	*/
+
+	auto rsmSamplesVolume = (RSMSamplesVolume*) rvc->GetRenderVolume ("ReflectiveShadowMapSamplesVolume");
+
+	PipelineAttribute temporalGeometryMap;
+	PipelineAttribute rsmResolution;
+	PipelineAttribute rsmSubsetsCount;
+	PipelineAttribute rsmHistoryValid;
+	PipelineAttribute rsmHistoryMaxDistance;
+	PipelineAttribute rsmHistoryMinAngle;
+	PipelineAttribute lastCameraPosition;
+
+	temporalGeometryMap.type = PipelineAttribute::AttrType::ATTR_TEXTURE_2D;
+	rsmResolution.type = PipelineAttribute::AttrType::ATTR_2F;
+	rsmSubsetsCount.type = PipelineAttribute::AttrType::ATTR_1I;
+	rsmHistoryValid.type = PipelineAttribute::AttrType::ATTR_1I;
+	rsmHistoryMaxDistance.type = PipelineAttribute::AttrType::ATTR_1F;
+	rsmHistoryMinAngle.type = PipelineAttribute::AttrType::ATTR_1F;
+	lastCameraPosition.type = PipelineAttribute::AttrType::ATTR_3F;
+
+	temporalGeometryMap.name = "temporalGeometryMap";
+	rsmResolution.name = "rsmResolution";
+	rsmSubsetsCount.name = "rsmSubsetsCount";
+	rsmHistoryValid.name = "rsmHistoryValid";
+	rsmHistoryMaxDistance.name = "rsmHistoryMaxDistance";
+	rsmHistoryMinAngle.name = "rsmHistoryMinAngle";
+	lastCameraPosition.name = "lastCameraPosition";
+
+	temporalGeometryMap.value.x = GetLastPostProcessMapVolume ()->GetFramebufferView ()->GetTextureView (1)->GetGPUIndex ();
+	rsmResolution.value = glm::vec3 (GetPostProcessVolumeResolution (settings), 0.0f);
+	rsmSubsetsCount.value.x = rsmSamplesVolume->GetSubsetsCount ();
+	rsmHistoryValid.value.x = _isHistoryValid;
+	rsmHistoryMaxDistance.value.x = settings.rsm_history_max_distance;
+	rsmHistoryMinAngle.value.x = std::cos (DEG2RAD * settings.rsm_history_min_angle);
+	lastCameraPosition.value = _lastCameraPosition;
+
+	attributes.push_back (temporalGeometryMap);
+	attributes.push_back (rsmResolution);
+	attributes.push_back (rsmSubsetsCount);
+	attributes.push_back (rsmHistoryValid);
+	attributes.push_back (rsmHistoryMaxDistance);
+	attributes.push_back (rsmHistoryMinAngle);
+	attributes.push_back (lastCameraPosition);
+
+	/*
+	 * Update statistics object
+	*/
+
+	auto rsmStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RSMStatisticsObject> ();
+
+	rsmStatisticsObject->rsmSamplesSubsetsCount = rsmSamplesVolume->GetSubsetsCount ();
+
+	return attributes;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef RSMTEMPORALACCUMULATIONRENDERPASS_H
+#define RSMTEMPORALACCUMULATIONRENDERPASS_H
+
+#include "RenderPasses/TemporalFiltering/TemporalFilterRenderPass.h"
+
+class ENGINE_API RSMTemporalAccumulationRenderPass : public TemporalFilterRenderPass
+{
+	DECLARE_RENDER_PASS(RSMTemporalAccumulationRenderPass)
+
+protected:
+	glm::vec3 _lastCameraPosition;
+	glm::ivec2 _lastResolution;
+	std::size_t _lastFrameIndex;
+	bool _isHistoryValid;
+
+public:
+	RSMTemporalAccumulationRenderPass ();
+
+	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+
+	bool IsAvailable (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderVolumeCollection* rvc) const;
+protected:
+	std::string GetPostProcessFragmentShaderPath () const;
+	std::string GetPostProcessVolumeName () const;
+	glm::ivec2 GetPostProcessVolumeResolution (const RenderSettings& settings) const;
+	FramebufferRenderVolume* CreatePostProcessVolume (const RenderSettings& settings) const;
+
+	std::vector<PipelineAttribute> GetCustomAttributes (const Camera* camera,
+		const RenderSettings& settings, RenderVolumeCollection* rvc);
+};
+
+#endif
\ No newline at end of file
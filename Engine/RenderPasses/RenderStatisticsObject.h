@@ -10,6 +10,7 @@ struct ENGINE_API RenderStatisticsObject : public StatisticsObject
 	std::size_t DrawnVerticesCount;
 	std::size_t DrawnPolygonsCount;
 	std::size_t DrawnObjectsCount;
+	std::size_t DrawCallsCount;
 };
 
 #endif
\ No newline at end of file
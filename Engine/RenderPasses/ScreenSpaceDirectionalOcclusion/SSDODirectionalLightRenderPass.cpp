@@ -16,7 +16,7 @@ void SSDODirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ScreenSpaceDirectionalOcclusion/screenSpaceDirectionalOcclusionLightFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void SSDODirectionalLightRenderPass::Clear ()
@@ -18,7 +18,7 @@ void DeferredSpotLightShadowMapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -29,7 +29,18 @@ void DeferredSpotLightShadowMapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
+
+	/*
+	 * Shader for instanced not animated objects
+	*/
+
+	Resource<Shader> staticInstancedShader = Resources::LoadShader ({
+		"Assets/Shaders/ShadowMap/shadowMapInstancedVertex.glsl",
+		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
+	});
+
+	_staticInstancedShaderView = LoadShader (staticInstancedShader);
 }
 
 void DeferredSpotLightShadowMapRenderPass::LockShader (int sceneLayers)
@@ -56,3 +67,18 @@ void DeferredSpotLightShadowMapRenderPass::LockShader (int sceneLayers)
 		Pipeline::LockShader (_staticShaderView);
 	}
 }
+
+void DeferredSpotLightShadowMapRenderPass::LockInstancedShader ()
+{
+	/*
+	 * Unlock last shader
+	*/
+
+	Pipeline::UnlockShader ();
+
+	/*
+	 * Lock shader for instanced not animated objects
+	*/
+
+	Pipeline::LockShader (_staticInstancedShaderView);
+}
@@ -13,11 +13,13 @@ class ENGINE_API DeferredSpotLightShadowMapRenderPass : public SpotLightShadowMa
 protected:
 	Resource<ShaderView> _staticShaderView;
 	Resource<ShaderView> _animationShaderView;
+	Resource<ShaderView> _staticInstancedShaderView;
 
 public:
 	void Init (const RenderSettings& settings);
 protected:
 	void LockShader (int sceneLayers);
+	void LockInstancedShader ();
 };
 
 #endif
\ No newline at end of file
@@ -28,7 +28,7 @@ void DirectionalLightExponentialShadowMapRenderPass::Init ()
 		"Assets/Shaders/ShadowMap/exponentialShadowMapFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -39,7 +39,7 @@ void DirectionalLightExponentialShadowMapRenderPass::Init ()
 		"Assets/Shaders/ShadowMap/exponentialShadowMapFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 std::vector<PipelineAttribute> DirectionalLightExponentialShadowMapRenderPass::GetCustomAttributes () const
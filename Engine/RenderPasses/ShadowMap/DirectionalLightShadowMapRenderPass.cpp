@@ -12,13 +12,19 @@
 #include "Renderer/RenderSystem.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
 
 #include "Core/Console/Console.h"
 
 #include "SceneNodes/SceneLayer.h"
 
+#include "Debug/Statistics/StatisticsManager.h"
+#include "ShadowMapStatisticsObject.h"
+
 DirectionalLightShadowMapRenderPass::DirectionalLightShadowMapRenderPass () :
-	_volume (nullptr)
+	_volume (nullptr),
+	_staticVolume (nullptr),
+	_cachedRenderLightObject (nullptr)
 {
 
 }
@@ -34,7 +40,7 @@ void DirectionalLightShadowMapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -45,7 +51,18 @@ void DirectionalLightShadowMapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
+
+	/*
+	 * Shader for instanced not animated objects
+	*/
+
+	Resource<Shader> staticInstancedShader = Resources::LoadShader ({
+		"Assets/Shaders/ShadowMap/shadowMapInstancedVertex.glsl",
+		"Assets/Shaders/ShadowMap/shadowMapFragment.glsl"
+	});
+
+	_staticInstancedShaderView = LoadShader (staticInstancedShader);
 }
 
 RenderVolumeCollection* DirectionalLightShadowMapRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -67,7 +84,7 @@ RenderVolumeCollection* DirectionalLightShadowMapRenderPass::Execute (const Rend
 	 * Draw shadow map
 	*/
 
-	ShadowMapPass (renderScene, camera, renderLightObject);
+	ShadowMapPass (renderScene, camera, settings, renderLightObject);
 
 	/*
 	 * End drawing
@@ -81,10 +98,14 @@ RenderVolumeCollection* DirectionalLightShadowMapRenderPass::Execute (const Rend
 void DirectionalLightShadowMapRenderPass::Clear ()
 {
 	/*
-	 * Clear shadow map volume
+	 * Clear shadow map volumes
 	*/
 
 	delete _volume;
+	delete _staticVolume;
+
+	_cascadeStates.clear ();
+	_casterTracker.Clear ();
 }
 
 bool DirectionalLightShadowMapRenderPass::IsAvailable (const RenderLightObject* renderLightObject) const
@@ -96,13 +117,34 @@ bool DirectionalLightShadowMapRenderPass::IsAvailable (const RenderLightObject*
 	return renderLightObject->IsCastingShadows ();
 }
 
-void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera, const RenderLightObject* renderLightObject)
+void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject)
 {
 	UpdateCascadeLevelsLimits (camera, renderLightObject);
 	UpdateLightCameras (camera, renderLightObject);
 
+	/*
+	 * Static casters are kept apart only while the cache is enabled
+	*/
+
+	if (settings.shadow_cache_enabled == true) {
+		CachedShadowMapPass (renderScene, settings, renderLightObject);
+
+		return;
+	}
+
+	for (auto& cascadeState : _cascadeStates) {
+		cascadeState = ShadowMapCacheState ();
+	}
+
 	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
 
+	auto shadowMapStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ShadowMapStatisticsObject> ();
+
+	shadowMapStatisticsObject->CascadesCount = shadow.cascadesCount;
+	shadowMapStatisticsObject->CascadeStaticUpdatesCount = 0;
+	shadowMapStatisticsObject->CascadeCompositionsCount = shadow.cascadesCount;
+
 	/*
 	 * Bind shadow map cascade for writing
 	*/
@@ -125,7 +167,103 @@ void DirectionalLightShadowMapRenderPass::ShadowMapPass (const RenderScene* rend
 		OrthographicCamera* lightCamera = (OrthographicCamera*) _volume->GetLightCamera (index);
 
 		SendLightCamera (lightCamera);
-		Render (renderScene, lightCamera);
+		Render (renderScene, settings, lightCamera, size.height / 2);
+	}
+}
+
+void DirectionalLightShadowMapRenderPass::CachedShadowMapPass (const RenderScene* renderScene,
+	const RenderSettings& settings, const RenderLightObject* renderLightObject)
+{
+	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
+
+	/*
+	 * Cached layers belong to a single light
+	*/
+
+	if (_cachedRenderLightObject != renderLightObject) {
+		_cachedRenderLightObject = renderLightObject;
+
+		for (auto& cascadeState : _cascadeStates) {
+			cascadeState = ShadowMapCacheState ();
+		}
+	}
+
+	_casterTracker.NewFrame ();
+
+	auto shadowMapStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ShadowMapStatisticsObject> ();
+
+	shadowMapStatisticsObject->CascadesCount = shadow.cascadesCount;
+	shadowMapStatisticsObject->CascadeStaticUpdatesCount = 0;
+	shadowMapStatisticsObject->CascadeCompositionsCount = 0;
+
+	auto size = _volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ();
+
+	for (std::size_t index = 0; index < shadow.cascadesCount; index++) {
+
+		glm::ivec2 startPos = glm::ivec2 ((index % 2) * size.width / 2, (index / 2) * size.height / 2);
+		glm::ivec2 endPos = startPos + glm::ivec2 (size.width / 2, size.height / 2);
+
+		OrthographicCamera* lightCamera = (OrthographicCamera*) _volume->GetLightCamera (index);
+
+		std::size_t staticCastersHash = Cull (renderScene, settings, lightCamera, size.height / 2, true);
+
+		glm::mat4 lightView = glm::translate (glm::mat4_cast (lightCamera->GetRotation ()), lightCamera->GetPosition () * -1.0f);
+		glm::mat4 lightSpaceMatrix = lightCamera->GetProjectionMatrix () * lightView;
+
+		ShadowMapCacheState& cascadeState = _cascadeStates [index];
+
+		bool isStaticLayerValid = ShadowMapCache::IsStaticLayerValid (cascadeState, lightSpaceMatrix, staticCastersHash);
+		bool hasDynamicCasters = !_dynamicCasters.empty ();
+
+		if (!ShadowMapCache::NeedsComposition (cascadeState, isStaticLayerValid, hasDynamicCasters)) {
+			continue;
+		}
+
+		SendLightCamera (lightCamera);
+
+		/*
+		 * Render static casters in their own layer
+		*/
+
+		if (isStaticLayerValid == false) {
+			_staticVolume->GetFramebufferView ()->Activate ();
+
+			GL::Viewport (startPos.x, startPos.y, size.width / 2, size.height / 2);
+
+			GL::DepthMask (GL_TRUE);
+			GL::Enable (GL_SCISSOR_TEST);
+			GL::Scissor (startPos.x, startPos.y, size.width / 2, size.height / 2);
+			GL::Clear (GL_DEPTH_BUFFER_BIT);
+			GL::Disable (GL_SCISSOR_TEST);
+
+			RenderCasters (_staticCasters, settings);
+
+			cascadeState.lightSpaceMatrix = lightSpaceMatrix;
+			cascadeState.staticCastersHash = staticCastersHash;
+			cascadeState.isValid = true;
+			cascadeState.lastUpdateFrame = _casterTracker.GetFrame ();
+
+			shadowMapStatisticsObject->CascadeStaticUpdatesCount ++;
+		}
+
+		/*
+		 * Copy static layer and draw dynamic casters over it
+		*/
+
+		_volume->GetFramebufferView ()->Activate ();
+		_staticVolume->GetFramebufferView ()->ActivateSource ();
+
+		GL::BlitFramebuffer (startPos.x, startPos.y, endPos.x, endPos.y,
+			startPos.x, startPos.y, endPos.x, endPos.y,
+			GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+
+		GL::Viewport (startPos.x, startPos.y, size.width / 2, size.height / 2);
+
+		RenderCasters (_dynamicCasters, settings);
+
+		cascadeState.hasDynamicCasters = hasDynamicCasters;
+
+		shadowMapStatisticsObject->CascadeCompositionsCount ++;
 	}
 }
 
@@ -214,71 +352,75 @@ void DirectionalLightShadowMapRenderPass::UpdateLightCameras (const Camera* view
 
 	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
 
+	float resolution = _volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().height / 2;
+
 	for (std::size_t index = 0; index < shadow.cascadesCount; index++) {
 
 		OrthographicCamera* lightCamera = (OrthographicCamera*)_volume->GetLightCamera (index);
 
-		glm::vec3 cuboidExtendsMin = glm::vec3(std::numeric_limits<float>::max());
-		glm::vec3 cuboidExtendsMax = glm::vec3(-std::numeric_limits<float>::min());
-
 		float zStart = index == 0 ? - 1 : _volume->GetCameraLimit (index - 1);
 		float zEnd = _volume->GetCameraLimit (index);
 
-		for (int x = -1; x <= 1; x += 2) {
-			for (int y = -1; y <= 1; y += 2) {
-				for (int z = -1; z <= 1; z += 2) {
-					glm::vec4 cuboidCorner = glm::vec4(x, y, z == -1 ? zStart : zEnd, 1.0f);
+		glm::vec3 cuboidCorners [8];
+		glm::vec3 cuboidCenter (0.0f);
+
+		for (std::size_t corner = 0; corner < 8; corner++) {
+			glm::vec4 cuboidCorner = glm::vec4 (corner & 1 ? 1 : -1, corner & 2 ? 1 : -1,
+				corner & 4 ? zEnd : zStart, 1.0f);
 
-					cuboidCorner = invCameraProjView * cuboidCorner;
-					cuboidCorner /= cuboidCorner.w;
+			cuboidCorner = invCameraProjView * cuboidCorner;
+			cuboidCorner /= cuboidCorner.w;
 
-					cuboidCorner = glm::vec4 (lightRotation * glm::vec3 (cuboidCorner), 0.0f);
+			cuboidCorners [corner] = lightRotation * glm::vec3 (cuboidCorner);
+			cuboidCenter += cuboidCorners [corner] / 8.0f;
+		}
+
+		/*
+		 * Fit a sphere instead of a box, its size doesn't change when
+		 * the view rotates. Snapping its center to whole texels keeps
+		 * the projection of static casters, so the cached layer stays
+		 * valid and the shadow edges don't shimmer.
+		*/
 
-					cuboidExtendsMin.x = std::min(cuboidExtendsMin.x, cuboidCorner.x);
-					cuboidExtendsMin.y = std::min(cuboidExtendsMin.y, cuboidCorner.y);
-					cuboidExtendsMin.z = std::min(cuboidExtendsMin.z, cuboidCorner.z);
+		float cuboidRadius = 0.0f;
 
-					cuboidExtendsMax.x = std::max(cuboidExtendsMax.x, cuboidCorner.x);
-					cuboidExtendsMax.y = std::max(cuboidExtendsMax.y, cuboidCorner.y);
-					cuboidExtendsMax.z = std::max(cuboidExtendsMax.z, cuboidCorner.z);
-				}
-			}
+		for (std::size_t corner = 0; corner < 8; corner++) {
+			cuboidRadius = std::max (cuboidRadius, glm::distance (cuboidCenter, cuboidCorners [corner]));
 		}
 
+		cuboidRadius = std::ceil (cuboidRadius * 16.0f) / 16.0f;
+
+		float texelSize = 2.0f * cuboidRadius / resolution;
+
+		cuboidCenter = glm::floor (cuboidCenter / texelSize) * texelSize;
+
 		lightCamera->SetRotation(lightRotation);
 
 		lightCamera->SetOrthographicInfo (
-			cuboidExtendsMin.x, cuboidExtendsMax.x,
-			cuboidExtendsMin.y, cuboidExtendsMax.y,
-			cuboidExtendsMin.z - LIGHT_CAMERA_OFFSET, cuboidExtendsMax.z + LIGHT_CAMERA_OFFSET
+			cuboidCenter.x - cuboidRadius, cuboidCenter.x + cuboidRadius,
+			cuboidCenter.y - cuboidRadius, cuboidCenter.y + cuboidRadius,
+			cuboidCenter.z - cuboidRadius - LIGHT_CAMERA_OFFSET, cuboidCenter.z + cuboidRadius + LIGHT_CAMERA_OFFSET
 		);
 
 		_volume->SetLightCamera (index, lightCamera);
 	}
 }
 
-void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene, OrthographicCamera* lightCamera)
+void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene, const RenderSettings& settings,
+	OrthographicCamera* lightCamera, std::size_t resolution)
 {
-	/*
-	 * Shadow map is a depth test
-	*/
+	Cull (renderScene, settings, lightCamera, resolution, false);
 
-	GL::Enable (GL_DEPTH_TEST);
-	GL::DepthMask (GL_TRUE);
+	RenderCasters (_dynamicCasters, settings);
+}
 
-	/*
-	 * Doesn't really matter
-	*/
+std::size_t DirectionalLightShadowMapRenderPass::Cull (const RenderScene* renderScene, const RenderSettings& settings,
+	OrthographicCamera* lightCamera, std::size_t resolution, bool splitStaticCasters)
+{
+	_staticCasters.clear ();
+	_dynamicCasters.clear ();
 
-	GL::Enable(GL_BLEND);
-	GL::BlendFunc(GL_ONE, GL_ZERO);
-
-	/*
-	 * Enable front face culling
-	*/
-
-	GL::Enable(GL_CULL_FACE);
-	GL::CullFace (GL_FRONT);
+	std::size_t staticCastersHash = 0;
 
 	/*
 	 * Light camera
@@ -286,10 +428,6 @@ void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene
 
 	auto frustum = lightCamera->GetFrustumVolume ();
 
-	/*
-	* Render scene entities to framebuffer at Deferred Rendering Stage
-	*/
-
 	for_each_type (RenderObject*, renderObject, *renderScene) {
 
 		/*
@@ -313,11 +451,85 @@ void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene
 			continue;
 		}
 
+		/*
+		 * Shadows don't need as much detail as the camera view
+		*/
+
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, lightCamera,
+			resolution, settings, settings.lod_shadow_bias);
+
+		/*
+		 * Animated objects and the ones that moved lately are drawn every frame
+		*/
+
+		int sceneLayers = renderObject->GetSceneLayers ();
+
+		bool isStatic = splitStaticCasters == true &&
+			!(sceneLayers & (SceneLayer::ANIMATION | SceneLayer::DYNAMIC)) &&
+			_casterTracker.IsStatic (renderObject, boundingBox.minVertex, boundingBox.maxVertex);
+
+		if (isStatic == false) {
+			_dynamicCasters.push_back ({ renderObject, levelOfDetail });
+
+			continue;
+		}
+
+		_staticCasters.push_back ({ renderObject, levelOfDetail });
+
+		staticCastersHash = ShadowMapCache::HashCaster (staticCastersHash, renderObject,
+			boundingBox.minVertex, boundingBox.maxVertex, levelOfDetail);
+	}
+
+	return staticCastersHash;
+}
+
+void DirectionalLightShadowMapRenderPass::RenderCasters (const std::vector<ShadowCaster>& shadowCasters,
+	const RenderSettings& settings)
+{
+	/*
+	 * Shadow map is a depth test
+	*/
+
+	GL::Enable (GL_DEPTH_TEST);
+	GL::DepthMask (GL_TRUE);
+
+	/*
+	 * Doesn't really matter
+	*/
+
+	GL::Enable(GL_BLEND);
+	GL::BlendFunc(GL_ONE, GL_ZERO);
+
+	/*
+	 * Enable front face culling
+	*/
+
+	GL::Enable(GL_CULL_FACE);
+	GL::CullFace (GL_FRONT);
+
+	/*
+	* Render scene entities to framebuffer at Deferred Rendering Stage
+	*/
+
+	_renderBatches.Clear ();
+
+	for (const ShadowCaster& shadowCaster : shadowCasters) {
+
+		/*
+		 * Postpone objects that can be drawn together with others
+		*/
+
+		if (IsInstanceable (shadowCaster.renderObject, settings)) {
+			_renderBatches.AddRenderObject (shadowCaster.renderObject, shadowCaster.levelOfDetail);
+
+			continue;
+		}
+
 		/*
 		 * Lock shader based on scene object layer
 		*/
 
-		LockShader (renderObject->GetSceneLayers ());
+		LockShader (shadowCaster.renderObject->GetSceneLayers ());
 
 		/*
 		 * Send custom attributes
@@ -329,7 +541,44 @@ void DirectionalLightShadowMapRenderPass::Render (const RenderScene* renderScene
 		 * Render object on shadow map
 		*/
 
-		renderObject->DrawGeometry ();
+		shadowCaster.renderObject->DrawGeometry (shadowCaster.levelOfDetail);
+	}
+
+	/*
+	 * Render objects that share the same model in batches
+	*/
+
+	RenderBatches ();
+}
+
+void DirectionalLightShadowMapRenderPass::RenderBatches ()
+{
+	for (auto& renderBatchIt : _renderBatches) {
+		RenderBatch* renderBatch = renderBatchIt.second;
+
+		if (renderBatch->GetRenderObjectsCount () == 0) {
+			continue;
+		}
+
+		/*
+		 * A single object doesn't need instancing
+		*/
+
+		if (renderBatch->GetRenderObjectsCount () == 1) {
+			LockShader (renderBatch->GetSceneLayers ());
+
+			Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
+
+			renderBatch->GetRenderObject (0)->DrawGeometry (renderBatch->GetLevelOfDetail ());
+
+			continue;
+		}
+
+		LockInstancedShader ();
+
+		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
+
+		renderBatch->DrawGeometry ();
 	}
 }
 
@@ -358,6 +607,40 @@ void DirectionalLightShadowMapRenderPass::LockShader (int sceneLayers)
 	}
 }
 
+void DirectionalLightShadowMapRenderPass::LockInstancedShader ()
+{
+	/*
+	 * Unlock last shader
+	*/
+
+	Pipeline::UnlockShader ();
+
+	/*
+	 * Lock shader for instanced not animated objects
+	*/
+
+	Pipeline::LockShader (_staticInstancedShaderView);
+}
+
+bool DirectionalLightShadowMapRenderPass::IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const
+{
+	if (settings.instancing_enabled == false) {
+		return false;
+	}
+
+	/*
+	 * There is an instanced shader only for not animated objects
+	*/
+
+	int sceneLayers = renderObject->GetSceneLayers ();
+
+	if ((sceneLayers & SceneLayer::ANIMATION) || !(sceneLayers & (SceneLayer::STATIC | SceneLayer::DYNAMIC))) {
+		return false;
+	}
+
+	return renderObject->IsInstanceable ();
+}
+
 std::vector<PipelineAttribute> DirectionalLightShadowMapRenderPass::GetCustomAttributes () const
 {
 	std::vector<PipelineAttribute> attributes;
@@ -390,6 +673,12 @@ void DirectionalLightShadowMapRenderPass::UpdateShadowMapVolume (const RenderLig
 		*/
 
 		InitShadowMapVolume (renderLightObject);
+
+		/*
+		 * Cached static layers are lost with the old volume
+		*/
+
+		InitStaticShadowMapVolume ();
 	}
 
 	_volume->SetShadowBias (shadow.bias);
@@ -423,4 +712,30 @@ void DirectionalLightShadowMapRenderPass::InitShadowMapVolume (const RenderLight
 	for (std::size_t index = 0; index < shadow.cascadesCount; index ++) {
 		_volume->SetLightCamera (index, new OrthographicCamera ());
 	}
-}
\ No newline at end of file
+}
+
+void DirectionalLightShadowMapRenderPass::InitStaticShadowMapVolume ()
+{
+	delete _staticVolume;
+
+	Resource<Texture> shadowMapTexture = _volume->GetFramebuffer ()->GetDepthTexture ();
+
+	Resource<Texture> texture = Resource<Texture> (new Texture ("staticShadowMap"));
+
+	texture->SetSize (shadowMapTexture->GetSize ());
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (shadowMapTexture->GetSizedInternalFormat ());
+	texture->SetInternalFormat (shadowMapTexture->GetInternalFormat ());
+	texture->SetChannelType (shadowMapTexture->GetChannelType ());
+	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetAnisotropicFiltering (false);
+
+	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (nullptr, texture));
+
+	_staticVolume = new FramebufferRenderVolume (framebuffer);
+
+	_cascadeStates.clear ();
+	_cascadeStates.resize (_volume->GetCascadeLevels ());
+}
@@ -5,8 +5,10 @@
 
 #include "Core/Resources/Resource.h"
 #include "Renderer/RenderViews/ShaderView.h"
+#include "Renderer/RenderBatchCollection.h"
 
 #include "RenderPasses/ShadowMap/CascadedShadowMapVolume.h"
+#include "RenderPasses/ShadowMap/ShadowMapCache.h"
 
 #include "Systems/Camera/Camera.h"
 #include "Cameras/OrthographicCamera.h"
@@ -15,10 +17,26 @@ class ENGINE_API DirectionalLightShadowMapRenderPass : public VolumetricLightRen
 {
 	DECLARE_RENDER_PASS(DirectionalLightShadowMapRenderPass)
 
+protected:
+	struct ShadowCaster
+	{
+		RenderObject* renderObject;
+		std::size_t levelOfDetail;
+	};
+
 protected:
 	Resource<ShaderView> _staticShaderView;
 	Resource<ShaderView> _animationShaderView;
+	Resource<ShaderView> _staticInstancedShaderView;
 	CascadedShadowMapVolume* _volume;
+	FramebufferRenderVolume* _staticVolume;
+	RenderBatchCollection _renderBatches;
+
+	std::vector<ShadowMapCacheState> _cascadeStates;
+	ShadowMapCasterTracker _casterTracker;
+	const RenderLightObject* _cachedRenderLightObject;
+	std::vector<ShadowCaster> _staticCasters;
+	std::vector<ShadowCaster> _dynamicCasters;
 
 public:
 	DirectionalLightShadowMapRenderPass ();
@@ -31,19 +49,31 @@ public:
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
-	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera, const RenderLightObject* renderLightObject);
+	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera,
+		const RenderSettings& settings, const RenderLightObject* renderLightObject);
 	void EndShadowMapPass ();
 
 	void UpdateCascadeLevelsLimits (const Camera* camera, const RenderLightObject* renderLightObject);
 	void SendLightCamera (Camera* lightCamera);
 	void UpdateLightCameras (const Camera* viewCamera, const RenderLightObject* renderLightObject);
-	void Render (const RenderScene* renderScene, OrthographicCamera* lightCamera);
+	void CachedShadowMapPass (const RenderScene* renderScene, const RenderSettings& settings,
+		const RenderLightObject* renderLightObject);
+	void Render (const RenderScene* renderScene, const RenderSettings& settings,
+		OrthographicCamera* lightCamera, std::size_t resolution);
+	std::size_t Cull (const RenderScene* renderScene, const RenderSettings& settings,
+		OrthographicCamera* lightCamera, std::size_t resolution, bool splitStaticCasters);
+	void RenderCasters (const std::vector<ShadowCaster>& shadowCasters, const RenderSettings& settings);
+	void RenderBatches ();
 	void LockShader (int sceneLayers);
+	void LockInstancedShader ();
+
+	bool IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const;
 
 	virtual std::vector<PipelineAttribute> GetCustomAttributes () const;
 
 	virtual void UpdateShadowMapVolume (const RenderLightObject* renderLightObject);
 	virtual void InitShadowMapVolume (const RenderLightObject* renderLightObject);
+	void InitStaticShadowMapVolume ();
 };
 
 #endif
\ No newline at end of file
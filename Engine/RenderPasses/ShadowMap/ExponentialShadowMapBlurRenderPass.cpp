@@ -43,14 +43,14 @@ void ExponentialShadowMapBlurRenderPass::Init ()
 		"Assets/Shaders/Blur/horizontalGaussianBlurFragment.glsl"
 	});
 
-	_horizontalShaderViewer = RenderSystem::LoadShader (horizontalShader);
+	_horizontalShaderViewer = LoadShader (horizontalShader);
 
 	Resource<Shader> verticalShader = Resources::LoadShader ({
 		"Assets/Shaders/PostProcess/postProcessVertex.glsl",
 		"Assets/Shaders/Blur/verticalGaussianBlurFragment.glsl"
 	});
 
-	_verticalShaderViewer = RenderSystem::LoadShader (verticalShader);
+	_verticalShaderViewer = LoadShader (verticalShader);
 
 	/*
 	 * Initialize settings
@@ -0,0 +1,120 @@
+#include "ShadowMapCache.h"
+
+#include <functional>
+
+ShadowMapCacheState::ShadowMapCacheState () :
+	lightSpaceMatrix (0.0f),
+	staticCastersHash (0),
+	isValid (false),
+	hasDynamicCasters (false),
+	lastUpdateFrame (0)
+{
+
+}
+
+bool ShadowMapCache::IsStaticLayerValid (const ShadowMapCacheState& state,
+	const glm::mat4& lightSpaceMatrix, std::size_t staticCastersHash)
+{
+	/*
+	 * Light space matrices are snapped, any difference moves the texels
+	*/
+
+	return state.isValid == true &&
+		state.lightSpaceMatrix == lightSpaceMatrix &&
+		state.staticCastersHash == staticCastersHash;
+}
+
+bool ShadowMapCache::NeedsComposition (const ShadowMapCacheState& state,
+	bool isStaticLayerValid, bool hasDynamicCasters)
+{
+	/*
+	 * Dynamic casters of the last composition need to be erased too
+	*/
+
+	return isStaticLayerValid == false || hasDynamicCasters == true ||
+		state.hasDynamicCasters == true;
+}
+
+std::size_t ShadowMapCache::HashCaster (std::size_t hash, const void* caster,
+	const glm::vec3& minVertex, const glm::vec3& maxVertex, std::size_t levelOfDetail)
+{
+	auto combine = [&hash] (std::size_t value) {
+		hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	};
+
+	combine (std::hash<const void*> () (caster));
+
+	for (std::size_t i=0;i<3;i++) {
+		combine (std::hash<float> () (minVertex [i]));
+		combine (std::hash<float> () (maxVertex [i]));
+	}
+
+	combine (levelOfDetail);
+
+	return hash;
+}
+
+ShadowMapCasterTracker::ShadowMapCasterTracker () :
+	_frame (0)
+{
+
+}
+
+void ShadowMapCasterTracker::NewFrame ()
+{
+	++ _frame;
+
+	/*
+	 * Forget casters that left every light frustum a while ago
+	*/
+
+	for (auto it = _casters.begin (); it != _casters.end ();) {
+		if (_frame - it->second.lastSeenFrame > SHADOW_MAP_CACHE_SETTLE_FRAMES) {
+			it = _casters.erase (it);
+
+			continue;
+		}
+
+		++ it;
+	}
+}
+
+bool ShadowMapCasterTracker::IsStatic (const void* caster, const glm::vec3& minVertex, const glm::vec3& maxVertex)
+{
+	auto it = _casters.find (caster);
+
+	/*
+	 * New casters go to the static layer right away, it is
+	 * rendered again anyway because the casters changed
+	*/
+
+	if (it == _casters.end ()) {
+		_casters [caster] = { minVertex, maxVertex, _frame, _frame, false };
+
+		return true;
+	}
+
+	Caster& entry = it->second;
+
+	if (entry.minVertex != minVertex || entry.maxVertex != maxVertex) {
+		entry.minVertex = minVertex;
+		entry.maxVertex = maxVertex;
+		entry.lastChangeFrame = _frame;
+		entry.hasChanged = true;
+	}
+
+	entry.lastSeenFrame = _frame;
+
+	return entry.hasChanged == false ||
+		_frame - entry.lastChangeFrame > SHADOW_MAP_CACHE_SETTLE_FRAMES;
+}
+
+std::size_t ShadowMapCasterTracker::GetFrame () const
+{
+	return _frame;
+}
+
+void ShadowMapCasterTracker::Clear ()
+{
+	_casters.clear ();
+}
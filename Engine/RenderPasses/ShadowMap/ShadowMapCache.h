@@ -0,0 +1,76 @@
+#ifndef SHADOWMAPCACHE_H
+#define SHADOWMAPCACHE_H
+
+#include <map>
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+
+#define SHADOW_MAP_CACHE_SETTLE_FRAMES 30
+
+/*
+ * What the cached static layer of a shadow map was rendered with
+*/
+
+struct ENGINE_API ShadowMapCacheState
+{
+	glm::mat4 lightSpaceMatrix;
+	std::size_t staticCastersHash;
+	bool isValid;
+	bool hasDynamicCasters;
+	std::size_t lastUpdateFrame;
+
+	ShadowMapCacheState ();
+};
+
+/*
+ * A shadow map keeps a layer with the depth of static casters, it is
+ * copied under the dynamic casters on every composition. The static
+ * layer is rendered again only when the light space changes or when the
+ * casters inside the light frustum are not the same anymore.
+*/
+
+class ENGINE_API ShadowMapCache
+{
+public:
+	static bool IsStaticLayerValid (const ShadowMapCacheState& state,
+		const glm::mat4& lightSpaceMatrix, std::size_t staticCastersHash);
+	static bool NeedsComposition (const ShadowMapCacheState& state,
+		bool isStaticLayerValid, bool hasDynamicCasters);
+
+	static std::size_t HashCaster (std::size_t hash, const void* caster,
+		const glm::vec3& minVertex, const glm::vec3& maxVertex, std::size_t levelOfDetail);
+};
+
+/*
+ * Static layer casters could still be moved by physics or scripts. The
+ * ones that moved lately are drawn with the dynamic casters, otherwise
+ * they would invalidate the static layer on every frame.
+*/
+
+class ENGINE_API ShadowMapCasterTracker
+{
+protected:
+	struct Caster
+	{
+		glm::vec3 minVertex;
+		glm::vec3 maxVertex;
+		std::size_t lastChangeFrame;
+		std::size_t lastSeenFrame;
+		bool hasChanged;
+	};
+
+	std::map<const void*, Caster> _casters;
+	std::size_t _frame;
+
+public:
+	ShadowMapCasterTracker ();
+
+	void NewFrame ();
+	bool IsStatic (const void* caster, const glm::vec3& minVertex, const glm::vec3& maxVertex);
+
+	std::size_t GetFrame () const;
+
+	void Clear ();
+};
+
+#endif
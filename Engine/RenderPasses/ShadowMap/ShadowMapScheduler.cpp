@@ -0,0 +1,65 @@
+#include "ShadowMapScheduler.h"
+
+#include <algorithm>
+#include <glm/geometric.hpp>
+
+std::vector<std::size_t> ShadowMapScheduler::Schedule (const std::vector<ShadowMapUpdateRequest>& requests, std::size_t budget)
+{
+	std::vector<std::size_t> candidates;
+
+	for (std::size_t i=0;i<requests.size ();i++) {
+		if (requests [i].needsUpdate == true) {
+			candidates.push_back (i);
+		}
+	}
+
+	/*
+	 * No budget means every map is refreshed
+	*/
+
+	if (budget == 0 || candidates.size () <= budget) {
+		return candidates;
+	}
+
+	std::stable_sort (candidates.begin (), candidates.end (), [&requests] (std::size_t left, std::size_t right) {
+		if (requests [left].isRendered != requests [right].isRendered) {
+			return requests [left].isRendered == false;
+		}
+
+		return GetPriority (requests [left]) > GetPriority (requests [right]);
+	});
+
+	candidates.resize (budget);
+
+	std::sort (candidates.begin (), candidates.end ());
+
+	return candidates;
+}
+
+float ShadowMapScheduler::GetPriority (const ShadowMapUpdateRequest& request)
+{
+	return request.importance * (1.0f + request.framesSinceUpdate);
+}
+
+float ShadowMapScheduler::GetScreenImportance (const glm::vec3& viewPosition, float projectionScale,
+	const glm::vec3& lightPosition, float lightRange)
+{
+	float distance = glm::distance (viewPosition, lightPosition);
+
+	/*
+	 * Light covers the whole screen from inside its range
+	*/
+
+	if (distance <= lightRange) {
+		return 1.0f;
+	}
+
+	/*
+	 * Part of the screen height covered by the light range sphere,
+	 * the scale is the cotangent of half the vertical field of view
+	*/
+
+	float ratio = lightRange * projectionScale / distance;
+
+	return std::min (ratio * ratio, 1.0f);
+}
@@ -0,0 +1,31 @@
+#ifndef SHADOWMAPSCHEDULER_H
+#define SHADOWMAPSCHEDULER_H
+
+#include <vector>
+#include <glm/vec3.hpp>
+
+struct ENGINE_API ShadowMapUpdateRequest
+{
+	float importance;
+	std::size_t framesSinceUpdate;
+	bool isRendered;
+	bool needsUpdate;
+};
+
+/*
+ * Chooses which shadow maps are refreshed in a frame. Maps that were
+ * never rendered go first, the others are ordered by how much of the
+ * screen their light covers and by how long they have been waiting.
+*/
+
+class ENGINE_API ShadowMapScheduler
+{
+public:
+	static std::vector<std::size_t> Schedule (const std::vector<ShadowMapUpdateRequest>& requests, std::size_t budget);
+
+	static float GetPriority (const ShadowMapUpdateRequest& request);
+	static float GetScreenImportance (const glm::vec3& viewPosition, float projectionScale,
+		const glm::vec3& lightPosition, float lightRange);
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef SHADOWMAPSTATISTICSOBJECT_H
+#define SHADOWMAPSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API ShadowMapStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(ShadowMapStatisticsObject)
+
+	std::size_t CascadesCount;
+	std::size_t CascadeStaticUpdatesCount;
+	std::size_t CascadeCompositionsCount;
+	std::size_t SpotLightMapsCount;
+	std::size_t SpotLightUpdatesCount;
+	std::size_t SpotLightStaticUpdatesCount;
+	std::size_t SpotLightPostponedCount;
+};
+
+#endif
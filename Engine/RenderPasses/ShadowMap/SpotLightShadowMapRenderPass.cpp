@@ -3,6 +3,7 @@
 #include "Core/Intersections/Intersection.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -10,12 +11,35 @@
 
 #include "SceneNodes/SceneLayer.h"
 
+#include "RenderPasses/ShadowMap/ShadowMapScheduler.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "ShadowMapStatisticsObject.h"
+
+SpotLightShadowMapRenderPass::SpotLightShadowMap::SpotLightShadowMap () :
+	volume (nullptr),
+	staticVolume (nullptr),
+	lightSpaceMatrix (0.0f),
+	staticCastersHash (0),
+	isStaticLayerValid (false),
+	isScheduled (false),
+	isRendered (false),
+	lastSeenFrame (0)
+{
+
+}
+
 SpotLightShadowMapRenderPass::SpotLightShadowMapRenderPass () :
-	_volume (nullptr)
+	_lightCamera (new PerspectiveCamera ())
 {
 
 }
 
+SpotLightShadowMapRenderPass::~SpotLightShadowMapRenderPass ()
+{
+	delete _lightCamera;
+}
+
 RenderVolumeCollection* SpotLightShadowMapRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
 	const RenderSettings& settings, RenderVolumeCollection* rvc)
 {
@@ -26,39 +50,51 @@ RenderVolumeCollection* SpotLightShadowMapRenderPass::Execute (const RenderScene
 	RenderLightObject* renderLightObject = GetRenderLightObject (rvc);
 
 	/*
-	 * Update shadow map volume
+	 * Decide which maps are refreshed when the first light of the frame comes
 	*/
 
-	UpdateShadowMapVolume (renderLightObject);
+	if (IsFirstShadowCaster (renderScene, renderLightObject)) {
+		ScheduleShadowMaps (renderScene, camera, settings);
+	}
 
-	/*
-	 * Update light camera
-	*/
+	auto it = _shadowMaps.find (renderLightObject);
 
-	UpdateLightCamera (renderLightObject);
+	if (it == _shadowMaps.end ()) {
+		return rvc;
+	}
+
+	SpotLightShadowMap& shadowMap = it->second;
 
 	/*
 	 * Draw shadow map
 	*/
 
-	ShadowMapPass (renderScene, camera);
+	if (shadowMap.isScheduled == true) {
+		ShadowMapPass (shadowMap, renderLightObject, settings);
 
-	/*
-	 * End drawing
-	*/
+		/*
+		 * End drawing
+		*/
 
-	EndShadowMapPass ();
+		EndShadowMapPass ();
+	}
 
-	return rvc->Insert ("ShadowMapSpotLightVolume", _volume, false);
+	return rvc->Insert ("ShadowMapSpotLightVolume", shadowMap.volume, false);
 }
 
 void SpotLightShadowMapRenderPass::Clear ()
 {
 	/*
-	 * Clear shadow map volume
+	 * Clear shadow map volumes
 	*/
 
-	delete _volume;
+	for (auto& shadowMapIt : _shadowMaps) {
+		ClearShadowMap (shadowMapIt.second);
+	}
+
+	_shadowMaps.clear ();
+
+	_casterTracker.Clear ();
 }
 
 bool SpotLightShadowMapRenderPass::IsAvailable (const RenderLightObject* renderLightObject) const
@@ -70,46 +106,124 @@ bool SpotLightShadowMapRenderPass::IsAvailable (const RenderLightObject* renderL
 	return renderLightObject->IsCastingShadows ();
 }
 
-void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene, const Camera* camera)
+void SpotLightShadowMapRenderPass::ScheduleShadowMaps (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings)
 {
-	/*
-	 * Change resolution on viewport as shadow map size
-	*/
+	_casterTracker.NewFrame ();
 
-	auto resolution = _volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ();
+	std::size_t frame = _casterTracker.GetFrame ();
 
-	GL::Viewport (0, 0, resolution.width, resolution.height);
+	std::vector<SpotLightShadowMap*> shadowMaps;
+	std::vector<ShadowMapUpdateRequest> requests;
+
+	for_each_type (RenderSpotLightObject*, renderSpotLightObject, *renderScene) {
+
+		if (renderSpotLightObject->IsActive () == false || !IsAvailable (renderSpotLightObject)) {
+			continue;
+		}
+
+		SpotLightShadowMap& shadowMap = _shadowMaps [renderSpotLightObject];
+
+		UpdateShadowMapVolume (renderSpotLightObject, shadowMap);
+
+		shadowMap.lastSeenFrame = frame;
+		shadowMap.isScheduled = false;
+
+		/*
+		 * Find what the map would be rendered with in this frame
+		*/
+
+		UpdateLightCamera (renderSpotLightObject, _lightCamera);
+
+		glm::mat4 lightView = glm::translate (glm::mat4_cast (_lightCamera->GetRotation ()), _lightCamera->GetPosition () * -1.0f);
+
+		shadowMap.lightSpaceMatrix = _lightCamera->GetProjectionMatrix () * lightView;
+
+		std::size_t resolution = shadowMap.volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().height;
+
+		shadowMap.staticCastersHash = Cull (renderScene, settings, _lightCamera, resolution,
+			settings.shadow_cache_enabled, shadowMap);
+
+		shadowMap.isStaticLayerValid = settings.shadow_cache_enabled == true &&
+			ShadowMapCache::IsStaticLayerValid (shadowMap.state, shadowMap.lightSpaceMatrix, shadowMap.staticCastersHash);
+
+		ShadowMapUpdateRequest request;
+
+		request.importance = ShadowMapScheduler::GetScreenImportance (camera->GetPosition (),
+			camera->GetProjectionMatrix () [1][1], renderSpotLightObject->GetTransform ()->GetPosition (),
+			renderSpotLightObject->GetLightRange ());
+		request.framesSinceUpdate = frame - shadowMap.state.lastUpdateFrame;
+		request.isRendered = shadowMap.isRendered;
+		request.needsUpdate = settings.shadow_cache_enabled == false ||
+			ShadowMapCache::NeedsComposition (shadowMap.state, shadowMap.isStaticLayerValid,
+				!shadowMap.dynamicCasters.empty ());
+
+		shadowMaps.push_back (&shadowMap);
+		requests.push_back (request);
+	}
 
 	/*
-	 * Bind shadow map for writing
+	 * Without the cache every map is rendered as before
 	*/
 
-	_volume->GetFramebufferView ()->Activate ();
+	std::size_t budget = settings.shadow_cache_enabled == true ? settings.shadow_spot_light_updates : 0;
 
-	GL::Clear (GL_DEPTH_BUFFER_BIT);
+	std::vector<std::size_t> scheduled = ShadowMapScheduler::Schedule (requests, budget);
+
+	for (std::size_t index : scheduled) {
+		shadowMaps [index]->isScheduled = true;
+	}
 
 	/*
-	 * Shadow map is a depth test
+	 * Release the maps of lights that are gone for a while
 	*/
 
-	GL::Enable (GL_DEPTH_TEST);
-	GL::DepthMask (GL_TRUE);
+	for (auto it = _shadowMaps.begin (); it != _shadowMaps.end ();) {
+		if (frame - it->second.lastSeenFrame > SHADOW_MAP_CACHE_SETTLE_FRAMES) {
+			ClearShadowMap (it->second);
+
+			it = _shadowMaps.erase (it);
 
+			continue;
+		}
+
+		++ it;
+	}
+
+	std::size_t pendingCount = 0;
+
+	for (const ShadowMapUpdateRequest& request : requests) {
+		pendingCount += request.needsUpdate == true ? 1 : 0;
+	}
+
+	auto shadowMapStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ShadowMapStatisticsObject> ();
+
+	shadowMapStatisticsObject->SpotLightMapsCount = _shadowMaps.size ();
+	shadowMapStatisticsObject->SpotLightUpdatesCount = scheduled.size ();
+	shadowMapStatisticsObject->SpotLightStaticUpdatesCount = 0;
+	shadowMapStatisticsObject->SpotLightPostponedCount = pendingCount - scheduled.size ();
+}
+
+void SpotLightShadowMapRenderPass::ShadowMapPass (SpotLightShadowMap& shadowMap, const RenderLightObject* renderLightObject,
+	const RenderSettings& settings)
+{
 	/*
-	 * Doesn't really matter
+	 * Update light camera
 	*/
 
-	GL::Enable(GL_BLEND);
-	GL::BlendFunc(GL_ONE, GL_ZERO);
+	PerspectiveCamera* lightCamera = shadowMap.volume->GetLightCamera ();
+
+	UpdateLightCamera (renderLightObject, lightCamera);
+
+	shadowMap.volume->SetLightCamera (lightCamera);
 
 	/*
-	 * Enable front face culling
+	 * Change resolution on viewport as shadow map size
 	*/
 
-	GL::Enable(GL_CULL_FACE);
-	GL::CullFace (GL_FRONT);
+	auto resolution = shadowMap.volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ();
 
-	PerspectiveCamera* lightCamera = _volume->GetLightCamera ();
+	GL::Viewport (0, 0, resolution.width, resolution.height);
 
 	/*
 	 * Send light camera
@@ -118,16 +232,67 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 	Pipeline::CreateProjection (lightCamera->GetProjectionMatrix ());
 	Pipeline::SendCamera (lightCamera);
 
+	GL::DepthMask (GL_TRUE);
+
 	/*
-	 * Light camera
+	 * Render static casters in their own layer
 	*/
 
-	auto frustum = lightCamera->GetFrustumVolume ();
+	if (settings.shadow_cache_enabled == true && shadowMap.isStaticLayerValid == false) {
+		shadowMap.staticVolume->GetFramebufferView ()->Activate ();
+
+		GL::Clear (GL_DEPTH_BUFFER_BIT);
+
+		RenderCasters (shadowMap.staticCasters, settings);
+
+		shadowMap.state.lightSpaceMatrix = shadowMap.lightSpaceMatrix;
+		shadowMap.state.staticCastersHash = shadowMap.staticCastersHash;
+		shadowMap.state.isValid = true;
+
+		StatisticsManager::Instance ()->GetStatisticsObject <ShadowMapStatisticsObject> ()->SpotLightStaticUpdatesCount ++;
+	}
 
 	/*
-	* Render scene entities to framebuffer at Deferred Rendering Stage
+	 * Bind shadow map for writing, it starts from the static layer
+	*/
+
+	shadowMap.volume->GetFramebufferView ()->Activate ();
+
+	if (settings.shadow_cache_enabled == true) {
+		shadowMap.staticVolume->GetFramebufferView ()->ActivateSource ();
+
+		GL::BlitFramebuffer (0, 0, resolution.width, resolution.height,
+			0, 0, resolution.width, resolution.height,
+			GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+	}
+
+	if (settings.shadow_cache_enabled == false) {
+		GL::Clear (GL_DEPTH_BUFFER_BIT);
+
+		shadowMap.state.isValid = false;
+	}
+
+	RenderCasters (shadowMap.dynamicCasters, settings);
+
+	shadowMap.state.hasDynamicCasters = !shadowMap.dynamicCasters.empty ();
+	shadowMap.state.lastUpdateFrame = _casterTracker.GetFrame ();
+	shadowMap.isRendered = true;
+}
+
+std::size_t SpotLightShadowMapRenderPass::Cull (const RenderScene* renderScene, const RenderSettings& settings,
+	PerspectiveCamera* lightCamera, std::size_t resolution, bool splitStaticCasters, SpotLightShadowMap& shadowMap)
+{
+	shadowMap.staticCasters.clear ();
+	shadowMap.dynamicCasters.clear ();
+
+	std::size_t staticCastersHash = 0;
+
+	/*
+	 * Light camera
 	*/
 
+	auto frustum = lightCamera->GetFrustumVolume ();
+
 	for_each_type (RenderObject*, renderObject, *renderScene) {
 
 		/*
@@ -151,11 +316,85 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 			continue;
 		}
 
+		/*
+		 * Shadows don't need as much detail as the camera view
+		*/
+
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, lightCamera,
+			resolution, settings, settings.lod_shadow_bias);
+
+		/*
+		 * Animated casters and the ones that moved lately go over the static layer
+		*/
+
+		int sceneLayers = renderObject->GetSceneLayers ();
+
+		bool isStatic = splitStaticCasters == true &&
+			!(sceneLayers & (SceneLayer::ANIMATION | SceneLayer::DYNAMIC)) &&
+			_casterTracker.IsStatic (renderObject, boundingBox.minVertex, boundingBox.maxVertex);
+
+		if (isStatic == false) {
+			shadowMap.dynamicCasters.push_back ({ renderObject, levelOfDetail });
+
+			continue;
+		}
+
+		shadowMap.staticCasters.push_back ({ renderObject, levelOfDetail });
+
+		staticCastersHash = ShadowMapCache::HashCaster (staticCastersHash, renderObject,
+			boundingBox.minVertex, boundingBox.maxVertex, levelOfDetail);
+	}
+
+	return staticCastersHash;
+}
+
+void SpotLightShadowMapRenderPass::RenderCasters (const std::vector<ShadowCaster>& shadowCasters,
+	const RenderSettings& settings)
+{
+	/*
+	 * Shadow map is a depth test
+	*/
+
+	GL::Enable (GL_DEPTH_TEST);
+	GL::DepthMask (GL_TRUE);
+
+	/*
+	 * Doesn't really matter
+	*/
+
+	GL::Enable(GL_BLEND);
+	GL::BlendFunc(GL_ONE, GL_ZERO);
+
+	/*
+	 * Enable front face culling
+	*/
+
+	GL::Enable(GL_CULL_FACE);
+	GL::CullFace (GL_FRONT);
+
+	/*
+	* Render scene entities to framebuffer at Deferred Rendering Stage
+	*/
+
+	_renderBatches.Clear ();
+
+	for (const ShadowCaster& shadowCaster : shadowCasters) {
+
+		/*
+		 * Postpone objects that can be drawn together with others
+		*/
+
+		if (IsInstanceable (shadowCaster.renderObject, settings)) {
+			_renderBatches.AddRenderObject (shadowCaster.renderObject, shadowCaster.levelOfDetail);
+
+			continue;
+		}
+
 		/*
 		 * Lock shader based on scene object layer
 		*/
 
-		LockShader (renderObject->GetSceneLayers ());
+		LockShader (shadowCaster.renderObject->GetSceneLayers ());
 
 		/*
 		 * Send custom attributes
@@ -167,7 +406,44 @@ void SpotLightShadowMapRenderPass::ShadowMapPass (const RenderScene* renderScene
 		 * Render object on shadow map
 		*/
 
-		renderObject->DrawGeometry ();
+		shadowCaster.renderObject->DrawGeometry (shadowCaster.levelOfDetail);
+	}
+
+	/*
+	 * Render objects that share the same model in batches
+	*/
+
+	RenderBatches ();
+}
+
+void SpotLightShadowMapRenderPass::RenderBatches ()
+{
+	for (auto& renderBatchIt : _renderBatches) {
+		RenderBatch* renderBatch = renderBatchIt.second;
+
+		if (renderBatch->GetRenderObjectsCount () == 0) {
+			continue;
+		}
+
+		/*
+		 * A single object doesn't need instancing
+		*/
+
+		if (renderBatch->GetRenderObjectsCount () == 1) {
+			LockShader (renderBatch->GetSceneLayers ());
+
+			Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
+
+			renderBatch->GetRenderObject (0)->DrawGeometry (renderBatch->GetLevelOfDetail ());
+
+			continue;
+		}
+
+		LockInstancedShader ();
+
+		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes ());
+
+		renderBatch->DrawGeometry ();
 	}
 }
 
@@ -180,6 +456,25 @@ void SpotLightShadowMapRenderPass::EndShadowMapPass ()
 	Pipeline::UnlockShader ();
 }
 
+bool SpotLightShadowMapRenderPass::IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const
+{
+	if (settings.instancing_enabled == false) {
+		return false;
+	}
+
+	/*
+	 * There is an instanced shader only for not animated objects
+	*/
+
+	int sceneLayers = renderObject->GetSceneLayers ();
+
+	if ((sceneLayers & SceneLayer::ANIMATION) || !(sceneLayers & (SceneLayer::STATIC | SceneLayer::DYNAMIC))) {
+		return false;
+	}
+
+	return renderObject->IsInstanceable ();
+}
+
 std::vector<PipelineAttribute> SpotLightShadowMapRenderPass::GetCustomAttributes () const
 {
 	std::vector<PipelineAttribute> attributes;
@@ -191,14 +486,24 @@ std::vector<PipelineAttribute> SpotLightShadowMapRenderPass::GetCustomAttributes
 	return attributes;
 }
 
-void SpotLightShadowMapRenderPass::UpdateLightCamera (const RenderLightObject* renderLightObject)
+bool SpotLightShadowMapRenderPass::IsFirstShadowCaster (const RenderScene* renderScene,
+	const RenderLightObject* renderLightObject) const
+{
+	for_each_type (RenderSpotLightObject*, renderSpotLightObject, *renderScene) {
+		if (renderSpotLightObject->IsActive () == true && IsAvailable (renderSpotLightObject)) {
+			return renderSpotLightObject == renderLightObject;
+		}
+	}
+
+	return false;
+}
+
+void SpotLightShadowMapRenderPass::UpdateLightCamera (const RenderLightObject* renderLightObject, PerspectiveCamera* lightCamera)
 {
 	auto renderSpotLightObject = dynamic_cast<const RenderSpotLightObject*> (renderLightObject);
 
 	const Transform* lightTransform = renderSpotLightObject->GetTransform ();
 
-	PerspectiveCamera* lightCamera = _volume->GetLightCamera ();
-
 	lightCamera->SetPosition (lightTransform->GetPosition ());
 	lightCamera->SetRotation (glm::conjugate (lightTransform->GetRotation ()));
 
@@ -206,33 +511,33 @@ void SpotLightShadowMapRenderPass::UpdateLightCamera (const RenderLightObject* r
 	lightCamera->SetZFar (renderSpotLightObject->GetLightRange ());
 	lightCamera->SetFieldOfViewAngle (renderSpotLightObject->GetLightSpotOuterCutoff () * 2);
 	lightCamera->SetAspect (1.0f);
-
-	_volume->SetLightCamera (lightCamera);
 }
 
-void SpotLightShadowMapRenderPass::UpdateShadowMapVolume (const RenderLightObject* renderLightObject)
+void SpotLightShadowMapRenderPass::UpdateShadowMapVolume (const RenderLightObject* renderLightObject, SpotLightShadowMap& shadowMap)
 {
 	RenderLightObject::Shadow shadow = renderLightObject->GetShadow ();
 
-	if (_volume == nullptr ||
-		_volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().width != (std::size_t) shadow.resolution.x ||
-		_volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().height != (std::size_t) shadow.resolution.y) {
+	if (shadowMap.volume == nullptr ||
+		shadowMap.volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().width != (std::size_t) shadow.resolution.x ||
+		shadowMap.volume->GetFramebuffer ()->GetDepthTexture ()->GetSize ().height != (std::size_t) shadow.resolution.y) {
 
 		/*
 		 * Clear shadow map volume
 		*/
 
-		delete _volume;
+		ClearShadowMap (shadowMap);
 
 		/*
 		 * Initialize shadow map volume
 		*/
 
-		InitShadowMapVolume (renderLightObject);
+		InitShadowMapVolume (renderLightObject, shadowMap);
 	}
+
+	shadowMap.volume->SetShadowBias (shadow.bias);
 }
 
-void SpotLightShadowMapRenderPass::InitShadowMapVolume (const RenderLightObject* renderLightObject)
+void SpotLightShadowMapRenderPass::InitShadowMapVolume (const RenderLightObject* renderLightObject, SpotLightShadowMap& shadowMap)
 {
 	/*
 	 * Create perspective shadow map volume
@@ -255,8 +560,38 @@ void SpotLightShadowMapRenderPass::InitShadowMapVolume (const RenderLightObject*
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (nullptr, texture));
 
-	_volume = new PerspectiveShadowMapVolume (framebuffer);
+	shadowMap.volume = new PerspectiveShadowMapVolume (framebuffer);
+	shadowMap.volume->SetLightCamera (new PerspectiveCamera ());
+
+	/*
+	 * Static casters are cached in a layer of the same format
+	*/
+
+	Resource<Texture> staticTexture = Resource<Texture> (new Texture ("staticShadowMap"));
+
+	staticTexture->SetSize (Size (shadow.resolution.x, shadow.resolution.y));
+	staticTexture->SetMipmapGeneration (false);
+	staticTexture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_DEPTH16);
+	staticTexture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_DEPTH);
+	staticTexture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_FLOAT);
+	staticTexture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_EDGE);
+	staticTexture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	staticTexture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	staticTexture->SetAnisotropicFiltering (false);
+
+	Resource<Framebuffer> staticFramebuffer = Resource<Framebuffer> (new Framebuffer (nullptr, staticTexture));
+
+	shadowMap.staticVolume = new FramebufferRenderVolume (staticFramebuffer);
+
+	shadowMap.state = ShadowMapCacheState ();
+	shadowMap.isRendered = false;
+}
+
+void SpotLightShadowMapRenderPass::ClearShadowMap (SpotLightShadowMap& shadowMap)
+{
+	delete shadowMap.volume;
+	delete shadowMap.staticVolume;
 
-	_volume->SetLightCamera (new PerspectiveCamera ());
-	_volume->SetShadowBias (shadow.bias);
+	shadowMap.volume = nullptr;
+	shadowMap.staticVolume = nullptr;
 }
\ No newline at end of file
@@ -3,15 +3,54 @@
 
 #include "RenderPasses/VolumetricLightRenderPassI.h"
 
+#include <map>
+
 #include "RenderPasses/ShadowMap/PerspectiveShadowMapVolume.h"
+#include "RenderPasses/ShadowMap/ShadowMapCache.h"
+
+#include "Renderer/RenderBatchCollection.h"
 
 class ENGINE_API SpotLightShadowMapRenderPass : public VolumetricLightRenderPassI
 {
 protected:
-	PerspectiveShadowMapVolume* _volume;
+	struct ShadowCaster
+	{
+		RenderObject* renderObject;
+		std::size_t levelOfDetail;
+	};
+
+	/*
+	 * Every light keeps its own map, lights that are not refreshed in a
+	 * frame are shaded with the map and the light camera of their last
+	 * update
+	*/
+
+	struct SpotLightShadowMap
+	{
+		PerspectiveShadowMapVolume* volume;
+		FramebufferRenderVolume* staticVolume;
+		ShadowMapCacheState state;
+		std::vector<ShadowCaster> staticCasters;
+		std::vector<ShadowCaster> dynamicCasters;
+		glm::mat4 lightSpaceMatrix;
+		std::size_t staticCastersHash;
+		bool isStaticLayerValid;
+		bool isScheduled;
+		bool isRendered;
+		std::size_t lastSeenFrame;
+
+		SpotLightShadowMap ();
+	};
+
+protected:
+	std::map<const RenderLightObject*, SpotLightShadowMap> _shadowMaps;
+	ShadowMapCasterTracker _casterTracker;
+	PerspectiveCamera* _lightCamera;
+	RenderBatchCollection _renderBatches;
 
 public:
 	SpotLightShadowMapRenderPass ();
+	~SpotLightShadowMapRenderPass ();
 
 	virtual RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
 		const RenderSettings& settings, RenderVolumeCollection* rvc);
@@ -20,16 +59,28 @@ public:
 protected:
 	bool IsAvailable (const RenderLightObject*) const;
 
-	void ShadowMapPass (const RenderScene* renderScene, const Camera* camera);
+	void ScheduleShadowMaps (const RenderScene* renderScene, const Camera* camera, const RenderSettings& settings);
+	void ShadowMapPass (SpotLightShadowMap& shadowMap, const RenderLightObject* renderLightObject,
+		const RenderSettings& settings);
+	std::size_t Cull (const RenderScene* renderScene, const RenderSettings& settings, PerspectiveCamera* lightCamera,
+		std::size_t resolution, bool splitStaticCasters, SpotLightShadowMap& shadowMap);
+	void RenderCasters (const std::vector<ShadowCaster>& shadowCasters, const RenderSettings& settings);
+	void RenderBatches ();
 	void EndShadowMapPass ();
 
 	virtual void LockShader (int sceneLayers) = 0;
+	virtual void LockInstancedShader () = 0;
+
+	bool IsInstanceable (const RenderObject* renderObject, const RenderSettings& settings) const;
 
 	virtual std::vector<PipelineAttribute> GetCustomAttributes () const;
 
-	void UpdateLightCamera (const RenderLightObject* renderLightObject);
-	void UpdateShadowMapVolume (const RenderLightObject* renderLightObject);
-	void InitShadowMapVolume (const RenderLightObject* renderLightObject);
+	bool IsFirstShadowCaster (const RenderScene* renderScene, const RenderLightObject* renderLightObject) const;
+
+	void UpdateLightCamera (const RenderLightObject* renderLightObject, PerspectiveCamera* lightCamera);
+	void UpdateShadowMapVolume (const RenderLightObject* renderLightObject, SpotLightShadowMap& shadowMap);
+	void InitShadowMapVolume (const RenderLightObject* renderLightObject, SpotLightShadowMap& shadowMap);
+	void ClearShadowMap (SpotLightShadowMap& shadowMap);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -33,17 +33,5 @@ TRSMSamplesVolume::TRSMSamplesVolume (std::size_t samplesCount) :
 	 * Update attributes
 	*/
 
-	_attributes.clear ();
-
-	std::vector<PipelineAttribute> attributes;
-
-	PipelineAttribute rsmSamples;
-
-	rsmSamples.type = PipelineAttribute::AttrType::ATTR_BLOCK;
-
-	rsmSamples.name = "rsmSamples";
-
-	rsmSamples.value.x = _samplesUBO;
-
-	_attributes.push_back (rsmSamples);
+	_attributes [0].value.x = _samplesUBO;
 }
@@ -44,7 +44,7 @@ glm::ivec2 TextureLUTRenderPass::GetPostProcessVolumeResolution (const RenderSet
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* TextureLUTRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> TextureLUTRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	Resource<Texture> texture = Resource<Texture> (new Texture ("postProcessMap"));
 
@@ -62,7 +62,24 @@ FramebufferRenderVolume* TextureLUTRenderPass::CreatePostProcessVolume (const Re
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool TextureLUTRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
+}
+
+PostProcessFusionSnippet TextureLUTRenderPass::GetPostProcessFusionSnippet () const
+{
+	PostProcessFusionSnippet snippet;
+
+	snippet.path = "Assets/Shaders/TextureLUT/textureLUT.glsl";
+	snippet.function = "CalcTextureLUT";
+	snippet.inputVolume = "PostProcessMapVolume";
+	snippet.inputMap = "postProcessMap";
+
+	return snippet;
 }
 
 std::vector<PipelineAttribute> TextureLUTRenderPass::GetCustomAttributes (const Camera* camera,
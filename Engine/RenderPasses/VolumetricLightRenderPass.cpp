@@ -19,7 +19,7 @@ void VolumetricLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/deferredStencilVolLightFragment.glsl"
 	});
 
-	_stencilShaderView = RenderSystem::LoadShader (stencilShader);
+	_stencilShaderView = LoadShader (stencilShader);
 }
 
 RenderVolumeCollection* VolumetricLightRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -46,6 +46,21 @@ RenderVolumeCollection* VolumetricLightRenderPass::Execute (const RenderScene* r
 	return rvc;
 }
 
+bool VolumetricLightRenderPass::IsAvailable (const RenderScene* renderScene, const Camera* camera,
+	const RenderSettings& settings, const RenderVolumeCollection* rvc) const
+{
+	/*
+	 * Lights are drawn with the projection of the geometry buffer, skip
+	 * them when there is none
+	*/
+
+	if (rvc->GetRenderVolume ("GBuffer") == nullptr) {
+		return false;
+	}
+
+	return VolumetricLightRenderPassI::IsAvailable (renderScene, camera, settings, rvc);
+}
+
 bool VolumetricLightRenderPass::IsAvailable (const RenderLightObject*) const
 {
 	/*
@@ -16,6 +16,8 @@ public:
 
 	RenderVolumeCollection* Execute (const RenderScene*, const Camera*, const RenderSettings&, RenderVolumeCollection* );
 protected:
+	bool IsAvailable (const RenderScene*, const Camera*,
+		const RenderSettings&, const RenderVolumeCollection*) const;
 	bool IsAvailable (const RenderLightObject*) const;
 
 	void StartPointLightPass (RenderVolumeCollection*);
@@ -19,7 +19,7 @@ void VolumetricLightingDirectionalRenderPass::Init (const RenderSettings& settin
 		"Assets/Shaders/VolumetricLighting/volumetricLightingDirectionalFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shader);
+	_shadowShaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* VolumetricLightingDirectionalRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -25,7 +25,7 @@ glm::ivec2 VolumetricLightingRenderPass::GetPostProcessVolumeResolution (const R
 	return glm::ivec2 (settings.resolution.width, settings.resolution.height);
 }
 
-FramebufferRenderVolume* VolumetricLightingRenderPass::CreatePostProcessVolume (const RenderSettings& settings) const
+Resource<Framebuffer> VolumetricLightingRenderPass::CreatePostProcessFramebuffer (const RenderSettings& settings) const
 {
 	/*
 	 * Create bloom accumulation framebuffer
@@ -47,5 +47,10 @@ FramebufferRenderVolume* VolumetricLightingRenderPass::CreatePostProcessVolume (
 
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (texture));
 
-	return new FramebufferRenderVolume (framebuffer);
+	return framebuffer;
+}
+
+bool VolumetricLightingRenderPass::IsPostProcessVolumeTransient () const
+{
+	return true;
 }
@@ -16,7 +16,7 @@ void VCTDirectionalLightRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/VoxelConeTracing/voxelConeTracingFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shadowShader);
+	_shadowShaderView = LoadShader (shadowShader);
 }
 
 void VCTDirectionalLightRenderPass::Clear ()
@@ -19,7 +19,7 @@ void VCTDirectionalLightShadowRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/VoxelConeTracing/voxelConeTracingShadowFragment.glsl"
 	});
 
-	_shadowShaderView = RenderSystem::LoadShader (shader);
+	_shadowShaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* VCTDirectionalLightShadowRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
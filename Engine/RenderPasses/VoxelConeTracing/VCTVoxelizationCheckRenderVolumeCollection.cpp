@@ -10,7 +10,13 @@ VCTVoxelizationCheckRenderVolumeCollection::VCTVoxelizationCheckRenderVolumeColl
 
 RenderVolumeI* VCTVoxelizationCheckRenderVolumeCollection::GetNextVolume (const RenderScene* renderScene, const RenderSettings& settings)
 {
-	if (settings.vct_continuous_voxelization == !_check && _firstTime == false) {
+	/*
+	 * Clipmap follows the camera, it is voxelized every frame
+	*/
+
+	bool continuousVoxelization = settings.vct_continuous_voxelization || settings.vct_clipmap_enabled;
+
+	if (continuousVoxelization == !_check && _firstTime == false) {
 		return nullptr;
 	}
 
@@ -26,7 +26,7 @@ void VRTRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/VoxelRayTracing/voxelRayTracingGeometry.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 RenderVolumeCollection* VRTRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
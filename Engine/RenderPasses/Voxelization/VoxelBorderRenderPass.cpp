@@ -25,7 +25,7 @@ void VoxelBorderRenderPass::Init (const RenderSettings& settings)
 
 	Resource<Shader> shader = Resources::LoadComputeShader ("Assets/Shaders/Voxelize/voxelBorderCompute.glsl");
 
-	_shaderView = RenderSystem::LoadComputeShader (shader);
+	_shaderView = LoadComputeShader (shader);
 }
 
 RenderVolumeCollection* VoxelBorderRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
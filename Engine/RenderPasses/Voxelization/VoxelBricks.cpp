@@ -0,0 +1,390 @@
+#include "VoxelBricks.h"
+
+#include <glm/common.hpp>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+bool VoxelRegion::operator < (const VoxelRegion& other) const
+{
+	return std::tie (minVoxel.x, minVoxel.y, minVoxel.z, maxVoxel.x, maxVoxel.y, maxVoxel.z) <
+		std::tie (other.minVoxel.x, other.minVoxel.y, other.minVoxel.z,
+			other.maxVoxel.x, other.maxVoxel.y, other.maxVoxel.z);
+}
+
+bool VoxelRegion::operator == (const VoxelRegion& other) const
+{
+	return minVoxel == other.minVoxel && maxVoxel == other.maxVoxel;
+}
+
+VoxelBricks::VoxelBricks () :
+	_volumeSize (0),
+	_brickSize (VOXEL_BRICK_SIZE),
+	_bricksCount (0),
+	_minVertex (0.0f),
+	_maxVertex (0.0f),
+	_origin (0.0f),
+	_brickWorldSize (0.0f),
+	_minBrick (0),
+	_dirtyBricksCount (0)
+{
+
+}
+
+void VoxelBricks::Reset (std::size_t volumeSize, std::size_t brickSize,
+	const glm::vec3& minVertex, const glm::vec3& maxVertex)
+{
+	/*
+	 * A volume fitted to the scene is addressed from its own corner
+	*/
+
+	Reset (volumeSize, brickSize, minVertex, maxVertex, minVertex);
+}
+
+void VoxelBricks::Reset (std::size_t volumeSize, std::size_t brickSize,
+	const glm::vec3& minVertex, const glm::vec3& maxVertex, const glm::vec3& origin)
+{
+	brickSize = std::max ((std::size_t) 1, std::min (brickSize, volumeSize));
+
+	if (_volumeSize == volumeSize && _brickSize == brickSize &&
+		_minVertex == minVertex && _maxVertex == maxVertex && _origin == origin) {
+		return;
+	}
+
+	glm::vec3 brickWorldSize = (maxVertex - minVertex) * ((float) brickSize / volumeSize);
+
+	/*
+	 * The volume only scrolls when it keeps its size and moves by whole
+	 * bricks, anything else remaps every voxel
+	*/
+
+	bool isValid = brickWorldSize.x > 0.0f && brickWorldSize.y > 0.0f && brickWorldSize.z > 0.0f;
+
+	glm::vec3 minPosition = isValid ? (minVertex - origin) / brickWorldSize : glm::vec3 (0.0f);
+	glm::ivec3 minBrick = glm::ivec3 (glm::round (minPosition));
+
+	bool isScroll = isValid && _volumeSize == volumeSize && _brickSize == brickSize && _origin == origin;
+
+	for (int k = 0; k < 3 && isScroll; k++) {
+		isScroll = std::abs (brickWorldSize [k] - _brickWorldSize [k]) <= 1e-4f * std::abs (_brickWorldSize [k]) &&
+			std::abs (minPosition [k] - minBrick [k]) <= 1e-3f;
+	}
+
+	_minVertex = minVertex;
+	_maxVertex = maxVertex;
+
+	if (isScroll) {
+		Scroll (minBrick);
+
+		return;
+	}
+
+	_volumeSize = volumeSize;
+	_brickSize = brickSize;
+	_bricksCount = (volumeSize + brickSize - 1) / brickSize;
+
+	_origin = origin;
+	_brickWorldSize = brickWorldSize;
+	_minBrick = minBrick;
+
+	/*
+	 * Every voxel moves when the volume is remapped
+	*/
+
+	_dirtyBricks.assign (_bricksCount * _bricksCount * _bricksCount, false);
+	_objects.clear ();
+
+	Invalidate ();
+}
+
+void VoxelBricks::BeginUpdate ()
+{
+	for (auto& object : _objects) {
+		object.second.visited = false;
+	}
+}
+
+bool VoxelBricks::UpdateObject (std::size_t objectID, const AABBVolume& bounds)
+{
+	auto it = _objects.find (objectID);
+
+	if (it == _objects.end ()) {
+		ObjectBounds objectBounds;
+
+		objectBounds.bounds = bounds;
+		objectBounds.visited = true;
+
+		_objects [objectID] = objectBounds;
+
+		MarkDirty (bounds);
+
+		return true;
+	}
+
+	it->second.visited = true;
+
+	if (it->second.bounds.minVertex == bounds.minVertex &&
+		it->second.bounds.maxVertex == bounds.maxVertex) {
+		return false;
+	}
+
+	/*
+	 * Both the voxels that the object left and the ones it covers now
+	 * have to be rebuilt
+	*/
+
+	MarkDirty (it->second.bounds);
+	MarkDirty (bounds);
+
+	it->second.bounds = bounds;
+
+	return true;
+}
+
+void VoxelBricks::EndUpdate ()
+{
+	for (auto it = _objects.begin (); it != _objects.end ();) {
+		if (it->second.visited == false) {
+			MarkDirty (it->second.bounds);
+
+			it = _objects.erase (it);
+
+			continue;
+		}
+
+		++ it;
+	}
+}
+
+void VoxelBricks::MarkDirty (const AABBVolume& bounds)
+{
+	glm::ivec3 minBrick, maxBrick;
+
+	if (!GetBrickRange (bounds, minBrick, maxBrick)) {
+		return;
+	}
+
+	for (int z = minBrick.z; z <= maxBrick.z; z++) {
+		for (int y = minBrick.y; y <= maxBrick.y; y++) {
+			for (int x = minBrick.x; x <= maxBrick.x; x++) {
+				std::size_t index = GetBrickIndex (x, y, z);
+
+				if (_dirtyBricks [index] == false) {
+					_dirtyBricks [index] = true;
+					_dirtyBricksCount ++;
+				}
+			}
+		}
+	}
+}
+
+void VoxelBricks::Invalidate ()
+{
+	std::fill (_dirtyBricks.begin (), _dirtyBricks.end (), true);
+
+	_dirtyBricksCount = _dirtyBricks.size ();
+}
+
+void VoxelBricks::ClearDirty ()
+{
+	std::fill (_dirtyBricks.begin (), _dirtyBricks.end (), false);
+
+	_dirtyBricksCount = 0;
+}
+
+bool VoxelBricks::IsDirty () const
+{
+	return _dirtyBricksCount > 0;
+}
+
+bool VoxelBricks::IsDirty (const AABBVolume& bounds) const
+{
+	if (_dirtyBricksCount == 0) {
+		return false;
+	}
+
+	glm::ivec3 minBrick, maxBrick;
+
+	if (!GetBrickRange (bounds, minBrick, maxBrick)) {
+		return false;
+	}
+
+	for (int z = minBrick.z; z <= maxBrick.z; z++) {
+		for (int y = minBrick.y; y <= maxBrick.y; y++) {
+			for (int x = minBrick.x; x <= maxBrick.x; x++) {
+				if (_dirtyBricks [GetBrickIndex (x, y, z)] == true) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool VoxelBricks::IsFullyDirty () const
+{
+	return _dirtyBricksCount == _dirtyBricks.size ();
+}
+
+std::size_t VoxelBricks::GetBricksCount () const
+{
+	return _dirtyBricks.size ();
+}
+
+std::size_t VoxelBricks::GetDirtyBricksCount () const
+{
+	return _dirtyBricksCount;
+}
+
+std::vector<VoxelRegion> VoxelBricks::GetDirtyRegions (std::size_t mipLevel) const
+{
+	std::vector<VoxelRegion> regions;
+
+	if (_dirtyBricksCount == 0) {
+		return regions;
+	}
+
+	int scale = 1 << mipLevel;
+	int levelSize = std::max (1, (int) _volumeSize / scale);
+
+	/*
+	 * A fully dirty volume is a single region
+	*/
+
+	if (IsFullyDirty ()) {
+		VoxelRegion region;
+
+		region.minVoxel = glm::ivec3 (0);
+		region.maxVoxel = glm::ivec3 (levelSize);
+
+		regions.push_back (region);
+
+		return regions;
+	}
+
+	/*
+	 * Merge runs of dirty bricks along the x axis. On coarser levels the
+	 * bounds are rounded outwards, so a partly covered voxel is included.
+	*/
+
+	for (std::size_t z = 0; z < _bricksCount; z++) {
+		for (std::size_t y = 0; y < _bricksCount; y++) {
+			for (std::size_t x = 0; x < _bricksCount; x++) {
+				if (_dirtyBricks [GetBrickIndex (x, y, z)] == false) {
+					continue;
+				}
+
+				std::size_t runEnd = x;
+
+				while (runEnd + 1 < _bricksCount && _dirtyBricks [GetBrickIndex (runEnd + 1, y, z)] == true) {
+					runEnd ++;
+				}
+
+				glm::ivec3 minVoxel = glm::ivec3 (x, y, z) * (int) _brickSize;
+				glm::ivec3 maxVoxel = glm::min (glm::ivec3 (runEnd + 1, y + 1, z + 1) * (int) _brickSize,
+					glm::ivec3 ((int) _volumeSize));
+
+				VoxelRegion region;
+
+				region.minVoxel = minVoxel / scale;
+				region.maxVoxel = glm::min ((maxVoxel + scale - 1) / scale, glm::ivec3 (levelSize));
+
+				regions.push_back (region);
+
+				x = runEnd;
+			}
+		}
+	}
+
+	std::sort (regions.begin (), regions.end ());
+	regions.erase (std::unique (regions.begin (), regions.end ()), regions.end ());
+
+	return regions;
+}
+
+bool VoxelBricks::GetBrickRange (const AABBVolume& bounds, glm::ivec3& minBrick, glm::ivec3& maxBrick) const
+{
+	if (_bricksCount == 0) {
+		return false;
+	}
+
+	glm::vec3 volumeSize = _maxVertex - _minVertex;
+
+	if (volumeSize.x <= 0.0f || volumeSize.y <= 0.0f || volumeSize.z <= 0.0f) {
+		return false;
+	}
+
+	/*
+	 * Skip uninitialized bounds and objects outside the volume
+	*/
+
+	for (int k = 0; k < 3; k++) {
+		if (!std::isfinite (bounds.minVertex [k]) || !std::isfinite (bounds.maxVertex [k])) {
+			return false;
+		}
+
+		if (bounds.maxVertex [k] < _minVertex [k] || bounds.minVertex [k] > _maxVertex [k]) {
+			return false;
+		}
+	}
+
+	glm::vec3 minPosition = glm::floor ((bounds.minVertex - _origin) / _brickWorldSize);
+	glm::vec3 maxPosition = glm::floor ((bounds.maxVertex - _origin) / _brickWorldSize);
+
+	glm::ivec3 maxVolumeBrick = _minBrick + glm::ivec3 ((int) _bricksCount - 1);
+
+	minBrick = glm::clamp (glm::ivec3 (minPosition), _minBrick, maxVolumeBrick);
+	maxBrick = glm::clamp (glm::ivec3 (maxPosition), _minBrick, maxVolumeBrick);
+
+	return true;
+}
+
+std::size_t VoxelBricks::GetBrickIndex (int x, int y, int z) const
+{
+	/*
+	 * Wrap world bricks around the volume
+	*/
+
+	int bricksCount = (int) _bricksCount;
+
+	x = ((x % bricksCount) + bricksCount) % bricksCount;
+	y = ((y % bricksCount) + bricksCount) % bricksCount;
+	z = ((z % bricksCount) + bricksCount) % bricksCount;
+
+	return ((std::size_t) z * _bricksCount + y) * _bricksCount + x;
+}
+
+void VoxelBricks::Scroll (const glm::ivec3& minBrick)
+{
+	glm::ivec3 lastMinBrick = _minBrick;
+	glm::ivec3 lastMaxBrick = lastMinBrick + glm::ivec3 ((int) _bricksCount);
+
+	_minBrick = minBrick;
+
+	/*
+	 * The bricks that enter the volume take the place of the ones that
+	 * left it on the opposite side
+	*/
+
+	glm::ivec3 maxBrick = minBrick + glm::ivec3 ((int) _bricksCount);
+
+	for (int z = minBrick.z; z < maxBrick.z; z++) {
+		for (int y = minBrick.y; y < maxBrick.y; y++) {
+			for (int x = minBrick.x; x < maxBrick.x; x++) {
+				if (x >= lastMinBrick.x && x < lastMaxBrick.x &&
+					y >= lastMinBrick.y && y < lastMaxBrick.y &&
+					z >= lastMinBrick.z && z < lastMaxBrick.z) {
+					continue;
+				}
+
+				std::size_t index = GetBrickIndex (x, y, z);
+
+				if (_dirtyBricks [index] == false) {
+					_dirtyBricks [index] = true;
+					_dirtyBricksCount ++;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#ifndef VOXELBRICKS_H
+#define VOXELBRICKS_H
+
+#include <glm/vec3.hpp>
+#include <cstddef>
+#include <vector>
+#include <map>
+
+#include "Core/Intersections/AABBVolume.h"
+
+#define VOXEL_BRICK_SIZE 16
+
+/*
+ * Half open box of voxels, [minVoxel, maxVoxel)
+*/
+
+struct VoxelRegion
+{
+	glm::ivec3 minVoxel;
+	glm::ivec3 maxVoxel;
+
+	bool operator < (const VoxelRegion& other) const;
+	bool operator == (const VoxelRegion& other) const;
+};
+
+/*
+ * Splits the voxel volume in bricks and remembers the world bounds of
+ * every tracked object. Bricks covered by an object before and after it
+ * changed are marked dirty, so only they need to be cleared and voxelized
+ * again. Keeps no GPU state.
+ *
+ * Bricks are aligned to a world origin and addressed toroidally, a world
+ * brick always lands in the same texture brick. When the volume scrolls,
+ * only the bricks that enter it are marked dirty.
+*/
+
+class VoxelBricks
+{
+protected:
+	struct ObjectBounds
+	{
+		AABBVolume bounds;
+		bool visited;
+	};
+
+protected:
+	std::size_t _volumeSize;
+	std::size_t _brickSize;
+	std::size_t _bricksCount;
+
+	glm::vec3 _minVertex;
+	glm::vec3 _maxVertex;
+	glm::vec3 _origin;
+
+	glm::vec3 _brickWorldSize;
+	glm::ivec3 _minBrick;
+
+	std::vector<bool> _dirtyBricks;
+	std::size_t _dirtyBricksCount;
+
+	std::map<std::size_t, ObjectBounds> _objects;
+
+public:
+	VoxelBricks ();
+
+	void Reset (std::size_t volumeSize, std::size_t brickSize,
+		const glm::vec3& minVertex, const glm::vec3& maxVertex);
+	void Reset (std::size_t volumeSize, std::size_t brickSize,
+		const glm::vec3& minVertex, const glm::vec3& maxVertex, const glm::vec3& origin);
+
+	void BeginUpdate ();
+	bool UpdateObject (std::size_t objectID, const AABBVolume& bounds);
+	void EndUpdate ();
+
+	void MarkDirty (const AABBVolume& bounds);
+	void Invalidate ();
+	void ClearDirty ();
+
+	bool IsDirty () const;
+	bool IsDirty (const AABBVolume& bounds) const;
+	bool IsFullyDirty () const;
+
+	std::size_t GetBricksCount () const;
+	std::size_t GetDirtyBricksCount () const;
+
+	std::vector<VoxelRegion> GetDirtyRegions (std::size_t mipLevel = 0) const;
+protected:
+	bool GetBrickRange (const AABBVolume& bounds, glm::ivec3& minBrick, glm::ivec3& maxBrick) const;
+	std::size_t GetBrickIndex (int x, int y, int z) const;
+
+	void Scroll (const glm::ivec3& minBrick);
+};
+
+#endif
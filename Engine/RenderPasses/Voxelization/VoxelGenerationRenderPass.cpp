@@ -1,5 +1,7 @@
 #include "VoxelGenerationRenderPass.h"
 
+#include <algorithm>
+
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
@@ -46,10 +48,15 @@ RenderVolumeCollection* VoxelGenerationRenderPass::Execute (const RenderScene* r
 	UpdateVoxelVolume (settings);
 
 	/*
-	* Update voxel volume based on scene bounding box
+	* Update voxel volume based on scene bounding box, or center the
+	* clipmap on the camera
 	*/
 
-	UpdateVoxelVolumeBoundingBox (renderScene);
+	if (settings.vct_clipmap_enabled == true) {
+		UpdateVoxelVolumeClipmap (camera, settings);
+	} else {
+		UpdateVoxelVolumeBoundingBox (renderScene);
+	}
 
 	return rvc->Insert ("VoxelVolume", _voxelVolume);
 }
@@ -73,10 +80,22 @@ void VoxelGenerationRenderPass::UpdateVoxelVolumeBoundingBox (const RenderScene*
 	_voxelVolume->UpdateBoundingBox (minVertex, maxVertex);
 }
 
+void VoxelGenerationRenderPass::UpdateVoxelVolumeClipmap (const Camera* camera, const RenderSettings& settings)
+{
+	_voxelVolume->UpdateClipmap (camera->GetPosition (), settings.vct_clipmap_voxel_size);
+}
+
 void VoxelGenerationRenderPass::InitVoxelVolume (const RenderSettings& settings)
 {
 	std::vector<Resource<Texture>> textures;
 
+	/*
+	 * Clipmap levels are stacked along z
+	*/
+
+	std::size_t levelsCount = GetLevelsCount (settings);
+	TEXTURE_WRAP_MODE wrapMode = GetWrapMode (settings);
+
 	/*
 	 * Highest resolution
 	*/
@@ -84,6 +103,7 @@ void VoxelGenerationRenderPass::InitVoxelVolume (const RenderSettings& settings)
 	Resource<Texture> texture = Resource<Texture> (new Texture ("voxelTexture"));
 
 	glm::ivec3 size = glm::ivec3 (settings.vct_voxels_size);
+	size.z *= levelsCount;
 
 	texture->SetType (TEXTURE_TYPE::TEXTURE_3D);
 	texture->SetSize (Size (size.x, size.y, size.z));
@@ -91,7 +111,7 @@ void VoxelGenerationRenderPass::InitVoxelVolume (const RenderSettings& settings)
 	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA8);
 	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
 	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_UNSIGNED_BYTE);
-	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER);
+	texture->SetWrapMode (wrapMode);
 	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
 	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
 	texture->SetAnisotropicFiltering (false);
@@ -107,13 +127,14 @@ void VoxelGenerationRenderPass::InitVoxelVolume (const RenderSettings& settings)
 
 	size = glm::ivec3 (settings.vct_voxels_size >> 1);
 	size.x *= 6;
+	size.z *= levelsCount;
 
 	texture->SetType (TEXTURE_TYPE::TEXTURE_3D);
 	texture->SetSize (Size (size.x, size.y, size.z));
 	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA8);
 	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
 	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_UNSIGNED_BYTE);
-	texture->SetWrapMode (TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER);
+	texture->SetWrapMode (wrapMode);
 	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR_MIPMAP_LINEAR);
 	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_LINEAR);
 	texture->SetAnisotropicFiltering (false);
@@ -121,9 +142,33 @@ void VoxelGenerationRenderPass::InitVoxelVolume (const RenderSettings& settings)
 
 	textures.push_back (texture);
 
+	/*
+	 * Static geometry, kept between frames and copied in the highest
+	 * resolution before the dynamic objects are voxelized
+	*/
+
+	texture = Resource<Texture> (new Texture ("voxelStaticTexture"));
+
+	size = glm::ivec3 (settings.vct_voxels_size);
+	size.z *= levelsCount;
+
+	texture->SetType (TEXTURE_TYPE::TEXTURE_3D);
+	texture->SetSize (Size (size.x, size.y, size.z));
+	texture->SetMipmapGeneration (false);
+	texture->SetSizedInternalFormat (TEXTURE_SIZED_INTERNAL_FORMAT::FORMAT_RGBA8);
+	texture->SetInternalFormat (TEXTURE_INTERNAL_FORMAT::FORMAT_RGBA);
+	texture->SetChannelType (TEXTURE_CHANNEL_TYPE::CHANNEL_UNSIGNED_BYTE);
+	texture->SetWrapMode (wrapMode);
+	texture->SetMinFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetMagFilter (TEXTURE_FILTER_MODE::FILTER_NEAREST);
+	texture->SetAnisotropicFiltering (false);
+	texture->SetBorderColor (glm::vec4 (0.0));
+
+	textures.push_back (texture);
+
 	Resource<Framebuffer> framebuffer = Resource<Framebuffer> (new Framebuffer (textures));
 
-	_voxelVolume = new VoxelVolume (framebuffer, settings.vct_mipmap_levels);
+	_voxelVolume = new VoxelVolume (framebuffer, settings.vct_mipmap_levels, levelsCount);
 }
 
 void VoxelGenerationRenderPass::UpdateVoxelVolume (const RenderSettings& settings)
@@ -132,7 +177,9 @@ void VoxelGenerationRenderPass::UpdateVoxelVolume (const RenderSettings& setting
 	std::size_t mipmap_levels = _voxelVolume->GetMipmapLevels ();
 
 	if (size.width != settings.vct_voxels_size ||
-		mipmap_levels != settings.vct_mipmap_levels) {
+		mipmap_levels != settings.vct_mipmap_levels ||
+		_voxelVolume->GetLevelsCount () != GetLevelsCount (settings) ||
+		_voxelVolume->GetFramebuffer ()->GetTexture (0)->GetWrapMode () != GetWrapMode (settings)) {
 
 		/*
 		 * Clear voxel volume
@@ -147,3 +194,25 @@ void VoxelGenerationRenderPass::UpdateVoxelVolume (const RenderSettings& setting
 		InitVoxelVolume (settings);
 	}
 }
+
+std::size_t VoxelGenerationRenderPass::GetLevelsCount (const RenderSettings& settings) const
+{
+	if (settings.vct_clipmap_enabled == false) {
+		return 1;
+	}
+
+	return std::max ((std::size_t) 1, std::min (settings.vct_clipmap_levels, (std::size_t) MAX_CLIPMAP_LEVELS));
+}
+
+TEXTURE_WRAP_MODE VoxelGenerationRenderPass::GetWrapMode (const RenderSettings& settings) const
+{
+	/*
+	 * Clipmap levels wrap around their toroidal offset
+	*/
+
+	if (settings.vct_clipmap_enabled == true) {
+		return TEXTURE_WRAP_MODE::WRAP_REPEAT;
+	}
+
+	return TEXTURE_WRAP_MODE::WRAP_CLAMP_BORDER;
+}
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "RenderPasses/Container/ContainerRenderSubPassI.h"
 
+#include "Renderer/Render/Texture/TextureMode.h"
+
 #include "VoxelVolume.h"
 
 class VoxelGenerationRenderPass : public ContainerRenderSubPassI
@@ -25,9 +27,13 @@ public:
 	void Clear ();
 protected:
 	void UpdateVoxelVolumeBoundingBox (const RenderScene*);
+	void UpdateVoxelVolumeClipmap (const Camera* camera, const RenderSettings& settings);
 
 	void InitVoxelVolume (const RenderSettings& settings);
 	void UpdateVoxelVolume (const RenderSettings& settings);
+
+	std::size_t GetLevelsCount (const RenderSettings& settings) const;
+	TEXTURE_WRAP_MODE GetWrapMode (const RenderSettings& settings) const;
 };
 
 #endif
\ No newline at end of file
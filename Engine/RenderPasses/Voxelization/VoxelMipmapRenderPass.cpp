@@ -27,7 +27,7 @@ void VoxelMipmapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/Voxelize/voxelAnisotropicMipmapCompute.glsl"
 	);
 
-	_anisotropicShaderView = RenderSystem::LoadComputeShader (shader);
+	_anisotropicShaderView = LoadComputeShader (shader);
 
 	/*
 	 * Shader for voxel mipmap render pass
@@ -37,7 +37,7 @@ void VoxelMipmapRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/Voxelize/voxelMipmapCompute.glsl"
 	);
 
-	_shaderView = RenderSystem::LoadComputeShader (shader);
+	_shaderView = LoadComputeShader (shader);
 }
 
 RenderVolumeCollection* VoxelMipmapRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -80,33 +80,62 @@ void VoxelMipmapRenderPass::GenerateMipmaps (const RenderSettings& settings, Ren
 
 	VoxelVolume* voxelVolume = (VoxelVolume*) rvc->GetRenderVolume ("VoxelVolume");
 
-	for (std::size_t mipLevel = 0; mipLevel < voxelVolume->GetMipmapLevels () - 1; mipLevel++) {
+	/*
+	 * Without incremental voxelization every level is rebuilt
+	*/
 
-		if (mipLevel == 0) {
-			Pipeline::SetShader (_anisotropicShaderView);
+	if (settings.vct_incremental_voxelization == false) {
+		for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+			voxelVolume->GetMipmapBricks (level).Invalidate ();
+		}
+	}
 
-			Pipeline::SendCustomAttributes (_anisotropicShaderView, GetCustomAttributes (rvc, 0));
+	for (std::size_t mipLevel = 0; mipLevel < voxelVolume->GetMipmapLevels () - 1; mipLevel++) {
 
-			GL::Uniform1i (_anisotropicShaderView->GetUniformLocation ("DstMipRes"), dstMipRes);
-		} else {
-			Pipeline::SetShader (_shaderView);
+		Resource<ShaderView> shaderView = mipLevel == 0 ? _anisotropicShaderView : _shaderView;
 
-			Pipeline::SendCustomAttributes (_shaderView, GetCustomAttributes (rvc, 1));
+		Pipeline::SetShader (shaderView);
 
-			GL::Uniform1i (_shaderView->GetUniformLocation ("DstMipRes"), dstMipRes);
-		}
+		Pipeline::SendCustomAttributes (shaderView, GetCustomAttributes (rvc, mipLevel == 0 ? 0 : 1));
+
+		GL::Uniform1i (shaderView->GetUniformLocation ("DstMipRes"), dstMipRes);
 
 		GL::Uniform1i (_shaderView->GetUniformLocation ("srcMipLevel"), mipLevel == 0 ? 0 : mipLevel - 1);
 
 		unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (1)->GetGPUIndex ();
 		GL::BindImageTexture (0, voxelTextureID, mipLevel, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
 
-		int numWorkGroups = (int) std::ceil (dstMipRes / 4.0);
+		for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+
+			/*
+			 * Clipmap levels are stacked along z
+			*/
 
-		if (mipLevel == 0) {
-			GL::DispatchCompute (numWorkGroups, numWorkGroups, numWorkGroups);
-		} else {
-			GL::DispatchCompute (numWorkGroups * 6, numWorkGroups, numWorkGroups);
+			GL::Uniform1i (shaderView->GetUniformLocation ("DstMipLevel"), level);
+
+			/*
+			 * Only the regions covered by dirty bricks are filtered again
+			*/
+
+			for (const VoxelRegion& region : voxelVolume->GetMipmapBricks (level).GetDirtyRegions (mipLevel + 1)) {
+				glm::ivec3 regionSize = region.maxVoxel - region.minVoxel;
+
+				GL::Uniform3i (shaderView->GetUniformLocation ("DstMipOffset"),
+					region.minVoxel.x, region.minVoxel.y, region.minVoxel.z);
+				GL::Uniform3i (shaderView->GetUniformLocation ("DstMipRegion"),
+					regionSize.x, regionSize.y, regionSize.z);
+
+				/*
+				 * The directional mipmap shader runs six times wider groups,
+				 * one lane for each direction, so the group count is the same
+				*/
+
+				int numWorkGroupsX = (int) std::ceil (regionSize.x / 4.0);
+				int numWorkGroupsY = (int) std::ceil (regionSize.y / 4.0);
+				int numWorkGroupsZ = (int) std::ceil (regionSize.z / 4.0);
+
+				GL::DispatchCompute (numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+			}
 		}
 
 		GL::MemoryBarrier (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
@@ -114,6 +143,10 @@ void VoxelMipmapRenderPass::GenerateMipmaps (const RenderSettings& settings, Ren
 
 		Pipeline::UnlockShader ();
 	}
+
+	for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+		voxelVolume->GetMipmapBricks (level).ClearDirty ();
+	}
 }
 
 void VoxelMipmapRenderPass::EndVoxelMipmaping ()
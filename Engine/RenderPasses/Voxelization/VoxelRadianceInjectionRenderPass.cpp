@@ -16,7 +16,7 @@ void VoxelRadianceInjectionRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/Voxelize/voxelRadianceInjectionFragment.glsl"
 	});
 
-	_shaderView = RenderSystem::LoadShader (shader);
+	_shaderView = LoadShader (shader);
 }
 
 void VoxelRadianceInjectionRenderPass::Clear ()
@@ -1,5 +1,7 @@
 #include "VoxelVolume.h"
 
+#include <algorithm>
+
 #include "Renderer/Pipeline.h"
 
 #include "Wrappers/OpenGL/GL.h"
@@ -8,9 +10,20 @@
 
 #include "Debug/Logger/Logger.h"
 
-VoxelVolume::VoxelVolume (const Resource<Framebuffer>& framebuffer, std::size_t mipmapLevels) :
-	FramebufferRenderVolume (framebuffer)
+VoxelVolume::VoxelVolume (const Resource<Framebuffer>& framebuffer, std::size_t mipmapLevels,
+	std::size_t levelsCount) :
+	FramebufferRenderVolume (framebuffer),
+	_levelsCount (levelsCount),
+	_origin (0.0f),
+	_staticBricks (levelsCount),
+	_mipmapBricks (levelsCount)
 {
+	/*
+	 * Volume attributes follow the attributes of the textures
+	*/
+
+	_volumeAttributesIndex = _attributes.size ();
+
 	/*
 	 * Create attributes
 	*/
@@ -37,6 +50,36 @@ VoxelVolume::VoxelVolume (const Resource<Framebuffer>& framebuffer, std::size_t
 	_attributes.push_back (maxVertex);
 	_attributes.push_back (volumeSizeAttribute);
 	_attributes.push_back (volumeMipmapLevels);
+
+	/*
+	 * Create clipmap attributes, the first level is the volume above
+	*/
+
+	PipelineAttribute clipmapLevels;
+
+	clipmapLevels.type = PipelineAttribute::AttrType::ATTR_1I;
+	clipmapLevels.name = "clipmapLevels";
+	clipmapLevels.value.x = levelsCount;
+
+	_attributes.push_back (clipmapLevels);
+
+	for (std::size_t level = 0; level < levelsCount; level++) {
+		PipelineAttribute levelMinVertex;
+		PipelineAttribute levelMaxVertex;
+		PipelineAttribute levelOffset;
+
+		levelMinVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+		levelMaxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
+		levelOffset.type = PipelineAttribute::AttrType::ATTR_3I;
+
+		levelMinVertex.name = "clipmapMinVertex[" + std::to_string (level) + "]";
+		levelMaxVertex.name = "clipmapMaxVertex[" + std::to_string (level) + "]";
+		levelOffset.name = "clipmapOffset[" + std::to_string (level) + "]";
+
+		_attributes.push_back (levelMinVertex);
+		_attributes.push_back (levelMaxVertex);
+		_attributes.push_back (levelOffset);
+	}
 }
 
 void VoxelVolume::UpdateBoundingBox(const glm::vec3& minVertex, const glm::vec3& maxVertex)
@@ -65,21 +108,111 @@ void VoxelVolume::UpdateBoundingBox(const glm::vec3& minVertex, const glm::vec3&
 	 * Update attributes
 	*/
 
-	_attributes [2].value = minVertex - glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
-	_attributes [3].value = maxVertex + glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
+	glm::vec3 volumeMinVertex = minVertex - glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
+	glm::vec3 volumeMaxVertex = maxVertex + glm::vec3(difX / 2.0f, difY / 2.0f, difZ / 2.0f);
+
+	/*
+	 * Fitted volume is addressed from its own corner
+	*/
+
+	_origin = volumeMinVertex;
+
+	for (std::size_t level = 0; level < _levelsCount; level++) {
+		SetLevel (level, volumeMinVertex, volumeMaxVertex, glm::ivec3 (0));
+	}
 }
 
-const glm::vec3& VoxelVolume::GetMinVertex () const
+void VoxelVolume::UpdateClipmap (const glm::vec3& center, float voxelSize)
 {
-	return _attributes [2].value;
+	int volumeSize = (int) GetVolumeSize ();
+
+	/*
+	 * Levels move by whole bricks and whole voxels of the coarsest
+	 * mipmap, so that scrolling keeps both of them aligned
+	*/
+
+	int snapSize = std::max (1 << GetMipmapLevels (), VOXEL_BRICK_SIZE);
+	snapSize = std::max (1, std::min (snapSize, volumeSize / 2));
+
+	_origin = glm::vec3 (0.0f);
+
+	for (std::size_t level = 0; level < _levelsCount; level++) {
+		float levelVoxelSize = voxelSize * (1 << level);
+		float snapWorldSize = levelVoxelSize * snapSize;
+
+		glm::vec3 minVertex = glm::floor (center / snapWorldSize) * snapWorldSize -
+			glm::vec3 (levelVoxelSize * (volumeSize / 2));
+		glm::vec3 maxVertex = minVertex + glm::vec3 (levelVoxelSize * volumeSize);
+
+		/*
+		 * Toroidal offset of the first voxel in the level
+		*/
+
+		glm::ivec3 minVoxel = glm::ivec3 (glm::round ((minVertex - _origin) / levelVoxelSize));
+		glm::ivec3 offset = ((minVoxel % volumeSize) + volumeSize) % volumeSize;
+
+		SetLevel (level, minVertex, maxVertex, offset);
+	}
+}
+
+const glm::vec3& VoxelVolume::GetMinVertex (std::size_t level) const
+{
+	return _attributes [_volumeAttributesIndex + 5 + level * 3].value;
+}
+
+const glm::vec3& VoxelVolume::GetMaxVertex (std::size_t level) const
+{
+	return _attributes [_volumeAttributesIndex + 6 + level * 3].value;
 }
 
-const glm::vec3& VoxelVolume::GetMaxVertex () const
+glm::ivec3 VoxelVolume::GetOffset (std::size_t level) const
 {
-	return _attributes [3].value;
+	return glm::ivec3 (_attributes [_volumeAttributesIndex + 7 + level * 3].value);
+}
+
+const glm::vec3& VoxelVolume::GetOrigin () const
+{
+	return _origin;
+}
+
+std::size_t VoxelVolume::GetVolumeSize () const
+{
+	return (std::size_t) _attributes [_volumeAttributesIndex + 2].value.x;
 }
 
 std::size_t VoxelVolume::GetMipmapLevels () const
 {
-	return (std::size_t) _attributes [5].value.x;
+	return (std::size_t) _attributes [_volumeAttributesIndex + 3].value.x;
+}
+
+std::size_t VoxelVolume::GetLevelsCount () const
+{
+	return _levelsCount;
+}
+
+VoxelBricks& VoxelVolume::GetStaticBricks (std::size_t level)
+{
+	return _staticBricks [level];
+}
+
+VoxelBricks& VoxelVolume::GetMipmapBricks (std::size_t level)
+{
+	return _mipmapBricks [level];
 }
+
+void VoxelVolume::SetLevel (std::size_t level, const glm::vec3& minVertex, const glm::vec3& maxVertex,
+	const glm::ivec3& offset)
+{
+	_attributes [_volumeAttributesIndex + 5 + level * 3].value = minVertex;
+	_attributes [_volumeAttributesIndex + 6 + level * 3].value = maxVertex;
+	_attributes [_volumeAttributesIndex + 7 + level * 3].value = glm::vec3 (offset);
+
+	/*
+	 * The volume bounds are the bounds of the finest level
+	*/
+
+	if (level == 0) {
+		_attributes [_volumeAttributesIndex].value = minVertex;
+		_attributes [_volumeAttributesIndex + 1].value = maxVertex;
+	}
+}
\ No newline at end of file
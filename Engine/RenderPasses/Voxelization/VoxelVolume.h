@@ -8,19 +8,51 @@
 
 #include "Renderer/PipelineAttribute.h"
 
+#include "VoxelBricks.h"
+
 #define VOXEL_TEXTURE_NOT_INIT 360
 
+#define MAX_CLIPMAP_LEVELS 4
+
+/*
+ * The levels of a clipmap are stacked along the z axis of the textures.
+ * Each level doubles the voxel size of the previous one and is addressed
+ * toroidally, from a world aligned offset. A volume fitted to the scene
+ * is a single level without offset.
+*/
+
 class VoxelVolume : public FramebufferRenderVolume
 {
+protected:
+	std::size_t _volumeAttributesIndex;
+	std::size_t _levelsCount;
+
+	glm::vec3 _origin;
+
+	std::vector<VoxelBricks> _staticBricks;
+	std::vector<VoxelBricks> _mipmapBricks;
+
 public:
-	VoxelVolume (const Resource<Framebuffer>& framebuffer, std::size_t mipmapLevels);
+	VoxelVolume (const Resource<Framebuffer>& framebuffer, std::size_t mipmapLevels,
+		std::size_t levelsCount = 1);
 
 	virtual void UpdateBoundingBox (const glm::vec3& minVertex, const glm::vec3& maxVertex);
+	virtual void UpdateClipmap (const glm::vec3& center, float voxelSize);
 
-	const glm::vec3& GetMinVertex () const;
-	const glm::vec3& GetMaxVertex () const;
+	const glm::vec3& GetMinVertex (std::size_t level = 0) const;
+	const glm::vec3& GetMaxVertex (std::size_t level = 0) const;
+	glm::ivec3 GetOffset (std::size_t level) const;
+	const glm::vec3& GetOrigin () const;
 
+	std::size_t GetVolumeSize () const;
 	std::size_t GetMipmapLevels () const;
+	std::size_t GetLevelsCount () const;
+
+	VoxelBricks& GetStaticBricks (std::size_t level = 0);
+	VoxelBricks& GetMipmapBricks (std::size_t level = 0);
+protected:
+	void SetLevel (std::size_t level, const glm::vec3& minVertex, const glm::vec3& maxVertex,
+		const glm::ivec3& offset);
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,9 +1,13 @@
 #include "VoxelizationRenderPass.h"
 
+#include <algorithm>
+
 #include "Resources/Resources.h"
 #include "Renderer/RenderSystem.h"
 
 #include "Renderer/Pipeline.h"
+#include "Renderer/RenderLevelOfDetail.h"
+#include "Renderer/RenderDirectionalLightObject.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -33,7 +37,7 @@ void VoxelizationRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/Voxelize/voxelizeGeometry.glsl"
 	});
 
-	_staticShaderView = RenderSystem::LoadShader (staticShader);
+	_staticShaderView = LoadShader (staticShader);
 
 	/*
 	 * Shader for animated objects
@@ -45,7 +49,7 @@ void VoxelizationRenderPass::Init (const RenderSettings& settings)
 		"Assets/Shaders/Voxelize/voxelizeGeometry.glsl"
 	});
 
-	_animationShaderView = RenderSystem::LoadShader (animationShader);
+	_animationShaderView = LoadShader (animationShader);
 }
 
 RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* renderScene, const Camera* camera,
@@ -53,17 +57,49 @@ RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* rend
 {
 	VoxelVolume* voxelVolume = (VoxelVolume*) rvc->GetRenderVolume ("VoxelVolume");
 
+	/*
+	 * Voxelize geometry
+	*/
+
+	if (settings.vct_incremental_voxelization == true) {
+		IncrementalVoxelization (renderScene, settings, voxelVolume);
+	} else {
+		FullVoxelization (renderScene, settings, voxelVolume);
+	}
+
+	/*
+	 * Send back the collection with voxel volume attached
+	*/
+
+	return rvc;
+}
+
+void VoxelizationRenderPass::Clear ()
+{
+
+}
+
+void VoxelizationRenderPass::FullVoxelization (const RenderScene* renderScene,
+	const RenderSettings& settings, VoxelVolume* voxelVolume)
+{
 	/*
 	* Voxelization start
 	*/
 
-	StartVoxelization (voxelVolume);
+	ClearVoxelVolume (voxelVolume);
+
+	StartVoxelization ();
 
 	/*
 	* Voxelization: voxelize geomtry
 	*/
 
-	GeometryVoxelizationPass (renderScene, settings, voxelVolume);
+	std::vector<RenderObject*> renderObjects = GetRenderObjects (renderScene);
+
+	for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+		GeometryVoxelizationPass (GetLevelObjects (renderObjects, voxelVolume, level),
+			settings, voxelVolume, level, 0);
+	}
 
 	/*
 	* Clear opengl state after voxelization
@@ -72,18 +108,183 @@ RenderVolumeCollection* VoxelizationRenderPass::Execute (const RenderScene* rend
 	EndVoxelization ();
 
 	/*
-	 * Send back the collection with voxel volume attached
+	 * The static volume was cleared as well, rebuild everything when
+	 * switching back to incremental voxelization
 	*/
 
-	return rvc;
+	for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+		voxelVolume->GetStaticBricks (level).Invalidate ();
+		voxelVolume->GetMipmapBricks (level).Invalidate ();
+	}
 }
 
-void VoxelizationRenderPass::Clear ()
+void VoxelizationRenderPass::IncrementalVoxelization (const RenderScene* renderScene,
+	const RenderSettings& settings, VoxelVolume* voxelVolume)
+{
+	/*
+	 * Find the bricks changed since last frame
+	*/
+
+	UpdateBricks (renderScene, settings, voxelVolume);
+
+	std::vector<RenderObject*> renderObjects = GetRenderObjects (renderScene);
+
+	StartVoxelization ();
+
+	/*
+	 * Rebuild the dirty bricks of the static volume. Only the static
+	 * objects that touch them are voxelized again. A scrolled clipmap
+	 * level has only the bricks that entered it dirty.
+	*/
+
+	for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+		VoxelBricks& staticBricks = voxelVolume->GetStaticBricks (level);
+
+		if (!staticBricks.IsDirty ()) {
+			continue;
+		}
+
+		ClearStaticBricks (voxelVolume, level);
+
+		std::vector<RenderObject*> staticObjects;
+
+		for (RenderObject* renderObject : renderObjects) {
+			if (IsStatic (renderObject) && staticBricks.IsDirty (renderObject->GetBoundingBox ())) {
+				staticObjects.push_back (renderObject);
+			}
+		}
+
+		GeometryVoxelizationPass (staticObjects, settings, voxelVolume, level, 2);
+
+		GL::MemoryBarrier (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+
+		staticBricks.ClearDirty ();
+	}
+
+	/*
+	 * Start from the static volume, which also drops the radiance
+	 * injected last frame, and add the dynamic objects on top
+	*/
+
+	CopyStaticVolume (voxelVolume);
+
+	std::vector<RenderObject*> dynamicObjects;
+
+	for (RenderObject* renderObject : renderObjects) {
+		if (!IsStatic (renderObject)) {
+			dynamicObjects.push_back (renderObject);
+		}
+	}
+
+	for (std::size_t level = 0; level < voxelVolume->GetLevelsCount (); level++) {
+		GeometryVoxelizationPass (GetLevelObjects (dynamicObjects, voxelVolume, level),
+			settings, voxelVolume, level, 0);
+	}
+
+	EndVoxelization ();
+}
+
+void VoxelizationRenderPass::UpdateBricks (const RenderScene* renderScene,
+	const RenderSettings& settings, VoxelVolume* voxelVolume)
+{
+	std::size_t levelsCount = voxelVolume->GetLevelsCount ();
+
+	for (std::size_t level = 0; level < levelsCount; level++) {
+		voxelVolume->GetStaticBricks (level).Reset (voxelVolume->GetVolumeSize (), VOXEL_BRICK_SIZE,
+			voxelVolume->GetMinVertex (level), voxelVolume->GetMaxVertex (level), voxelVolume->GetOrigin ());
+		voxelVolume->GetMipmapBricks (level).Reset (voxelVolume->GetVolumeSize (), VOXEL_BRICK_SIZE,
+			voxelVolume->GetMinVertex (level), voxelVolume->GetMaxVertex (level), voxelVolume->GetOrigin ());
+	}
+
+	/*
+	 * Injected radiance changes everywhere when a light changes
+	*/
+
+	std::vector<glm::vec4> lightsState;
+	std::vector<glm::vec3> lightDirections;
+
+	for_each_type (RenderDirectionalLightObject*, renderLightObject, *renderScene) {
+		if (renderLightObject->IsActive () == false) {
+			continue;
+		}
+
+		glm::quat lightRotation = renderLightObject->GetTransform ()->GetRotation ();
+
+		lightsState.push_back (glm::vec4 (lightRotation.x, lightRotation.y, lightRotation.z, lightRotation.w));
+		lightsState.push_back (renderLightObject->GetLightColor ().ToVector4 () * renderLightObject->GetLightIntensity ());
+
+		lightDirections.push_back (glm::normalize (lightRotation * glm::vec3 (0, 0, -1)));
+	}
+
+	if (lightsState != _lightsState) {
+		for (std::size_t level = 0; level < levelsCount; level++) {
+			voxelVolume->GetMipmapBricks (level).Invalidate ();
+		}
+
+		_lightsState = lightsState;
+	}
+
+	/*
+	 * A moved object changes the light that reaches the voxels in its
+	 * shadow, so the mipmaps follow its bounds extruded along the lights
+	*/
+
+	std::vector<RenderObject*> renderObjects = GetRenderObjects (renderScene);
+
+	for (std::size_t level = 0; level < levelsCount; level++) {
+		VoxelBricks& staticBricks = voxelVolume->GetStaticBricks (level);
+		VoxelBricks& mipmapBricks = voxelVolume->GetMipmapBricks (level);
+
+		float volumeDiagonal = glm::length (voxelVolume->GetMaxVertex (level) - voxelVolume->GetMinVertex (level));
+
+		std::vector<glm::vec3> extrusions;
+
+		for (const glm::vec3& lightDirection : lightDirections) {
+			extrusions.push_back (lightDirection * volumeDiagonal);
+		}
+
+		staticBricks.BeginUpdate ();
+		mipmapBricks.BeginUpdate ();
+
+		for (RenderObject* renderObject : renderObjects) {
+			std::size_t objectID = (std::size_t) renderObject;
+
+			const AABBVolume& bounds = renderObject->GetBoundingBox ();
+			AABBVolume shadowBounds = GetShadowBounds (bounds, extrusions);
+
+			if (IsStatic (renderObject)) {
+				staticBricks.UpdateObject (objectID, bounds);
+			}
+
+			mipmapBricks.UpdateObject (objectID, shadowBounds);
+
+			/*
+			 * Skinned meshes change without moving their bounds
+			*/
+
+			if (renderObject->GetSceneLayers () & SceneLayer::ANIMATION) {
+				mipmapBricks.MarkDirty (shadowBounds);
+			}
+		}
+
+		staticBricks.EndUpdate ();
+		mipmapBricks.EndUpdate ();
+	}
+}
+
+AABBVolume VoxelizationRenderPass::GetShadowBounds (const AABBVolume& bounds, const std::vector<glm::vec3>& extrusions)
 {
+	AABBVolume shadowBounds = bounds;
 
+	for (const glm::vec3& extrusion : extrusions) {
+		shadowBounds.minVertex = glm::min (shadowBounds.minVertex, bounds.minVertex + extrusion);
+		shadowBounds.maxVertex = glm::max (shadowBounds.maxVertex, bounds.maxVertex + extrusion);
+	}
+
+	return shadowBounds;
 }
 
-void VoxelizationRenderPass::StartVoxelization (VoxelVolume* voxelVolume)
+void VoxelizationRenderPass::ClearVoxelVolume (VoxelVolume* voxelVolume)
 {
 	/*
 	 * Clear voxel volume
@@ -95,7 +296,40 @@ void VoxelizationRenderPass::StartVoxelization (VoxelVolume* voxelVolume)
 	GL::Clear(GL_COLOR_BUFFER_BIT);
 
 	GL::BindFramebuffer (GL_FRAMEBUFFER, 0);
+}
+
+void VoxelizationRenderPass::ClearStaticBricks (VoxelVolume* voxelVolume, std::size_t level)
+{
+	unsigned int staticTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (2)->GetGPUIndex ();
+
+	/*
+	 * Levels are stacked along z
+	*/
+
+	int levelOffset = (int) (level * voxelVolume->GetVolumeSize ());
+
+	for (const VoxelRegion& region : voxelVolume->GetStaticBricks (level).GetDirtyRegions ()) {
+		glm::ivec3 size = region.maxVoxel - region.minVoxel;
+
+		GL::ClearTexSubImage (staticTextureID, 0, region.minVoxel.x, region.minVoxel.y, region.minVoxel.z + levelOffset,
+			size.x, size.y, size.z, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	}
+}
+
+void VoxelizationRenderPass::CopyStaticVolume (VoxelVolume* voxelVolume)
+{
+	unsigned int staticTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (2)->GetGPUIndex ();
+	unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex ();
+
+	int volumeSize = (int) voxelVolume->GetVolumeSize ();
 
+	GL::CopyImageSubData (staticTextureID, GL_TEXTURE_3D, 0, 0, 0, 0,
+		voxelTextureID, GL_TEXTURE_3D, 0, 0, 0, 0,
+		volumeSize, volumeSize, volumeSize * (int) voxelVolume->GetLevelsCount ());
+}
+
+void VoxelizationRenderPass::StartVoxelization ()
+{
 	/*
 	* Render to window but mask out all color.
 	*/
@@ -106,8 +340,8 @@ void VoxelizationRenderPass::StartVoxelization (VoxelVolume* voxelVolume)
 	GL::DepthMask (GL_FALSE);
 }
 
-void VoxelizationRenderPass::GeometryVoxelizationPass (const RenderScene* renderScene,
-	const RenderSettings& settings, VoxelVolume* voxelVolume)
+void VoxelizationRenderPass::GeometryVoxelizationPass (const std::vector<RenderObject*>& renderObjects,
+	const RenderSettings& settings, VoxelVolume* voxelVolume, std::size_t level, std::size_t textureIndex)
 {
 	/*
 	 * Set viewport
@@ -119,26 +353,21 @@ void VoxelizationRenderPass::GeometryVoxelizationPass (const RenderScene* render
 	* Bind voxel volume to geometry render pass
 	*/
 
-	unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (0)->GetGPUIndex ();
+	unsigned int voxelTextureID = voxelVolume->GetFramebufferView ()->GetTextureView (textureIndex)->GetGPUIndex ();
 	GL::BindImageTexture (0, voxelTextureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
 
 	/*
-	* Render geometry
+	 * World size of a voxel, used to select the level of detail
 	*/
 
-	for_each_type (RenderObject*, renderObject, *renderScene) {
+	glm::vec3 volumeSize = voxelVolume->GetMaxVertex (level) - voxelVolume->GetMinVertex (level);
+	float voxelSize = std::max (volumeSize.x, std::max (volumeSize.y, volumeSize.z)) / settings.vct_voxels_size;
 
-		/*
-		 * Check if it's active
-		*/
+	/*
+	* Render geometry
+	*/
 
-		if (renderObject->IsActive () == false) {
-			continue;
-		}
-
-		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
-			continue;
-		}
+	for (RenderObject* renderObject : renderObjects) {
 
 		/*
 		 * Lock voxelization shader for geomtry rendering
@@ -150,13 +379,16 @@ void VoxelizationRenderPass::GeometryVoxelizationPass (const RenderScene* render
 		 * Send voxel volume attributes to pipeline
 		*/
 
-		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (voxelVolume));
+		Pipeline::SendCustomAttributes (nullptr, GetCustomAttributes (voxelVolume, level));
 
 		/*
-		 * Voxelize object
+		 * Voxelize object, a voxel hides any detail smaller than itself
 		*/
 
-		renderObject->Draw ();
+		std::size_t levelOfDetail = RenderLevelOfDetail::Select (renderObject, voxelSize,
+			settings, settings.lod_gi_bias);
+
+		renderObject->Draw (levelOfDetail);
 	}
 }
 
@@ -203,7 +435,64 @@ void VoxelizationRenderPass::LockShader (int sceneLayers)
 	}
 }
 
-std::vector<PipelineAttribute> VoxelizationRenderPass::GetCustomAttributes (VoxelVolume* voxelVolume)
+std::vector<RenderObject*> VoxelizationRenderPass::GetRenderObjects (const RenderScene* renderScene)
+{
+	std::vector<RenderObject*> renderObjects;
+
+	for_each_type (RenderObject*, renderObject, *renderScene) {
+
+		/*
+		 * Check if it's active
+		*/
+
+		if (renderObject->IsActive () == false) {
+			continue;
+		}
+
+		if (renderObject->GetRenderStage () != RenderStage::RENDER_STAGE_DEFERRED) {
+			continue;
+		}
+
+		renderObjects.push_back (renderObject);
+	}
+
+	return renderObjects;
+}
+
+std::vector<RenderObject*> VoxelizationRenderPass::GetLevelObjects (const std::vector<RenderObject*>& renderObjects,
+	VoxelVolume* voxelVolume, std::size_t level)
+{
+	std::vector<RenderObject*> levelObjects;
+
+	const glm::vec3& minVertex = voxelVolume->GetMinVertex (level);
+	const glm::vec3& maxVertex = voxelVolume->GetMaxVertex (level);
+
+	for (RenderObject* renderObject : renderObjects) {
+		const AABBVolume& bounds = renderObject->GetBoundingBox ();
+
+		/*
+		 * Skip objects outside of the level
+		*/
+
+		if (glm::any (glm::lessThan (bounds.maxVertex, minVertex)) ||
+			glm::any (glm::greaterThan (bounds.minVertex, maxVertex))) {
+			continue;
+		}
+
+		levelObjects.push_back (renderObject);
+	}
+
+	return levelObjects;
+}
+
+bool VoxelizationRenderPass::IsStatic (const RenderObject* renderObject) const
+{
+	int sceneLayers = renderObject->GetSceneLayers ();
+
+	return (sceneLayers & SceneLayer::STATIC) && !(sceneLayers & SceneLayer::ANIMATION);
+}
+
+std::vector<PipelineAttribute> VoxelizationRenderPass::GetCustomAttributes (VoxelVolume* voxelVolume, std::size_t level)
 {
 	std::vector<PipelineAttribute> attributes;
 
@@ -211,26 +500,40 @@ std::vector<PipelineAttribute> VoxelizationRenderPass::GetCustomAttributes (Voxe
 	PipelineAttribute maxVertex;
 	PipelineAttribute volumeSizeAttribute;
 	PipelineAttribute volumeMipmapLevels;
+	PipelineAttribute volumeOffset;
+	PipelineAttribute volumeLevel;
 
 	minVertex.type = PipelineAttribute::AttrType::ATTR_3F;
 	maxVertex.type = PipelineAttribute::AttrType::ATTR_3F;
 	volumeSizeAttribute.type = PipelineAttribute::AttrType::ATTR_3I;
 	volumeMipmapLevels.type = PipelineAttribute::AttrType::ATTR_1I;
+	volumeOffset.type = PipelineAttribute::AttrType::ATTR_3I;
+	volumeLevel.type = PipelineAttribute::AttrType::ATTR_1I;
 
 	minVertex.name = "minVertex";
 	maxVertex.name = "maxVertex";
 	volumeSizeAttribute.name = "volumeSize";
 	volumeMipmapLevels.name = "volumeMipmapLevels";
+	volumeOffset.name = "volumeOffset";
+	volumeLevel.name = "volumeLevel";
+
+	/*
+	 * Geometry is projected on the window of the level
+	*/
 
-	minVertex.value = voxelVolume->GetMinVertex ();
-	maxVertex.value = voxelVolume->GetMaxVertex ();
-	volumeSizeAttribute.value = glm::vec3 ((float) voxelVolume->GetFramebuffer ()->GetTexture (0)->GetSize ().width);
+	minVertex.value = voxelVolume->GetMinVertex (level);
+	maxVertex.value = voxelVolume->GetMaxVertex (level);
+	volumeSizeAttribute.value = glm::vec3 ((float) voxelVolume->GetVolumeSize ());
 	volumeMipmapLevels.value.x = voxelVolume->GetMipmapLevels ();
+	volumeOffset.value = glm::vec3 (voxelVolume->GetOffset (level));
+	volumeLevel.value.x = level;
 
 	attributes.push_back (minVertex);
 	attributes.push_back (maxVertex);
 	attributes.push_back (volumeSizeAttribute);
 	attributes.push_back (volumeMipmapLevels);
+	attributes.push_back (volumeOffset);
+	attributes.push_back (volumeLevel);
 
 	return attributes;
 }
@@ -16,6 +16,8 @@ protected:
 	Resource<ShaderView> _staticShaderView;
 	Resource<ShaderView> _animationShaderView;
 
+	std::vector<glm::vec4> _lightsState;
+
 public:
 	void Init (const RenderSettings& settings);
 	RenderVolumeCollection* Execute (const RenderScene* renderScene, const Camera* camera,
@@ -26,13 +28,29 @@ public:
 
 	void Clear ();
 protected:
-	void StartVoxelization (VoxelVolume* voxelVolume);
-	void GeometryVoxelizationPass (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+	void FullVoxelization (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+	void IncrementalVoxelization (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+
+	void UpdateBricks (const RenderScene* renderScene, const RenderSettings& settings, VoxelVolume* voxelVolume);
+	AABBVolume GetShadowBounds (const AABBVolume& bounds, const std::vector<glm::vec3>& extrusions);
+
+	void ClearVoxelVolume (VoxelVolume* voxelVolume);
+	void ClearStaticBricks (VoxelVolume* voxelVolume, std::size_t level);
+	void CopyStaticVolume (VoxelVolume* voxelVolume);
+
+	void StartVoxelization ();
+	void GeometryVoxelizationPass (const std::vector<RenderObject*>& renderObjects, const RenderSettings& settings,
+		VoxelVolume* voxelVolume, std::size_t level, std::size_t textureIndex);
 	void EndVoxelization ();
 
+	std::vector<RenderObject*> GetRenderObjects (const RenderScene* renderScene);
+	std::vector<RenderObject*> GetLevelObjects (const std::vector<RenderObject*>& renderObjects,
+		VoxelVolume* voxelVolume, std::size_t level);
+	bool IsStatic (const RenderObject* renderObject) const;
+
 	void LockShader (int sceneLayers);
 
-	std::vector<PipelineAttribute> GetCustomAttributes (VoxelVolume* voxelVolume);
+	std::vector<PipelineAttribute> GetCustomAttributes (VoxelVolume* voxelVolume, std::size_t level);
 };
 
 #endif
\ No newline at end of file
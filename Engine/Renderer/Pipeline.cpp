@@ -476,6 +476,14 @@ void Pipeline::SendMaterial(Resource<MaterialView> mat, const Resource<ShaderVie
 		GL::Uniform1i (currentShaderView->GetUniformLocation ("AlphaMap"), 0);
 	}
 
+	if (mat->lightMapTexture != nullptr) {
+		mat->lightMapTexture->Activate (_textureCount);
+		GL::Uniform1i (currentShaderView->GetUniformLocation ("LightMap"), _textureCount);
+		++ _textureCount;
+	} else {
+		GL::Uniform1i (currentShaderView->GetUniformLocation ("LightMap"), 0);
+	}
+
 	/*
 	 * Send custom attributes
 	*/
@@ -0,0 +1,91 @@
+#include "GLReadbackBackend.h"
+
+#include <cstring>
+
+#include "Wrappers/OpenGL/GL.h"
+
+unsigned int GLReadbackBackend::CreateBuffer (std::size_t size)
+{
+	unsigned int buffer;
+
+	GL::GenBuffers (1, &buffer);
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, buffer);
+	GL::BufferData (GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+
+	return buffer;
+}
+
+void GLReadbackBackend::DeleteBuffer (unsigned int buffer)
+{
+	GL::DeleteBuffers (1, &buffer);
+}
+
+bool GLReadbackBackend::GetTextureSize (unsigned int textureID, std::size_t& width, std::size_t& height)
+{
+	int textureWidth = 0, textureHeight = 0;
+
+	GL::BindTexture (GL_TEXTURE_2D, textureID);
+
+	GL::GetTexLevelParameteriv (GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &textureWidth);
+	GL::GetTexLevelParameteriv (GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &textureHeight);
+
+	width = textureWidth;
+	height = textureHeight;
+
+	return textureWidth > 0 && textureHeight > 0;
+}
+
+void GLReadbackBackend::ReadTexture (unsigned int textureID, unsigned int buffer)
+{
+	/*
+	 * With a pixel pack buffer bound the copy is only queued, the pixels
+	 * argument is an offset in the buffer
+	*/
+
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, buffer);
+	GL::BindTexture (GL_TEXTURE_2D, textureID);
+
+	GL::GetTexImage (GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+}
+
+bool GLReadbackBackend::ReadBuffer (unsigned int buffer, std::size_t size, unsigned char* pixels)
+{
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, buffer);
+
+	void* data = GL::MapBufferRange (GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+
+	if (data != nullptr) {
+		std::memcpy (pixels, data, size);
+
+		GL::UnmapBuffer (GL_PIXEL_PACK_BUFFER);
+	}
+
+	GL::BindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+
+	return data != nullptr;
+}
+
+ReadbackFence GLReadbackBackend::CreateFence ()
+{
+	return GL::FenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+bool GLReadbackBackend::IsFenceSignaled (ReadbackFence fence)
+{
+	/*
+	 * Poll without waiting, the flush makes sure the fence gets to the
+	 * GPU even if nothing else is submitted
+	*/
+
+	GLenum result = GL::ClientWaitSync ((GLsync) fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+}
+
+void GLReadbackBackend::DeleteFence (ReadbackFence fence)
+{
+	GL::DeleteSync ((GLsync) fence);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef GLREADBACKBACKEND_H
+#define GLREADBACKBACKEND_H
+
+#include "ReadbackBackendI.h"
+
+class ENGINE_API GLReadbackBackend : public ReadbackBackendI
+{
+public:
+	unsigned int CreateBuffer (std::size_t size);
+	void DeleteBuffer (unsigned int buffer);
+
+	bool GetTextureSize (unsigned int textureID, std::size_t& width, std::size_t& height);
+	void ReadTexture (unsigned int textureID, unsigned int buffer);
+	bool ReadBuffer (unsigned int buffer, std::size_t size, unsigned char* pixels);
+
+	ReadbackFence CreateFence ();
+	bool IsFenceSignaled (ReadbackFence fence);
+	void DeleteFence (ReadbackFence fence);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef READBACKBACKENDI_H
+#define READBACKBACKENDI_H
+
+#include <cstddef>
+
+typedef void* ReadbackFence;
+
+/*
+ * The calls the readback ring needs from the graphics API. Keeping them
+ * behind an interface lets the ring logic run without a GL context.
+*/
+
+class ENGINE_API ReadbackBackendI
+{
+public:
+	virtual ~ReadbackBackendI () {}
+
+	virtual unsigned int CreateBuffer (std::size_t size) = 0;
+	virtual void DeleteBuffer (unsigned int buffer) = 0;
+
+	virtual bool GetTextureSize (unsigned int textureID, std::size_t& width, std::size_t& height) = 0;
+	virtual void ReadTexture (unsigned int textureID, unsigned int buffer) = 0;
+	virtual bool ReadBuffer (unsigned int buffer, std::size_t size, unsigned char* pixels) = 0;
+
+	virtual ReadbackFence CreateFence () = 0;
+	virtual bool IsFenceSignaled (ReadbackFence fence) = 0;
+	virtual void DeleteFence (ReadbackFence fence) = 0;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "ReadbackManager.h"
+
+#include <memory>
+
+#include "Managers/ResourceStreamer.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "ReadbackStatisticsObject.h"
+
+ReadbackManager::ReadbackManager () :
+	_ring (&_backend, READBACK_RING_SIZE)
+{
+
+}
+
+ReadbackManager::~ReadbackManager ()
+{
+
+}
+
+SPECIALIZE_SINGLETON(ReadbackManager)
+
+bool ReadbackManager::ReadTexture (unsigned int textureID, const ReadbackCallback& callback)
+{
+	std::size_t id = _ring.Request (textureID);
+
+	if (id == 0) {
+		return false;
+	}
+
+	_callbacks [id] = callback;
+
+	return true;
+}
+
+void ReadbackManager::Update ()
+{
+	std::vector<ReadbackResult> results = _ring.Update ();
+
+	for (ReadbackResult& result : results) {
+		auto it = _callbacks.find (result.id);
+
+		if (it == _callbacks.end ()) {
+			continue;
+		}
+
+		ReadbackCallback callback = it->second;
+		_callbacks.erase (it);
+
+		/*
+		 * Keep the pixels alive until the loader thread gets to them
+		*/
+
+		auto readbackResult = std::make_shared<ReadbackResult> (std::move (result));
+
+		ResourceStreamer::Instance ()->EnqueueJob ([readbackResult, callback] () {
+			Texture* texture = new Texture ("temp");
+
+			texture->SetSize (Size (readbackResult->width, readbackResult->height));
+			texture->SetPixels (readbackResult->pixels.data (), readbackResult->pixels.size ());
+
+			callback (Resource<Texture> (texture, texture->GetName ()));
+		});
+	}
+
+	UpdateStatistics ();
+}
+
+void ReadbackManager::Clear ()
+{
+	_ring.Clear ();
+
+	_callbacks.clear ();
+}
+
+void ReadbackManager::UpdateStatistics ()
+{
+	auto readbackStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <ReadbackStatisticsObject> ();
+
+	readbackStatisticsObject->PendingCount = _ring.GetPendingCount ();
+	readbackStatisticsObject->CompletedCount = _ring.GetCompletedCount ();
+	readbackStatisticsObject->DroppedCount = _ring.GetDroppedCount ();
+	readbackStatisticsObject->LatencyFrames = _ring.GetLastLatency ();
+}
\ No newline at end of file
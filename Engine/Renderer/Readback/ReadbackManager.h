@@ -0,0 +1,58 @@
+#ifndef READBACKMANAGER_H
+#define READBACKMANAGER_H
+
+#include "Core/Singleton/Singleton.h"
+
+#include <functional>
+#include <map>
+
+#include "ReadbackRing.h"
+#include "GLReadbackBackend.h"
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Texture/Texture.h"
+
+/*
+ * Pixel buffers in flight, a capture is delivered this many frames
+ * after it was requested at best
+*/
+
+#define READBACK_RING_SIZE 4
+
+typedef std::function<void (const Resource<Texture>&)> ReadbackCallback;
+
+/*
+ * Reads textures back to the CPU without stalling the render thread.
+ * The copy goes through the readback ring, the texture is built and the
+ * callback runs later on a loader thread, where it could also encode
+ * and save the image.
+*/
+
+class ENGINE_API ReadbackManager : public Singleton<ReadbackManager>
+{
+	friend Singleton<ReadbackManager>;
+
+	DECLARE_SINGLETON(ReadbackManager)
+
+protected:
+	GLReadbackBackend _backend;
+	ReadbackRing _ring;
+
+	std::map<std::size_t, ReadbackCallback> _callbacks;
+
+public:
+	bool ReadTexture (unsigned int textureID, const ReadbackCallback& callback);
+
+	void Update ();
+
+	void Clear ();
+protected:
+	void UpdateStatistics ();
+private:
+	ReadbackManager ();
+	~ReadbackManager ();
+	ReadbackManager (const ReadbackManager&);
+	ReadbackManager& operator=(const ReadbackManager&);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "ReadbackRing.h"
+
+ReadbackRing::ReadbackRing (ReadbackBackendI* backend, std::size_t slotsCount) :
+	_backend (backend),
+	_frame (0),
+	_nextID (1),
+	_requestsCount (0),
+	_completedCount (0),
+	_droppedCount (0),
+	_lastLatency (0)
+{
+	Slot slot = { 0, 0, nullptr, false, 0, 0, 0, 0 };
+
+	_slots.resize (slotsCount, slot);
+}
+
+ReadbackRing::~ReadbackRing ()
+{
+	Clear ();
+}
+
+std::size_t ReadbackRing::Request (unsigned int textureID)
+{
+	++ _requestsCount;
+
+	std::size_t width = 0, height = 0;
+
+	if (_backend->GetTextureSize (textureID, width, height) == false) {
+		++ _droppedCount;
+
+		return 0;
+	}
+
+	std::size_t slotIndex = 0;
+
+	while (slotIndex < _slots.size () && _slots [slotIndex].isPending == true) {
+		++ slotIndex;
+	}
+
+	/*
+	 * Every buffer is still in flight
+	*/
+
+	if (slotIndex == _slots.size ()) {
+		++ _droppedCount;
+
+		return 0;
+	}
+
+	Slot& slot = _slots [slotIndex];
+
+	/*
+	 * Buffers only grow, a capture of the same size reuses the storage
+	*/
+
+	std::size_t size = width * height * 4;
+
+	if (slot.capacity < size) {
+		if (slot.capacity > 0) {
+			_backend->DeleteBuffer (slot.buffer);
+		}
+
+		slot.buffer = _backend->CreateBuffer (size);
+		slot.capacity = size;
+	}
+
+	_backend->ReadTexture (textureID, slot.buffer);
+
+	slot.fence = _backend->CreateFence ();
+	slot.isPending = true;
+	slot.id = _nextID ++;
+	slot.width = width;
+	slot.height = height;
+	slot.frame = _frame;
+
+	_pending.push_back (slotIndex);
+
+	return slot.id;
+}
+
+std::vector<ReadbackResult> ReadbackRing::Update ()
+{
+	std::vector<ReadbackResult> results;
+
+	/*
+	 * Fences are signaled in submission order, stop at the first one that
+	 * is not ready yet
+	*/
+
+	while (_pending.empty () == false) {
+		Slot& slot = _slots [_pending.front ()];
+
+		if (_backend->IsFenceSignaled (slot.fence) == false) {
+			break;
+		}
+
+		ReadbackResult result;
+
+		result.id = slot.id;
+		result.width = slot.width;
+		result.height = slot.height;
+		result.latency = _frame - slot.frame;
+		result.pixels.resize (slot.width * slot.height * 4);
+
+		bool isRead = _backend->ReadBuffer (slot.buffer, result.pixels.size (), result.pixels.data ());
+
+		_backend->DeleteFence (slot.fence);
+
+		slot.fence = nullptr;
+		slot.isPending = false;
+
+		_pending.pop_front ();
+
+		if (isRead == false) {
+			++ _droppedCount;
+
+			continue;
+		}
+
+		++ _completedCount;
+		_lastLatency = result.latency;
+
+		results.push_back (std::move (result));
+	}
+
+	++ _frame;
+
+	return results;
+}
+
+void ReadbackRing::Clear ()
+{
+	for (Slot& slot : _slots) {
+		if (slot.isPending == true) {
+			_backend->DeleteFence (slot.fence);
+		}
+
+		if (slot.capacity > 0) {
+			_backend->DeleteBuffer (slot.buffer);
+		}
+
+		slot.fence = nullptr;
+		slot.isPending = false;
+		slot.capacity = 0;
+	}
+
+	_pending.clear ();
+}
+
+std::size_t ReadbackRing::GetSlotsCount () const
+{
+	return _slots.size ();
+}
+
+std::size_t ReadbackRing::GetPendingCount () const
+{
+	return _pending.size ();
+}
+
+std::size_t ReadbackRing::GetRequestsCount () const
+{
+	return _requestsCount;
+}
+
+std::size_t ReadbackRing::GetCompletedCount () const
+{
+	return _completedCount;
+}
+
+std::size_t ReadbackRing::GetDroppedCount () const
+{
+	return _droppedCount;
+}
+
+std::size_t ReadbackRing::GetLastLatency () const
+{
+	return _lastLatency;
+}
\ No newline at end of file
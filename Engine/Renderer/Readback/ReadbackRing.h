@@ -0,0 +1,71 @@
+#ifndef READBACKRING_H
+#define READBACKRING_H
+
+#include <vector>
+#include <deque>
+
+#include "ReadbackBackendI.h"
+
+struct ENGINE_API ReadbackResult
+{
+	std::size_t id;
+	std::size_t width;
+	std::size_t height;
+	std::size_t latency;
+	std::vector<unsigned char> pixels;
+};
+
+/*
+ * A fixed number of pixel buffers the GPU copies textures into. Every
+ * copy is followed by a fence and only mapped once the fence was
+ * signaled, so the CPU never waits for the GPU. When all buffers are in
+ * flight a new request is dropped instead of stalling the frame. Results
+ * come out in the order they were requested.
+*/
+
+class ENGINE_API ReadbackRing
+{
+protected:
+	struct Slot
+	{
+		unsigned int buffer;
+		std::size_t capacity;
+		ReadbackFence fence;
+		bool isPending;
+		std::size_t id;
+		std::size_t width;
+		std::size_t height;
+		std::size_t frame;
+	};
+
+protected:
+	ReadbackBackendI* _backend;
+	std::vector<Slot> _slots;
+	std::deque<std::size_t> _pending;
+	std::size_t _frame;
+	std::size_t _nextID;
+
+	std::size_t _requestsCount;
+	std::size_t _completedCount;
+	std::size_t _droppedCount;
+	std::size_t _lastLatency;
+
+public:
+	ReadbackRing (ReadbackBackendI* backend, std::size_t slotsCount);
+	~ReadbackRing ();
+
+	std::size_t Request (unsigned int textureID);
+
+	std::vector<ReadbackResult> Update ();
+
+	void Clear ();
+
+	std::size_t GetSlotsCount () const;
+	std::size_t GetPendingCount () const;
+	std::size_t GetRequestsCount () const;
+	std::size_t GetCompletedCount () const;
+	std::size_t GetDroppedCount () const;
+	std::size_t GetLastLatency () const;
+};
+
+#endif
\ No newline at end of file
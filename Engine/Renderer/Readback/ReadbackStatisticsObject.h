@@ -0,0 +1,16 @@
+#ifndef READBACKSTATISTICSOBJECT_H
+#define READBACKSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API ReadbackStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(ReadbackStatisticsObject)
+
+	std::size_t PendingCount;
+	std::size_t CompletedCount;
+	std::size_t DroppedCount;
+	std::size_t LatencyFrames;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "CookedModel.h"
+
+CookedModelHeader::CookedModelHeader () :
+	magic (COOKED_MODEL_MAGIC),
+	version (COOKED_MODEL_VERSION),
+	sourceHash (0),
+	lodLevels (0),
+	lodReduction (0.0f),
+	lodMinPolygons (0),
+	vertexStride (0)
+{
+
+}
+
+bool CookedModelHeader::operator == (const CookedModelHeader& other) const
+{
+	return magic == other.magic && version == other.version &&
+		sourceHash == other.sourceHash && lodLevels == other.lodLevels &&
+		lodReduction == other.lodReduction && lodMinPolygons == other.lodMinPolygons &&
+		vertexStride == other.vertexStride;
+}
+
+CookedModel::CookedModel () :
+	Model (),
+	_file (),
+	_vertexData (nullptr),
+	_verticesCount (0),
+	_indexData (nullptr),
+	_indicesCount (0),
+	_levelsOfDetail ()
+{
+
+}
+
+MappedFile& CookedModel::GetFile ()
+{
+	return _file;
+}
+
+void CookedModel::SetVertexData (const unsigned char* vertexData, std::size_t verticesCount)
+{
+	_vertexData = vertexData;
+	_verticesCount = verticesCount;
+}
+
+void CookedModel::SetIndexData (const unsigned int* indexData, std::size_t indicesCount)
+{
+	_indexData = indexData;
+	_indicesCount = indicesCount;
+}
+
+void CookedModel::AddCookedLevelOfDetail (const CookedLevelOfDetail& levelOfDetail)
+{
+	_levelsOfDetail.push_back (levelOfDetail);
+}
+
+const unsigned char* CookedModel::GetVertexData () const
+{
+	return _vertexData;
+}
+
+std::size_t CookedModel::GetVerticesCount () const
+{
+	return _verticesCount;
+}
+
+const unsigned int* CookedModel::GetIndexData () const
+{
+	return _indexData;
+}
+
+std::size_t CookedModel::GetIndicesCount () const
+{
+	return _indicesCount;
+}
+
+const std::vector<CookedLevelOfDetail>& CookedModel::GetCookedLevelsOfDetail () const
+{
+	return _levelsOfDetail;
+}
+
+ResidencyMemory CookedModel::GetResidencyMemory () const
+{
+	ResidencyMemory memory = Model::GetResidencyMemory ();
+
+	/*
+	 * The streams are read from the mapped file
+	*/
+
+	memory.cpuMemory += _file.GetSize ();
+
+	return memory;
+}
@@ -0,0 +1,92 @@
+#ifndef COOKEDMODEL_H
+#define COOKEDMODEL_H
+
+#include "Model.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Material/Material.h"
+
+#include "Utils/Files/MappedFile.h"
+
+#define COOKED_MODEL_MAGIC 0x4C444D43
+#define COOKED_MODEL_VERSION 1
+#define COOKED_MODEL_ALIGNMENT 16
+
+/*
+ * Every field has to match for a cooked file to be reused, anything else
+ * means the source or the import settings changed since it was written
+*/
+
+struct CookedModelHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t sourceHash;
+	std::uint32_t lodLevels;
+	float lodReduction;
+	std::uint32_t lodMinPolygons;
+	std::uint32_t vertexStride;
+
+	CookedModelHeader ();
+
+	bool operator == (const CookedModelHeader& other) const;
+};
+
+struct CookedGroup
+{
+	Resource<Material> material;
+	std::size_t offset;
+	std::size_t INDEX_COUNT;
+};
+
+struct CookedLevelOfDetail
+{
+	std::vector<CookedGroup> groups;
+	float geometricError;
+};
+
+/*
+ * Model loaded from a cooked file. The final vertex and index streams stay
+ * in the mapped file and are uploaded as they are, only the geometry of
+ * the first level of detail is rebuilt for the systems that work on
+ * polygons (colliders, bounding boxes, voxelization).
+*/
+
+class ENGINE_API CookedModel : public Model
+{
+protected:
+	MappedFile _file;
+
+	const unsigned char* _vertexData;
+	std::size_t _verticesCount;
+
+	const unsigned int* _indexData;
+	std::size_t _indicesCount;
+
+	std::vector<CookedLevelOfDetail> _levelsOfDetail;
+
+public:
+	CookedModel ();
+	CookedModel (const CookedModel& other) = delete;
+
+	MappedFile& GetFile ();
+
+	void SetVertexData (const unsigned char* vertexData, std::size_t verticesCount);
+	void SetIndexData (const unsigned int* indexData, std::size_t indicesCount);
+	void AddCookedLevelOfDetail (const CookedLevelOfDetail& levelOfDetail);
+
+	const unsigned char* GetVertexData () const;
+	std::size_t GetVerticesCount () const;
+
+	const unsigned int* GetIndexData () const;
+	std::size_t GetIndicesCount () const;
+
+	const std::vector<CookedLevelOfDetail>& GetCookedLevelsOfDetail () const;
+
+	ResidencyMemory GetResidencyMemory () const;
+};
+
+#endif
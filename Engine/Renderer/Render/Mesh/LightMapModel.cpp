@@ -5,7 +5,8 @@
 LightMapModel::LightMapModel () :
 	Model (),
 	_haveLightMapUV (false),
-	_lmTexcoords ()
+	_lmTexcoords (),
+	_lightMap (nullptr)
 {
 
 }
@@ -38,4 +39,14 @@ glm::vec2 LightMapModel::GetLightMapTexcoord (std::size_t position) const
 	}
 
 	return _lmTexcoords [position];
+}
+
+void LightMapModel::SetLightMap (const Resource<Texture>& lightMap)
+{
+	_lightMap = lightMap;
+}
+
+const Resource<Texture>& LightMapModel::GetLightMap () const
+{
+	return _lightMap;
 }
\ No newline at end of file
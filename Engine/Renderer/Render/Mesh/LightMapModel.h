@@ -3,12 +3,26 @@
 
 #include "Model.h"
 
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Texture/Texture.h"
+
+#define LIGHTMAP_MODEL_MAGIC 0x4C444D4C
+#define LIGHTMAP_MODEL_VERSION 1
+
+/*
+ * Light map texcoords are indexed the same as the texcoords of the model.
+ * The light map belongs to the whole model, not to its materials, since
+ * the same material may be baked on many objects.
+*/
+
 class LightMapModel : public Model
 {
 protected:
 	bool _haveLightMapUV;
 	std::vector<glm::vec2> _lmTexcoords;
 
+	Resource<Texture> _lightMap;
+
 public:
 	LightMapModel ();
 
@@ -18,6 +32,9 @@ public:
 
 	void AddLightMapTexcoord (const glm::vec2& lmTexcoord);
 	glm::vec2 GetLightMapTexcoord (std::size_t position) const;
+
+	void SetLightMap (const Resource<Texture>& lightMap);
+	const Resource<Texture>& GetLightMap () const;
 };
 
 #endif
\ No newline at end of file
@@ -115,6 +115,17 @@ std::size_t Model::ObjectsCount (void) const
 	return _objectModels.size ();
 }
 
+std::size_t Model::LevelsOfDetailCount (void) const 
+{
+	std::size_t levelsOfDetailCount = 1;
+
+	for (std::size_t i=0;i<_objectModels.size();i++) {
+		levelsOfDetailCount = std::max (levelsOfDetailCount, _objectModels [i]->LevelsOfDetailCount ());
+	}
+
+	return levelsOfDetailCount;
+}
+
 glm::vec3 Model::GetVertex (std::size_t position) const 
 {
 	if (position >= _vertices.size()) {
@@ -386,3 +397,34 @@ void Model::CalculateBoundingBox (const glm::vec3& vertex)
 	_boundingBox.zmin = std::min (_boundingBox.zmin, vertex.z);
 	_boundingBox.zmax = std::max (_boundingBox.zmax, vertex.z);
 }
+
+RESIDENCY_GROUP Model::GetResidencyGroup () const
+{
+	return RESIDENCY_MODELS;
+}
+
+ResidencyMemory Model::GetResidencyMemory () const
+{
+	ResidencyMemory memory = { 0, 0 };
+
+	memory.cpuMemory += _vertices.capacity () * sizeof (glm::vec3);
+	memory.cpuMemory += _normals.capacity () * sizeof (glm::vec3);
+	memory.cpuMemory += _texcoords.capacity () * sizeof (glm::vec2);
+	memory.cpuMemory += _smoothNormals.capacity () * sizeof (glm::vec3);
+	memory.cpuMemory += _smoothNormalsCount.capacity () * sizeof (int);
+
+	/*
+	 * Every polygon keeps a vertex, a normal and a texcoord index per
+	 * corner, the levels of detail have their own polygons
+	*/
+
+	std::size_t polygonSize = sizeof (Polygon) + 9 * sizeof (int);
+
+	for (ObjectModel* objectModel : _objectModels) {
+		for (std::size_t levelOfDetail = 0; levelOfDetail < objectModel->LevelsOfDetailCount (); levelOfDetail ++) {
+			memory.cpuMemory += objectModel->GetLevelOfDetail (levelOfDetail)->PolygonsCount () * polygonSize;
+		}
+	}
+
+	return memory;
+}
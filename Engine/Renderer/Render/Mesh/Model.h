@@ -6,6 +6,7 @@
 #define MODEL_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
 #include <glm/vec3.hpp>
 #include <glm/vec2.hpp>
@@ -19,7 +20,7 @@
 #include "Polygon.h"
 #include "ObjectModel.h"
 
-class ENGINE_API Model : public Object
+class ENGINE_API Model : public Object, public ResidentObjectI
 {
 protected:
 	bool _haveUV;
@@ -56,6 +57,7 @@ public:
 	std::size_t NormalsCount () const;
 	std::size_t TexcoordsCount () const;
 	std::size_t ObjectsCount () const;
+	std::size_t LevelsOfDetailCount () const;
 
 	std::string GetName () const;
 	std::string GetMaterialLibrary () const;
@@ -67,6 +69,9 @@ public:
 
 	const BoundingBox& GetBoundingBox () const;
 
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
+
 	void SetVertex (const glm::vec3& vertex, std::size_t position);
 	void ClearObjects ();
 
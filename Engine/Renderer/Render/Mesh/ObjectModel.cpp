@@ -1,22 +1,31 @@
 #include "ObjectModel.h"
 
+#include <algorithm>
+
 ObjectModel::ObjectModel (const std::string& name) :
-	_name (name)
+	_name (name),
+	_geometricError (0.0f)
 {
 
 }
 
 ObjectModel::ObjectModel (const ObjectModel& other) :
-	_name (other._name)
+	_name (other._name),
+	_geometricError (other._geometricError)
 {
 	for (PolygonGroup* polyGroup : other._polygonGroups) {
 		_polygonGroups.push_back (new PolygonGroup (*polyGroup));
 	}
+
+	for (ObjectModel* levelOfDetail : other._levelsOfDetail) {
+		_levelsOfDetail.push_back (new ObjectModel (*levelOfDetail));
+	}
 }
 
 ObjectModel::~ObjectModel ()
 {
 	Clear ();
+	ClearLevelsOfDetail ();
 }
 
 void ObjectModel::AddPolygonGroup (PolygonGroup* polygonGroup)
@@ -47,6 +56,62 @@ void ObjectModel::SetName (const std::string& name)
 	_name = name;
 }
 
+void ObjectModel::AddLevelOfDetail (ObjectModel* levelOfDetail)
+{
+	_levelsOfDetail.push_back (levelOfDetail);
+}
+
+ObjectModel* ObjectModel::GetLevelOfDetail (std::size_t levelOfDetail)
+{
+	/*
+	 * Level zero is the object itself, the coarsest level is used for
+	 * any level past the end of the chain
+	*/
+
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return this;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1];
+}
+
+std::size_t ObjectModel::LevelsOfDetailCount () const
+{
+	return _levelsOfDetail.size () + 1;
+}
+
+void ObjectModel::ClearLevelsOfDetail ()
+{
+	for (ObjectModel* levelOfDetail : _levelsOfDetail) {
+		delete levelOfDetail;
+	}
+
+	_levelsOfDetail.clear ();
+}
+
+void ObjectModel::SetGeometricError (float geometricError)
+{
+	_geometricError = geometricError;
+}
+
+float ObjectModel::GetGeometricError () const
+{
+	return _geometricError;
+}
+
+std::size_t ObjectModel::PolygonsCount () const
+{
+	std::size_t polygonsCount = 0;
+
+	for (PolygonGroup* polyGroup : _polygonGroups) {
+		polygonsCount += std::distance (polyGroup->begin (), polyGroup->end ());
+	}
+
+	return polygonsCount;
+}
+
 std::vector<PolygonGroup*>::iterator ObjectModel::begin ()
 {
 	return _polygonGroups.begin ();
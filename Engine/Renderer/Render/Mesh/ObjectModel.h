@@ -13,6 +13,8 @@ class ObjectModel : public Object
 private:
 	std::string _name;
 	std::vector<PolygonGroup*> _polygonGroups;
+	std::vector<ObjectModel*> _levelsOfDetail;
+	float _geometricError;
 
 public:
 	ObjectModel (const std::string& name);
@@ -26,6 +28,16 @@ public:
 	
 	void SetName (const std::string& name);
 
+	void AddLevelOfDetail (ObjectModel* levelOfDetail);
+	ObjectModel* GetLevelOfDetail (std::size_t levelOfDetail);
+	std::size_t LevelsOfDetailCount () const;
+	void ClearLevelsOfDetail ();
+
+	void SetGeometricError (float geometricError);
+	float GetGeometricError () const;
+
+	std::size_t PolygonsCount () const;
+
 	std::vector<PolygonGroup*>::iterator begin ();
 	std::vector<PolygonGroup*>::iterator end ();
 
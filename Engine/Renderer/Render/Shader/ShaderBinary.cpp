@@ -0,0 +1,47 @@
+#include "ShaderBinary.h"
+
+ShaderBinaryHeader::ShaderBinaryHeader () :
+	magic (SHADER_BINARY_MAGIC),
+	version (SHADER_BINARY_VERSION),
+	sourceHash (0),
+	driverHash (0)
+{
+
+}
+
+bool ShaderBinaryHeader::operator == (const ShaderBinaryHeader& other) const
+{
+	return magic == other.magic && version == other.version &&
+		sourceHash == other.sourceHash && driverHash == other.driverHash;
+}
+
+ShaderBinary::ShaderBinary () :
+	_format (0)
+{
+
+}
+
+void ShaderBinary::SetFormat (unsigned int format)
+{
+	_format = format;
+}
+
+void ShaderBinary::SetData (const unsigned char* data, std::size_t size)
+{
+	_data.assign (data, data + size);
+}
+
+unsigned int ShaderBinary::GetFormat () const
+{
+	return _format;
+}
+
+const unsigned char* ShaderBinary::GetData () const
+{
+	return _data.data ();
+}
+
+std::size_t ShaderBinary::GetSize () const
+{
+	return _data.size ();
+}
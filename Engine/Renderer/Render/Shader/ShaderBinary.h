@@ -0,0 +1,46 @@
+#ifndef SHADERBINARY_H
+#define SHADERBINARY_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <cstdint>
+#include <vector>
+
+#define SHADER_BINARY_MAGIC 0x47525043
+#define SHADER_BINARY_VERSION 1
+
+/*
+ * A program binary is reused only when it was linked from the same
+ * preprocessed sources by the same driver
+*/
+
+struct ShaderBinaryHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t sourceHash;
+	std::uint64_t driverHash;
+
+	ShaderBinaryHeader ();
+
+	bool operator == (const ShaderBinaryHeader& other) const;
+};
+
+class ShaderBinary : public Object
+{
+protected:
+	unsigned int _format;
+	std::vector<unsigned char> _data;
+
+public:
+	ShaderBinary ();
+
+	void SetFormat (unsigned int format);
+	void SetData (const unsigned char* data, std::size_t size);
+
+	unsigned int GetFormat () const;
+	const unsigned char* GetData () const;
+	std::size_t GetSize () const;
+};
+
+#endif
@@ -19,3 +19,13 @@ const std::string& ShaderContent::GetContent () const
 {
 	return _content;
 }
+
+RESIDENCY_GROUP ShaderContent::GetResidencyGroup () const
+{
+	return RESIDENCY_SHADERS;
+}
+
+ResidencyMemory ShaderContent::GetResidencyMemory () const
+{
+	return ResidencyMemory { _content.capacity (), 0 };
+}
@@ -2,8 +2,9 @@
 #define SHADERCONTENT_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
-class ShaderContent : public Object
+class ShaderContent : public Object, public ResidentObjectI
 {
 protected:
 	std::string _filename;
@@ -15,6 +16,9 @@ public:
 
 	const std::string& GetFilename () const;
 	const std::string& GetContent () const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 };
 
 #endif
\ No newline at end of file
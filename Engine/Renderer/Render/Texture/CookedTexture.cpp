@@ -0,0 +1,18 @@
+#include "CookedTexture.h"
+
+CookedTextureHeader::CookedTextureHeader () :
+	magic (COOKED_TEXTURE_MAGIC),
+	version (COOKED_TEXTURE_VERSION),
+	sourceHash (0),
+	cookMode (COOK_NONE),
+	compressionType (COMPRESS_NONE)
+{
+
+}
+
+bool CookedTextureHeader::operator == (const CookedTextureHeader& other) const
+{
+	return magic == other.magic && version == other.version &&
+		sourceHash == other.sourceHash && cookMode == other.cookMode &&
+		compressionType == other.compressionType;
+}
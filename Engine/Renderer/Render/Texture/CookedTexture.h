@@ -0,0 +1,29 @@
+#ifndef COOKEDTEXTURE_H
+#define COOKEDTEXTURE_H
+
+#include <cstdint>
+
+#include "TextureMode.h"
+
+#define COOKED_TEXTURE_MAGIC 0x58455443
+#define COOKED_TEXTURE_VERSION 1
+
+/*
+ * A cooked texture is reused only when it was built from the same source
+ * with the same cook mode and requested compression
+*/
+
+struct CookedTextureHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t sourceHash;
+	std::uint32_t cookMode;
+	std::uint32_t compressionType;
+
+	CookedTextureHeader ();
+
+	bool operator == (const CookedTextureHeader& other) const;
+};
+
+#endif
@@ -24,6 +24,7 @@ Texture::Texture(const std::string& name) :
 {
 	for (std::size_t i=0;i<MAX_TEXTURE_MIPMAP_LEVEL; i++) {
 		_pixels [i] = nullptr;
+		_pixelsSize [i] = 0;
 	}
 }
 
@@ -108,7 +109,7 @@ void Texture::SetPixels (const unsigned char* pixels, std::size_t length)
 
 void Texture::AddMipmapLevel (const unsigned char* pixels, std::size_t length)
 {
-	if (_mipmapLevels + 1 >= MAX_TEXTURE_MIPMAP_LEVEL) {
+	if (_mipmapLevels >= MAX_TEXTURE_MIPMAP_LEVEL) {
 		Console::LogWarning ("Texture mipmap index exceed max mipmaps level. \
 			You are searching for " + std::to_string (_mipmapLevels + 1) +
 			" and the size is " + std::to_string (MAX_TEXTURE_MIPMAP_LEVEL));
@@ -116,10 +117,11 @@ void Texture::AddMipmapLevel (const unsigned char* pixels, std::size_t length)
 		return;
 	}
 
-	_mipmapLevels ++;
-
 	_pixels [_mipmapLevels] = new unsigned char [length];
 	memcpy (_pixels [_mipmapLevels], pixels, length);
+	_pixelsSize [_mipmapLevels] = length;
+
+	_mipmapLevels ++;
 }
 
 void Texture::SetMipmapLevel (const unsigned char* pixels, std::size_t mipmapLevel, std::size_t length)
@@ -138,6 +140,7 @@ void Texture::SetMipmapLevel (const unsigned char* pixels, std::size_t mipmapLev
 
 	_pixels [mipmapLevel] = new unsigned char [length];
 	memcpy (_pixels [mipmapLevel], pixels, length);
+	_pixelsSize [mipmapLevel] = length;
 }
 
 void Texture::SetBorderColor (const Color& borderColor)
@@ -237,3 +240,19 @@ const Color& Texture::GetBorderColor () const
 {
 	return _borderColor;
 }
+
+RESIDENCY_GROUP Texture::GetResidencyGroup () const
+{
+	return RESIDENCY_TEXTURES;
+}
+
+ResidencyMemory Texture::GetResidencyMemory () const
+{
+	ResidencyMemory memory = { 0, 0 };
+
+	for (std::size_t mipmapLevel = 0; mipmapLevel < _mipmapLevels; mipmapLevel ++) {
+		memory.cpuMemory += _pixelsSize [mipmapLevel];
+	}
+
+	return memory;
+}
@@ -2,6 +2,7 @@
 #define TEXTURE_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
 #include "TextureMode.h"
 #include "Utils/Color/Color.h"
@@ -9,12 +10,13 @@
 #define MAX_TEXTURE_MIPMAP_LEVEL 16
 
 // TODO: Extend this
-class ENGINE_API Texture : public Object
+class ENGINE_API Texture : public Object, public ResidentObjectI
 {
 protected:
 	std::string _name;
 
 	unsigned char *_pixels[MAX_TEXTURE_MIPMAP_LEVEL];
+	std::size_t _pixelsSize[MAX_TEXTURE_MIPMAP_LEVEL];
 
 	TEXTURE_TYPE _type;
 	Size _size;
@@ -71,6 +73,9 @@ public:
 	unsigned char* GetPixels () const;
 	unsigned char* GetMipmapLevel (std::size_t mipmapLevel) const;
 	const Color& GetBorderColor () const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 };
 
 #endif
\ No newline at end of file
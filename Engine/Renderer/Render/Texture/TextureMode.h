@@ -71,9 +71,17 @@ enum TEXTURE_COMPRESSION_TYPE
 	COMPRESS_AEXP,       /* DXT5  */
 	COMPRESS_YCOCG,      /* DXT5  */
 	COMPRESS_YCOCGS,     /* DXT5  */
+	COMPRESS_BC7,        /* BPTC  */
 	COMPRESS_MAX
 };
 
+enum TEXTURE_COOK_MODE
+{
+	COOK_NONE = 0,
+	COOK_COLOR,
+	COOK_NORMAL_MAP
+};
+
 struct Size
 {
 	std::size_t width;
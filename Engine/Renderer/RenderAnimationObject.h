@@ -27,8 +27,10 @@ protected:
 public:
 	RenderAnimationObject ();
 
-	void Draw ();
-	void DrawGeometry ();
+	bool IsInstanceable () const;
+
+	void Draw (std::size_t levelOfDetail = 0);
+	void DrawGeometry (std::size_t levelOfDetail = 0);
 
 	//TODO: Fix this
 	void SetAnimationModel (const Resource<Model>& animationModel);
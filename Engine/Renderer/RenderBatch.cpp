@@ -0,0 +1,78 @@
+#include "RenderBatch.h"
+
+#include "Renderer/RenderSystem.h"
+#include "Renderer/Pipeline.h"
+
+RenderBatch::RenderBatch (int sceneLayers, std::size_t levelOfDetail) :
+	_sceneLayers (sceneLayers),
+	_levelOfDetail (levelOfDetail)
+{
+
+}
+
+void RenderBatch::AddRenderObject (RenderObject* renderObject)
+{
+	_renderObjects.push_back (renderObject);
+	_modelMatrices.push_back (renderObject->GetTransform ()->GetModelMatrix ());
+}
+
+void RenderBatch::Clear ()
+{
+	/*
+	 * Keep allocated memory for the next frame
+	*/
+
+	_renderObjects.clear ();
+	_modelMatrices.clear ();
+}
+
+int RenderBatch::GetSceneLayers () const
+{
+	return _sceneLayers;
+}
+
+std::size_t RenderBatch::GetLevelOfDetail () const
+{
+	return _levelOfDetail;
+}
+
+std::size_t RenderBatch::GetRenderObjectsCount () const
+{
+	return _renderObjects.size ();
+}
+
+RenderObject* RenderBatch::GetRenderObject (std::size_t index) const
+{
+	return _renderObjects [index];
+}
+
+void RenderBatch::Draw ()
+{
+	UpdateModelMatrices ();
+
+	Resource<ModelView> modelView = _renderObjects.front ()->GetModelView ();
+
+	modelView->DrawInstanced (_renderObjects.size (), _levelOfDetail);
+}
+
+void RenderBatch::DrawGeometry ()
+{
+	UpdateModelMatrices ();
+
+	Resource<ModelView> modelView = _renderObjects.front ()->GetModelView ();
+
+	modelView->DrawGeometryInstanced (_renderObjects.size (), _levelOfDetail);
+}
+
+void RenderBatch::UpdateModelMatrices ()
+{
+	/*
+	 * Model matrices are taken per instance from the batch buffer
+	*/
+
+	Pipeline::ClearObjectTransform ();
+
+	Resource<ModelView> modelView = _renderObjects.front ()->GetModelView ();
+
+	RenderSystem::UpdateBatchModelView (modelView, _modelMatrices);
+}
@@ -0,0 +1,36 @@
+#ifndef RENDERBATCH_H
+#define RENDERBATCH_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <vector>
+#include <glm/mat4x4.hpp>
+
+#include "Renderer/RenderObject.h"
+
+class RenderBatch : public Object
+{
+protected:
+	int _sceneLayers;
+	std::size_t _levelOfDetail;
+	std::vector<RenderObject*> _renderObjects;
+	std::vector<glm::mat4> _modelMatrices;
+
+public:
+	RenderBatch (int sceneLayers, std::size_t levelOfDetail);
+
+	void AddRenderObject (RenderObject* renderObject);
+	void Clear ();
+
+	int GetSceneLayers () const;
+	std::size_t GetLevelOfDetail () const;
+	std::size_t GetRenderObjectsCount () const;
+	RenderObject* GetRenderObject (std::size_t index) const;
+
+	void Draw ();
+	void DrawGeometry ();
+protected:
+	void UpdateModelMatrices ();
+};
+
+#endif
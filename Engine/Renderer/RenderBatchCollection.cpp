@@ -0,0 +1,74 @@
+#include "RenderBatchCollection.h"
+
+RenderBatchCollection::~RenderBatchCollection ()
+{
+	for (auto& renderBatch : _renderBatches) {
+		delete renderBatch.second;
+	}
+}
+
+void RenderBatchCollection::AddRenderObject (RenderObject* renderObject, std::size_t levelOfDetail)
+{
+	Resource<ModelView> modelView = renderObject->GetModelView ();
+
+	auto key = std::make_tuple (&*modelView, renderObject->GetSceneLayers (), levelOfDetail);
+
+	auto it = _renderBatches.find (key);
+
+	if (it == _renderBatches.end ()) {
+		RenderBatch* renderBatch = new RenderBatch (renderObject->GetSceneLayers (), levelOfDetail);
+
+		it = _renderBatches.insert (std::make_pair (key, renderBatch)).first;
+	}
+
+	it->second->AddRenderObject (renderObject);
+}
+
+void RenderBatchCollection::Clear ()
+{
+	/*
+	 * Batches that stayed empty for a whole frame are released, the others
+	 * are kept to reuse their memory
+	*/
+
+	for (auto it = _renderBatches.begin (); it != _renderBatches.end ();) {
+		if (it->second->GetRenderObjectsCount () == 0) {
+			delete it->second;
+
+			it = _renderBatches.erase (it);
+
+			continue;
+		}
+
+		it->second->Clear ();
+
+		++ it;
+	}
+}
+
+std::size_t RenderBatchCollection::GetDrawCallsCount () const
+{
+	std::size_t drawCallsCount = 0;
+
+	for (auto& renderBatch : _renderBatches) {
+		if (renderBatch.second->GetRenderObjectsCount () == 0) {
+			continue;
+		}
+
+		Resource<ModelView> modelView = renderBatch.second->GetRenderObject (0)->GetModelView ();
+
+		drawCallsCount += std::distance (modelView->begin (), modelView->end ());
+	}
+
+	return drawCallsCount;
+}
+
+std::map<std::tuple<ModelView*, int, std::size_t>, RenderBatch*>::iterator RenderBatchCollection::begin ()
+{
+	return _renderBatches.begin ();
+}
+
+std::map<std::tuple<ModelView*, int, std::size_t>, RenderBatch*>::iterator RenderBatchCollection::end ()
+{
+	return _renderBatches.end ();
+}
@@ -0,0 +1,35 @@
+#ifndef RENDERBATCHCOLLECTION_H
+#define RENDERBATCHCOLLECTION_H
+
+#include "Core/Interfaces/Object.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "Renderer/RenderBatch.h"
+
+/*
+ * Groups the visible objects of a pass that share the same model view, scene
+ * layers and level of detail, so they can be drawn with a single instanced
+ * draw call.
+*/
+
+class RenderBatchCollection : public Object
+{
+protected:
+	std::map<std::tuple<ModelView*, int, std::size_t>, RenderBatch*> _renderBatches;
+
+public:
+	~RenderBatchCollection ();
+
+	void AddRenderObject (RenderObject* renderObject, std::size_t levelOfDetail = 0);
+	void Clear ();
+
+	std::size_t GetDrawCallsCount () const;
+
+	std::map<std::tuple<ModelView*, int, std::size_t>, RenderBatch*>::iterator begin ();
+	std::map<std::tuple<ModelView*, int, std::size_t>, RenderBatch*>::iterator end ();
+};
+
+#endif
@@ -0,0 +1,343 @@
+#include "RenderGovernor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define RENDER_GOVERNOR_EPSILON 0.0001f
+
+static void ScaleValue (float& value, float level)
+{
+	value *= level;
+}
+
+static void ScaleCount (std::size_t& count, float level)
+{
+	count = std::max ((std::size_t) std::lround (count * level), (std::size_t) 1);
+}
+
+RenderGovernor::RenderGovernor () :
+	_resolutionScale (1.0f),
+	_frameTime (0.0f),
+	_hasFrameTime (false),
+	_skipFrames (0),
+	_cooldownFrames (0)
+{
+	/*
+	 * Every knob scales the user values down, so the rendering settings stay
+	 * the upper bound. Passes are recognized by the prefix of their name.
+	*/
+
+	_knobs.push_back ({ "SSAO", { "SSAO" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.ssao_scale, level);
+		ScaleCount (settings.ssao_samples, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "SSR", { "SSR" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.ssr_scale, level);
+		ScaleCount (settings.ssr_iterations, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "SSDO", { "SSDO" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.ssdo_scale, level);
+		ScaleCount (settings.ssdo_samples, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "RSM", { "RSM", "TRSM" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.rsm_scale, level);
+		ScaleCount (settings.rsm_samples, level);
+		ScaleCount (settings.trsm_samples, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "HGI", { "HGI", "Hybrid" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.hgi_ssdo_sampling_scale, level);
+		ScaleCount (settings.hgi_rsm_samples, level);
+		ScaleCount (settings.hgi_ssdo_samples, level);
+		ScaleCount (settings.hgi_ao_samples, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "LPV", { "LPV" }, [] (RenderSettings& settings, float level) {
+		ScaleCount (settings.lpv_iterations, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "Bloom", { "Bloom", "BrightExtraction" }, [] (RenderSettings& settings, float level) {
+		ScaleValue (settings.bloom_scale, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "VolumetricLighting", { "VolumetricLighting" }, [] (RenderSettings& settings, float level) {
+		ScaleCount (settings.vol_lighting_iterations, level);
+	}, 1.0f, 0.0f });
+
+	_knobs.push_back ({ "LightShafts", { "LightShafts" }, [] (RenderSettings& settings, float level) {
+		ScaleCount (settings.light_shafts_iterations, level);
+	}, 1.0f, 0.0f });
+}
+
+void RenderGovernor::Reset ()
+{
+	for (auto& knob : _knobs) {
+		knob.level = 1.0f;
+		knob.cost = 0.0f;
+	}
+
+	_resolutionScale = 1.0f;
+	_frameTime = 0.0f;
+	_hasFrameTime = false;
+	_skipFrames = 0;
+	_cooldownFrames = 0;
+}
+
+void RenderGovernor::Update (const std::vector<RenderGovernorTiming>& timings, const RenderSettings& settings)
+{
+	/*
+	 * Keep the state inside the bounds, they may be edited at any time
+	*/
+
+	_resolutionScale = std::min (std::max (_resolutionScale, settings.governor_min_resolution_scale),
+		settings.governor_max_resolution_scale);
+
+	for (auto& knob : _knobs) {
+		knob.level = std::min (std::max (knob.level, settings.governor_min_quality), 1.0f);
+	}
+
+	if (timings.size () == 0) {
+		return;
+	}
+
+	/*
+	 * Timings arrive a few frames late, the ones right after a change
+	 * were still measured with the previous quality
+	*/
+
+	if (_skipFrames > 0) {
+		_skipFrames --;
+		return;
+	}
+
+	Sample (timings);
+
+	if (_cooldownFrames > 0) {
+		_cooldownFrames --;
+		return;
+	}
+
+	float upperFrameTime = settings.governor_target_frame_time * (1.0f + settings.governor_hysteresis);
+	float lowerFrameTime = settings.governor_target_frame_time * (1.0f - settings.governor_hysteresis);
+
+	if (_frameTime > upperFrameTime && Degrade (settings)) {
+		OnChange (settings);
+	} else if (_frameTime < lowerFrameTime && Upgrade (settings)) {
+		OnChange (settings);
+	}
+}
+
+void RenderGovernor::Apply (RenderSettings& settings) const
+{
+	if (settings.governor_enabled == false) {
+		return;
+	}
+
+	settings.resolution.width = std::max ((std::size_t) std::lround (settings.resolution.width * _resolutionScale), (std::size_t) 1);
+	settings.resolution.height = std::max ((std::size_t) std::lround (settings.resolution.height * _resolutionScale), (std::size_t) 1);
+
+	settings.viewport.x = (std::size_t) std::lround (settings.viewport.x * _resolutionScale);
+	settings.viewport.y = (std::size_t) std::lround (settings.viewport.y * _resolutionScale);
+	settings.viewport.width = std::min (std::max ((std::size_t) std::lround (settings.viewport.width * _resolutionScale), (std::size_t) 1),
+		settings.resolution.width);
+	settings.viewport.height = std::min (std::max ((std::size_t) std::lround (settings.viewport.height * _resolutionScale), (std::size_t) 1),
+		settings.resolution.height);
+
+	for (const auto& knob : _knobs) {
+		if (knob.level < 1.0f - RENDER_GOVERNOR_EPSILON) {
+			knob.apply (settings, knob.level);
+		}
+	}
+}
+
+float RenderGovernor::GetResolutionScale () const
+{
+	return _resolutionScale;
+}
+
+float RenderGovernor::GetFrameTime () const
+{
+	return _frameTime;
+}
+
+float RenderGovernor::GetQuality () const
+{
+	float quality = 0.0f;
+
+	for (const auto& knob : _knobs) {
+		quality += knob.level;
+	}
+
+	return quality / _knobs.size ();
+}
+
+const std::vector<RenderGovernor::Knob>& RenderGovernor::GetKnobs () const
+{
+	return _knobs;
+}
+
+void RenderGovernor::Sample (const std::vector<RenderGovernorTiming>& timings)
+{
+	float frameTime = 0.0f;
+	std::vector<float> costs (_knobs.size (), 0.0f);
+
+	/*
+	 * Timings are nested, a pass is only counted once for a knob even if
+	 * its container already matched it
+	*/
+
+	std::vector<int> matchedDepths (_knobs.size (), -1);
+
+	for (const auto& timing : timings) {
+		if (timing.nestDepth == 0) {
+			frameTime += timing.duration;
+		}
+
+		for (std::size_t i=0;i<_knobs.size ();i++) {
+			if (matchedDepths [i] >= (int) timing.nestDepth) {
+				matchedDepths [i] = -1;
+			}
+
+			if (matchedDepths [i] == -1 && IsPass (timing.name, _knobs [i])) {
+				costs [i] += timing.duration;
+				matchedDepths [i] = (int) timing.nestDepth;
+			}
+		}
+	}
+
+	if (_hasFrameTime == false) {
+		_frameTime = frameTime;
+
+		for (std::size_t i=0;i<_knobs.size ();i++) {
+			_knobs [i].cost = costs [i];
+		}
+
+		_hasFrameTime = true;
+
+		return;
+	}
+
+	_frameTime += (frameTime - _frameTime) * RENDER_GOVERNOR_SMOOTHING;
+
+	for (std::size_t i=0;i<_knobs.size ();i++) {
+		_knobs [i].cost += (costs [i] - _knobs [i].cost) * RENDER_GOVERNOR_SMOOTHING;
+	}
+}
+
+bool RenderGovernor::Degrade (const RenderSettings& settings)
+{
+	float minQuality = settings.governor_min_quality;
+
+	/*
+	 * Lower the most expensive technique while it is worth it, then the
+	 * resolution, then whatever technique is left
+	*/
+
+	Knob* candidate = nullptr;
+
+	for (auto& knob : _knobs) {
+		if (knob.level > minQuality + RENDER_GOVERNOR_EPSILON &&
+			knob.cost >= _frameTime * RENDER_GOVERNOR_KNOB_SHARE &&
+			(candidate == nullptr || knob.cost > candidate->cost)) {
+			candidate = &knob;
+		}
+	}
+
+	if (candidate == nullptr && _resolutionScale > settings.governor_min_resolution_scale + RENDER_GOVERNOR_EPSILON) {
+		_resolutionScale = ScaleResolution (_resolutionScale, settings, -1);
+
+		return true;
+	}
+
+	if (candidate == nullptr) {
+		for (auto& knob : _knobs) {
+			if (knob.level > minQuality + RENDER_GOVERNOR_EPSILON &&
+				(candidate == nullptr || knob.cost > candidate->cost)) {
+				candidate = &knob;
+			}
+		}
+	}
+
+	if (candidate == nullptr) {
+		return false;
+	}
+
+	candidate->level = std::max (candidate->level - settings.governor_quality_step, minQuality);
+
+	return true;
+}
+
+bool RenderGovernor::Upgrade (const RenderSettings& settings)
+{
+	float targetFrameTime = settings.governor_target_frame_time;
+
+	/*
+	 * The cost of a step is predicted from the measured one, resolution
+	 * by the pixels count and techniques proportionally to their level
+	*/
+
+	if (_resolutionScale < settings.governor_max_resolution_scale - RENDER_GOVERNOR_EPSILON) {
+		float nextScale = ScaleResolution (_resolutionScale, settings, 1);
+		float predictedFrameTime = _frameTime * (nextScale * nextScale) / (_resolutionScale * _resolutionScale);
+
+		if (predictedFrameTime <= targetFrameTime) {
+			_resolutionScale = nextScale;
+
+			return true;
+		}
+	}
+
+	Knob* candidate = nullptr;
+
+	for (auto& knob : _knobs) {
+		if (knob.level < 1.0f - RENDER_GOVERNOR_EPSILON &&
+			(candidate == nullptr || knob.level < candidate->level ||
+			(knob.level == candidate->level && knob.cost < candidate->cost))) {
+			candidate = &knob;
+		}
+	}
+
+	if (candidate == nullptr) {
+		return false;
+	}
+
+	float nextLevel = std::min (candidate->level + settings.governor_quality_step, 1.0f);
+	float predictedFrameTime = _frameTime + candidate->cost * (nextLevel / std::max (candidate->level, RENDER_GOVERNOR_EPSILON) - 1.0f);
+
+	if (predictedFrameTime > targetFrameTime) {
+		return false;
+	}
+
+	candidate->level = nextLevel;
+
+	return true;
+}
+
+void RenderGovernor::OnChange (const RenderSettings& settings)
+{
+	_hasFrameTime = false;
+	_skipFrames = RENDER_GOVERNOR_LATENCY_FRAMES;
+	_cooldownFrames = settings.governor_cooldown_frames;
+}
+
+bool RenderGovernor::IsPass (const std::string& name, const Knob& knob)
+{
+	for (const auto& passPrefix : knob.passPrefixes) {
+		if (name.compare (0, passPrefix.size (), passPrefix) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+float RenderGovernor::ScaleResolution (float scale, const RenderSettings& settings, int steps)
+{
+	scale += steps * settings.governor_resolution_step;
+
+	return std::min (std::max (scale, settings.governor_min_resolution_scale),
+		settings.governor_max_resolution_scale);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef RENDERGOVERNOR_H
+#define RENDERGOVERNOR_H
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "Renderer/RenderSettings.h"
+
+#define RENDER_GOVERNOR_SMOOTHING 0.2f
+#define RENDER_GOVERNOR_LATENCY_FRAMES 3
+#define RENDER_GOVERNOR_KNOB_SHARE 0.1f
+
+struct ENGINE_API RenderGovernorTiming
+{
+	std::string name;
+	float duration;
+	std::size_t nestDepth;
+};
+
+/*
+ * Holds the frame time around a target by trading render resolution and
+ * the quality of the most expensive techniques. It only sees the timings
+ * it is fed, so the same trace always gives the same decisions.
+ *
+ * Quality drops on the technique that costs the most before the resolution
+ * goes down, and comes back in the reverse order: resolution first, then
+ * the techniques, each step only if the predicted frame time fits.
+*/
+
+class ENGINE_API RenderGovernor
+{
+public:
+	struct Knob
+	{
+		std::string name;
+		std::vector<std::string> passPrefixes;
+		std::function<void (RenderSettings&, float)> apply;
+		float level;
+		float cost;
+	};
+
+protected:
+	std::vector<Knob> _knobs;
+
+	float _resolutionScale;
+	float _frameTime;
+	bool _hasFrameTime;
+	std::size_t _skipFrames;
+	std::size_t _cooldownFrames;
+
+public:
+	RenderGovernor ();
+
+	void Reset ();
+
+	void Update (const std::vector<RenderGovernorTiming>& timings, const RenderSettings& settings);
+	void Apply (RenderSettings& settings) const;
+
+	float GetResolutionScale () const;
+	float GetFrameTime () const;
+	float GetQuality () const;
+	const std::vector<Knob>& GetKnobs () const;
+protected:
+	void Sample (const std::vector<RenderGovernorTiming>& timings);
+
+	bool Degrade (const RenderSettings& settings);
+	bool Upgrade (const RenderSettings& settings);
+
+	void OnChange (const RenderSettings& settings);
+
+	static bool IsPass (const std::string& name, const Knob& knob);
+	static float ScaleResolution (float scale, const RenderSettings& settings, int steps);
+};
+
+#endif
\ No newline at end of file
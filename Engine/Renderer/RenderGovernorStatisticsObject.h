@@ -0,0 +1,16 @@
+#ifndef RENDERGOVERNORSTATISTICSOBJECT_H
+#define RENDERGOVERNORSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API RenderGovernorStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(RenderGovernorStatisticsObject)
+
+	bool IsEnabled;
+	float FrameTime;
+	float ResolutionScale;
+	float Quality;
+};
+
+#endif
\ No newline at end of file
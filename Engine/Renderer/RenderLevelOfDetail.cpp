@@ -0,0 +1,78 @@
+#include "RenderLevelOfDetail.h"
+
+#include <glm/geometric.hpp>
+#include <algorithm>
+
+std::size_t RenderLevelOfDetail::Select (const RenderObject* renderObject, const Camera* camera,
+	std::size_t resolution, const RenderSettings& settings, float bias)
+{
+	if (settings.lod_enabled == false || resolution == 0) {
+		return 0;
+	}
+
+	/*
+	 * Distance from camera to the bounding sphere of the object
+	*/
+
+	const AABBVolume& boundingBox = renderObject->GetBoundingBox ();
+
+	glm::vec3 center = (boundingBox.minVertex + boundingBox.maxVertex) * 0.5f;
+	float radius = glm::length (boundingBox.maxVertex - boundingBox.minVertex) * 0.5f;
+
+	float distance = glm::length (center - camera->GetPosition ()) - radius;
+	distance = std::max (distance, camera->GetZNear ());
+
+	/*
+	 * World size of a pixel at that distance, for both perspective
+	 * and orthographic projections
+	*/
+
+	glm::mat4 projectionMatrix = camera->GetProjectionMatrix ();
+
+	float pixelSize = 2.0f / (projectionMatrix [1][1] * resolution);
+
+	if (projectionMatrix [3][3] == 0.0f) {
+		pixelSize *= distance;
+	}
+
+	return Select (renderObject, pixelSize, settings, bias);
+}
+
+std::size_t RenderLevelOfDetail::Select (const RenderObject* renderObject, float pixelSize,
+	const RenderSettings& settings, float bias)
+{
+	if (settings.lod_enabled == false) {
+		return 0;
+	}
+
+	Resource<ModelView> modelView = renderObject->GetModelView ();
+
+	if (modelView == nullptr || modelView->GetLevelsOfDetailCount () == 1) {
+		return 0;
+	}
+
+	/*
+	 * Geometric errors are computed in model space, the world scale
+	 * includes the scale of the parents
+	*/
+
+	const glm::mat4& modelMatrix = renderObject->GetTransform ()->GetModelMatrix ();
+
+	glm::vec3 scale = glm::vec3 (glm::length (glm::vec3 (modelMatrix [0])),
+		glm::length (glm::vec3 (modelMatrix [1])), glm::length (glm::vec3 (modelMatrix [2])));
+	float maxScale = std::max (scale.x, std::max (scale.y, scale.z));
+
+	float maxError = pixelSize * settings.lod_pixel_error * bias;
+
+	std::size_t levelOfDetail = 0;
+
+	for (std::size_t index = 1; index < modelView->GetLevelsOfDetailCount (); index ++) {
+		if (modelView->GetGeometricError (index) * maxScale > maxError) {
+			break;
+		}
+
+		levelOfDetail = index;
+	}
+
+	return levelOfDetail;
+}
@@ -0,0 +1,25 @@
+#ifndef RENDERLEVELOFDETAIL_H
+#define RENDERLEVELOFDETAIL_H
+
+#include "Renderer/RenderObject.h"
+#include "Renderer/RenderSettings.h"
+
+#include "Systems/Camera/Camera.h"
+
+/*
+ * Chooses the coarsest level of detail of an object whose geometric error,
+ * projected on the render target of a pass, stays below the pixel error
+ * threshold. Passes that don't need full detail, like the shadow and the
+ * global illumination ones, relax the threshold with a bias.
+*/
+
+class RenderLevelOfDetail
+{
+public:
+	static std::size_t Select (const RenderObject* renderObject, const Camera* camera,
+		std::size_t resolution, const RenderSettings& settings, float bias = 1.0f);
+	static std::size_t Select (const RenderObject* renderObject, float pixelSize,
+		const RenderSettings& settings, float bias = 1.0f);
+};
+
+#endif
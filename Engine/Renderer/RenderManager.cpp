@@ -4,6 +4,11 @@
 
 #include "Debug/Profiler/Profiler.h"
 
+#include "Debug/Statistics/StatisticsManager.h"
+#include "RenderGovernorStatisticsObject.h"
+
+#define RENDER_GOVERNOR_PROFILER_SCOPE "RenderGovernor"
+
 /*
  * Singleton Part
 */
@@ -98,11 +103,87 @@ RenderProduct RenderManager::Render (const Camera* camera, const RenderSettings&
 		initalized.insert (renderModule);
 	}
 
+	if (settings.governor_enabled == true) {
+		return RenderGoverned (renderModule, camera, settings);
+	}
+
+	if (settings.renderMode == _governedRenderMode) {
+		Profiler::Instance ()->GetGPUProfilerService ()->SetRequired (false);
+
+		StatisticsManager::Instance ()->GetStatisticsObject <RenderGovernorStatisticsObject> ()->IsEnabled = false;
+
+		_governedRenderMode.clear ();
+	}
+
 	RenderProduct result = renderModule->Render (_renderScene, camera, settings);
 
 	return result;
 }
 
+RenderProduct RenderManager::RenderGoverned (RenderModule* renderModule, const Camera* camera, const RenderSettings& settings)
+{
+	if (settings.renderMode != _governedRenderMode) {
+		_renderGovernor.Reset ();
+		_governedRenderMode = settings.renderMode;
+	}
+
+	/*
+	 * The governor needs the timings of the passes every frame
+	*/
+
+	Profiler::Instance ()->GetGPUProfilerService ()->SetRequired (true);
+
+	_renderGovernor.Update (GetGovernorTimings (), settings);
+
+	RenderSettings governedSettings = settings;
+	_renderGovernor.Apply (governedSettings);
+
+	auto renderGovernorStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RenderGovernorStatisticsObject> ();
+
+	renderGovernorStatisticsObject->IsEnabled = true;
+	renderGovernorStatisticsObject->FrameTime = _renderGovernor.GetFrameTime ();
+	renderGovernorStatisticsObject->ResolutionScale = _renderGovernor.GetResolutionScale ();
+	renderGovernorStatisticsObject->Quality = _renderGovernor.GetQuality ();
+
+	PROFILER_GPU_LOGGER(RENDER_GOVERNOR_PROFILER_SCOPE)
+
+	return renderModule->Render (_renderScene, camera, governedSettings);
+}
+
+std::vector<RenderGovernorTiming> RenderManager::GetGovernorTimings () const
+{
+	std::vector<RenderGovernorTiming> timings;
+
+	/*
+	 * Only the passes of the governed render count, other renders of the
+	 * frame, like the editor interface, are left out
+	*/
+
+	const auto& profilerEvents = Profiler::Instance ()->GetGPUProfilerService ()->GetLastFrameEvents ();
+
+	bool isInScope = false;
+	std::size_t scopeDepth = 0;
+
+	for (auto profilerEvent : profilerEvents) {
+		if (isInScope == true && profilerEvent->NestDepth <= scopeDepth) {
+			isInScope = false;
+		}
+
+		if (isInScope == false) {
+			if (profilerEvent->Name == RENDER_GOVERNOR_PROFILER_SCOPE) {
+				isInScope = true;
+				scopeDepth = profilerEvent->NestDepth;
+			}
+
+			continue;
+		}
+
+		timings.push_back ({ profilerEvent->Name, profilerEvent->Duration, profilerEvent->NestDepth - scopeDepth - 1 });
+	}
+
+	return timings;
+}
+
 void RenderManager::Clear ()
 {
 	delete _renderScene;
@@ -26,6 +26,9 @@
 #include "RenderScene.h"
 #include "Systems/Camera/Camera.h"
 #include "RenderSettings.h"
+#include "RenderGovernor.h"
+
+class RenderModule;
 
 class ENGINE_API RenderManager : public Singleton<RenderManager>
 {
@@ -36,6 +39,9 @@ class ENGINE_API RenderManager : public Singleton<RenderManager>
 private:
 	RenderScene* _renderScene;
 
+	RenderGovernor _renderGovernor;
+	std::string _governedRenderMode;
+
 public:
 	void Init ();
 
@@ -59,6 +65,9 @@ public:
 
 	void Clear ();
 private:
+	RenderProduct RenderGoverned (RenderModule* renderModule, const Camera* camera, const RenderSettings& settings);
+	std::vector<RenderGovernorTiming> GetGovernorTimings () const;
+
 	RenderManager ();
 	RenderManager (const RenderManager& other);
 	RenderManager& operator=(const RenderManager& other);
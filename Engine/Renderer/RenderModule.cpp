@@ -1,5 +1,7 @@
 #include "RenderModule.h"
 
+#include "Renderer/RenderTargets/RenderTargetPool.h"
+
 #include "Debug/Profiler/Profiler.h"
 
 RenderModule::RenderModule () :
@@ -44,6 +46,23 @@ RenderProduct RenderModule::Render (const RenderScene* renderScene, const Camera
 
 	RenderProduct product;
 
+	/*
+	 * Passes read the volumes of the passes before them, so nothing is
+	 * drawn while a shader of the module still compiles
+	*/
+
+	if (IsPending () == true) {
+		product.resultVolume = nullptr;
+
+		return product;
+	}
+
+	/*
+	 * Targets shared between passes are free again
+	*/
+
+	RenderTargetPool::Instance ()->NewFrame ();
+
 	/*
 	 * Start scope
 	*/
@@ -58,6 +77,14 @@ RenderProduct RenderModule::Render (const RenderScene* renderScene, const Camera
 		PROFILER_LOGGER(renderPass->GetName ())
 		PROFILER_GPU_LOGGER(renderPass->GetName ())
 
+		/*
+		 * Skip render pass whose shaders could not be built
+		*/
+
+		if (!renderPass->IsReady ()) {
+			continue;
+		}
+
 		_rvc = renderPass->Execute (renderScene, camera, settings, _rvc);
 	}
 
@@ -76,6 +103,17 @@ RenderProduct RenderModule::Render (const RenderScene* renderScene, const Camera
 	return product;
 }
 
+bool RenderModule::IsPending () const
+{
+	for (RenderPassI* renderPass : _renderPasses) {
+		if (renderPass->IsPending ()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void RenderModule::ClearModule ()
 {
 	/*
@@ -29,6 +29,8 @@ public:
 	virtual void ClearModule ();
 protected:
 	virtual void Init () = 0;
+
+	bool IsPending () const;
 };
 
 #endif
\ No newline at end of file
@@ -107,18 +107,27 @@ bool RenderObject::IsActive () const
 	return _isActive;
 }
 
-void RenderObject::Draw ()
+bool RenderObject::IsInstanceable () const
+{
+	/*
+	 * Objects with custom attributes need their own draw call
+	*/
+
+	return _modelView != nullptr && _attributes.empty ();
+}
+
+void RenderObject::Draw (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
-	_modelView->Draw ();
+	_modelView->Draw (levelOfDetail);
 }
 
-void RenderObject::DrawGeometry ()
+void RenderObject::DrawGeometry (std::size_t levelOfDetail)
 {
 	Pipeline::SetObjectTransform (_transform);
 
-	_modelView->DrawGeometry ();
+	_modelView->DrawGeometry (levelOfDetail);
 }
 
 void RenderObject::UpdateBoundingBox ()
@@ -49,8 +49,10 @@ public:
 	int GetPriority () const;
 	bool IsActive () const;
 
-	virtual void Draw ();
-	virtual void DrawGeometry ();
+	virtual bool IsInstanceable () const;
+
+	virtual void Draw (std::size_t levelOfDetail = 0);
+	virtual void DrawGeometry (std::size_t levelOfDetail = 0);
 protected:
 	void UpdateBoundingBox ();
 };
@@ -1,6 +1,48 @@
 #include "RenderPassI.h"
 
+#include "Renderer/RenderSystem.h"
+
 RenderPassI::~RenderPassI ()
 {
 
 }
+
+bool RenderPassI::IsReady () const
+{
+	for (auto& shaderView : _loadedShaderViews) {
+		if (!shaderView->IsReady ()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool RenderPassI::IsPending () const
+{
+	for (auto& shaderView : _loadedShaderViews) {
+		if (!shaderView->IsReady () && !shaderView->IsFailed ()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+Resource<ShaderView> RenderPassI::LoadShader (const Resource<Shader>& shader)
+{
+	Resource<ShaderView> shaderView = RenderSystem::LoadShader (shader);
+
+	_loadedShaderViews.push_back (shaderView);
+
+	return shaderView;
+}
+
+Resource<ShaderView> RenderPassI::LoadComputeShader (const Resource<Shader>& shader)
+{
+	Resource<ShaderView> shaderView = RenderSystem::LoadComputeShader (shader);
+
+	_loadedShaderViews.push_back (shaderView);
+
+	return shaderView;
+}
@@ -3,8 +3,14 @@
 
 #include "Core/Interfaces/Object.h"
 
+#include <vector>
+
 #include "RenderVolumeCollection.h"
 
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Shader/Shader.h"
+#include "Renderer/RenderViews/ShaderView.h"
+
 #include "Renderer/RenderScene.h"
 #include "Systems/Camera/Camera.h"
 #include "RenderSettings.h"
@@ -15,6 +21,9 @@ public: \
 
 class ENGINE_API RenderPassI : public Object
 {
+protected:
+	std::vector<Resource<ShaderView>> _loadedShaderViews;
+
 public:
 	virtual ~RenderPassI () = 0;
 
@@ -24,7 +33,19 @@ public:
 
 	virtual std::string GetName () const = 0;
 
+	/*
+	 * A pass is ready once every shader it loaded is linked. It is
+	 * pending while any of them still compiles, a shader that failed
+	 * to build leaves it not ready without keeping it pending
+	*/
+
+	virtual bool IsReady () const;
+	virtual bool IsPending () const;
+
 	virtual void Clear () = 0;
+protected:
+	Resource<ShaderView> LoadShader (const Resource<Shader>& shader);
+	Resource<ShaderView> LoadComputeShader (const Resource<Shader>& shader);
 };
 
 #endif
\ No newline at end of file
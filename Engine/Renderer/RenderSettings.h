@@ -31,6 +31,25 @@ struct RenderSettings : public Object
 	bool indirect_diffuse_enabled;
 	bool indirect_specular_enabled;
 	bool subsurface_scattering_enabled;
+	bool instancing_enabled;
+
+	bool lod_enabled;
+	float lod_pixel_error;
+	float lod_shadow_bias;
+	float lod_gi_bias;
+
+	bool shadow_cache_enabled;
+	std::size_t shadow_spot_light_updates;
+
+	bool governor_enabled;
+	float governor_target_frame_time;
+	float governor_hysteresis;
+	std::size_t governor_cooldown_frames;
+	float governor_min_resolution_scale;
+	float governor_max_resolution_scale;
+	float governor_resolution_step;
+	float governor_min_quality;
+	float governor_quality_step;
 
 	bool ssao_enabled;
 	float ssao_scale;
@@ -97,6 +116,10 @@ struct RenderSettings : public Object
 	float rsm_min_interpolation_distance;
 	float rsm_min_interpolation_angle;
 	bool rsm_debug_interpolation;
+	bool rsm_interleaved_sampling;
+	std::size_t rsm_interleave_size;
+	float rsm_history_max_distance;
+	float rsm_history_min_angle;
 
 	std::size_t trsm_samples;
 	float trsm_indirect_diffuse_intensity;
@@ -107,6 +130,11 @@ struct RenderSettings : public Object
 	std::size_t lpv_iterations;
 	float lpv_injection_bias;
 	bool lpv_geometry_occlusion;
+	bool lpv_propagation_cache;
+	std::size_t lpv_propagation_budget;
+	bool lpv_cascades_enabled;
+	std::size_t lpv_cascades_count;
+	float lpv_cascade_cell_size;
 	float lpv_indirect_diffuse_intensity;
 	float lpv_indirect_specular_intensity;
 	float lpv_indirect_refractive_intensity;
@@ -121,8 +149,12 @@ struct RenderSettings : public Object
 
 	std::size_t vct_voxels_size;
 	bool vct_continuous_voxelization;
+	bool vct_incremental_voxelization;
 	bool vct_bordering;
 	std::size_t vct_mipmap_levels;
+	bool vct_clipmap_enabled;
+	std::size_t vct_clipmap_levels;
+	float vct_clipmap_voxel_size;
 	float vct_indirect_diffuse_intensity;
 	float vct_indirect_specular_intensity;
 	float vct_indirect_refractive_intensity;
@@ -22,7 +22,7 @@ public:
 	RenderSkyboxObject ();
 	~RenderSkyboxObject ();
 
-	void Draw ();
+	void Draw (std::size_t levelOfDetail = 0);
 
 	void SetCubeMap (const Resource<TextureView>& cubeMap);
 
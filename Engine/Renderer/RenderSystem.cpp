@@ -4,6 +4,7 @@
 
 #include "Renderer/Render/Mesh/AnimationModel.h"
 #include "Renderer/Render/Mesh/LightMapModel.h"
+#include "Renderer/Render/Mesh/CookedModel.h"
 
 #include "Renderer/Render/Texture/CubeMap.h"
 
@@ -13,11 +14,17 @@
 #include "Renderer/RenderViews/CubeMapView.h"
 #include "RenderViews/TextureLUTView.h"
 
+#include "Resources/Resources.h"
+
+#include "Systems/Settings/SettingsManager.h"
+
 #include "Core/Console/Console.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
 #include "Utils/Extensions/MathExtend.h"
+#include "Utils/Extensions/StringExtend.h"
+#include "Utils/Compression/BlockCompression.h"
 
 VertexData::VertexData ()
 {
@@ -69,6 +76,17 @@ Resource<ModelView> RenderSystem::LoadModel (const Resource<Model>& model)
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
 
+	/*
+	 * Cooked models only carry the normal map layout, the extra tangent
+	 * attribute is ignored by the shaders that don't use it
+	*/
+
+	const CookedModel* cookedModel = dynamic_cast<const CookedModel*> (&*model);
+
+	if (cookedModel != nullptr) {
+		return LoadCookedModel (model, cookedModel);
+	}
+
 	ModelView* modelView = new ModelView ();
 
 	/*
@@ -80,68 +98,115 @@ Resource<ModelView> RenderSystem::LoadModel (const Resource<Model>& model)
 	std::vector<VertexData> vertexBuffer;
 	std::vector<unsigned int> indexBuffer;
 
-	for_each_type (ObjectModel*, objModel, *model) {
-		for (PolygonGroup* polyGroup : *objModel) {
-			std::size_t startIndex = indexBuffer.size ();
+	/*
+	 * Levels of detail share the vertex buffer, each of them only has its
+	 * own range of indices
+	*/
 
-			for (Polygon* polygon : *polyGroup) {
-				for(std::size_t j=0;j<polygon->VertexCount();j++) {
+	std::map<ObjectModel*, std::vector<GroupBuffer>> levelsOfDetailGroups;
+	std::size_t polygonsCount = 0;
 
-					std::size_t index = 0;
+	for (std::size_t levelOfDetail = 0; levelOfDetail < model->LevelsOfDetailCount (); levelOfDetail ++) {
+		LevelOfDetailBuffer levelOfDetailBuffer;
+		levelOfDetailBuffer.geometricError = 0.0f;
 
-					std::size_t vertexPos = polygon->GetVertex (j);
-					std::size_t normalPos = polygon->GetNormal (j);
-					std::size_t texcoordPos = polygon->GetTexcoord (j);
+		for_each_type (ObjectModel*, objModel, *model) {
+			ObjectModel* lodObjModel = objModel->GetLevelOfDetail (levelOfDetail);
 
-					std::size_t hashPos = hash (vertexPos, hash (normalPos, texcoordPos));
+			levelOfDetailBuffer.geometricError = std::max (levelOfDetailBuffer.geometricError,
+				lodObjModel->GetGeometricError ());
 
-					auto indexIt = indices.find (hashPos);
+			/*
+			 * Objects with a shorter chain reuse their coarsest level
+			*/
 
-					if (indexIt == indices.end ()) {
-						VertexData vertexData;
+			auto groupsIt = levelsOfDetailGroups.find (lodObjModel);
 
-						glm::vec3 position = model->GetVertex (polygon->GetVertex(j));
-						vertexData.position[0] = position.x;
-						vertexData.position[1] = position.y;
-						vertexData.position[2] = position.z;
+			if (groupsIt != levelsOfDetailGroups.end ()) {
+				levelOfDetailBuffer.groupBuffers.insert (levelOfDetailBuffer.groupBuffers.end (),
+					groupsIt->second.begin (), groupsIt->second.end ());
 
-						if (polygon->HaveNormals ()) {
-							glm::vec3 normal = model->GetNormal (polygon->GetNormal(j));
-							vertexData.normal[0] = normal.x;
-							vertexData.normal[1] = normal.y;
-							vertexData.normal[2] = normal.z;
-						}
+				continue;
+			}
 
-						if (model->HaveUV()) {
-							glm::vec2 texcoord = model->GetTexcoord (polygon->GetTexcoord(j));
-							vertexData.texcoord[0] = texcoord.x;
-							vertexData.texcoord[1] = texcoord.y;
-						}
+			std::vector<GroupBuffer>& lodGroupBuffers = levelsOfDetailGroups [lodObjModel];
 
-						vertexBuffer.push_back (vertexData);
+			for (PolygonGroup* polyGroup : *lodObjModel) {
+				std::size_t startIndex = indexBuffer.size ();
 
-						index = vertexBuffer.size () - 1;
+				for (Polygon* polygon : *polyGroup) {
+					for(std::size_t j=0;j<polygon->VertexCount();j++) {
 
-						indices [hashPos] = index;
-					} else {
-						index = indexIt->second;
-					}
+						std::size_t index = 0;
 
-					indexBuffer.push_back (index);
+						std::size_t vertexPos = polygon->GetVertex (j);
+						std::size_t normalPos = polygon->GetNormal (j);
+						std::size_t texcoordPos = polygon->GetTexcoord (j);
+
+						std::size_t hashPos = hash (vertexPos, hash (normalPos, texcoordPos));
+
+						auto indexIt = indices.find (hashPos);
+
+						if (indexIt == indices.end ()) {
+							VertexData vertexData;
+
+							glm::vec3 position = model->GetVertex (polygon->GetVertex(j));
+							vertexData.position[0] = position.x;
+							vertexData.position[1] = position.y;
+							vertexData.position[2] = position.z;
+
+							if (polygon->HaveNormals ()) {
+								glm::vec3 normal = model->GetNormal (polygon->GetNormal(j));
+								vertexData.normal[0] = normal.x;
+								vertexData.normal[1] = normal.y;
+								vertexData.normal[2] = normal.z;
+							}
+
+							if (model->HaveUV()) {
+								glm::vec2 texcoord = model->GetTexcoord (polygon->GetTexcoord(j));
+								vertexData.texcoord[0] = texcoord.x;
+								vertexData.texcoord[1] = texcoord.y;
+							}
+
+							vertexBuffer.push_back (vertexData);
+
+							index = vertexBuffer.size () - 1;
+
+							indices [hashPos] = index;
+						} else {
+							index = indexIt->second;
+						}
+
+						indexBuffer.push_back (index);
+					}
 				}
+
+				GroupBuffer groupBuffer;
+
+				groupBuffer.materialView = LoadMaterial (polyGroup->GetMaterial ());
+				groupBuffer.offset = startIndex;
+				groupBuffer.INDEX_COUNT = indexBuffer.size () - startIndex;
+
+				lodGroupBuffers.push_back (groupBuffer);
+				levelOfDetailBuffer.groupBuffers.push_back (groupBuffer);
 			}
+		}
 
-			GroupBuffer groupBuffer;
+		if (levelOfDetail > 0) {
+			modelView->AddLevelOfDetail (levelOfDetailBuffer);
 
-			groupBuffer.materialView = LoadMaterial (polyGroup->GetMaterial ());
-			groupBuffer.offset = startIndex;
-			groupBuffer.INDEX_COUNT = indexBuffer.size () - startIndex;
+			continue;
+		}
 
+		for (const GroupBuffer& groupBuffer : levelOfDetailBuffer.groupBuffers) {
 			modelView->AddGroupBuffer (groupBuffer);
+
+			polygonsCount += groupBuffer.INDEX_COUNT / 3;
 		}
 	}
 
 	ObjectBuffer objectBuffer = BindModelVertexData (vertexBuffer, indexBuffer);
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
@@ -248,93 +313,205 @@ Resource<ModelView> RenderSystem::LoadNormalMapModel (const Resource<Model>& mod
 		return Resource<ModelView>::GetResource (model->GetName ());
 	}
 
+	/*
+	 * Cooked models already contain the final streams
+	*/
+
+	const CookedModel* cookedModel = dynamic_cast<const CookedModel*> (&*model);
+
+	if (cookedModel != nullptr) {
+		return LoadCookedModel (model, cookedModel);
+	}
+
 	ModelView* modelView = new ModelView ();
 
 	/*
 	 * Create buffer data
 	*/
 
-	std::map<std::size_t, std::size_t> indices;
-
 	std::vector<NormalMapVertexData> vertexBuffer;
 	std::vector<unsigned int> indexBuffer;
+	std::vector<CookedLevelOfDetail> levelsOfDetail;
 
-	for_each_type (ObjectModel*, objModel, *model) {
-		for (PolygonGroup* polyGroup : *objModel) {
-			std::size_t startIndex = indexBuffer.size ();
+	CookNormalMapModel (&*model, vertexBuffer, indexBuffer, levelsOfDetail);
 
-			for (Polygon* polygon : *polyGroup) {
-				for(std::size_t j=0;j<polygon->VertexCount();j++) {
+	std::size_t polygonsCount = ProcessLevelsOfDetail (modelView, levelsOfDetail);
 
-					std::size_t index = 0;
+	ObjectBuffer objectBuffer = BindNormalMapModelVertexData (vertexBuffer.data (), vertexBuffer.size (),
+		indexBuffer.data (), indexBuffer.size ());
+	objectBuffer.PolygonsCount = polygonsCount;
 
-					std::size_t vertexPos = polygon->GetVertex (j);
-					std::size_t normalPos = polygon->GetNormal (j);
-					std::size_t texcoordPos = polygon->GetTexcoord (j);
+	modelView->SetObjectBuffer (objectBuffer);
 
-					std::size_t hashPos = hash (vertexPos, hash (normalPos, texcoordPos));
+	return Resource<ModelView> (modelView, model->GetName ());
+}
 
-					auto indexIt = indices.find (hashPos);
+void RenderSystem::CookNormalMapModel (const Model* model, std::vector<NormalMapVertexData>& vertexBuffer,
+	std::vector<unsigned int>& indexBuffer, std::vector<CookedLevelOfDetail>& levelsOfDetail)
+{
+	std::map<std::size_t, std::size_t> indices;
 
-					if (indexIt == indices.end ()) {
-						NormalMapVertexData vertexData;
+	/*
+	 * Levels of detail share the vertex buffer, each of them only has its
+	 * own range of indices
+	*/
 
-						glm::vec3 position = model->GetVertex (polygon->GetVertex(j));
-						vertexData.position[0] = position.x;
-						vertexData.position[1] = position.y;
-						vertexData.position[2] = position.z;
+	std::map<ObjectModel*, std::vector<CookedGroup>> levelsOfDetailGroups;
 
-						if (polygon->HaveNormals ()) {
-							glm::vec3 normal = model->GetNormal (polygon->GetNormal(j));
-							vertexData.normal[0] = normal.x;
-							vertexData.normal[1] = normal.y;
-							vertexData.normal[2] = normal.z;
-						}
+	for (std::size_t levelOfDetail = 0; levelOfDetail < model->LevelsOfDetailCount (); levelOfDetail ++) {
+		CookedLevelOfDetail cookedLevelOfDetail;
+		cookedLevelOfDetail.geometricError = 0.0f;
 
-						if (model->HaveUV()) {
-							glm::vec2 texcoord = model->GetTexcoord (polygon->GetTexcoord(j));
-							vertexData.texcoord[0] = texcoord.x;
-							vertexData.texcoord[1] = texcoord.y;
-						}
+		for_each_type (ObjectModel*, objModel, *model) {
+			ObjectModel* lodObjModel = objModel->GetLevelOfDetail (levelOfDetail);
 
-						if (model->HaveUV ()) {
-							glm::vec3 tangent = CalculateTangent (model, polygon);
+			cookedLevelOfDetail.geometricError = std::max (cookedLevelOfDetail.geometricError,
+				lodObjModel->GetGeometricError ());
 
-							vertexData.tangent [0] = tangent.x;
-							vertexData.tangent [1] = tangent.y;
-							vertexData.tangent [2] = tangent.z;
-						}
+			/*
+			 * Objects with a shorter chain reuse their coarsest level
+			*/
 
-						vertexBuffer.push_back (vertexData);
+			auto groupsIt = levelsOfDetailGroups.find (lodObjModel);
 
-						index = vertexBuffer.size () - 1;
+			if (groupsIt != levelsOfDetailGroups.end ()) {
+				cookedLevelOfDetail.groups.insert (cookedLevelOfDetail.groups.end (),
+					groupsIt->second.begin (), groupsIt->second.end ());
 
-						indices [hashPos] = index;
-					} else {
-						index = indexIt->second;
-					}
+				continue;
+			}
 
-					indexBuffer.push_back (index);
+			std::vector<CookedGroup>& lodGroups = levelsOfDetailGroups [lodObjModel];
+
+			for (PolygonGroup* polyGroup : *lodObjModel) {
+				std::size_t startIndex = indexBuffer.size ();
+
+				for (Polygon* polygon : *polyGroup) {
+					for(std::size_t j=0;j<polygon->VertexCount();j++) {
+
+						std::size_t index = 0;
+
+						std::size_t vertexPos = polygon->GetVertex (j);
+						std::size_t normalPos = polygon->GetNormal (j);
+						std::size_t texcoordPos = polygon->GetTexcoord (j);
+
+						std::size_t hashPos = hash (vertexPos, hash (normalPos, texcoordPos));
+
+						auto indexIt = indices.find (hashPos);
+
+						if (indexIt == indices.end ()) {
+							NormalMapVertexData vertexData;
+
+							glm::vec3 position = model->GetVertex (polygon->GetVertex(j));
+							vertexData.position[0] = position.x;
+							vertexData.position[1] = position.y;
+							vertexData.position[2] = position.z;
+
+							if (polygon->HaveNormals ()) {
+								glm::vec3 normal = model->GetNormal (polygon->GetNormal(j));
+								vertexData.normal[0] = normal.x;
+								vertexData.normal[1] = normal.y;
+								vertexData.normal[2] = normal.z;
+							}
+
+							if (model->HaveUV()) {
+								glm::vec2 texcoord = model->GetTexcoord (polygon->GetTexcoord(j));
+								vertexData.texcoord[0] = texcoord.x;
+								vertexData.texcoord[1] = texcoord.y;
+							}
+
+							if (model->HaveUV ()) {
+								glm::vec3 tangent = CalculateTangent (model, polygon);
+
+								vertexData.tangent [0] = tangent.x;
+								vertexData.tangent [1] = tangent.y;
+								vertexData.tangent [2] = tangent.z;
+							}
+
+							vertexBuffer.push_back (vertexData);
+
+							index = vertexBuffer.size () - 1;
+
+							indices [hashPos] = index;
+						} else {
+							index = indexIt->second;
+						}
+
+						indexBuffer.push_back (index);
+					}
 				}
-			}
 
-			GroupBuffer groupBuffer;
+				CookedGroup group;
 
-			groupBuffer.materialView = LoadMaterial (polyGroup->GetMaterial ());
-			groupBuffer.offset = startIndex;
-			groupBuffer.INDEX_COUNT = indexBuffer.size () - startIndex;
+				group.material = polyGroup->GetMaterial ();
+				group.offset = startIndex;
+				group.INDEX_COUNT = indexBuffer.size () - startIndex;
 
-			modelView->AddGroupBuffer (groupBuffer);
+				lodGroups.push_back (group);
+				cookedLevelOfDetail.groups.push_back (group);
+			}
 		}
+
+		levelsOfDetail.push_back (cookedLevelOfDetail);
 	}
+}
+
+Resource<ModelView> RenderSystem::LoadCookedModel (const Resource<Model>& model, const CookedModel* cookedModel)
+{
+	ModelView* modelView = new ModelView ();
 
-	ObjectBuffer objectBuffer = BindNormalMapModelVertexData (vertexBuffer, indexBuffer);
+	std::size_t polygonsCount = ProcessLevelsOfDetail (modelView, cookedModel->GetCookedLevelsOfDetail ());
+
+	/*
+	 * Upload straight from the mapped file
+	*/
+
+	ObjectBuffer objectBuffer = BindNormalMapModelVertexData (
+		(const NormalMapVertexData*) cookedModel->GetVertexData (), cookedModel->GetVerticesCount (),
+		cookedModel->GetIndexData (), cookedModel->GetIndicesCount ());
+	objectBuffer.PolygonsCount = polygonsCount;
 
 	modelView->SetObjectBuffer (objectBuffer);
 
 	return Resource<ModelView> (modelView, model->GetName ());
 }
 
+std::size_t RenderSystem::ProcessLevelsOfDetail (ModelView* modelView, const std::vector<CookedLevelOfDetail>& levelsOfDetail)
+{
+	std::size_t polygonsCount = 0;
+
+	for (std::size_t levelOfDetail = 0; levelOfDetail < levelsOfDetail.size (); levelOfDetail ++) {
+		const CookedLevelOfDetail& cookedLevelOfDetail = levelsOfDetail [levelOfDetail];
+
+		LevelOfDetailBuffer levelOfDetailBuffer;
+		levelOfDetailBuffer.geometricError = cookedLevelOfDetail.geometricError;
+
+		for (const CookedGroup& group : cookedLevelOfDetail.groups) {
+			GroupBuffer groupBuffer;
+
+			groupBuffer.materialView = LoadMaterial (group.material);
+			groupBuffer.offset = group.offset;
+			groupBuffer.INDEX_COUNT = group.INDEX_COUNT;
+
+			levelOfDetailBuffer.groupBuffers.push_back (groupBuffer);
+		}
+
+		if (levelOfDetail > 0) {
+			modelView->AddLevelOfDetail (levelOfDetailBuffer);
+
+			continue;
+		}
+
+		for (const GroupBuffer& groupBuffer : levelOfDetailBuffer.groupBuffers) {
+			modelView->AddGroupBuffer (groupBuffer);
+
+			polygonsCount += groupBuffer.INDEX_COUNT / 3;
+		}
+	}
+
+	return polygonsCount;
+}
+
 Resource<ModelView> RenderSystem::LoadLightMapModel (const Resource<Model>& model)
 {
 	if (Resource<ModelView>::GetResource (model->GetName ()) != nullptr) {
@@ -392,7 +569,7 @@ Resource<ModelView> RenderSystem::LoadLightMapModel (const Resource<Model>& mode
 							vertexData.texcoord[1] = texcoord.y;
 						}
 
-						if (lmModel->HaveLightMapUV ()) {
+						if (lmModel != nullptr && lmModel->HaveLightMapUV ()) {
 							glm::vec2 lmTexcoord = lmModel->GetLightMapTexcoord (polygon->GetTexcoord (j));
 							vertexData.lmTexcoord [0] = lmTexcoord.x;
 							vertexData.lmTexcoord [1] = lmTexcoord.y;
@@ -414,6 +591,11 @@ Resource<ModelView> RenderSystem::LoadLightMapModel (const Resource<Model>& mode
 			GroupBuffer groupBuffer;
 
 			groupBuffer.materialView = LoadMaterial (polyGroup->GetMaterial ());
+
+			if (lmModel != nullptr && lmModel->GetLightMap () != nullptr) {
+				groupBuffer.materialView = LoadLightMapMaterial (polyGroup->GetMaterial (), lmModel->GetLightMap ());
+			}
+
 			groupBuffer.offset = startIndex;
 			groupBuffer.INDEX_COUNT = indexBuffer.size () - startIndex;
 
@@ -490,6 +672,47 @@ void RenderSystem::UpdateInstanceModelView (Resource<ModelView>& modelView, std:
 	objectBuffer.INSTANCES_COUNT = instancesCount;
 }
 
+/*
+ * Upload the model matrices of a batch of objects that share the same model
+ * view. The batch buffer is bound on attributes 8 to 11 of the model vertex
+ * array and it is grown only when the batch exceeds its current capacity.
+*/
+
+void RenderSystem::UpdateBatchModelView (Resource<ModelView>& modelView, const std::vector<glm::mat4>& modelMatrices)
+{
+	ObjectBuffer& objectBuffer = modelView->GetObjectBuffer ();
+
+	if (objectBuffer.VBO_BATCH_INDEX == 0) {
+		GL::GenBuffers(1, &objectBuffer.VBO_BATCH_INDEX);
+
+		GL::BindVertexArray(objectBuffer.VAO_INDEX);
+		GL::BindBuffer(GL_ARRAY_BUFFER, objectBuffer.VBO_BATCH_INDEX);
+
+		for (std::size_t column = 0; column < 4; column ++) {
+			GL::EnableVertexAttribArray (BATCH_MATRIX_ATTRIBUTE_INDEX + column);
+			GL::VertexAttribPointer (BATCH_MATRIX_ATTRIBUTE_INDEX + column, 4, GL_FLOAT, GL_FALSE, sizeof (glm::mat4), (void*) (sizeof (glm::vec4) * column));
+			GL::VertexAttribDivisor (BATCH_MATRIX_ATTRIBUTE_INDEX + column, 1);
+		}
+	}
+
+	GL::BindBuffer(GL_ARRAY_BUFFER, objectBuffer.VBO_BATCH_INDEX);
+
+	if (objectBuffer.BATCH_CAPACITY < modelMatrices.size ()) {
+		objectBuffer.BATCH_CAPACITY = modelMatrices.size ();
+
+		GL::BufferData(GL_ARRAY_BUFFER, sizeof (glm::mat4) * modelMatrices.size (), modelMatrices.data (), GL_STREAM_DRAW);
+
+		return;
+	}
+
+	/*
+	 * Orphan the previous storage to avoid waiting on draws still using it
+	*/
+
+	GL::BufferData(GL_ARRAY_BUFFER, sizeof (glm::mat4) * objectBuffer.BATCH_CAPACITY, nullptr, GL_STREAM_DRAW);
+	GL::BufferSubData(GL_ARRAY_BUFFER, 0, sizeof (glm::mat4) * modelMatrices.size (), modelMatrices.data ());
+}
+
 Resource<MaterialView> RenderSystem::LoadMaterial (const Resource<Material>& material)
 {
 	if (material == nullptr) {
@@ -507,6 +730,31 @@ Resource<MaterialView> RenderSystem::LoadMaterial (const Resource<Material>& mat
 	return Resource<MaterialView> (materialView, material->name);
 }
 
+Resource<MaterialView> RenderSystem::LoadLightMapMaterial (const Resource<Material>& material,
+	const Resource<Texture>& lightMap)
+{
+	/*
+	 * The same material may be baked in many light maps, each pair gets
+	 * its own view
+	*/
+
+	std::string name = (material != nullptr ? material->name : std::string ()) + "::" + lightMap.GetPath ();
+
+	if (Resource<MaterialView>::GetResource (name) != nullptr) {
+		return Resource<MaterialView>::GetResource (name);
+	}
+
+	MaterialView* materialView = new MaterialView ();
+
+	if (material != nullptr) {
+		ProcessMaterial (material, materialView);
+	}
+
+	materialView->lightMapTexture = LoadTexture (lightMap);
+
+	return Resource<MaterialView> (materialView, name);
+}
+
 Resource<TextureView> RenderSystem::LoadTexture (const Resource<Texture>& texture)
 {
 	if (texture.GetPath () != std::string () &&
@@ -523,6 +771,19 @@ Resource<TextureView> RenderSystem::LoadTexture (const Resource<Texture>& textur
 	textureView->SetGPUIndex (LoadTextureGPU (texture));
 	textureView->SetType ((int) texture->GetType ());
 
+	/*
+	 * The device keeps what was uploaded, plus the mipmaps generated
+	 * from the first level
+	*/
+
+	std::size_t memorySize = texture->GetResidencyMemory ().cpuMemory;
+
+	if (texture->GenerateMipmap () == true && texture->HasMipmap () == false) {
+		memorySize += memorySize / 3;
+	}
+
+	textureView->SetMemorySize (memorySize);
+
 	return Resource<TextureView> (textureView, texture.GetPath ());
 }
 
@@ -568,37 +829,25 @@ Resource<ShaderView> RenderSystem::LoadShader (const Resource<Shader>& shader)
 
 	const DrawingShader* drawingShader = dynamic_cast<const DrawingShader*> (&*shader);
 
-	GLuint program = GL::CreateProgram ();
-
 	/*
-	 * Compile and attach vertex shader
+	 * Vertex and fragment shaders are mandatory, geometry shader is optional
 	*/
 
-	GLuint vertexShaderID = BuildShaderContent (drawingShader->GetVertexShaderContent (), GL_VERTEX_SHADER);
+	std::vector<Resource<ShaderContent>> shaderContents;
+	std::vector<int> shaderTypes;
 
-	GL::AttachShader (program, vertexShaderID);
+	shaderContents.push_back (drawingShader->GetVertexShaderContent ());
+	shaderTypes.push_back (GL_VERTEX_SHADER);
 
-	/*
-	 * Compile and attach fragment shader
-	*/
-
-	GLuint fragmentShaderID = BuildShaderContent (drawingShader->GetFragmentShaderContent (), GL_FRAGMENT_SHADER);
-
-	GL::AttachShader (program, fragmentShaderID);
-
-	/*
-	 * Compile and attach geometry shader if exists
-	*/
+	shaderContents.push_back (drawingShader->GetFragmentShaderContent ());
+	shaderTypes.push_back (GL_FRAGMENT_SHADER);
 
 	if (drawingShader->GetGeometryShaderContent () != nullptr) {
-		unsigned int geometryShaderID = BuildShaderContent (drawingShader->GetGeometryShaderContent (), GL_GEOMETRY_SHADER);
-
-		GL::AttachShader (program, geometryShaderID);
+		shaderContents.push_back (drawingShader->GetGeometryShaderContent ());
+		shaderTypes.push_back (GL_GEOMETRY_SHADER);
 	}
 
-	GL::LinkProgram (program);
-
-	ShaderView* shaderView = new ShaderView (program);
+	ShaderView* shaderView = LoadProgram (shader->GetName (), shaderContents, shaderTypes);
 
 	return Resource<ShaderView> (shaderView, shader->GetName ());
 }
@@ -607,19 +856,10 @@ Resource<ShaderView> RenderSystem::LoadComputeShader (const Resource<Shader>& sh
 {
 	const ComputeShader* computeShader = dynamic_cast<const ComputeShader*> (&*shader);
 
-	unsigned int program = GL::CreateProgram();
+	std::vector<Resource<ShaderContent>> shaderContents (1, computeShader->GetComputeShaderContent ());
+	std::vector<int> shaderTypes (1, GL_COMPUTE_SHADER);
 
-	/*
-	 * Load, compile and attach vertex shader
-	*/
-
-	GLuint computeShaderID = BuildShaderContent (computeShader->GetComputeShaderContent (), GL_COMPUTE_SHADER);
-
-	GL::AttachShader (program, computeShaderID);
-
-	GL::LinkProgram(program);
-
-	ShaderView* shaderView = new ShaderView (program);
+	ShaderView* shaderView = LoadProgram (shader->GetName (), shaderContents, shaderTypes);
 
 	return Resource<ShaderView> (shaderView, shader->GetName ());
 }
@@ -689,7 +929,7 @@ Resource<FramebufferView> RenderSystem::LoadFramebuffer (const Resource<Framebuf
 	*/
 
 	if (status != GL_FRAMEBUFFER_COMPLETE) {
-		Console::LogError ("Framebuffer status error: " + status);
+		Console::LogError ("Framebuffer status error: {}", status);
 		return nullptr;
 	}
 
@@ -758,10 +998,14 @@ ObjectBuffer RenderSystem::BindModelVertexData (const std::vector<VertexData>& v
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.VBO_BATCH_INDEX = 0;
+	objectBuffer.BATCH_CAPACITY = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
 	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
+	objectBuffer.MemorySize = sizeof (VertexData) * vBuf.size () + sizeof (unsigned int) * iBuf.size ();
+
 	return objectBuffer;
 }
 
@@ -801,14 +1045,19 @@ ObjectBuffer RenderSystem::BindAnimationModelVertexData (const std::vector<Anima
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.VBO_BATCH_INDEX = 0;
+	objectBuffer.BATCH_CAPACITY = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
 	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
+	objectBuffer.MemorySize = sizeof (AnimatedVertexData) * vBuf.size () + sizeof (unsigned int) * iBuf.size ();
+
 	return objectBuffer;
 }
 
-ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<NormalMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf)
+ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const NormalMapVertexData* vBuf, std::size_t verticesCount,
+	const unsigned int* iBuf, std::size_t indicesCount)
 {
 	unsigned int VAO, VBO, IBO;
 
@@ -819,12 +1068,12 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
 	//creeaza vbo
 	GL::GenBuffers (1, &VBO);
 	GL::BindBuffer (GL_ARRAY_BUFFER, VBO);
-	GL::BufferData (GL_ARRAY_BUFFER, sizeof (NormalMapVertexData)*vBuf.size (), &vBuf [0], GL_STATIC_DRAW);
+	GL::BufferData (GL_ARRAY_BUFFER, sizeof (NormalMapVertexData)*verticesCount, vBuf, GL_STATIC_DRAW);
 
 	//creeaza ibo
 	GL::GenBuffers (1, &IBO);
 	GL::BindBuffer (GL_ELEMENT_ARRAY_BUFFER, IBO);
-	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned int)*iBuf.size (), &iBuf [0], GL_STATIC_DRAW);
+	GL::BufferData (GL_ELEMENT_ARRAY_BUFFER, sizeof (unsigned int)*indicesCount, iBuf, GL_STATIC_DRAW);
 
 	// metoda 1: seteaza atribute folosind pipe-urile interne ce fac legatura OpenGL - GLSL, in shader folosim layout(location = pipe_index)
 	// metoda cea mai buna, specificare explicita prin qualificator layout)
@@ -842,9 +1091,13 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.VBO_BATCH_INDEX = 0;
+	objectBuffer.BATCH_CAPACITY = 0;
 
-	objectBuffer.VerticesCount = vBuf.size ();
-	objectBuffer.PolygonsCount = iBuf.size () / 3;
+	objectBuffer.VerticesCount = verticesCount;
+	objectBuffer.PolygonsCount = indicesCount / 3;
+
+	objectBuffer.MemorySize = sizeof (NormalMapVertexData) * verticesCount + sizeof (unsigned int) * indicesCount;
 
 	return objectBuffer;
 }
@@ -855,7 +1108,7 @@ ObjectBuffer RenderSystem::BindNormalMapModelVertexData (const std::vector<Norma
  * Calculate vertex tangent based on explanation from the link above;
 */
 
-glm::vec3 RenderSystem::CalculateTangent (const Resource<Model>& model, Polygon* poly)
+glm::vec3 RenderSystem::CalculateTangent (const Model* model, Polygon* poly)
 {
 	/*
 	 * Tangents are generated only when texcoords are present
@@ -950,10 +1203,14 @@ ObjectBuffer RenderSystem::BindLightMapModelVertexData (const std::vector<LightM
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.VBO_BATCH_INDEX = 0;
+	objectBuffer.BATCH_CAPACITY = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
 	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
+	objectBuffer.MemorySize = sizeof (LightMapVertexData) * vBuf.size () + sizeof (unsigned int) * iBuf.size ();
+
 	return objectBuffer;
 }
 
@@ -1051,10 +1308,14 @@ ObjectBuffer RenderSystem::BindTextGUIVertexData (const std::vector<TextGUIVerte
 	objectBuffer.VBO_INDEX = VBO;
 	objectBuffer.IBO_INDEX = IBO;
 	objectBuffer.VBO_INSTANCE_INDEX = 0;
+	objectBuffer.VBO_BATCH_INDEX = 0;
+	objectBuffer.BATCH_CAPACITY = 0;
 
 	objectBuffer.VerticesCount = vBuf.size ();
 	objectBuffer.PolygonsCount = iBuf.size () / 3;
 
+	objectBuffer.MemorySize = sizeof (TextGUIVertexData) * vBuf.size () + sizeof (unsigned int) * iBuf.size ();
+
 	return objectBuffer;
 }
 
@@ -1217,7 +1478,21 @@ unsigned int RenderSystem::LoadTextureGPU (const Resource<Texture>& texture)
 	 * Send MipMaps to GPU
 	*/
 
-	if (texture->GetType () == TEXTURE_TYPE::TEXTURE_2D) {
+	if (texture->GetCompressionType () != COMPRESS_NONE && texture->GetType () == TEXTURE_TYPE::TEXTURE_2D) {
+		int compressedFormat = GetCompressedFormat (texture->GetCompressionType ());
+
+		for (std::size_t i=0;i<texture->GetMipMapLevels ();i++) {
+			std::size_t width = std::max<std::size_t> (1, size.width >> i);
+			std::size_t height = std::max<std::size_t> (1, size.height >> i);
+
+			GL::CompressedTexImage2D (GL_TEXTURE_2D, i, compressedFormat, width, height, 0,
+				BlockCompression::GetCompressedSize (width, height, texture->GetCompressionType ()),
+				texture->GetMipmapLevel (i));
+		}
+
+		GL::TexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture->GetMipMapLevels () - 1);
+	}
+	else if (texture->GetType () == TEXTURE_TYPE::TEXTURE_2D) {
 		for (std::size_t i=0;i<texture->GetMipMapLevels ();i++) {
 			GL::TexImage2D(GL_TEXTURE_2D, i, sizedInternalFormat, size.width >> i, size.height >> i, 0, internalFormat, channelType, texture->GetMipmapLevel (i));
 		}
@@ -1342,6 +1617,22 @@ unsigned int RenderSystem::LoadTextureGPU (const Resource<Texture>& texture)
 	return gpuIndex;
 }
 
+int RenderSystem::GetCompressedFormat (TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	switch (compressionType) {
+		case COMPRESS_BC1:
+			return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		case COMPRESS_BC3:
+			return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		case COMPRESS_BC5:
+			return GL_COMPRESSED_RG_RGTC2;
+		case COMPRESS_BC7:
+			return GL_COMPRESSED_RGBA_BPTC_UNORM;
+		default:
+			return GL_RGBA8;
+	}
+}
+
 unsigned int RenderSystem::LoadCubeMapGPU (const Resource<Texture>& texture)
 {
 	const CubeMap* cubemap = dynamic_cast<const CubeMap*> (&*texture);
@@ -1408,19 +1699,200 @@ unsigned int RenderSystem::LoadTextureLUTGPU (const Resource<Texture>& texture)
  * Compile shader based on type (vertex, geometry, fragment, compute)
 */
 
+ShaderView* RenderSystem::LoadProgram (const std::string& name, const std::vector<Resource<ShaderContent>>& shaderContents,
+	const std::vector<int>& shaderTypes)
+{
+	bool shaderCache = SettingsManager::Instance ()->GetValue<bool> ("Resources", "shader_cache", false);
+
+	/*
+	 * The shader contents already have their includes expanded, so the
+	 * key changes with any of the files a program is built from
+	*/
+
+	ShaderBinaryHeader header;
+	header.driverHash = GetDriverHash ();
+	header.sourceHash = Extensions::StringExtend::Hash (std::string ());
+
+	for (std::size_t i=0;i<shaderContents.size ();i++) {
+		header.sourceHash = Extensions::StringExtend::Hash (std::to_string (shaderTypes [i]), header.sourceHash);
+		header.sourceHash = Extensions::StringExtend::Hash (shaderContents [i]->GetContent (), header.sourceHash);
+	}
+
+	if (shaderCache == true) {
+		GLuint program = LoadProgramBinary (name, header);
+
+		if (program != 0) {
+			return new ShaderView (program);
+		}
+	}
+
+	GLuint program = GL::CreateProgram ();
+
+	if (shaderCache == true) {
+		GL::ProgramParameteri (program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	/*
+	 * Submit compile and link without querying their status, so that the
+	 * driver may work on several programs at once
+	*/
+
+	std::vector<GLuint> shaderIDs;
+
+	for (std::size_t i=0;i<shaderContents.size ();i++) {
+		GLuint shaderID = BuildShaderContent (shaderContents [i], shaderTypes [i]);
+
+		GL::AttachShader (program, shaderID);
+
+		shaderIDs.push_back (shaderID);
+	}
+
+	GL::LinkProgram (program);
+
+	ShaderView* shaderView = new ShaderView (program);
+
+	shaderView->SetPending ([name, shaderIDs, header, shaderCache] (unsigned int program) {
+		return FinishProgram (name, program, shaderIDs, header, shaderCache);
+	});
+
+	return shaderView;
+}
+
+bool RenderSystem::FinishProgram (const std::string& name, unsigned int program,
+	const std::vector<unsigned int>& shaderIDs, const ShaderBinaryHeader& header, bool shaderCache)
+{
+	bool isCompiled = true;
+
+	for (GLuint shaderID : shaderIDs) {
+		isCompiled &= ShaderErrorCheck (shaderID);
+	}
+
+	/*
+	 * The linked program doesn't need the shader objects any more
+	*/
+
+	for (GLuint shaderID : shaderIDs) {
+		GL::DetachShader (program, shaderID);
+		GL::DeleteShader (shaderID);
+	}
+
+	/*
+	 * A binary left from an earlier build of the same sources must not
+	 * be loaded in place of a compile that reports the error again
+	*/
+
+	if (isCompiled == false || ProgramErrorCheck (program) == false) {
+		Console::LogError ("Program \"" + name + "\" could not be built!");
+
+		if (shaderCache == true) {
+			Resources::RemoveShaderBinary (header);
+		}
+
+		return false;
+	}
+
+	if (shaderCache == true) {
+		SaveProgramBinary (program, header);
+	}
+
+	return true;
+}
+
+unsigned int RenderSystem::LoadProgramBinary (const std::string& name, const ShaderBinaryHeader& header)
+{
+	ShaderBinary* shaderBinary = Resources::LoadShaderBinary (header);
+
+	if (shaderBinary == nullptr) {
+		return 0;
+	}
+
+	GLuint program = GL::CreateProgram ();
+
+	GL::ProgramBinary (program, shaderBinary->GetFormat (), shaderBinary->GetData (), shaderBinary->GetSize ());
+
+	delete shaderBinary;
+
+	/*
+	 * The driver may still reject the binary, after an update that kept
+	 * the same version string for example
+	*/
+
+	GLint linkStatus = GL_FALSE;
+	GL::GetProgramiv (program, GL_LINK_STATUS, &linkStatus);
+
+	if (linkStatus == GL_FALSE) {
+		Console::LogWarning ("Program binary of \"" + name + "\" was rejected by the driver. It will be compiled again.");
+
+		GL::DeleteProgram (program);
+
+		Resources::RemoveShaderBinary (header);
+
+		return 0;
+	}
+
+	Console::Log ("Program \"{}\" loaded from binary cache", name);
+
+	return program;
+}
+
+void RenderSystem::SaveProgramBinary (unsigned int program, const ShaderBinaryHeader& header)
+{
+	GLint binaryLength = 0;
+	GL::GetProgramiv (program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+
+	if (binaryLength <= 0) {
+		return;
+	}
+
+	std::vector<unsigned char> binary (binaryLength);
+	GLenum binaryFormat = 0;
+
+	GL::GetProgramBinary (program, binaryLength, &binaryLength, &binaryFormat, binary.data ());
+
+	ShaderBinary* shaderBinary = new ShaderBinary ();
+
+	shaderBinary->SetFormat (binaryFormat);
+	shaderBinary->SetData (binary.data (), binaryLength);
+
+	Resources::SaveShaderBinary (shaderBinary, header);
+
+	delete shaderBinary;
+}
+
+std::uint64_t RenderSystem::GetDriverHash ()
+{
+	static std::uint64_t driverHash = 0;
+
+	if (driverHash != 0) {
+		return driverHash;
+	}
+
+	driverHash = Extensions::StringExtend::Hash (std::string ());
+
+	GLenum names [] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+
+	for (GLenum name : names) {
+		const GLubyte* value = GL::GetString (name);
+
+		if (value != nullptr) {
+			driverHash = Extensions::StringExtend::Hash ((const char*) value, driverHash);
+		}
+	}
+
+	return driverHash;
+}
+
 unsigned int RenderSystem::BuildShaderContent (const Resource<ShaderContent>& shaderContent, int shaderType)
 {
 	unsigned int shaderID = GL::CreateShader ((GLenum)shaderType);
 
 	const char* csource = shaderContent->GetContent ().c_str ();
 
-	Console::Log ("Compiling \"" + shaderContent->GetFilename () + "\" !");
+	Console::Log ("Compiling \"{}\" !", shaderContent->GetFilename ());
 
 	GL::ShaderSource (shaderID, 1, &csource, NULL);
 	GL::CompileShader (shaderID);
 
-	ShaderErrorCheck (shaderID);
-
 	return shaderID;
 }
 
@@ -1440,7 +1912,26 @@ bool RenderSystem::ShaderErrorCheck (unsigned int shader)
 		std::string error(errorLog.begin(), errorLog.end());
 		Console::LogError (error);
 
-		GL::DeleteShader(shader); // Don't leak the shader.
+		return false;
+	}
+
+	return true;
+}
+
+bool RenderSystem::ProgramErrorCheck (unsigned int program)
+{
+	int isLinked;
+	GL::GetProgramiv (program, GL_LINK_STATUS, &isLinked);
+
+	if (isLinked == GL_FALSE) {
+		int maxLength = 0;
+		GL::GetProgramiv (program, GL_INFO_LOG_LENGTH, &maxLength);
+
+		std::vector<GLchar> errorLog (std::max (maxLength, 1));
+		GL::GetProgramInfoLog (program, maxLength, &maxLength, &errorLog [0]);
+
+		std::string error (errorLog.begin (), errorLog.end ());
+		Console::LogError (error);
 
 		return false;
 	}
@@ -5,10 +5,12 @@
 
 #include "Core/Resources/Resource.h"
 #include "Render/Mesh/Model.h"
+#include "Render/Mesh/CookedModel.h"
 #include "Render/Material/Material.h"
 #include "Render/Texture/Texture.h"
 #include "Render/Shader/Shader.h"
 #include "Render/Shader/ShaderContent.h"
+#include "Render/Shader/ShaderBinary.h"
 #include "Render/Framebuffer/Framebuffer.h"
 
 #include "RenderViews/ModelView.h"
@@ -21,6 +23,8 @@
 
 #include "Renderer/BufferAttribute.h"
 
+#define BATCH_MATRIX_ATTRIBUTE_INDEX 8
+
 struct VertexData
 {
 	float position[3];
@@ -69,10 +73,17 @@ public:
 	static Resource<ModelView> LoadLightMapModel (const Resource<Model>& model);
 	static Resource<ModelView> LoadTextGUI (const std::string& text, const Resource<Font>& font);
 
+	static void CookNormalMapModel (const Model* model, std::vector<NormalMapVertexData>& vBuf,
+		std::vector<unsigned int>& iBuf, std::vector<CookedLevelOfDetail>& levelsOfDetail);
+
 	static void CreateInstanceModelView (Resource<ModelView>& modelView, const std::vector<BufferAttribute>& attributes, std::size_t size, unsigned char* buffer = nullptr);
 	static void UpdateInstanceModelView (Resource<ModelView>& modelView, std::size_t size, std::size_t instancesCount, unsigned char* buffer);
 
+	static void UpdateBatchModelView (Resource<ModelView>& modelView, const std::vector<glm::mat4>& modelMatrices);
+
 	static Resource<MaterialView> LoadMaterial (const Resource<Material>& material);
+	static Resource<MaterialView> LoadLightMapMaterial (const Resource<Material>& material,
+		const Resource<Texture>& lightMap);
 
 	static Resource<TextureView> LoadTexture (const Resource<Texture>& texture);
 	static Resource<TextureView> LoadCubeMap (const Resource<Texture>& texture);
@@ -85,12 +96,16 @@ public:
 
 	static Resource<Texture> SaveTexture (const Resource<TextureView>& textureView);
 private:
+	static Resource<ModelView> LoadCookedModel (const Resource<Model>& model, const CookedModel* cookedModel);
+	static std::size_t ProcessLevelsOfDetail (ModelView* modelView, const std::vector<CookedLevelOfDetail>& levelsOfDetail);
+
 	static ObjectBuffer BindModelVertexData (const std::vector<VertexData>& vBuf, const std::vector<unsigned int>& iBuf);
 	static ObjectBuffer BindAnimationModelVertexData (const std::vector<AnimatedVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
-	static ObjectBuffer BindNormalMapModelVertexData (const std::vector<NormalMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
+	static ObjectBuffer BindNormalMapModelVertexData (const NormalMapVertexData* vBuf, std::size_t verticesCount,
+		const unsigned int* iBuf, std::size_t indicesCount);
 	static ObjectBuffer BindLightMapModelVertexData (const std::vector<LightMapVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
 
-	static glm::vec3 CalculateTangent (const Resource<Model>& model, Polygon* poly);
+	static glm::vec3 CalculateTangent (const Model* model, Polygon* poly);
 
 	static ObjectBuffer ProcessTextGUI (const std::string& text, const Resource<Font>& font);
 	static ObjectBuffer BindTextGUIVertexData (const std::vector<TextGUIVertexData>& vBuf, const std::vector<unsigned int>& iBuf);
@@ -100,9 +115,19 @@ private:
 	static unsigned int LoadTextureGPU (const Resource<Texture>& texture);
 	static unsigned int LoadCubeMapGPU (const Resource<Texture>& texture);
 	static unsigned int LoadTextureLUTGPU (const Resource<Texture>& texture);
+	static int GetCompressedFormat (TEXTURE_COMPRESSION_TYPE compressionType);
+
+	static ShaderView* LoadProgram (const std::string& name, const std::vector<Resource<ShaderContent>>& shaderContents,
+		const std::vector<int>& shaderTypes);
+	static bool FinishProgram (const std::string& name, unsigned int program,
+		const std::vector<unsigned int>& shaderIDs, const ShaderBinaryHeader& header, bool shaderCache);
+	static unsigned int LoadProgramBinary (const std::string& name, const ShaderBinaryHeader& header);
+	static void SaveProgramBinary (unsigned int program, const ShaderBinaryHeader& header);
+	static std::uint64_t GetDriverHash ();
 
 	static unsigned int BuildShaderContent (const Resource<ShaderContent>& shaderContent, int shaderType);
 	static bool ShaderErrorCheck (unsigned int shader);
+	static bool ProgramErrorCheck (unsigned int program);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "RenderTargetAllocator.h"
+
+#include <algorithm>
+
+RenderTargetAllocator::RenderTargetAllocator (std::size_t maxIdleFrames) :
+	_nextSlot (0),
+	_frame (0),
+	_maxIdleFrames (maxIdleFrames),
+	_allocatedMemory (0),
+	_peakMemory (0),
+	_requestedMemory (0),
+	_allocationsCount (0),
+	_evictionsCount (0)
+{
+
+}
+
+std::size_t RenderTargetAllocator::Acquire (const RenderTargetDescriptor& descriptor, bool& isNew)
+{
+	std::size_t memorySize = descriptor.GetMemorySize ();
+
+	/*
+	 * Every request is counted as if it would own its target
+	*/
+
+	_requestedMemory += memorySize;
+
+	/*
+	 * Slots are visited in creation order, so the same sequence of
+	 * requests gets the same targets every frame
+	*/
+
+	for (auto& it : _slots) {
+		Slot& slot = it.second;
+
+		if (slot.isBusy == false && slot.descriptor == descriptor) {
+			slot.isBusy = true;
+			slot.lastFrame = _frame;
+
+			isNew = false;
+
+			return it.first;
+		}
+	}
+
+	Slot slot;
+
+	slot.descriptor = descriptor;
+	slot.isBusy = true;
+	slot.lastFrame = _frame;
+
+	_slots [_nextSlot] = slot;
+
+	_allocatedMemory += memorySize;
+	_peakMemory = std::max (_peakMemory, _allocatedMemory);
+
+	++ _allocationsCount;
+
+	isNew = true;
+
+	return _nextSlot ++;
+}
+
+void RenderTargetAllocator::Release (std::size_t slot)
+{
+	auto it = _slots.find (slot);
+
+	if (it == _slots.end ()) {
+		return;
+	}
+
+	it->second.isBusy = false;
+}
+
+std::vector<std::size_t> RenderTargetAllocator::NewFrame ()
+{
+	std::vector<std::size_t> evictedSlots;
+
+	++ _frame;
+
+	_requestedMemory = 0;
+	_allocationsCount = 0;
+	_evictionsCount = 0;
+
+	/*
+	 * Nothing outlives the frame it was acquired in
+	*/
+
+	for (auto it = _slots.begin (); it != _slots.end ();) {
+		Slot& slot = it->second;
+
+		slot.isBusy = false;
+
+		if (_frame - slot.lastFrame > _maxIdleFrames) {
+			_allocatedMemory -= slot.descriptor.GetMemorySize ();
+
+			evictedSlots.push_back (it->first);
+
+			++ _evictionsCount;
+
+			it = _slots.erase (it);
+			continue;
+		}
+
+		++ it;
+	}
+
+	return evictedSlots;
+}
+
+std::vector<std::size_t> RenderTargetAllocator::Clear ()
+{
+	std::vector<std::size_t> evictedSlots;
+
+	for (auto& it : _slots) {
+		evictedSlots.push_back (it.first);
+	}
+
+	_slots.clear ();
+
+	_allocatedMemory = 0;
+
+	return evictedSlots;
+}
+
+std::size_t RenderTargetAllocator::GetSlotsCount () const
+{
+	return _slots.size ();
+}
+
+std::size_t RenderTargetAllocator::GetAllocatedMemory () const
+{
+	return _allocatedMemory;
+}
+
+std::size_t RenderTargetAllocator::GetPeakMemory () const
+{
+	return _peakMemory;
+}
+
+std::size_t RenderTargetAllocator::GetRequestedMemory () const
+{
+	return _requestedMemory;
+}
+
+std::size_t RenderTargetAllocator::GetAllocationsCount () const
+{
+	return _allocationsCount;
+}
+
+std::size_t RenderTargetAllocator::GetEvictionsCount () const
+{
+	return _evictionsCount;
+}
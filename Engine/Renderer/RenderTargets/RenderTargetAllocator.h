@@ -0,0 +1,56 @@
+#ifndef RENDERTARGETALLOCATOR_H
+#define RENDERTARGETALLOCATOR_H
+
+#include <map>
+#include <vector>
+
+#include "RenderTargetDescriptor.h"
+
+/*
+ * Decides which physical render target serves every request. It knows
+ * nothing about the GPU, the pool creates and deletes the objects for
+ * the slots it reports. A slot is reused by any request with the same
+ * descriptor once its previous owner released it, slots that stay free
+ * for too many frames are evicted.
+*/
+
+class ENGINE_API RenderTargetAllocator
+{
+protected:
+	struct Slot
+	{
+		RenderTargetDescriptor descriptor;
+		bool isBusy;
+		std::size_t lastFrame;
+	};
+
+protected:
+	std::map<std::size_t, Slot> _slots;
+	std::size_t _nextSlot;
+	std::size_t _frame;
+	std::size_t _maxIdleFrames;
+
+	std::size_t _allocatedMemory;
+	std::size_t _peakMemory;
+	std::size_t _requestedMemory;
+	std::size_t _allocationsCount;
+	std::size_t _evictionsCount;
+
+public:
+	RenderTargetAllocator (std::size_t maxIdleFrames);
+
+	std::size_t Acquire (const RenderTargetDescriptor& descriptor, bool& isNew);
+	void Release (std::size_t slot);
+
+	std::vector<std::size_t> NewFrame ();
+	std::vector<std::size_t> Clear ();
+
+	std::size_t GetSlotsCount () const;
+	std::size_t GetAllocatedMemory () const;
+	std::size_t GetPeakMemory () const;
+	std::size_t GetRequestedMemory () const;
+	std::size_t GetAllocationsCount () const;
+	std::size_t GetEvictionsCount () const;
+};
+
+#endif
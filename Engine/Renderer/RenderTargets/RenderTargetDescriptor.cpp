@@ -0,0 +1,76 @@
+#include "RenderTargetDescriptor.h"
+
+bool RenderTargetAttachment::operator== (const RenderTargetAttachment& other) const
+{
+	return sizedInternalFormat == other.sizedInternalFormat &&
+		internalFormat == other.internalFormat &&
+		channelType == other.channelType &&
+		wrapMode == other.wrapMode &&
+		minFilter == other.minFilter &&
+		magFilter == other.magFilter &&
+		mipmaps == other.mipmaps;
+}
+
+RenderTargetDescriptor::RenderTargetDescriptor () :
+	width (0),
+	height (0)
+{
+
+}
+
+bool RenderTargetDescriptor::operator== (const RenderTargetDescriptor& other) const
+{
+	return width == other.width && height == other.height &&
+		attachments == other.attachments &&
+		depthAttachments == other.depthAttachments;
+}
+
+std::size_t RenderTargetDescriptor::GetMemorySize () const
+{
+	std::size_t memorySize = 0;
+
+	std::vector<RenderTargetAttachment> allAttachments (attachments);
+	allAttachments.insert (allAttachments.end (), depthAttachments.begin (), depthAttachments.end ());
+
+	for (const RenderTargetAttachment& attachment : allAttachments) {
+		std::size_t attachmentSize = width * height * GetPixelSize (attachment.sizedInternalFormat);
+
+		/*
+		 * A full mipmap chain adds a third of the base level
+		*/
+
+		if (attachment.mipmaps == true) {
+			attachmentSize += attachmentSize / 3;
+		}
+
+		memorySize += attachmentSize;
+	}
+
+	return memorySize;
+}
+
+std::size_t RenderTargetDescriptor::GetPixelSize (TEXTURE_SIZED_INTERNAL_FORMAT sizedInternalFormat) const
+{
+	/*
+	 * Three channel formats are padded by most drivers
+	*/
+
+	switch (sizedInternalFormat) {
+		case FORMAT_R8: return 1;
+		case FORMAT_R16: return 2;
+		case FORMAT_RG8: return 2;
+		case FORMAT_RG16F: return 4;
+		case FORMAT_RG32F: return 8;
+		case FORMAT_RGB8: return 4;
+		case FORMAT_RGB16: return 8;
+		case FORMAT_RGB32: return 16;
+		case FORMAT_RGBA8: return 4;
+		case FORMAT_RGBA16: return 8;
+		case FORMAT_RGBA32: return 16;
+		case FORMAT_DEPTH16: return 2;
+		case FORMAT_DEPTH32: return 4;
+		case FORMAT_DEPTH24_STENCIL8: return 4;
+	}
+
+	return 4;
+}
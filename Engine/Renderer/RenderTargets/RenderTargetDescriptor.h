@@ -0,0 +1,43 @@
+#ifndef RENDERTARGETDESCRIPTOR_H
+#define RENDERTARGETDESCRIPTOR_H
+
+#include <vector>
+#include <cstddef>
+
+#include "Renderer/Render/Texture/TextureMode.h"
+
+struct ENGINE_API RenderTargetAttachment
+{
+	TEXTURE_SIZED_INTERNAL_FORMAT sizedInternalFormat;
+	TEXTURE_INTERNAL_FORMAT internalFormat;
+	TEXTURE_CHANNEL_TYPE channelType;
+	TEXTURE_WRAP_MODE wrapMode;
+	TEXTURE_FILTER_MODE minFilter;
+	TEXTURE_FILTER_MODE magFilter;
+	bool mipmaps;
+
+	bool operator== (const RenderTargetAttachment& other) const;
+};
+
+/*
+ * Everything that makes two render targets interchangeable. Texture
+ * names are left out, they only matter for the shader attributes.
+*/
+
+struct ENGINE_API RenderTargetDescriptor
+{
+	std::size_t width;
+	std::size_t height;
+	std::vector<RenderTargetAttachment> attachments;
+	std::vector<RenderTargetAttachment> depthAttachments;
+
+	RenderTargetDescriptor ();
+
+	bool operator== (const RenderTargetDescriptor& other) const;
+
+	std::size_t GetMemorySize () const;
+protected:
+	std::size_t GetPixelSize (TEXTURE_SIZED_INTERNAL_FORMAT sizedInternalFormat) const;
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include "RenderTargetPool.h"
+
+#include <algorithm>
+
+#include "Renderer/RenderSystem.h"
+
+#include "Debug/Statistics/StatisticsManager.h"
+#include "RenderTargetStatisticsObject.h"
+
+RenderTargetPool::RenderTargetPool () :
+	_allocator (RENDER_TARGET_POOL_MAX_IDLE_FRAMES),
+	_frame (0)
+{
+
+}
+
+RenderTargetPool::~RenderTargetPool ()
+{
+
+}
+
+SPECIALIZE_SINGLETON(RenderTargetPool)
+
+void RenderTargetPool::NewFrame ()
+{
+	/*
+	 * Keep the statistics of the frame that just ended
+	*/
+
+	UpdateStatistics ();
+
+	++ _frame;
+
+	_leases.clear ();
+
+	Evict (_allocator.NewFrame ());
+
+	/*
+	 * Drop the aliases of passes that changed their framebuffer
+	*/
+
+	for (auto it = _aliases.begin (); it != _aliases.end ();) {
+		if (_frame - it->lastFrame > RENDER_TARGET_POOL_MAX_IDLE_FRAMES) {
+			delete it->volume;
+
+			it = _aliases.erase (it);
+			continue;
+		}
+
+		++ it;
+	}
+}
+
+FramebufferRenderVolume* RenderTargetPool::Acquire (const Resource<Framebuffer>& framebuffer, const RenderVolumeCollection* rvc)
+{
+	/*
+	 * Targets that nobody could read anymore are free for this request
+	*/
+
+	ReleaseUnreachable (rvc);
+
+	bool isNew = false;
+
+	std::size_t slot = _allocator.Acquire (GetDescriptor (framebuffer), isNew);
+
+	if (isNew == true) {
+		_framebufferViews [slot] = RenderSystem::LoadFramebuffer (framebuffer);
+	}
+
+	FramebufferRenderVolume* volume = GetAlias (slot, framebuffer);
+
+	Lease lease;
+
+	lease.slot = slot;
+	lease.volume = volume;
+
+	_leases.push_back (lease);
+
+	return volume;
+}
+
+void RenderTargetPool::Clear ()
+{
+	_leases.clear ();
+
+	Evict (_allocator.Clear ());
+}
+
+void RenderTargetPool::ReleaseUnreachable (const RenderVolumeCollection* rvc)
+{
+	for (auto it = _leases.begin (); it != _leases.end ();) {
+		if (rvc->Contains (it->volume) == false) {
+			_allocator.Release (it->slot);
+
+			it = _leases.erase (it);
+			continue;
+		}
+
+		++ it;
+	}
+}
+
+void RenderTargetPool::Evict (const std::vector<std::size_t>& slots)
+{
+	for (std::size_t slot : slots) {
+		_framebufferViews.erase (slot);
+
+		for (auto it = _aliases.begin (); it != _aliases.end ();) {
+			if (it->slot == slot) {
+				delete it->volume;
+
+				it = _aliases.erase (it);
+				continue;
+			}
+
+			++ it;
+		}
+	}
+}
+
+FramebufferRenderVolume* RenderTargetPool::GetAlias (std::size_t slot, const Resource<Framebuffer>& framebuffer)
+{
+	/*
+	 * Every pass sees the target through its own volume, so the
+	 * attributes keep the texture names its consumers expect
+	*/
+
+	for (Alias& alias : _aliases) {
+		if (alias.slot == slot && alias.framebuffer == framebuffer) {
+			alias.lastFrame = _frame;
+
+			return alias.volume;
+		}
+	}
+
+	Alias alias;
+
+	alias.slot = slot;
+	alias.framebuffer = framebuffer;
+	alias.volume = new FramebufferRenderVolume (framebuffer, _framebufferViews [slot]);
+	alias.lastFrame = _frame;
+
+	_aliases.push_back (alias);
+
+	return alias.volume;
+}
+
+void RenderTargetPool::UpdateStatistics ()
+{
+	auto renderTargetStatisticsObject = StatisticsManager::Instance ()->GetStatisticsObject <RenderTargetStatisticsObject> ();
+
+	renderTargetStatisticsObject->TargetsCount = _allocator.GetSlotsCount ();
+	renderTargetStatisticsObject->AllocatedMemory = _allocator.GetAllocatedMemory ();
+	renderTargetStatisticsObject->PeakMemory = _allocator.GetPeakMemory ();
+	renderTargetStatisticsObject->RequestedMemory = _allocator.GetRequestedMemory ();
+	renderTargetStatisticsObject->AllocationsCount = _allocator.GetAllocationsCount ();
+	renderTargetStatisticsObject->EvictionsCount = _allocator.GetEvictionsCount ();
+}
+
+RenderTargetDescriptor RenderTargetPool::GetDescriptor (const Resource<Framebuffer>& framebuffer)
+{
+	RenderTargetDescriptor descriptor;
+
+	Size size = framebuffer->GetTexture (0)->GetSize ();
+
+	descriptor.width = size.width;
+	descriptor.height = size.height;
+
+	for_each_type (Resource<Texture>, texture, *framebuffer) {
+		descriptor.attachments.push_back (GetAttachment (texture));
+	}
+
+	if (framebuffer->GetDepthTexture () != nullptr) {
+		descriptor.depthAttachments.push_back (GetAttachment (framebuffer->GetDepthTexture ()));
+	}
+
+	return descriptor;
+}
+
+RenderTargetAttachment RenderTargetPool::GetAttachment (const Resource<Texture>& texture)
+{
+	RenderTargetAttachment attachment;
+
+	attachment.sizedInternalFormat = texture->GetSizedInternalFormat ();
+	attachment.internalFormat = texture->GetInternalFormat ();
+	attachment.channelType = texture->GetChannelType ();
+	attachment.wrapMode = texture->GetWrapMode ();
+	attachment.minFilter = texture->GetMinFilter ();
+	attachment.magFilter = texture->GetMagFilter ();
+	attachment.mipmaps = texture->GenerateMipmap ();
+
+	return attachment;
+}
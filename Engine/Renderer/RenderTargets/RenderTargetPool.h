@@ -0,0 +1,82 @@
+#ifndef RENDERTARGETPOOL_H
+#define RENDERTARGETPOOL_H
+
+#include "Core/Singleton/Singleton.h"
+
+#include <map>
+#include <vector>
+
+#include "RenderTargetAllocator.h"
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Framebuffer/Framebuffer.h"
+#include "Renderer/RenderViews/FramebufferView.h"
+#include "Renderer/RenderVolumeCollection.h"
+#include "RenderPasses/FramebufferRenderVolume.h"
+
+/*
+ * Frames a free target is kept for before it is deleted, so a short
+ * resize or a disabled pass does not reallocate everything
+*/
+
+#define RENDER_TARGET_POOL_MAX_IDLE_FRAMES 16
+
+/*
+ * Shares framebuffers between render passes whose outputs are only
+ * read through the render volume collection. A target is leased until
+ * its volume could not be reached from the collection anymore, then a
+ * later pass that needs the same formats and size could draw over it.
+*/
+
+class ENGINE_API RenderTargetPool : public Singleton<RenderTargetPool>
+{
+	friend Singleton<RenderTargetPool>;
+
+	DECLARE_SINGLETON(RenderTargetPool)
+
+protected:
+	struct Lease
+	{
+		std::size_t slot;
+		FramebufferRenderVolume* volume;
+	};
+
+	struct Alias
+	{
+		std::size_t slot;
+		Resource<Framebuffer> framebuffer;
+		FramebufferRenderVolume* volume;
+		std::size_t lastFrame;
+	};
+
+protected:
+	RenderTargetAllocator _allocator;
+	std::map<std::size_t, Resource<FramebufferView>> _framebufferViews;
+	std::vector<Lease> _leases;
+	std::vector<Alias> _aliases;
+	std::size_t _frame;
+
+public:
+	void NewFrame ();
+
+	FramebufferRenderVolume* Acquire (const Resource<Framebuffer>& framebuffer, const RenderVolumeCollection* rvc);
+
+	void Clear ();
+protected:
+	void ReleaseUnreachable (const RenderVolumeCollection* rvc);
+	void Evict (const std::vector<std::size_t>& slots);
+
+	FramebufferRenderVolume* GetAlias (std::size_t slot, const Resource<Framebuffer>& framebuffer);
+
+	void UpdateStatistics ();
+
+	static RenderTargetDescriptor GetDescriptor (const Resource<Framebuffer>& framebuffer);
+	static RenderTargetAttachment GetAttachment (const Resource<Texture>& texture);
+private:
+	RenderTargetPool ();
+	~RenderTargetPool ();
+	RenderTargetPool (const RenderTargetPool&);
+	RenderTargetPool& operator=(const RenderTargetPool&);
+};
+
+#endif
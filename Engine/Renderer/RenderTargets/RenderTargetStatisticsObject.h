@@ -0,0 +1,18 @@
+#ifndef RENDERTARGETSTATISTICSOBJECT_H
+#define RENDERTARGETSTATISTICSOBJECT_H
+
+#include "Debug/Statistics/StatisticsObject.h"
+
+struct ENGINE_API RenderTargetStatisticsObject : public StatisticsObject
+{
+	DECLARE_STATISTICS_OBJECT(RenderTargetStatisticsObject)
+
+	std::size_t TargetsCount;
+	std::size_t AllocatedMemory;
+	std::size_t PeakMemory;
+	std::size_t RequestedMemory;
+	std::size_t AllocationsCount;
+	std::size_t EvictionsCount;
+};
+
+#endif
@@ -41,7 +41,7 @@ void RenderTextGUIObject::SetText (const std::string& text)
 	_modelView = RenderSystem::LoadTextGUI (text, _font);
 }
 
-void RenderTextGUIObject::Draw ()
+void RenderTextGUIObject::Draw (std::size_t levelOfDetail)
 {
 	if (_modelView == nullptr) {
 		return;
@@ -24,7 +24,7 @@ public:
 
 	void SetText (const std::string& text);
 
-	void Draw ();
+	void Draw (std::size_t levelOfDetail = 0);
 protected:
 	std::vector<PipelineAttribute> GetUniformAttributes ();
 };
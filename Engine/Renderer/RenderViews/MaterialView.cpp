@@ -19,6 +19,7 @@ MaterialView::MaterialView () :
 	alphaTexture (nullptr),
 	bumpTexture (nullptr),
 	cubeTexture (nullptr),
+	lightMapTexture (nullptr),
 	shaderView (nullptr)
 {
 
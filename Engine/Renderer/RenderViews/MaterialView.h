@@ -30,6 +30,7 @@ public:
 	Resource<TextureView> alphaTexture;
 	Resource<TextureView> bumpTexture;
 	Resource<TextureView> cubeTexture;
+	Resource<TextureView> lightMapTexture;
 	Resource<ShaderView> shaderView;
 
 	MaterialView ();
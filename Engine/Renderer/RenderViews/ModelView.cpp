@@ -1,5 +1,7 @@
 #include "ModelView.h"
 
+#include <algorithm>
+
 #include "Renderer/Pipeline.h"
 
 #include "Wrappers/OpenGL/GL.h"
@@ -8,48 +10,70 @@ ModelView::~ModelView ()
 {
 	GL::DeleteBuffers(1, &_objectBuffer.VBO_INDEX);
 	GL::DeleteBuffers(1, &_objectBuffer.VBO_INSTANCE_INDEX);
+	GL::DeleteBuffers(1, &_objectBuffer.VBO_BATCH_INDEX);
 	GL::DeleteBuffers(1, &_objectBuffer.IBO_INDEX);
 	GL::DeleteVertexArrays(1, &_objectBuffer.VAO_INDEX);
 }
 
-void ModelView::Draw ()
+void ModelView::Draw (std::size_t levelOfDetail)
 {
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
 	//bind pe containerul de stare de geometrie (vertex array object)
 	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
 
-	for (std::size_t i=0;i<_groupBuffers.size ();i++) {
-		Pipeline::SendMaterial (_groupBuffers [i].materialView);
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
+		Pipeline::SendMaterial (groupBuffers [i].materialView);
 
 		//comanda desenare
-		if (_objectBuffer.VBO_INSTANCE_INDEX == 0) {
-			GL::DrawElements (GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset));
-		}
-
-		if (_objectBuffer.VBO_INSTANCE_INDEX != 0) {
-			GL::DrawElementsInstanced(GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
-		}
+		DrawGroupBuffer (groupBuffers [i], _objectBuffer.INSTANCES_COUNT);
 	}
 }
 
-void ModelView::DrawGeometry ()
+void ModelView::DrawGeometry (std::size_t levelOfDetail)
 {
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
 	Pipeline::UpdateMatrices (nullptr);
 	//bind pe containerul de stare de geometrie (vertex array object)
 	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
 
-	for (std::size_t i=0;i<_groupBuffers.size ();i++) {
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
 		//comanda desenare
-		if (_objectBuffer.VBO_INSTANCE_INDEX == 0) {
-			GL::DrawElements (GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset));
-		}
-
-		if (_objectBuffer.VBO_INSTANCE_INDEX != 0) {
-			GL::DrawElementsInstanced(GL_TRIANGLES, _groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
-				(void*) (sizeof (unsigned int) * _groupBuffers [i].offset), _objectBuffer.INSTANCES_COUNT);
-		}
+		DrawGroupBuffer (groupBuffers [i], _objectBuffer.INSTANCES_COUNT);
+	}
+}
+
+/*
+ * Draw the model multiple times in a single call per group, using the
+ * per instance model matrices previously uploaded in the batch buffer
+*/
+
+void ModelView::DrawInstanced (std::size_t instancesCount, std::size_t levelOfDetail)
+{
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
+	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
+
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
+		Pipeline::SendMaterial (groupBuffers [i].materialView);
+
+		GL::DrawElementsInstanced(GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
+			(void*) (sizeof (unsigned int) * groupBuffers [i].offset), instancesCount);
+	}
+}
+
+void ModelView::DrawGeometryInstanced (std::size_t instancesCount, std::size_t levelOfDetail)
+{
+	const std::vector<GroupBuffer>& groupBuffers = GetGroupBuffers (levelOfDetail);
+
+	Pipeline::UpdateMatrices (nullptr);
+
+	GL::BindVertexArray(_objectBuffer.VAO_INDEX);
+
+	for (std::size_t i=0;i<groupBuffers.size ();i++) {
+		GL::DrawElementsInstanced(GL_TRIANGLES, groupBuffers [i].INDEX_COUNT, GL_UNSIGNED_INT,
+			(void*) (sizeof (unsigned int) * groupBuffers [i].offset), instancesCount);
 	}
 }
 
@@ -63,6 +87,18 @@ void ModelView::AddGroupBuffer (const GroupBuffer& groupBuffer)
 	_groupBuffers.push_back (groupBuffer);
 }
 
+void ModelView::AddLevelOfDetail (const LevelOfDetailBuffer& levelOfDetail)
+{
+	_levelsOfDetail.push_back (levelOfDetail);
+
+	LevelOfDetailBuffer& levelOfDetailBuffer = _levelsOfDetail.back ();
+	levelOfDetailBuffer.PolygonsCount = 0;
+
+	for (const GroupBuffer& groupBuffer : levelOfDetailBuffer.groupBuffers) {
+		levelOfDetailBuffer.PolygonsCount += groupBuffer.INDEX_COUNT / 3;
+	}
+}
+
 ObjectBuffer& ModelView::GetObjectBuffer ()
 {
 	return _objectBuffer;
@@ -73,9 +109,41 @@ std::size_t ModelView::GetVerticesCount () const
 	return _objectBuffer.VerticesCount;
 }
 
-std::size_t ModelView::GetPolygonsCount () const
+std::size_t ModelView::GetPolygonsCount (std::size_t levelOfDetail) const
+{
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return _objectBuffer.PolygonsCount;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1].PolygonsCount;
+}
+
+std::size_t ModelView::GetLevelsOfDetailCount () const
 {
-	return _objectBuffer.PolygonsCount;
+	return _levelsOfDetail.size () + 1;
+}
+
+float ModelView::GetGeometricError (std::size_t levelOfDetail) const
+{
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return 0.0f;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1].geometricError;
+}
+
+RESIDENCY_GROUP ModelView::GetResidencyGroup () const
+{
+	return RESIDENCY_MODELS;
+}
+
+ResidencyMemory ModelView::GetResidencyMemory () const
+{
+	return ResidencyMemory { 0, _objectBuffer.MemorySize };
 }
 
 std::vector<GroupBuffer>::iterator ModelView::begin ()
@@ -87,3 +155,32 @@ std::vector<GroupBuffer>::iterator ModelView::end ()
 {
 	return _groupBuffers.end ();
 }
+
+const std::vector<GroupBuffer>& ModelView::GetGroupBuffers (std::size_t levelOfDetail) const
+{
+	/*
+	 * Level zero is the full detail model, the coarsest level is used for
+	 * any level past the end of the chain
+	*/
+
+	if (levelOfDetail == 0 || _levelsOfDetail.empty ()) {
+		return _groupBuffers;
+	}
+
+	levelOfDetail = std::min (levelOfDetail, _levelsOfDetail.size ());
+
+	return _levelsOfDetail [levelOfDetail - 1].groupBuffers;
+}
+
+void ModelView::DrawGroupBuffer (const GroupBuffer& groupBuffer, std::size_t instancesCount)
+{
+	if (_objectBuffer.VBO_INSTANCE_INDEX == 0) {
+		GL::DrawElements (GL_TRIANGLES, groupBuffer.INDEX_COUNT, GL_UNSIGNED_INT,
+			(void*) (sizeof (unsigned int) * groupBuffer.offset));
+	}
+
+	if (_objectBuffer.VBO_INSTANCE_INDEX != 0) {
+		GL::DrawElementsInstanced(GL_TRIANGLES, groupBuffer.INDEX_COUNT, GL_UNSIGNED_INT,
+			(void*) (sizeof (unsigned int) * groupBuffer.offset), instancesCount);
+	}
+}
@@ -2,6 +2,7 @@
 #define MODELVIEW_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
 #include <vector>
 #include <string>
@@ -17,8 +18,13 @@ struct ObjectBuffer
 	unsigned int IBO_INDEX;
 	std::size_t INSTANCES_COUNT;
 
+	unsigned int VBO_BATCH_INDEX;
+	std::size_t BATCH_CAPACITY;
+
 	std::size_t VerticesCount;
 	std::size_t PolygonsCount;
+
+	std::size_t MemorySize;
 };
 
 struct GroupBuffer
@@ -28,29 +34,51 @@ struct GroupBuffer
 	std::size_t offset;
 };
 
-class ModelView : public Object
+struct LevelOfDetailBuffer
+{
+	std::vector<GroupBuffer> groupBuffers;
+	float geometricError;
+	std::size_t PolygonsCount;
+};
+
+class ModelView : public Object, public ResidentObjectI
 {
 protected:
 	ObjectBuffer _objectBuffer;
 	std::vector<GroupBuffer> _groupBuffers;
+	std::vector<LevelOfDetailBuffer> _levelsOfDetail;
 
 public:
 	~ModelView ();
 
-	virtual void Draw ();
-	virtual void DrawGeometry ();
+	virtual void Draw (std::size_t levelOfDetail = 0);
+	virtual void DrawGeometry (std::size_t levelOfDetail = 0);
+
+	void DrawInstanced (std::size_t instancesCount, std::size_t levelOfDetail = 0);
+	void DrawGeometryInstanced (std::size_t instancesCount, std::size_t levelOfDetail = 0);
 
 	void SetObjectBuffer (const ObjectBuffer& objectBuffer);
 
 	void AddGroupBuffer (const GroupBuffer& groupBuffer);
+	void AddLevelOfDetail (const LevelOfDetailBuffer& levelOfDetail);
 
 	ObjectBuffer& GetObjectBuffer ();
 
 	std::size_t GetVerticesCount () const;
-	std::size_t GetPolygonsCount () const;
+	std::size_t GetPolygonsCount (std::size_t levelOfDetail = 0) const;
+
+	std::size_t GetLevelsOfDetailCount () const;
+	float GetGeometricError (std::size_t levelOfDetail) const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 
 	std::vector<GroupBuffer>::iterator begin ();
 	std::vector<GroupBuffer>::iterator end ();
+protected:
+	const std::vector<GroupBuffer>& GetGroupBuffers (std::size_t levelOfDetail) const;
+
+	void DrawGroupBuffer (const GroupBuffer& groupBuffer, std::size_t instancesCount);
 };
 
 #endif
\ No newline at end of file
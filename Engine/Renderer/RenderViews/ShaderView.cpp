@@ -4,7 +4,10 @@
 
 ShaderView::ShaderView (unsigned int program) :
 	_program(program),
-	_uniforms ()
+	_uniforms (),
+	_isReady (true),
+	_isFailed (false),
+	_onLinked ()
 {
 
 }
@@ -18,11 +21,75 @@ ShaderView::~ShaderView ()
 	GL::DeleteProgram (_program);
 }
 
+void ShaderView::SetPending (const std::function<bool (unsigned int)>& onLinked)
+{
+	_isReady = false;
+	_onLinked = onLinked;
+}
+
+bool ShaderView::IsReady () const
+{
+	if (_isReady == true || _isFailed == true) {
+		return _isReady;
+	}
+
+	/*
+	 * Without the extension, the status query below waits for the driver
+	*/
+
+	if (GLEW_ARB_parallel_shader_compile) {
+		GLint isCompleted = GL_FALSE;
+		GL::GetProgramiv (_program, GL_COMPLETION_STATUS_ARB, &isCompleted);
+
+		if (isCompleted == GL_FALSE) {
+			return false;
+		}
+	}
+
+	Finish ();
+
+	return _isReady;
+}
+
+bool ShaderView::IsFailed () const
+{
+	return _isFailed;
+}
+
 unsigned int ShaderView::GetProgram () const
 {
+	/*
+	 * Programs used before they are done finish their link right away
+	*/
+
+	if (_isReady == false && _isFailed == false) {
+		Finish ();
+	}
+
+	/*
+	 * Binding the default program keeps a failed one out of the draws
+	*/
+
+	if (_isFailed == true) {
+		return 0;
+	}
+
 	return _program;
 }
 
+void ShaderView::Finish () const
+{
+	bool isLinked = true;
+
+	if (_onLinked) {
+		isLinked = _onLinked (_program);
+		_onLinked = nullptr;
+	}
+
+	_isReady = isLinked;
+	_isFailed = !isLinked;
+}
+
 int ShaderView::GetUniformLocation (const std::string& name)
 {
 	auto it = _uniforms.find (name);
@@ -3,6 +3,7 @@
 
 #include "Core/Interfaces/Object.h"
 
+#include <functional>
 #include <map>
 
 class ShaderView : public Object
@@ -11,16 +12,33 @@ protected:
 	unsigned int _program;
 	std::map<std::string, int> _uniforms;
 
+	/*
+	 * Compile and link run in the background when the driver allows it,
+	 * the status is checked once the program is done. A program that
+	 * fails to build is never ready
+	*/
+
+	mutable bool _isReady;
+	mutable bool _isFailed;
+	mutable std::function<bool (unsigned int)> _onLinked;
+
 public:
 	ShaderView (unsigned int program);
 	~ShaderView ();
 
+	void SetPending (const std::function<bool (unsigned int)>& onLinked);
+	bool IsReady () const;
+	bool IsFailed () const;
+
 	std::string GetName () const;
 	unsigned int GetProgram () const;
 
 	int GetUniformLocation (const std::string& name);
 	unsigned int GetUniformBlockIndex (const std::string& name);
 	unsigned int GetShaderStorageBlockIndex (const std::string& name);
+
+protected:
+	void Finish () const;
 };
 
 #endif
\ No newline at end of file
@@ -4,7 +4,8 @@
 
 TextureView::TextureView () :
 	_gpuIndex (0),
-	_textureType (1)
+	_textureType (1),
+	_memorySize (0)
 {
 
 }
@@ -36,7 +37,22 @@ void TextureView::SetType (int textureType)
 	_textureType = textureType;
 }
 
+void TextureView::SetMemorySize (std::size_t memorySize)
+{
+	_memorySize = memorySize;
+}
+
 unsigned int TextureView::GetGPUIndex () const
 {
 	return _gpuIndex;
 }
+
+RESIDENCY_GROUP TextureView::GetResidencyGroup () const
+{
+	return RESIDENCY_TEXTURES;
+}
+
+ResidencyMemory TextureView::GetResidencyMemory () const
+{
+	return ResidencyMemory { 0, _memorySize };
+}
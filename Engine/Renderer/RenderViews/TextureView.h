@@ -2,12 +2,14 @@
 #define TEXTUREVIEW_H
 
 #include "Core/Interfaces/Object.h"
+#include "Core/Resources/ResidentObjectI.h"
 
-class ENGINE_API TextureView : public Object
+class ENGINE_API TextureView : public Object, public ResidentObjectI
 {
 protected:
 	unsigned int _gpuIndex;
 	int _textureType;
+	std::size_t _memorySize;
 
 public:
 	TextureView ();
@@ -17,8 +19,12 @@ public:
 
 	void SetGPUIndex (unsigned int gpuIndex);
 	void SetType (int textureType);
+	void SetMemorySize (std::size_t memorySize);
 
 	unsigned int GetGPUIndex () const;
+
+	RESIDENCY_GROUP GetResidencyGroup () const;
+	ResidencyMemory GetResidencyMemory () const;
 };
 
 #endif
\ No newline at end of file
@@ -86,6 +86,28 @@ RenderVolumeI* RenderVolumeCollection::GetPreviousVolume () const
 	return GetRenderVolume (_lastRenderVolumeName);
 }
 
+bool RenderVolumeCollection::Contains (const RenderVolumeI* volume) const
+{
+	/*
+	 * Volumes hidden by a nested scope are visible again once the
+	 * scope is released, so every level is searched
+	*/
+
+	for (auto& it : _nestedRenderVolumes) {
+		std::stack<std::pair<RenderVolumeI*, std::size_t>> volumes (it.second);
+
+		while (volumes.empty () == false) {
+			if (volumes.top ().first == volume) {
+				return true;
+			}
+
+			volumes.pop ();
+		}
+	}
+
+	return false;
+}
+
 RenderVolumeCollectionIterator RenderVolumeCollection::begin ()
 {
 	RenderVolumeCollectionIterator rvcIt (_nestedRenderVolumes.begin ());
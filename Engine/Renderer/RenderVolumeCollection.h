@@ -30,6 +30,8 @@ public:
 	RenderVolumeI* GetRenderVolume (const std::string& name) const;
 	RenderVolumeI* GetPreviousVolume () const;
 
+	bool Contains (const RenderVolumeI* volume) const;
+
 	RenderVolumeCollectionIterator begin ();
 	RenderVolumeCollectionIterator end ();
 };
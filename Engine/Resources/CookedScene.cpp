@@ -0,0 +1,15 @@
+#include "CookedScene.h"
+
+CookedSceneHeader::CookedSceneHeader () :
+	magic (COOKED_SCENE_MAGIC),
+	version (COOKED_SCENE_VERSION),
+	sourceHash (0)
+{
+
+}
+
+bool CookedSceneHeader::operator == (const CookedSceneHeader& other) const
+{
+	return magic == other.magic && version == other.version &&
+		sourceHash == other.sourceHash;
+}
@@ -0,0 +1,27 @@
+#ifndef COOKEDSCENE_H
+#define COOKEDSCENE_H
+
+#include <cstdint>
+
+#define COOKED_SCENE_MAGIC 0x4E435343
+#define COOKED_SCENE_VERSION 1
+
+#define COOKED_SCENE_OBJECT 0
+#define COOKED_SCENE_PARTICLE_SYSTEM 1
+
+/*
+ * A cooked scene is reused only when it was built from the same scene file
+*/
+
+struct CookedSceneHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t sourceHash;
+
+	CookedSceneHeader ();
+
+	bool operator == (const CookedSceneHeader& other) const;
+};
+
+#endif
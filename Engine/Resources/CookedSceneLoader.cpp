@@ -0,0 +1,338 @@
+#include "CookedSceneLoader.h"
+
+#include <cstring>
+
+#include "VisualEffects/ParticleSystem/ParticleSystem.h"
+#include "Skybox/Skybox.h"
+
+#include "Systems/Components/PersistentComponent.h"
+
+#include "Resources/Resources.h"
+
+#include "Utils/Extensions/MathExtend.h"
+#include "Utils/Files/MappedFile.h"
+
+#include "Core/Console/Console.h"
+
+CookedSceneLoader::CookedSceneLoader () :
+	_current (nullptr),
+	_remaining (0)
+{
+
+}
+
+CookedSceneLoader& CookedSceneLoader::Instance ()
+{
+	static CookedSceneLoader cookedSceneLoader;
+
+	return cookedSceneLoader;
+}
+
+Scene* CookedSceneLoader::Load (const std::string& filename, const CookedSceneHeader& header)
+{
+	MappedFile file;
+
+	if (!file.Open (filename)) {
+		return nullptr;
+	}
+
+	if (!ProcessHeader (file.GetData (), file.GetSize (), header)) {
+		return nullptr;
+	}
+
+	std::int32_t skyboxPath = -1;
+	std::uint32_t sceneName = 0;
+	std::uint32_t objectsCount = 0;
+
+	if (!ProcessTables () || !Read (&skyboxPath, sizeof (std::int32_t)) ||
+		!ReadString (sceneName) || !ReadIndex (objectsCount) ||
+		skyboxPath >= (std::int32_t) _strings.size ()) {
+		Console::LogWarning ("Cooked scene \"" + filename + "\" is corrupted. It will be cooked again.");
+		return nullptr;
+	}
+
+	Scene* scene = new Scene ();
+
+	scene->SetName (_strings [sceneName]);
+
+	if (skyboxPath != -1) {
+		scene->SetSkybox (Resources::LoadSkybox (_strings [skyboxPath]));
+	}
+
+	for (std::uint32_t i=0;i<objectsCount;i++) {
+		if (!ProcessSceneObject (scene)) {
+			delete scene;
+
+			Console::LogWarning ("Cooked scene \"" + filename + "\" is corrupted. It will be cooked again.");
+			return nullptr;
+		}
+	}
+
+	return scene;
+}
+
+std::vector<std::string> CookedSceneLoader::GetModelPaths (const std::string& filename, const CookedSceneHeader& header)
+{
+	std::vector<std::string> paths;
+
+	MappedFile file;
+
+	if (!file.Open (filename)) {
+		return paths;
+	}
+
+	if (!ProcessHeader (file.GetData (), file.GetSize (), header) || !ProcessTables ()) {
+		return paths;
+	}
+
+	for (std::uint32_t modelPath : _modelPaths) {
+		paths.push_back (_strings [modelPath]);
+	}
+
+	return paths;
+}
+
+bool CookedSceneLoader::ProcessHeader (const unsigned char* data, std::size_t size, const CookedSceneHeader& header)
+{
+	_current = data;
+	_remaining = size;
+
+	CookedSceneHeader fileHeader;
+
+	if (!Read (&fileHeader, sizeof (CookedSceneHeader))) {
+		return false;
+	}
+
+	return fileHeader == header;
+}
+
+bool CookedSceneLoader::ProcessTables ()
+{
+	_strings.clear ();
+	_modelPaths.clear ();
+	_componentCreators.clear ();
+
+	std::uint32_t stringsCount = 0;
+
+	if (!ReadIndex (stringsCount) || stringsCount > _remaining / sizeof (std::uint32_t)) {
+		return false;
+	}
+
+	_strings.reserve (stringsCount);
+
+	for (std::uint32_t i=0;i<stringsCount;i++) {
+		std::uint32_t length = 0;
+
+		if (!ReadIndex (length) || length > _remaining) {
+			return false;
+		}
+
+		_strings.push_back (std::string ((const char*) _current, length));
+
+		_current += length;
+		_remaining -= length;
+	}
+
+	std::uint32_t modelPathsCount = 0;
+
+	if (!ReadIndex (modelPathsCount) || modelPathsCount > _remaining / sizeof (std::uint32_t)) {
+		return false;
+	}
+
+	for (std::uint32_t i=0;i<modelPathsCount;i++) {
+		std::uint32_t modelPath = 0;
+
+		if (!ReadString (modelPath)) {
+			return false;
+		}
+
+		_modelPaths.push_back (modelPath);
+	}
+
+	/*
+	 * Look up the component creators once per type instead of once per
+	 * component. Unknown types keep a null creator and are skipped.
+	*/
+
+	std::uint32_t componentTypesCount = 0;
+
+	if (!ReadIndex (componentTypesCount) || componentTypesCount > _remaining / sizeof (std::uint32_t)) {
+		return false;
+	}
+
+	for (std::uint32_t i=0;i<componentTypesCount;i++) {
+		std::uint32_t componentType = 0;
+
+		if (!ReadString (componentType)) {
+			return false;
+		}
+
+		_componentCreators.push_back (ObjectsFactory<Component>::Instance ()->GetCreateFn (_strings [componentType]));
+	}
+
+	return true;
+}
+
+bool CookedSceneLoader::ProcessSceneObject (Scene* scene)
+{
+	std::uint8_t description [2];
+	std::int32_t ids [3];
+	std::int32_t parentID = -1;
+	float transform [9];
+
+	if (!Read (description, sizeof (description)) || !Read (ids, sizeof (ids)) ||
+		!Read (&parentID, sizeof (std::int32_t)) || !Read (transform, sizeof (transform))) {
+		return false;
+	}
+
+	if (ids [1] < 0 || ids [1] >= (std::int32_t) _strings.size () || ids [2] >= (std::int32_t) _strings.size ()) {
+		return false;
+	}
+
+	SceneObject* sceneObject = nullptr;
+
+	if (description [0] == COOKED_SCENE_PARTICLE_SYSTEM) {
+		if (ids [2] < 0) {
+			return false;
+		}
+
+		sceneObject = Resources::LoadParticleSystem (_strings [ids [2]]);
+	} else {
+		sceneObject = new SceneObject ();
+	}
+
+	sceneObject->SetName (_strings [ids [1]]);
+	sceneObject->SetInstanceID (ids [0]);
+	sceneObject->SetActive (description [1] != 0);
+
+	Transform* objTransform = sceneObject->GetTransform ();
+
+	if (parentID != -1) {
+		SceneObject* parent = scene->GetObject ((std::size_t) parentID);
+
+		if (parent != nullptr) {
+			objTransform->SetParent (parent->GetTransform ());
+		}
+	}
+
+	objTransform->SetPosition (glm::vec3 (transform [0], transform [1], transform [2]));
+	objTransform->SetRotation (glm::quat (glm::vec3 (transform [3], transform [4], transform [5]) * DEG2RAD));
+	objTransform->SetScale (glm::vec3 (transform [6], transform [7], transform [8]));
+
+	if (!ProcessComponents (sceneObject)) {
+		delete sceneObject;
+
+		return false;
+	}
+
+	scene->AttachObject (sceneObject);
+
+	return true;
+}
+
+bool CookedSceneLoader::ProcessComponents (SceneObject* sceneObject)
+{
+	std::uint32_t componentsCount = 0;
+
+	if (!ReadIndex (componentsCount) || componentsCount > _remaining / sizeof (std::uint32_t)) {
+		return false;
+	}
+
+	for (std::uint32_t i=0;i<componentsCount;i++) {
+		std::uint32_t componentType = 0;
+
+		if (!ReadIndex (componentType) || componentType >= _componentCreators.size ()) {
+			return false;
+		}
+
+		/*
+		 * The generated loaders still expect an element, it is rebuilt in
+		 * memory from the string table
+		*/
+
+		TiXmlElement xmlElem ("Component");
+
+		if (!ProcessElement (&xmlElem)) {
+			return false;
+		}
+
+		if (_componentCreators [componentType] == nullptr) {
+			continue;
+		}
+
+		Component* component = _componentCreators [componentType] ();
+
+		PersistentComponent* persistentComponent = dynamic_cast<PersistentComponent*> (component);
+		persistentComponent->Load (&xmlElem);
+
+		sceneObject->AttachComponent (component);
+	}
+
+	return true;
+}
+
+bool CookedSceneLoader::ProcessElement (TiXmlElement* xmlElem)
+{
+	std::uint32_t attributesCount = 0;
+
+	if (!ReadIndex (attributesCount) || attributesCount > _remaining / (2 * sizeof (std::uint32_t))) {
+		return false;
+	}
+
+	for (std::uint32_t i=0;i<attributesCount;i++) {
+		std::uint32_t name = 0, value = 0;
+
+		if (!ReadString (name) || !ReadString (value)) {
+			return false;
+		}
+
+		xmlElem->SetAttribute (_strings [name].c_str (), _strings [value].c_str ());
+	}
+
+	std::uint32_t childrenCount = 0;
+
+	if (!ReadIndex (childrenCount) || childrenCount > _remaining / (3 * sizeof (std::uint32_t))) {
+		return false;
+	}
+
+	for (std::uint32_t i=0;i<childrenCount;i++) {
+		std::uint32_t name = 0;
+
+		if (!ReadString (name)) {
+			return false;
+		}
+
+		TiXmlElement* content = new TiXmlElement (_strings [name].c_str ());
+		xmlElem->LinkEndChild (content);
+
+		if (!ProcessElement (content)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CookedSceneLoader::Read (void* data, std::size_t size)
+{
+	if (_remaining < size) {
+		return false;
+	}
+
+	std::memcpy (data, _current, size);
+
+	_current += size;
+	_remaining -= size;
+
+	return true;
+}
+
+bool CookedSceneLoader::ReadIndex (std::uint32_t& value)
+{
+	return Read (&value, sizeof (std::uint32_t));
+}
+
+bool CookedSceneLoader::ReadString (std::uint32_t& value)
+{
+	return ReadIndex (value) && value < _strings.size ();
+}
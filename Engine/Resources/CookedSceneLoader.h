@@ -0,0 +1,54 @@
+#ifndef COOKEDSCENELOADER_H
+#define COOKEDSCENELOADER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Core/Parsers/XML/TinyXml/tinyxml.h"
+#include "Core/ObjectsFactory/ObjectsFactory.h"
+
+#include "SceneGraph/Scene.h"
+#include "SceneGraph/SceneObject.h"
+#include "Systems/Components/Component.h"
+
+#include "CookedScene.h"
+
+/*
+ * Reads the scene file written by CookedSceneSaver. Component types are
+ * resolved to their creators once per file, objects are built straight
+ * from the records without any text parsing.
+*/
+
+class ENGINE_API CookedSceneLoader
+{
+protected:
+	const unsigned char* _current;
+	std::size_t _remaining;
+
+	std::vector<std::string> _strings;
+	std::vector<std::uint32_t> _modelPaths;
+	std::vector<ObjectsFactory<Component>::CreateCompFn> _componentCreators;
+
+public:
+	static CookedSceneLoader& Instance ();
+
+	Scene* Load (const std::string& filename, const CookedSceneHeader& header);
+
+	std::vector<std::string> GetModelPaths (const std::string& filename, const CookedSceneHeader& header);
+protected:
+	CookedSceneLoader ();
+
+	bool ProcessHeader (const unsigned char* data, std::size_t size, const CookedSceneHeader& header);
+	bool ProcessTables ();
+
+	bool ProcessSceneObject (Scene* scene);
+	bool ProcessComponents (SceneObject* sceneObject);
+	bool ProcessElement (TiXmlElement* xmlElem);
+
+	bool Read (void* data, std::size_t size);
+	bool ReadIndex (std::uint32_t& value);
+	bool ReadString (std::uint32_t& value);
+};
+
+#endif
@@ -0,0 +1,325 @@
+#include "CookedSceneSaver.h"
+
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+
+#include "Utils/Files/FileSystem.h"
+#include "Utils/Extensions/StringExtend.h"
+
+#include "Core/Console/Console.h"
+
+CookedSceneSaver::CookedSceneSaver () :
+	_objectsCount (0)
+{
+
+}
+
+CookedSceneSaver& CookedSceneSaver::Instance ()
+{
+	static CookedSceneSaver cookedSceneSaver;
+
+	return cookedSceneSaver;
+}
+
+bool CookedSceneSaver::Save (TiXmlElement* root, const std::string& filename, const CookedSceneHeader& header)
+{
+	_strings.clear ();
+	_stringIndices.clear ();
+	_componentTypes.clear ();
+	_componentTypeIndices.clear ();
+	_modelPaths.clear ();
+	_objectsCount = 0;
+
+	/*
+	 * Convert the objects first, the tables are filled on the way
+	*/
+
+	std::string body;
+
+	std::int32_t skyboxPath = -1;
+
+	const char* name = root->Attribute ("name");
+	std::uint32_t sceneName = GetStringIndex (name != NULL ? name : std::string ());
+
+	for (TiXmlElement* content = root->FirstChildElement (); content != NULL; content = content->NextSiblingElement ()) {
+		std::string elementName = content->Value ();
+
+		if (elementName == "Skybox" && content->Attribute ("path") != NULL) {
+			skyboxPath = GetStringIndex (content->Attribute ("path"));
+		}
+		else if (elementName == "SceneObject") {
+			SaveSceneObject (content, COOKED_SCENE_OBJECT, body);
+		}
+		else if (elementName == "ParticleSystem") {
+			SaveSceneObject (content, COOKED_SCENE_PARTICLE_SYSTEM, body);
+		}
+	}
+
+	std::string buffer;
+
+	Write (buffer, &header, sizeof (CookedSceneHeader));
+
+	WriteIndex (buffer, _strings.size ());
+	for (const std::string& value : _strings) {
+		WriteIndex (buffer, value.size ());
+		Write (buffer, value.data (), value.size ());
+	}
+
+	WriteIndex (buffer, _modelPaths.size ());
+	for (std::uint32_t modelPath : _modelPaths) {
+		WriteIndex (buffer, modelPath);
+	}
+
+	WriteIndex (buffer, _componentTypes.size ());
+	for (std::uint32_t componentType : _componentTypes) {
+		WriteIndex (buffer, componentType);
+	}
+
+	Write (buffer, &skyboxPath, sizeof (std::int32_t));
+	WriteIndex (buffer, sceneName);
+	WriteIndex (buffer, _objectsCount);
+
+	buffer += body;
+
+	/*
+	 * Write in a temporary file first, so that an interrupted save never
+	 * leaves a truncated cooked scene behind
+	*/
+
+	std::filesystem::path path (filename);
+	std::filesystem::path temporaryPath (filename + ".tmp");
+
+	std::error_code error;
+
+	if (path.has_parent_path ()) {
+		std::filesystem::create_directories (path.parent_path (), error);
+	}
+
+	std::ofstream file (temporaryPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not save \"" + filename + "\" cooked scene!");
+		return false;
+	}
+
+	file.write (buffer.data (), buffer.size ());
+	file.close ();
+
+	if (file.fail ()) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked scene!");
+		return false;
+	}
+
+	std::filesystem::rename (temporaryPath, path, error);
+
+	if (error) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked scene!");
+		return false;
+	}
+
+	return true;
+}
+
+void CookedSceneSaver::SaveSceneObject (TiXmlElement* xmlElem, int type, std::string& buffer)
+{
+	const char* name = xmlElem->Attribute ("name");
+	const char* instanceID = xmlElem->Attribute (type == COOKED_SCENE_OBJECT ? "instanceID" : "InstanceID");
+	const char* isActive = xmlElem->Attribute ("isActive");
+	const char* path = xmlElem->Attribute ("path");
+
+	std::uint8_t description [2] = {
+		(std::uint8_t) type,
+		(std::uint8_t) (isActive != NULL && Extensions::StringExtend::ToBool (isActive))
+	};
+
+	std::int32_t ids [3] = {
+		instanceID != NULL ? std::stoi (instanceID) : 0,
+		(std::int32_t) GetStringIndex (name != NULL ? name : std::string ()),
+		path != NULL ? (std::int32_t) GetStringIndex (path) : -1
+	};
+
+	Write (buffer, description, sizeof (description));
+	Write (buffer, ids, sizeof (ids));
+
+	TiXmlElement* transformElem = xmlElem->FirstChildElement ("Transform");
+	SaveTransform (transformElem, buffer);
+
+	TiXmlElement* componentsElem = xmlElem->FirstChildElement ("Components");
+	SaveComponents (type == COOKED_SCENE_OBJECT ? componentsElem : NULL, buffer);
+
+	_objectsCount ++;
+}
+
+void CookedSceneSaver::SaveTransform (TiXmlElement* xmlElem, std::string& buffer)
+{
+	std::int32_t parentID = -1;
+
+	glm::vec3 position (0.0f), rotation (0.0f), scale (1.0f);
+
+	if (xmlElem != NULL) {
+		const char* parent = xmlElem->Attribute ("parentID");
+
+		if (parent != NULL) {
+			parentID = std::stoi (parent);
+		}
+
+		for (TiXmlElement* content = xmlElem->FirstChildElement (); content != NULL; content = content->NextSiblingElement ()) {
+			std::string name = content->Value ();
+
+			if (name == "Position") {
+				position = GetVector (content, 0.0f);
+			}
+			else if (name == "Rotation") {
+				rotation = GetVector (content, 0.0f);
+			}
+			else if (name == "Scale") {
+				scale = GetVector (content, 1.0f);
+			}
+		}
+	}
+
+	/*
+	 * Rotation is kept as euler angles in degrees, the same as in the
+	 * scene file
+	*/
+
+	float transform [9] = {
+		position.x, position.y, position.z,
+		rotation.x, rotation.y, rotation.z,
+		scale.x, scale.y, scale.z
+	};
+
+	Write (buffer, &parentID, sizeof (std::int32_t));
+	Write (buffer, transform, sizeof (transform));
+}
+
+void CookedSceneSaver::SaveComponents (TiXmlElement* xmlElem, std::string& buffer)
+{
+	std::vector<TiXmlElement*> components;
+
+	if (xmlElem != NULL) {
+		for (TiXmlElement* content = xmlElem->FirstChildElement ("Component"); content != NULL; content = content->NextSiblingElement ("Component")) {
+			const char* name = content->Attribute ("name");
+
+			if (name != NULL && std::string (name) != std::string ()) {
+				components.push_back (content);
+			}
+		}
+	}
+
+	WriteIndex (buffer, components.size ());
+
+	for (TiXmlElement* component : components) {
+		std::string typeName = "HT" + std::string (component->Attribute ("name"));
+
+		auto it = _componentTypeIndices.find (typeName);
+
+		if (it == _componentTypeIndices.end ()) {
+			it = _componentTypeIndices.insert (std::make_pair (typeName, (std::uint32_t) _componentTypes.size ())).first;
+			_componentTypes.push_back (GetStringIndex (typeName));
+		}
+
+		WriteIndex (buffer, it->second);
+
+		SaveElement (component, buffer);
+	}
+}
+
+void CookedSceneSaver::SaveElement (TiXmlElement* xmlElem, std::string& buffer)
+{
+	std::uint32_t attributesCount = 0;
+
+	for (TiXmlAttribute* attribute = xmlElem->FirstAttribute (); attribute != NULL; attribute = attribute->Next ()) {
+		attributesCount ++;
+	}
+
+	WriteIndex (buffer, attributesCount);
+
+	for (TiXmlAttribute* attribute = xmlElem->FirstAttribute (); attribute != NULL; attribute = attribute->Next ()) {
+		WriteIndex (buffer, GetStringIndex (attribute->Name ()));
+		WriteIndex (buffer, GetStringIndex (attribute->Value ()));
+	}
+
+	/*
+	 * Collect the models on the way, so that they can be requested before
+	 * the scene is instantiated. Animated models have their own loader.
+	*/
+
+	const char* path = xmlElem->Attribute ("path");
+
+	if (std::string (xmlElem->Value ()) == "model" && path != NULL && FileSystem::GetExtension (path) != ".anim") {
+		std::uint32_t modelPath = GetStringIndex (path);
+
+		if (std::find (_modelPaths.begin (), _modelPaths.end (), modelPath) == _modelPaths.end ()) {
+			_modelPaths.push_back (modelPath);
+		}
+	}
+
+	std::uint32_t childrenCount = 0;
+
+	for (TiXmlElement* content = xmlElem->FirstChildElement (); content != NULL; content = content->NextSiblingElement ()) {
+		childrenCount ++;
+	}
+
+	WriteIndex (buffer, childrenCount);
+
+	for (TiXmlElement* content = xmlElem->FirstChildElement (); content != NULL; content = content->NextSiblingElement ()) {
+		WriteIndex (buffer, GetStringIndex (content->Value ()));
+
+		SaveElement (content, buffer);
+	}
+}
+
+std::uint32_t CookedSceneSaver::GetStringIndex (const std::string& value)
+{
+	auto it = _stringIndices.find (value);
+
+	if (it != _stringIndices.end ()) {
+		return it->second;
+	}
+
+	std::uint32_t index = _strings.size ();
+
+	_strings.push_back (value);
+	_stringIndices [value] = index;
+
+	return index;
+}
+
+glm::vec3 CookedSceneSaver::GetVector (TiXmlElement* xmlElem, float defaultValue)
+{
+	glm::vec3 vector3 (defaultValue);
+
+	const char* x = xmlElem->Attribute ("x");
+	const char* y = xmlElem->Attribute ("y");
+	const char* z = xmlElem->Attribute ("z");
+
+	if (x) {
+		vector3.x = std::stof (x);
+	}
+
+	if (y) {
+		vector3.y = std::stof (y);
+	}
+
+	if (z) {
+		vector3.z = std::stof (z);
+	}
+
+	return vector3;
+}
+
+void CookedSceneSaver::Write (std::string& buffer, const void* data, std::size_t size)
+{
+	buffer.append ((const char*) data, size);
+}
+
+void CookedSceneSaver::WriteIndex (std::string& buffer, std::uint32_t value)
+{
+	Write (buffer, &value, sizeof (std::uint32_t));
+}
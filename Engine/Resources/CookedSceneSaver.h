@@ -0,0 +1,52 @@
+#ifndef COOKEDSCENESAVER_H
+#define COOKEDSCENESAVER_H
+
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Core/Parsers/XML/TinyXml/tinyxml.h"
+
+#include "CookedScene.h"
+
+/*
+ * Converts the scene description to a flat binary file. Strings are kept
+ * once in a table, component types are resolved to indices and the
+ * transforms are stored already parsed.
+*/
+
+class ENGINE_API CookedSceneSaver
+{
+protected:
+	std::vector<std::string> _strings;
+	std::map<std::string, std::uint32_t> _stringIndices;
+
+	std::vector<std::uint32_t> _componentTypes;
+	std::map<std::string, std::uint32_t> _componentTypeIndices;
+
+	std::vector<std::uint32_t> _modelPaths;
+
+	std::uint32_t _objectsCount;
+
+public:
+	static CookedSceneSaver& Instance ();
+
+	bool Save (TiXmlElement* root, const std::string& filename, const CookedSceneHeader& header);
+protected:
+	CookedSceneSaver ();
+
+	void SaveSceneObject (TiXmlElement* xmlElem, int type, std::string& buffer);
+	void SaveTransform (TiXmlElement* xmlElem, std::string& buffer);
+	void SaveComponents (TiXmlElement* xmlElem, std::string& buffer);
+	void SaveElement (TiXmlElement* xmlElem, std::string& buffer);
+
+	std::uint32_t GetStringIndex (const std::string& value);
+	glm::vec3 GetVector (TiXmlElement* xmlElem, float defaultValue);
+
+	void Write (std::string& buffer, const void* data, std::size_t size);
+	void WriteIndex (std::string& buffer, std::uint32_t value);
+};
+
+#endif
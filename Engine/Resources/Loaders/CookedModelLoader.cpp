@@ -0,0 +1,391 @@
+#include "CookedModelLoader.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "Resources/Resources.h"
+
+#include "Core/Console/Console.h"
+
+CookedModelLoader::CookedModelLoader () :
+	_header (),
+	_begin (nullptr),
+	_current (nullptr),
+	_end (nullptr)
+{
+
+}
+
+void CookedModelLoader::SetHeader (const CookedModelHeader& header)
+{
+	_header = header;
+}
+
+Object* CookedModelLoader::Load (const std::string& filename)
+{
+	CookedModel* model = new CookedModel ();
+
+	if (!model->GetFile ().Open (filename)) {
+		delete model;
+		return nullptr;
+	}
+
+	_begin = _current = model->GetFile ().GetData ();
+	_end = _begin + model->GetFile ().GetSize ();
+
+	/*
+	 * Reject files cooked from another source or with other settings
+	*/
+
+	CookedModelHeader header;
+
+	if (!Read (&header, sizeof (CookedModelHeader)) || !(header == _header)) {
+		delete model;
+		return nullptr;
+	}
+
+	if (!LoadGeometry (model) || !LoadLevelsOfDetail (model) || !LoadStreams (model)) {
+		Console::LogWarning ("Cooked model \"" + filename + "\" is corrupted. It will be cooked again.");
+
+		delete model;
+		return nullptr;
+	}
+
+	return model;
+}
+
+bool CookedModelLoader::LoadGeometry (CookedModel* model)
+{
+	std::string name, mtllib;
+
+	if (!ReadString (name) || !ReadString (mtllib)) {
+		return false;
+	}
+
+	model->SetName (name);
+	model->SetMaterialLibrary (mtllib);
+
+	std::size_t verticesCount = 0;
+
+	if (!ReadCount (verticesCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<verticesCount;i++) {
+		glm::vec3 vertex;
+
+		if (!Read (&vertex, sizeof (glm::vec3))) {
+			return false;
+		}
+
+		model->AddVertex (vertex);
+	}
+
+	std::size_t normalsCount = 0;
+
+	if (!ReadCount (normalsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<normalsCount;i++) {
+		glm::vec3 normal;
+
+		if (!Read (&normal, sizeof (glm::vec3))) {
+			return false;
+		}
+
+		model->AddNormal (normal);
+	}
+
+	std::size_t texcoordsCount = 0;
+
+	if (!ReadCount (texcoordsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<texcoordsCount;i++) {
+		glm::vec2 texcoord;
+
+		if (!Read (&texcoord, sizeof (glm::vec2))) {
+			return false;
+		}
+
+		model->AddTexcoord (texcoord);
+	}
+
+	std::size_t objectsCount = 0;
+
+	if (!ReadCount (objectsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<objectsCount;i++) {
+		std::string objectName;
+		std::size_t groupsCount = 0;
+
+		if (!ReadString (objectName) || !ReadCount (groupsCount)) {
+			return false;
+		}
+
+		ObjectModel* objModel = new ObjectModel (objectName);
+		model->AddObjectModel (objModel);
+
+		for (std::size_t j=0;j<groupsCount;j++) {
+			std::string groupName, materialName;
+			std::size_t polygonsCount = 0;
+
+			if (!ReadString (groupName) || !ReadString (materialName) || !ReadCount (polygonsCount)) {
+				return false;
+			}
+
+			PolygonGroup* polyGroup = new PolygonGroup (groupName);
+			polyGroup->SetMaterial (GetMaterial (materialName));
+
+			objModel->AddPolygonGroup (polyGroup);
+
+			for (std::size_t k=0;k<polygonsCount;k++) {
+				std::uint8_t polygonInfo [3];
+
+				if (!Read (polygonInfo, sizeof (polygonInfo))) {
+					return false;
+				}
+
+				Polygon* polygon = new Polygon ();
+				polyGroup->AddPolygon (polygon);
+
+				for (std::size_t l=0;l<polygonInfo [0];l++) {
+					std::int32_t indices [3];
+
+					if (!Read (indices, sizeof (indices))) {
+						return false;
+					}
+
+					/*
+					 * The file is mapped as it is, indices out of range
+					 * would be read past the attributes
+					*/
+
+					if (!IsIndexValid (indices [0], verticesCount) ||
+						(polygonInfo [1] && !IsIndexValid (indices [1], normalsCount)) ||
+						(polygonInfo [2] && !IsIndexValid (indices [2], texcoordsCount))) {
+						return false;
+					}
+
+					polygon->AddVertex (indices [0]);
+
+					if (polygonInfo [1]) {
+						polygon->AddNormal (indices [1]);
+					}
+
+					if (polygonInfo [2]) {
+						polygon->AddTexcoord (indices [2]);
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool CookedModelLoader::LoadLevelsOfDetail (CookedModel* model)
+{
+	std::size_t levelsOfDetailCount = 0;
+
+	if (!ReadCount (levelsOfDetailCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<levelsOfDetailCount;i++) {
+		CookedLevelOfDetail levelOfDetail;
+		std::size_t groupsCount = 0;
+
+		if (!Read (&levelOfDetail.geometricError, sizeof (float)) || !ReadCount (groupsCount)) {
+			return false;
+		}
+
+		for (std::size_t j=0;j<groupsCount;j++) {
+			std::string materialName;
+			CookedGroup group;
+
+			if (!ReadString (materialName) || !ReadCount (group.offset) || !ReadCount (group.INDEX_COUNT)) {
+				return false;
+			}
+
+			group.material = GetMaterial (materialName);
+
+			levelOfDetail.groups.push_back (group);
+		}
+
+		model->AddCookedLevelOfDetail (levelOfDetail);
+	}
+
+	return true;
+}
+
+bool CookedModelLoader::LoadStreams (CookedModel* model)
+{
+	std::size_t verticesCount = 0;
+	std::size_t indicesCount = 0;
+
+	if (!ReadCount (verticesCount) || !ReadCount (indicesCount)) {
+		return false;
+	}
+
+	if (!Align ()) {
+		return false;
+	}
+
+	/*
+	 * A vertex count that overflows the stream size is corrupted too
+	*/
+
+	if (_header.vertexStride == 0 || verticesCount > (std::size_t) (_end - _current) / _header.vertexStride) {
+		return false;
+	}
+
+	const unsigned char* vertexData = Skip (verticesCount * _header.vertexStride);
+
+	if (vertexData == nullptr || !Align ()) {
+		return false;
+	}
+
+	if (indicesCount > (std::size_t) (_end - _current) / sizeof (unsigned int)) {
+		return false;
+	}
+
+	const unsigned char* indexData = Skip (indicesCount * sizeof (unsigned int));
+
+	if (indexData == nullptr) {
+		return false;
+	}
+
+	/*
+	 * Every group has to stay inside the index stream
+	*/
+
+	for (const CookedLevelOfDetail& levelOfDetail : model->GetCookedLevelsOfDetail ()) {
+		for (const CookedGroup& group : levelOfDetail.groups) {
+			if (group.offset > indicesCount || group.INDEX_COUNT > indicesCount - group.offset) {
+				return false;
+			}
+		}
+	}
+
+	/*
+	 * The index stream is uploaded as it is, so every index has to point
+	 * inside the vertex stream
+	*/
+
+	for (std::size_t i=0;i<indicesCount;i++) {
+		unsigned int index;
+		std::memcpy (&index, indexData + i * sizeof (unsigned int), sizeof (unsigned int));
+
+		if (index >= verticesCount) {
+			return false;
+		}
+	}
+
+	model->SetVertexData (vertexData, verticesCount);
+	model->SetIndexData ((const unsigned int*) indexData, indicesCount);
+
+	return true;
+}
+
+Resource<Material> CookedModelLoader::GetMaterial (const std::string& materialName)
+{
+	/*
+	 * Material names are prefixed with the library they belong to
+	*/
+
+	std::size_t separator = materialName.rfind ("::");
+
+	if (separator == std::string::npos) {
+		return nullptr;
+	}
+
+	Resource<MaterialLibrary> materialLibrary = Resources::LoadMaterialLibrary (materialName.substr (0, separator));
+
+	/*
+	 * A library that was moved or deleted leaves the default material
+	*/
+
+	if (materialLibrary == nullptr) {
+		return nullptr;
+	}
+
+	return materialLibrary->GetMaterial (materialName);
+}
+
+bool CookedModelLoader::IsIndexValid (std::int32_t index, std::size_t count)
+{
+	return index >= 0 && (std::size_t) index < count;
+}
+
+bool CookedModelLoader::Read (void* data, std::size_t size)
+{
+	const unsigned char* source = Skip (size);
+
+	if (source == nullptr) {
+		return false;
+	}
+
+	std::memcpy (data, source, size);
+
+	return true;
+}
+
+bool CookedModelLoader::ReadString (std::string& value)
+{
+	std::size_t size = 0;
+
+	if (!ReadCount (size)) {
+		return false;
+	}
+
+	const unsigned char* source = Skip (size);
+
+	if (source == nullptr) {
+		return false;
+	}
+
+	value.assign ((const char*) source, size);
+
+	return true;
+}
+
+bool CookedModelLoader::ReadCount (std::size_t& count)
+{
+	std::uint64_t value = 0;
+
+	if (!Read (&value, sizeof (std::uint64_t))) {
+		return false;
+	}
+
+	count = (std::size_t) value;
+
+	return true;
+}
+
+const unsigned char* CookedModelLoader::Skip (std::size_t size)
+{
+	if (size > (std::size_t) (_end - _current)) {
+		return nullptr;
+	}
+
+	const unsigned char* data = _current;
+	_current += size;
+
+	return data;
+}
+
+bool CookedModelLoader::Align ()
+{
+	std::size_t remainder = (std::size_t) (_current - _begin) % COOKED_MODEL_ALIGNMENT;
+
+	if (remainder == 0) {
+		return true;
+	}
+
+	return Skip (COOKED_MODEL_ALIGNMENT - remainder) != nullptr;
+}
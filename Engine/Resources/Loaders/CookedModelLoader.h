@@ -0,0 +1,49 @@
+#ifndef COOKEDMODELLOADER_H
+#define COOKEDMODELLOADER_H
+
+#include "Resources/ResourceLoader.h"
+
+#include <cstdint>
+#include <string>
+
+#include "Renderer/Render/Mesh/CookedModel.h"
+#include "Renderer/Render/Material/MaterialLibrary.h"
+
+/*
+ * Maps a cooked model in memory. Returns nullptr when the file is missing,
+ * truncated or doesn't match the expected header, the caller is expected
+ * to import the source again in that case.
+*/
+
+class CookedModelLoader : public ResourceLoader
+{
+protected:
+	CookedModelHeader _header;
+
+	const unsigned char* _begin;
+	const unsigned char* _current;
+	const unsigned char* _end;
+
+public:
+	CookedModelLoader ();
+
+	void SetHeader (const CookedModelHeader& header);
+
+	Object* Load (const std::string& filename);
+protected:
+	bool LoadGeometry (CookedModel* model);
+	bool LoadLevelsOfDetail (CookedModel* model);
+	bool LoadStreams (CookedModel* model);
+
+	Resource<Material> GetMaterial (const std::string& materialName);
+
+	static bool IsIndexValid (std::int32_t index, std::size_t count);
+
+	bool Read (void* data, std::size_t size);
+	bool ReadString (std::string& value);
+	bool ReadCount (std::size_t& count);
+	const unsigned char* Skip (std::size_t size);
+	bool Align ();
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "CookedTextureLoader.h"
+
+#include <cstring>
+
+#include "Renderer/Render/Texture/Texture.h"
+
+#include "Utils/Files/MappedFile.h"
+
+#include "Core/Console/Console.h"
+
+void CookedTextureLoader::SetHeader (const CookedTextureHeader& header)
+{
+	_header = header;
+}
+
+Object* CookedTextureLoader::Load (const std::string& filename)
+{
+	MappedFile file;
+
+	if (!file.Open (filename)) {
+		return nullptr;
+	}
+
+	const unsigned char* current = file.GetData ();
+	const unsigned char* end = current + file.GetSize ();
+
+	auto read = [&] (void* data, std::size_t size) -> bool {
+		if (size > (std::size_t) (end - current)) {
+			return false;
+		}
+
+		std::memcpy (data, current, size);
+		current += size;
+
+		return true;
+	};
+
+	CookedTextureHeader header;
+
+	if (!read (&header, sizeof (CookedTextureHeader)) || !(header == _header)) {
+		return nullptr;
+	}
+
+	std::uint32_t description [4];
+
+	if (!read (description, sizeof (description)) || description [3] == 0 ||
+		description [3] > MAX_TEXTURE_MIPMAP_LEVEL) {
+		Console::LogWarning ("Cooked texture \"" + filename + "\" is corrupted. It will be cooked again.");
+		return nullptr;
+	}
+
+	Texture* texture = new Texture (filename);
+
+	texture->SetCompressionType ((TEXTURE_COMPRESSION_TYPE) description [0]);
+	texture->SetSize (Size (description [1], description [2]));
+	texture->SetMipmapGeneration (false);
+
+	for (std::size_t level = 0; level < description [3]; level ++) {
+		std::uint64_t size = 0;
+
+		if (!read (&size, sizeof (std::uint64_t)) || size > (std::uint64_t) (end - current)) {
+			Console::LogWarning ("Cooked texture \"" + filename + "\" is corrupted. It will be cooked again.");
+
+			delete texture;
+			return nullptr;
+		}
+
+		if (level == 0) {
+			texture->SetPixels (current, size);
+		} else {
+			texture->AddMipmapLevel (current, size);
+		}
+
+		current += size;
+	}
+
+	return texture;
+}
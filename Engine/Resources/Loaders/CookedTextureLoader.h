@@ -0,0 +1,26 @@
+#ifndef COOKEDTEXTURELOADER_H
+#define COOKEDTEXTURELOADER_H
+
+#include "Resources/ResourceLoader.h"
+
+#include <string>
+
+#include "Renderer/Render/Texture/CookedTexture.h"
+
+/*
+ * Returns nullptr when the cooked texture is missing, truncated or was
+ * built from another source, so that the caller cooks it again.
+*/
+
+class CookedTextureLoader : public ResourceLoader
+{
+protected:
+	CookedTextureHeader _header;
+
+public:
+	void SetHeader (const CookedTextureHeader& header);
+
+	Object* Load (const std::string& filename);
+};
+
+#endif
@@ -162,7 +162,7 @@ void GenericObjectModelLoader::ProcessMaterial (PolygonGroup* polyGroup, aiMesh*
 		textureName = directory + textureName;
 		textureName = FileSystem::FormatFilename (textureName);
 
-		Resource<Texture> texture = Resources::LoadTexture (std::string (textureName));
+		Resource<Texture> texture = Resources::LoadTexture (std::string (textureName), COOK_COLOR);
 
 		material->diffuseTexture = texture;
 	}
@@ -177,7 +177,7 @@ void GenericObjectModelLoader::ProcessMaterial (PolygonGroup* polyGroup, aiMesh*
 		textureName = directory + textureName;
 		textureName = FileSystem::FormatFilename (textureName);
 
-		Resource<Texture> texture = Resources::LoadTexture (std::string (textureName));
+		Resource<Texture> texture = Resources::LoadTexture (std::string (textureName), COOK_COLOR);
 
 		material->specularTexture = texture;
 	}
@@ -0,0 +1,240 @@
+#include "LightMapModelLoader.h"
+
+#include <cstdint>
+
+#include "Resources/Resources.h"
+
+#include "Core/Console/Console.h"
+
+#define LIGHTMAP_MODEL_MAX_STRING 4096
+
+Object* LightMapModelLoader::Load (const std::string& filename)
+{
+	std::ifstream file (filename, std::ios::binary);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not open \"" + filename + "\" light map model!");
+		return nullptr;
+	}
+
+	std::uint32_t header [2];
+
+	if (!Read (file, header, sizeof (header)) ||
+		header [0] != LIGHTMAP_MODEL_MAGIC || header [1] != LIGHTMAP_MODEL_VERSION) {
+		Console::LogError ("\"" + filename + "\" is not a light map model or it was baked by another version!");
+		return nullptr;
+	}
+
+	LightMapModel* model = new LightMapModel ();
+	model->SetName (filename);
+
+	if (!LoadGeometry (file, model) || !LoadObjects (file, model)) {
+		Console::LogError ("Light map model \"" + filename + "\" is corrupted!");
+
+		delete model;
+		return nullptr;
+	}
+
+	return model;
+}
+
+bool LightMapModelLoader::LoadGeometry (std::ifstream& file, LightMapModel* model)
+{
+	std::string mtllib, lightMapPath;
+
+	if (!ReadString (file, mtllib) || !ReadString (file, lightMapPath)) {
+		return false;
+	}
+
+	model->SetMaterialLibrary (mtllib);
+
+	/*
+	 * Mipmaps would blend the charts with their neighbours
+	*/
+
+	if (lightMapPath != std::string ()) {
+		Resource<Texture> lightMap = Resources::LoadTexture (lightMapPath);
+
+		if (lightMap != nullptr) {
+			lightMap->SetMipmapGeneration (false);
+			lightMap->SetMinFilter (FILTER_LINEAR);
+			lightMap->SetWrapMode (WRAP_CLAMP_EDGE);
+		}
+
+		model->SetLightMap (lightMap);
+	}
+
+	std::size_t verticesCount = 0;
+
+	if (!ReadCount (file, verticesCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<verticesCount;i++) {
+		glm::vec3 vertex;
+
+		if (!Read (file, &vertex, sizeof (glm::vec3))) {
+			return false;
+		}
+
+		model->AddVertex (vertex);
+	}
+
+	std::size_t normalsCount = 0;
+
+	if (!ReadCount (file, normalsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<normalsCount;i++) {
+		glm::vec3 normal;
+
+		if (!Read (file, &normal, sizeof (glm::vec3))) {
+			return false;
+		}
+
+		model->AddNormal (normal);
+	}
+
+	std::size_t texcoordsCount = 0;
+
+	if (!ReadCount (file, texcoordsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<texcoordsCount;i++) {
+		glm::vec2 texcoord, lmTexcoord;
+
+		if (!Read (file, &texcoord, sizeof (glm::vec2)) || !Read (file, &lmTexcoord, sizeof (glm::vec2))) {
+			return false;
+		}
+
+		model->AddTexcoord (texcoord);
+		model->AddLightMapTexcoord (lmTexcoord);
+	}
+
+	return true;
+}
+
+bool LightMapModelLoader::LoadObjects (std::ifstream& file, LightMapModel* model)
+{
+	std::size_t objectsCount = 0;
+
+	if (!ReadCount (file, objectsCount)) {
+		return false;
+	}
+
+	for (std::size_t i=0;i<objectsCount;i++) {
+		std::string objectName;
+		std::size_t groupsCount = 0;
+
+		if (!ReadString (file, objectName) || !ReadCount (file, groupsCount)) {
+			return false;
+		}
+
+		ObjectModel* objModel = new ObjectModel (objectName);
+		model->AddObjectModel (objModel);
+
+		for (std::size_t j=0;j<groupsCount;j++) {
+			std::string groupName, materialName;
+			std::size_t polygonsCount = 0;
+
+			if (!ReadString (file, groupName) || !ReadString (file, materialName) || !ReadCount (file, polygonsCount)) {
+				return false;
+			}
+
+			PolygonGroup* polyGroup = new PolygonGroup (groupName);
+			polyGroup->SetMaterial (GetMaterial (materialName));
+
+			objModel->AddPolygonGroup (polyGroup);
+
+			for (std::size_t k=0;k<polygonsCount;k++) {
+				std::uint8_t polygonInfo [2];
+
+				if (!Read (file, polygonInfo, sizeof (polygonInfo))) {
+					return false;
+				}
+
+				Polygon* polygon = new Polygon ();
+				polyGroup->AddPolygon (polygon);
+
+				for (std::size_t l=0;l<polygonInfo [0];l++) {
+					std::int32_t indices [3];
+
+					if (!Read (file, indices, sizeof (indices))) {
+						return false;
+					}
+
+					if (indices [0] < 0 || (std::size_t) indices [0] >= model->VertexCount () ||
+						indices [2] < 0 || (std::size_t) indices [2] >= model->TexcoordsCount ()) {
+						return false;
+					}
+
+					polygon->AddVertex (indices [0]);
+
+					if (polygonInfo [1]) {
+						polygon->AddNormal (indices [1]);
+					}
+
+					polygon->AddTexcoord (indices [2]);
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+Resource<Material> LightMapModelLoader::GetMaterial (const std::string& materialName)
+{
+	/*
+	 * Material names are prefixed with the library they belong to
+	*/
+
+	std::size_t separator = materialName.rfind ("::");
+
+	if (separator == std::string::npos) {
+		return nullptr;
+	}
+
+	Resource<MaterialLibrary> materialLibrary = Resources::LoadMaterialLibrary (materialName.substr (0, separator));
+
+	return materialLibrary->GetMaterial (materialName);
+}
+
+bool LightMapModelLoader::Read (std::ifstream& file, void* data, std::size_t size)
+{
+	file.read ((char*) data, size);
+
+	return (std::size_t) file.gcount () == size;
+}
+
+bool LightMapModelLoader::ReadString (std::ifstream& file, std::string& value)
+{
+	std::size_t size = 0;
+
+	if (!ReadCount (file, size)) {
+		return false;
+	}
+
+	if (size > LIGHTMAP_MODEL_MAX_STRING) {
+		return false;
+	}
+
+	value.resize (size);
+
+	return size == 0 || Read (file, &value [0], size);
+}
+
+bool LightMapModelLoader::ReadCount (std::ifstream& file, std::size_t& count)
+{
+	std::uint64_t value = 0;
+
+	if (!Read (file, &value, sizeof (std::uint64_t))) {
+		return false;
+	}
+
+	count = (std::size_t) value;
+
+	return true;
+}
@@ -0,0 +1,27 @@
+#ifndef LIGHTMAPMODELLOADER_H
+#define LIGHTMAPMODELLOADER_H
+
+#include "Resources/ResourceLoader.h"
+
+#include <fstream>
+#include <string>
+
+#include "Renderer/Render/Mesh/LightMapModel.h"
+#include "Renderer/Render/Material/MaterialLibrary.h"
+
+class LightMapModelLoader : public ResourceLoader
+{
+public:
+	Object* Load (const std::string& filename);
+protected:
+	bool LoadGeometry (std::ifstream& file, LightMapModel* model);
+	bool LoadObjects (std::ifstream& file, LightMapModel* model);
+
+	Resource<Material> GetMaterial (const std::string& materialName);
+
+	bool Read (std::ifstream& file, void* data, std::size_t size);
+	bool ReadString (std::ifstream& file, std::string& value);
+	bool ReadCount (std::ifstream& file, std::size_t& count);
+};
+
+#endif
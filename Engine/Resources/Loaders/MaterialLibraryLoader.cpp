@@ -254,7 +254,13 @@ void MaterialLibraryLoader::ProcessDefaultAttributes(std::ifstream &file, Materi
 		textureName = FileSystem::GetDirectory (filename) + textureName;
 		textureName = FileSystem::FormatFilename (textureName);
 
-		Resource<Texture> texture = Resources::LoadTexture (textureName);
+		/*
+		 * Material textures are cooked, normal maps keep their own filtering
+		*/
+
+		TEXTURE_COOK_MODE cookMode = fileType == "map_bump" ? COOK_NORMAL_MAP : COOK_COLOR;
+
+		Resource<Texture> texture = Resources::LoadTexture (textureName, cookMode);
 
 		if (fileType == "map_Ka") {
 			currentMaterial->ambientTexture = texture;
@@ -31,6 +31,15 @@ Object* RenderSettingsLoader::Load (const std::string& filename)
 		else if (name == "General") {
 			ProcessGeneral (content, settings);
 		}
+		else if (name == "LOD") {
+			ProcessLOD (content, settings);
+		}
+		else if (name == "Shadows") {
+			ProcessShadows (content, settings);
+		}
+		else if (name == "Governor") {
+			ProcessGovernor (content, settings);
+		}
 		else if (name == "SSAO") {
 			ProcessSSAO (content, settings);
 		}
@@ -102,10 +111,57 @@ void RenderSettingsLoader::ProcessGeneral (TiXmlElement* xmlElem, RenderSettings
 	std::string indirectDiffuseEnabled = xmlElem->Attribute ("indirectDiffuseEnabled");
 	std::string indirectSpecularEnabled = xmlElem->Attribute ("indirectSpecularEnabled");
 	std::string subsurfaceScatteringEnabled = xmlElem->Attribute ("subsurfaceScatteringEnabled");
+	std::string instancingEnabled = xmlElem->Attribute ("instancingEnabled");
 
 	settings->indirect_diffuse_enabled = Extensions::StringExtend::ToBool (indirectDiffuseEnabled);
 	settings->indirect_specular_enabled = Extensions::StringExtend::ToBool (indirectSpecularEnabled);
 	settings->subsurface_scattering_enabled = Extensions::StringExtend::ToBool (subsurfaceScatteringEnabled);
+	settings->instancing_enabled = Extensions::StringExtend::ToBool (instancingEnabled);
+}
+
+void RenderSettingsLoader::ProcessLOD (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string pixelError = xmlElem->Attribute ("pixelError");
+	std::string shadowBias = xmlElem->Attribute ("shadowBias");
+	std::string giBias = xmlElem->Attribute ("giBias");
+
+	settings->lod_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->lod_pixel_error = std::stof (pixelError);
+	settings->lod_shadow_bias = std::stof (shadowBias);
+	settings->lod_gi_bias = std::stof (giBias);
+}
+
+void RenderSettingsLoader::ProcessShadows (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string cacheEnabled = xmlElem->Attribute ("cacheEnabled");
+	std::string spotLightUpdates = xmlElem->Attribute ("spotLightUpdates");
+
+	settings->shadow_cache_enabled = Extensions::StringExtend::ToBool (cacheEnabled);
+	settings->shadow_spot_light_updates = std::stoi (spotLightUpdates);
+}
+
+void RenderSettingsLoader::ProcessGovernor (TiXmlElement* xmlElem, RenderSettings* settings)
+{
+	std::string enabled = xmlElem->Attribute ("enabled");
+	std::string targetFrameTime = xmlElem->Attribute ("targetFrameTime");
+	std::string hysteresis = xmlElem->Attribute ("hysteresis");
+	std::string cooldownFrames = xmlElem->Attribute ("cooldownFrames");
+	std::string minResolutionScale = xmlElem->Attribute ("minResolutionScale");
+	std::string maxResolutionScale = xmlElem->Attribute ("maxResolutionScale");
+	std::string resolutionStep = xmlElem->Attribute ("resolutionStep");
+	std::string minQuality = xmlElem->Attribute ("minQuality");
+	std::string qualityStep = xmlElem->Attribute ("qualityStep");
+
+	settings->governor_enabled = Extensions::StringExtend::ToBool (enabled);
+	settings->governor_target_frame_time = std::stof (targetFrameTime);
+	settings->governor_hysteresis = std::stof (hysteresis);
+	settings->governor_cooldown_frames = std::stoi (cooldownFrames);
+	settings->governor_min_resolution_scale = std::stof (minResolutionScale);
+	settings->governor_max_resolution_scale = std::stof (maxResolutionScale);
+	settings->governor_resolution_step = std::stof (resolutionStep);
+	settings->governor_min_quality = std::stof (minQuality);
+	settings->governor_quality_step = std::stof (qualityStep);
 }
 
 void RenderSettingsLoader::ProcessSSAO (TiXmlElement* xmlElem, RenderSettings* settings)
@@ -289,6 +345,10 @@ void RenderSettingsLoader::ProcessRSM (TiXmlElement* xmlElem, RenderSettings* se
 	std::string interpolationScale = xmlElem->Attribute ("interpolationScale");
 	std::string minInterpolationDistance = xmlElem->Attribute ("minInterpolationDistance");
 	std::string minInterpolationAngle = xmlElem->Attribute ("minInterpolationAngle");
+	std::string interleavedSampling = xmlElem->Attribute ("interleavedSampling");
+	std::string interleaveSize = xmlElem->Attribute ("interleaveSize");
+	std::string historyMaxDistance = xmlElem->Attribute ("historyMaxDistance");
+	std::string historyMinAngle = xmlElem->Attribute ("historyMinAngle");
 
 	settings->rsm_scale = std::stof (scale);
 	settings->rsm_samples = std::stoi (samples);
@@ -304,6 +364,10 @@ void RenderSettingsLoader::ProcessRSM (TiXmlElement* xmlElem, RenderSettings* se
 	settings->rsm_interpolation_scale = std::stof (interpolationScale);
 	settings->rsm_min_interpolation_distance = std::stof (minInterpolationDistance);
 	settings->rsm_min_interpolation_angle = std::stof (minInterpolationAngle);
+	settings->rsm_interleaved_sampling = Extensions::StringExtend::ToBool (interleavedSampling);
+	settings->rsm_interleave_size = std::stoi (interleaveSize);
+	settings->rsm_history_max_distance = std::stof (historyMaxDistance);
+	settings->rsm_history_min_angle = std::stof (historyMinAngle);
 }
 
 void RenderSettingsLoader::ProcessTRSM (TiXmlElement* xmlElem, RenderSettings* settings)
@@ -325,6 +389,11 @@ void RenderSettingsLoader::ProcessLPV (TiXmlElement* xmlElem, RenderSettings* se
 	std::string iterations = xmlElem->Attribute ("iterations");
 	std::string injectionBias = xmlElem->Attribute ("injectionBias");
 	std::string geometryOcclusion = xmlElem->Attribute ("geometryOcclusion");
+	std::string propagationCache = xmlElem->Attribute ("propagationCache");
+	std::string propagationBudget = xmlElem->Attribute ("propagationBudget");
+	std::string cascadesEnabled = xmlElem->Attribute ("cascadesEnabled");
+	std::string cascades = xmlElem->Attribute ("cascades");
+	std::string cascadeCellSize = xmlElem->Attribute ("cascadeCellSize");
 	std::string indirectDiffuseIntensity = xmlElem->Attribute ("indirectDiffuseIntensity");
 	std::string indirectSpecularIntensity = xmlElem->Attribute ("indirectSpecularIntensity");
 	std::string indirectRefractiveIntensity = xmlElem->Attribute ("indirectRefractiveIntensity");
@@ -339,6 +408,11 @@ void RenderSettingsLoader::ProcessLPV (TiXmlElement* xmlElem, RenderSettings* se
 	settings->lpv_iterations = std::stoi (iterations);
 	settings->lpv_injection_bias = std::stof (injectionBias);
 	settings->lpv_geometry_occlusion = Extensions::StringExtend::ToBool (geometryOcclusion);
+	settings->lpv_propagation_cache = Extensions::StringExtend::ToBool (propagationCache);
+	settings->lpv_propagation_budget = std::stoi (propagationBudget);
+	settings->lpv_cascades_enabled = Extensions::StringExtend::ToBool (cascadesEnabled);
+	settings->lpv_cascades_count = std::stoi (cascades);
+	settings->lpv_cascade_cell_size = std::stof (cascadeCellSize);
 	settings->lpv_indirect_diffuse_intensity = std::stof (indirectDiffuseIntensity);
 	settings->lpv_indirect_specular_intensity = std::stof (indirectSpecularIntensity);
 	settings->lpv_indirect_refractive_intensity = std::stof (indirectRefractiveIntensity);
@@ -354,8 +428,12 @@ void RenderSettingsLoader::ProcessVCT (TiXmlElement* xmlElem, RenderSettings* se
 {
 	std::string voxelsSize = xmlElem->Attribute ("voxelsSize");
 	std::string continuousVoxelization = xmlElem->Attribute ("continuousVoxelization");
+	std::string incrementalVoxelization = xmlElem->Attribute ("incrementalVoxelization");
 	std::string bordering = xmlElem->Attribute ("bordering");
 	std::string mipmapLevels = xmlElem->Attribute ("mipmapLevels");
+	std::string clipmapEnabled = xmlElem->Attribute ("clipmapEnabled");
+	std::string clipmapLevels = xmlElem->Attribute ("clipmapLevels");
+	std::string clipmapVoxelSize = xmlElem->Attribute ("clipmapVoxelSize");
 	std::string indirectDiffuseIntensity = xmlElem->Attribute ("indirectDiffuseIntensity");
 	std::string indirectSpecularIntensity = xmlElem->Attribute ("indirectSpecularIntensity");
 	std::string refractiveIndirectIntensity = xmlElem->Attribute ("refractiveIndirectIntensity");
@@ -377,8 +455,12 @@ void RenderSettingsLoader::ProcessVCT (TiXmlElement* xmlElem, RenderSettings* se
 
 	settings->vct_voxels_size = std::stoi (voxelsSize);
 	settings->vct_continuous_voxelization = Extensions::StringExtend::ToBool (continuousVoxelization);
+	settings->vct_incremental_voxelization = Extensions::StringExtend::ToBool (incrementalVoxelization);
 	settings->vct_bordering = Extensions::StringExtend::ToBool (bordering);
 	settings->vct_mipmap_levels = std::stoi (mipmapLevels);
+	settings->vct_clipmap_enabled = Extensions::StringExtend::ToBool (clipmapEnabled);
+	settings->vct_clipmap_levels = std::stoi (clipmapLevels);
+	settings->vct_clipmap_voxel_size = std::stof (clipmapVoxelSize);
 	settings->vct_indirect_diffuse_intensity = std::stof (indirectDiffuseIntensity);
 	settings->vct_indirect_specular_intensity = std::stof (indirectSpecularIntensity);
 	settings->vct_indirect_refractive_intensity = std::stof (refractiveIndirectIntensity);
@@ -14,6 +14,9 @@ public:
 protected:
 	void ProcessRenderMode (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessGeneral (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessLOD (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessShadows (TiXmlElement* xmlElem, RenderSettings* settings);
+	void ProcessGovernor (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSAO (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSDO (TiXmlElement* xmlElem, RenderSettings* settings);
 	void ProcessSSR (TiXmlElement* xmlElem, RenderSettings* settings);
@@ -0,0 +1,58 @@
+#include "ShaderBinaryLoader.h"
+
+#include <cstring>
+
+#include "Utils/Files/MappedFile.h"
+
+#include "Core/Console/Console.h"
+
+void ShaderBinaryLoader::SetHeader (const ShaderBinaryHeader& header)
+{
+	_header = header;
+}
+
+Object* ShaderBinaryLoader::Load (const std::string& filename)
+{
+	MappedFile file;
+
+	if (!file.Open (filename)) {
+		return nullptr;
+	}
+
+	const unsigned char* current = file.GetData ();
+	std::size_t remaining = file.GetSize ();
+
+	ShaderBinaryHeader header;
+
+	if (remaining < sizeof (ShaderBinaryHeader)) {
+		return nullptr;
+	}
+
+	std::memcpy (&header, current, sizeof (ShaderBinaryHeader));
+
+	current += sizeof (ShaderBinaryHeader);
+	remaining -= sizeof (ShaderBinaryHeader);
+
+	if (!(header == _header)) {
+		return nullptr;
+	}
+
+	std::uint32_t format = 0;
+
+	if (remaining <= sizeof (std::uint32_t)) {
+		Console::LogWarning ("Program binary \"" + filename + "\" is corrupted. It will be compiled again.");
+		return nullptr;
+	}
+
+	std::memcpy (&format, current, sizeof (std::uint32_t));
+
+	current += sizeof (std::uint32_t);
+	remaining -= sizeof (std::uint32_t);
+
+	ShaderBinary* shaderBinary = new ShaderBinary ();
+
+	shaderBinary->SetFormat (format);
+	shaderBinary->SetData (current, remaining);
+
+	return shaderBinary;
+}
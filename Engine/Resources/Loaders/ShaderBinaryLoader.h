@@ -0,0 +1,26 @@
+#ifndef SHADERBINARYLOADER_H
+#define SHADERBINARYLOADER_H
+
+#include "Resources/ResourceLoader.h"
+
+#include <string>
+
+#include "Renderer/Render/Shader/ShaderBinary.h"
+
+/*
+ * Returns nullptr when the program binary is missing, truncated or was
+ * built from other sources, so that the caller compiles it again.
+*/
+
+class ShaderBinaryLoader : public ResourceLoader
+{
+protected:
+	ShaderBinaryHeader _header;
+
+public:
+	void SetHeader (const ShaderBinaryHeader& header);
+
+	Object* Load (const std::string& filename);
+};
+
+#endif
@@ -52,7 +52,7 @@ Object* TextureLoader::Load(const std::string& filename)
 		SDL_LockSurface (surface2);
 	}
 
-	Console::Log (filename + " image was successully loaded!");
+	Console::Log ("{} image was successully loaded!", filename);
 
 	Texture* texture = new Texture(filename);
 	texture->SetSize (Size (surface2->w, surface2->h));
@@ -7,6 +7,9 @@
 #endif
 
 #include "Audio/AudioClip.h"
+#include "Audio/Decoders/WAVFileDecoder.h"
+
+#include "Systems/Settings/SettingsManager.h"
 
 #include "Core/Console/Console.h"
 
@@ -14,6 +17,28 @@ Object* WAVLoader::Load(const std::string& filename)
 {
 	AudioClip* audioClip = new AudioClip ();
 
+	audioClip->SetName (filename);
+
+	/*
+	 * Long uncompressed clips are not loaded, their samples are streamed
+	 * from the file while they play
+	*/
+
+	float streamMinDuration = SettingsManager::Instance ()->GetValue<float> ("Audio", "stream_min_duration", 10.0f);
+
+	WAVFileDecoder decoder;
+
+	if (decoder.Open (filename) == true) {
+		float duration = (float) decoder.GetSize () / decoder.GetFormat ().GetBytesPerSecond ();
+
+		if (duration >= streamMinDuration) {
+			audioClip->SetFormat (decoder.GetFormat ());
+			audioClip->SetStreamed (decoder.GetSize ());
+
+			return audioClip;
+		}
+	}
+
 	SDL_AudioSpec spec;
 	unsigned int size;
 	unsigned char* buffer;
@@ -23,8 +48,14 @@ Object* WAVLoader::Load(const std::string& filename)
 		exit (0);
 	}
 
-	audioClip->SetName (filename);
+	AudioFormat format;
+
+	format.channels = spec.channels;
+	format.bitsPerSample = SDL_AUDIO_BITSIZE (spec.format);
+	format.sampleRate = spec.freq;
+
 	audioClip->SetData (buffer, size, spec.freq);
+	audioClip->SetFormat (format);
 
 	return audioClip;
 }
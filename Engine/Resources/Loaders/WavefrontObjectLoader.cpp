@@ -118,7 +118,7 @@ void WavefrontObjectLoader::LoadMaterialLibrary(std::ifstream& file, Resource<Ma
 	std::string fullMtlFilename = FileSystem::GetDirectory(filename) + mtlfilename;
 	fullMtlFilename = FileSystem::FormatFilename (fullMtlFilename);
 
-	Console::Log ("Material name: " + mtlfilename);
+	Console::Log ("Material name: {}", mtlfilename);
 
 	model->SetMaterialLibrary (fullMtlFilename);
 
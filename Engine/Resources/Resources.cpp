@@ -1,8 +1,20 @@
 #include "Resources.h"
 
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
 #include "Core/Console/Console.h"
 
 #include "Utils/Files/FileSystem.h"
+#include "Utils/Simplification/Simplification.h"
+#include "Utils/Compression/TextureCooking.h"
+#include "Utils/Compression/BlockCompression.h"
+
+#include "Renderer/RenderSystem.h"
+
+#include "Systems/Settings/SettingsManager.h"
 
 /*
  * Load
@@ -12,16 +24,20 @@
 #include "Loaders/RenderSettingsLoader.h"
 #include "Loaders/WavefrontObjectLoader.h"
 #include "Loaders/StanfordObjectLoader.h"
+#include "Loaders/CookedModelLoader.h"
 #include "Loaders/GenericObjectModelLoader.h"
 #include "Loaders/AnimationModelLoader.h"
+#include "Loaders/LightMapModelLoader.h"
 #include "Loaders/AnimationSkinLoader.h"
 #include "Loaders/AnimationClipLoader.h"
 #include "Loaders/WAVLoader.h"
 #include "Loaders/ShaderLoader.h"
 #include "Loaders/ComputeShaderLoader.h"
 #include "Loaders/ShaderContentLoader.h"
+#include "Loaders/ShaderBinaryLoader.h"
 #include "Loaders/MaterialLibraryLoader.h"
 #include "Loaders/TextureLoader.h"
+#include "Loaders/CookedTextureLoader.h"
 #include "Loaders/TextureAtlasLoader.h"
 #include "Loaders/CubeMapLoader.h"
 #include "Loaders/ParticleSystemLoader.h"
@@ -34,6 +50,10 @@
 
 #include "Savers/PNGSaver.h"
 #include "Savers/SettingsSaver.h"
+#include "Savers/CookedModelSaver.h"
+#include "Savers/LightMapModelSaver.h"
+#include "Savers/CookedTextureSaver.h"
+#include "Savers/ShaderBinarySaver.h"
 
 /*
  * Load
@@ -69,6 +89,52 @@ Resource<Model> Resources::LoadModel (const std::string& filename)
 		return Resource<Model>::GetResource (filename);
 	}
 
+	/*
+	 * Baked models are already final, they keep the geometry they were
+	 * baked with
+	*/
+
+	if (extension == ".lmdl") {
+		return Resource<Model> (LoadLightMapModel (filename), filename);
+	}
+
+	auto startTime = std::chrono::high_resolution_clock::now ();
+
+	std::size_t lodLevels = SettingsManager::Instance ()->GetValue<int> ("Resources", "lod_levels", 4);
+	float lodReduction = SettingsManager::Instance ()->GetValue<float> ("Resources", "lod_reduction", 0.5f);
+	std::size_t lodMinPolygons = SettingsManager::Instance ()->GetValue<int> ("Resources", "lod_min_polygons", 512);
+
+	/*
+	 * Cooked models skip parsing, simplification and building the streams
+	*/
+
+	bool cookModels = SettingsManager::Instance ()->GetValue<bool> ("Resources", "cook_models", true);
+
+	CookedModelHeader cookedHeader;
+	std::string cookedFilename;
+
+	if (cookModels && extension == ".obj") {
+		cookedHeader.sourceHash = FileSystem::GetFileHash (filename);
+		cookedHeader.lodLevels = lodLevels;
+		cookedHeader.lodReduction = lodReduction;
+		cookedHeader.lodMinPolygons = lodMinPolygons;
+		cookedHeader.vertexStride = sizeof (NormalMapVertexData);
+
+		cookedFilename = GetCookedFilename (cookedHeader.sourceHash, ".cmdl");
+
+		Model* cookedModel = LoadCookedModel (cookedFilename, cookedHeader);
+
+		if (cookedModel != nullptr && cookedModel->GetName () == filename) {
+			std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+			Console::Log ("Model \"{}\" loaded from cooked file in {} ms", filename, loadTime.count ());
+
+			return Resource<Model> (cookedModel, filename);
+		}
+
+		delete cookedModel;
+	}
+
 	Model* mesh = nullptr;
 
 	if (extension == ".obj") {
@@ -80,9 +146,62 @@ Resource<Model> Resources::LoadModel (const std::string& filename)
 		mesh = LoadGenericModel (filename);
 	}
 
+	if (mesh == nullptr) {
+		return nullptr;
+	}
+
+	/*
+	 * Generate levels of detail at import time
+	*/
+
+	if (lodLevels > 1) {
+		Simplification::QuadricEdgeCollapse (mesh, lodLevels, lodReduction, lodMinPolygons);
+	}
+
+	std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+	Console::Log ("Model \"{}\" imported from source in {} ms", filename, loadTime.count ());
+
+	if (!cookedFilename.empty () && cookedHeader.sourceHash != 0) {
+		SaveCookedModel (mesh, cookedFilename, cookedHeader);
+	}
+
 	return Resource<Model> (mesh, filename);
 }
 
+Model* Resources::LoadCookedModel (const std::string& filename, const CookedModelHeader& header)
+{
+	CookedModelLoader* cookedModelLoader = new CookedModelLoader ();
+	cookedModelLoader->SetHeader (header);
+
+	Model* model = (Model*) cookedModelLoader->Load (filename);
+
+	delete cookedModelLoader;
+
+	return model;
+}
+
+std::string Resources::GetCookedFilename (std::uint64_t sourceHash, const std::string& extension)
+{
+	std::string cachePath = SettingsManager::Instance ()->GetValue<std::string> ("Resources", "cache_path", "Cache/");
+
+	std::stringstream cookedFilename;
+	cookedFilename << cachePath << std::hex << std::setw (16) << std::setfill ('0') << sourceHash << extension;
+
+	return cookedFilename.str ();
+}
+
+Model* Resources::LoadLightMapModel (const std::string& filename)
+{
+	LightMapModelLoader* lightMapModelLoader = new LightMapModelLoader ();
+
+	Model* model = (Model*) lightMapModelLoader->Load (filename);
+
+	delete lightMapModelLoader;
+
+	return model;
+}
+
 Model* Resources::LoadWavefrontModel(const std::string& filename)
 {
 	WavefrontObjectLoader* wavefrontObjectLoader = new WavefrontObjectLoader();
@@ -232,19 +351,124 @@ Resource<ShaderContent> Resources::LoadShaderContent (const std::string& filenam
 	return Resource<ShaderContent> (shaderContent, filename);
 }
 
-Resource<Texture> Resources::LoadTexture(const std::string& filename)
+ShaderBinary* Resources::LoadShaderBinary (const ShaderBinaryHeader& header)
+{
+	std::string filename = GetCookedFilename (header.sourceHash, ".cprog");
+
+	ShaderBinaryLoader* shaderBinaryLoader = new ShaderBinaryLoader ();
+	shaderBinaryLoader->SetHeader (header);
+
+	ShaderBinary* shaderBinary = (ShaderBinary*) shaderBinaryLoader->Load (filename);
+
+	delete shaderBinaryLoader;
+
+	return shaderBinary;
+}
+
+Resource<Texture> Resources::LoadTexture (const std::string& filename, TEXTURE_COOK_MODE cookMode)
 {
 	if (Resource<Texture>::GetResource (filename) != nullptr) {
 		return Resource<Texture>::GetResource (filename);
 	}
 
+	auto startTime = std::chrono::high_resolution_clock::now ();
+
+	/*
+	 * Cooked textures skip decoding, mipmap generation and compression
+	*/
+
+	bool cookTextures = SettingsManager::Instance ()->GetValue<bool> ("Resources", "cook_textures", true);
+
+	CookedTextureHeader cookedHeader;
+	std::string cookedFilename;
+
+	if (cookTextures && cookMode != COOK_NONE) {
+		cookedHeader.sourceHash = FileSystem::GetFileHash (filename);
+		cookedHeader.cookMode = cookMode;
+		cookedHeader.compressionType = GetTextureCompressionType ();
+
+		cookedFilename = GetCookedFilename (cookedHeader.sourceHash + cookMode, ".ctex");
+
+		Texture* cookedTexture = LoadCookedTexture (cookedFilename, cookedHeader);
+
+		if (cookedTexture != nullptr) {
+			cookedTexture->SetName (filename);
+
+			std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+			Console::Log ("Texture \"{}\" loaded from cooked file in {} ms", filename, loadTime.count ());
+
+			return Resource<Texture> (cookedTexture, filename);
+		}
+	}
+
 	TextureLoader* textureLoader = new TextureLoader();
 
 	Texture* texture = (Texture*) textureLoader->Load(filename);
 
 	delete textureLoader;
 
-	return Resource<Texture> (texture, filename);
+	if (cookedFilename.empty () || cookedHeader.sourceHash == 0) {
+		return Resource<Texture> (texture, filename);
+	}
+
+	/*
+	 * Compare against the RGBA8 texture with a full mip chain, which is
+	 * what the driver would allocate for the raw image
+	*/
+
+	Texture* cookedTexture = TextureCooking::Cook (texture, cookMode, (TEXTURE_COMPRESSION_TYPE) cookedHeader.compressionType);
+
+	Size size = texture->GetSize ();
+
+	std::size_t rawSize = size.width * size.height * 4 * 4 / 3;
+	std::size_t cookedSize = 0;
+
+	for (std::size_t level = 0; level < cookedTexture->GetMipMapLevels (); level ++) {
+		std::size_t width = std::max<std::size_t> (1, size.width >> level);
+		std::size_t height = std::max<std::size_t> (1, size.height >> level);
+
+		cookedSize += cookedTexture->GetCompressionType () == COMPRESS_NONE ? width * height * 4 :
+			BlockCompression::GetCompressedSize (width, height, cookedTexture->GetCompressionType ());
+	}
+
+	delete texture;
+
+	std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+	Console::Log ("Texture \"{}\" cooked in {} ms, {} KB raw, {} KB cooked", filename,
+		loadTime.count (), rawSize / 1024, cookedSize / 1024);
+
+	SaveCookedTexture (cookedTexture, cookedFilename, cookedHeader);
+
+	return Resource<Texture> (cookedTexture, filename);
+}
+
+Texture* Resources::LoadCookedTexture (const std::string& filename, const CookedTextureHeader& header)
+{
+	CookedTextureLoader* cookedTextureLoader = new CookedTextureLoader ();
+	cookedTextureLoader->SetHeader (header);
+
+	Texture* texture = (Texture*) cookedTextureLoader->Load (filename);
+
+	delete cookedTextureLoader;
+
+	return texture;
+}
+
+TEXTURE_COMPRESSION_TYPE Resources::GetTextureCompressionType ()
+{
+	std::string compression = SettingsManager::Instance ()->GetValue<std::string> ("Resources", "texture_compression", "bc7");
+
+	if (compression == "bc7") {
+		return COMPRESS_BC7;
+	}
+
+	if (compression == "bc1") {
+		return COMPRESS_BC1;
+	}
+
+	return COMPRESS_NONE;
 }
 
 Resource<Texture> Resources::LoadCubemap (const std::vector<std::string>& filename)
@@ -356,6 +580,41 @@ bool Resources::SavePNG (const Resource<Texture>& texture, const std::string& fi
 	return saveResult;
 }
 
+bool Resources::SaveLightMapModel (const Resource<Model>& model, const std::string& filename)
+{
+	LightMapModelSaver* lightMapModelSaver = new LightMapModelSaver ();
+
+	bool saveResult = lightMapModelSaver->Save (&*model, filename);
+
+	delete lightMapModelSaver;
+
+	return saveResult;
+}
+
+bool Resources::SaveCookedModel (const Model* model, const std::string& filename, const CookedModelHeader& header)
+{
+	CookedModelSaver* cookedModelSaver = new CookedModelSaver ();
+	cookedModelSaver->SetHeader (header);
+
+	bool saveResult = cookedModelSaver->Save (model, filename);
+
+	delete cookedModelSaver;
+
+	return saveResult;
+}
+
+bool Resources::SaveCookedTexture (const Texture* texture, const std::string& filename, const CookedTextureHeader& header)
+{
+	CookedTextureSaver* cookedTextureSaver = new CookedTextureSaver ();
+	cookedTextureSaver->SetHeader (header);
+
+	bool saveResult = cookedTextureSaver->Save (texture, filename);
+
+	delete cookedTextureSaver;
+
+	return saveResult;
+}
+
 bool Resources::SaveSettings (SettingsContainer* settingsContainer, const std::string& filename)
 {
 	SettingsSaver* settingsSaver = new SettingsSaver ();
@@ -367,6 +626,31 @@ bool Resources::SaveSettings (SettingsContainer* settingsContainer, const std::s
 	return saveResult;
 }
 
+bool Resources::SaveShaderBinary (const ShaderBinary* shaderBinary, const ShaderBinaryHeader& header)
+{
+	std::string filename = GetCookedFilename (header.sourceHash, ".cprog");
+
+	ShaderBinarySaver* shaderBinarySaver = new ShaderBinarySaver ();
+	shaderBinarySaver->SetHeader (header);
+
+	bool saveResult = shaderBinarySaver->Save (shaderBinary, filename);
+
+	delete shaderBinarySaver;
+
+	return saveResult;
+}
+
+/*
+ * Remove
+*/
+
+bool Resources::RemoveShaderBinary (const ShaderBinaryHeader& header)
+{
+	std::string filename = GetCookedFilename (header.sourceHash, ".cprog");
+
+	return std::remove (filename.c_str ()) == 0;
+}
+
 // bool SortingMethod (Polygon* a, Polygon* b) { return (a->matName < b->matName); }
 
 // int Resources::SaveModel(Model * model, char *filename)
@@ -9,13 +9,16 @@
 #include "Core/Settings/SettingsContainer.h"
 #include "Renderer/RenderSettings.h"
 #include "Renderer/Render/Mesh/Model.h"
+#include "Renderer/Render/Mesh/CookedModel.h"
 #include "Renderer/Render/Mesh/AnimationModel.h"
 #include "Renderer/Render/Mesh/AnimationContainer.h"
 #include "Audio/AudioClip.h"
 #include "Renderer/Render/Shader/Shader.h"
 #include "Renderer/Render/Shader/ShaderContent.h"
+#include "Renderer/Render/Shader/ShaderBinary.h"
 #include "Renderer/Render/Material/MaterialLibrary.h"
 #include "Renderer/Render/Texture/Texture.h"
+#include "Renderer/Render/Texture/CookedTexture.h"
 #include "Renderer/Render/Texture/TextureAtlas.h"
 #include "Renderer/Render/Texture/CubeMap.h"
 #include "VisualEffects/ParticleSystem/ParticleSystem.h"
@@ -43,8 +46,9 @@ public:
 	static Resource<Shader> LoadShader (const std::vector<std::string>& filenames);
 	static Resource<Shader> LoadComputeShader (const std::string& filename);
 	static Resource<ShaderContent> LoadShaderContent (const std::string& filename);
+	static ShaderBinary* LoadShaderBinary (const ShaderBinaryHeader& header);
 	
-	static Resource<Texture> LoadTexture (const std::string& filename);
+	static Resource<Texture> LoadTexture (const std::string& filename, TEXTURE_COOK_MODE cookMode = COOK_NONE);
 	static Resource<Texture> LoadTextureAtlas (const std::string& filename);
 	static Resource<Texture> LoadCubemap (const std::vector<std::string>& filenames);
 
@@ -59,7 +63,17 @@ public:
 	*/
 
 	static bool SaveTexture (const Resource<Texture>& texture, const std::string& filename);
+	static bool SaveLightMapModel (const Resource<Model>& model, const std::string& filename);
 	static bool SaveSettings (SettingsContainer* settingsContainer, const std::string& filename);
+	static bool SaveShaderBinary (const ShaderBinary* shaderBinary, const ShaderBinaryHeader& header);
+
+	/*
+	 * Remove
+	*/
+
+	static bool RemoveShaderBinary (const ShaderBinaryHeader& header);
+
+	static std::string GetCookedFilename (std::uint64_t sourceHash, const std::string& extension);
 
 private:
 	/*
@@ -69,6 +83,11 @@ private:
 	static Model* LoadWavefrontModel (const std::string& filename);
 	static Model* LoadStanfordModel (const std::string& filename);
 	static Model* LoadGenericModel (const std::string& filename);
+	static Model* LoadCookedModel (const std::string& filename, const CookedModelHeader& header);
+	static Model* LoadLightMapModel (const std::string& filename);
+
+	static Texture* LoadCookedTexture (const std::string& filename, const CookedTextureHeader& header);
+	static TEXTURE_COMPRESSION_TYPE GetTextureCompressionType ();
 
 	static AudioClip* LoadWAV (const std::string& filename);
 
@@ -77,6 +96,8 @@ private:
 	*/
 
 	static bool SavePNG (const Resource<Texture>& texture, const std::string& filename);
+	static bool SaveCookedModel (const Model* model, const std::string& filename, const CookedModelHeader& header);
+	static bool SaveCookedTexture (const Texture* texture, const std::string& filename, const CookedTextureHeader& header);
 
 //	static int SaveWavefrontModel (Model* model, char* filename);
 //	static int SaveStanfordModel (Model* model, char* filename);
@@ -0,0 +1,203 @@
+#include "CookedModelSaver.h"
+
+#include <filesystem>
+#include <cstdint>
+#include <vector>
+
+#include "Renderer/RenderSystem.h"
+
+#include "Core/Console/Console.h"
+
+void CookedModelSaver::SetHeader (const CookedModelHeader& header)
+{
+	_header = header;
+}
+
+bool CookedModelSaver::Save (const Object* object, const std::string& filename)
+{
+	const Model* model = dynamic_cast<const Model*> (object);
+
+	if (model == nullptr) {
+		Console::LogError ("Could not save \"" + filename + "\" cooked model!");
+		return false;
+	}
+
+	/*
+	 * Build the final streams the same way they are built at upload
+	*/
+
+	std::vector<NormalMapVertexData> vertexBuffer;
+	std::vector<unsigned int> indexBuffer;
+	std::vector<CookedLevelOfDetail> levelsOfDetail;
+
+	RenderSystem::CookNormalMapModel (model, vertexBuffer, indexBuffer, levelsOfDetail);
+
+	/*
+	 * Write in a temporary file first, so that an interrupted save never
+	 * leaves a truncated cooked model behind
+	*/
+
+	std::filesystem::path path (filename);
+	std::filesystem::path temporaryPath (filename + ".tmp");
+
+	std::error_code error;
+
+	if (path.has_parent_path ()) {
+		std::filesystem::create_directories (path.parent_path (), error);
+	}
+
+	std::ofstream file (temporaryPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not save \"" + filename + "\" cooked model!");
+		return false;
+	}
+
+	Write (file, &_header, sizeof (CookedModelHeader));
+
+	/*
+	 * Source geometry
+	*/
+
+	WriteString (file, model->GetName ());
+	WriteString (file, model->GetMaterialLibrary ());
+
+	WriteCount (file, model->VertexCount ());
+	for (std::size_t i=0;i<model->VertexCount ();i++) {
+		glm::vec3 vertex = model->GetVertex (i);
+		Write (file, &vertex, sizeof (glm::vec3));
+	}
+
+	WriteCount (file, model->NormalsCount ());
+	for (std::size_t i=0;i<model->NormalsCount ();i++) {
+		glm::vec3 normal = model->GetNormal (i);
+		Write (file, &normal, sizeof (glm::vec3));
+	}
+
+	WriteCount (file, model->TexcoordsCount ());
+	for (std::size_t i=0;i<model->TexcoordsCount ();i++) {
+		glm::vec2 texcoord = model->GetTexcoord (i);
+		Write (file, &texcoord, sizeof (glm::vec2));
+	}
+
+	WriteCount (file, model->ObjectsCount ());
+
+	for_each_type (ObjectModel*, objModel, *model) {
+		WriteString (file, objModel->GetName ());
+
+		std::vector<PolygonGroup*> polyGroups (objModel->begin (), objModel->end ());
+
+		WriteCount (file, polyGroups.size ());
+
+		for (PolygonGroup* polyGroup : polyGroups) {
+			Resource<Material> material = polyGroup->GetMaterial ();
+
+			WriteString (file, polyGroup->GetName ());
+			WriteString (file, material != nullptr ? material->name : "");
+
+			std::vector<Polygon*> polygons (polyGroup->begin (), polyGroup->end ());
+
+			WriteCount (file, polygons.size ());
+
+			for (Polygon* polygon : polygons) {
+				std::uint8_t polygonInfo [3] = {
+					(std::uint8_t) polygon->VertexCount (),
+					(std::uint8_t) polygon->HaveNormals (),
+					(std::uint8_t) polygon->HaveUV ()
+				};
+
+				Write (file, polygonInfo, sizeof (polygonInfo));
+
+				for (std::size_t j=0;j<polygon->VertexCount ();j++) {
+					std::int32_t indices [3] = {
+						polygon->GetVertex (j),
+						polygon->HaveNormals () ? polygon->GetNormal (j) : 0,
+						polygon->GetTexcoord (j)
+					};
+
+					Write (file, indices, sizeof (indices));
+				}
+			}
+		}
+	}
+
+	/*
+	 * Levels of detail as ranges in the index stream
+	*/
+
+	WriteCount (file, levelsOfDetail.size ());
+
+	for (const CookedLevelOfDetail& levelOfDetail : levelsOfDetail) {
+		Write (file, &levelOfDetail.geometricError, sizeof (float));
+
+		WriteCount (file, levelOfDetail.groups.size ());
+
+		for (const CookedGroup& group : levelOfDetail.groups) {
+			WriteString (file, group.material != nullptr ? group.material->name : "");
+			WriteCount (file, group.offset);
+			WriteCount (file, group.INDEX_COUNT);
+		}
+	}
+
+	/*
+	 * Streams are aligned, so they can be uploaded directly from the mapping
+	*/
+
+	WriteCount (file, vertexBuffer.size ());
+	WriteCount (file, indexBuffer.size ());
+
+	Align (file);
+	Write (file, vertexBuffer.data (), vertexBuffer.size () * sizeof (NormalMapVertexData));
+
+	Align (file);
+	Write (file, indexBuffer.data (), indexBuffer.size () * sizeof (unsigned int));
+
+	file.close ();
+
+	if (file.fail ()) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked model!");
+		return false;
+	}
+
+	std::filesystem::rename (temporaryPath, path, error);
+
+	if (error) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked model!");
+		return false;
+	}
+
+	return true;
+}
+
+void CookedModelSaver::Write (std::ofstream& file, const void* data, std::size_t size)
+{
+	file.write ((const char*) data, size);
+}
+
+void CookedModelSaver::WriteString (std::ofstream& file, const std::string& value)
+{
+	WriteCount (file, value.size ());
+	Write (file, value.data (), value.size ());
+}
+
+void CookedModelSaver::WriteCount (std::ofstream& file, std::size_t count)
+{
+	std::uint64_t value = count;
+	Write (file, &value, sizeof (std::uint64_t));
+}
+
+void CookedModelSaver::Align (std::ofstream& file)
+{
+	static const char padding [COOKED_MODEL_ALIGNMENT] = { 0 };
+
+	std::size_t position = (std::size_t) file.tellp ();
+	std::size_t remainder = position % COOKED_MODEL_ALIGNMENT;
+
+	if (remainder != 0) {
+		Write (file, padding, COOKED_MODEL_ALIGNMENT - remainder);
+	}
+}
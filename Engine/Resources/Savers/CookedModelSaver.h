@@ -0,0 +1,32 @@
+#ifndef COOKEDMODELSAVER_H
+#define COOKEDMODELSAVER_H
+
+#include "Resources/ResourceSaver.h"
+
+#include <fstream>
+#include <string>
+
+#include "Renderer/Render/Mesh/CookedModel.h"
+
+/*
+ * Writes the source geometry of a model together with its final vertex
+ * and index streams, so the next import only needs to map the file.
+*/
+
+class CookedModelSaver : public ResourceSaver
+{
+protected:
+	CookedModelHeader _header;
+
+public:
+	void SetHeader (const CookedModelHeader& header);
+
+	bool Save (const Object* object, const std::string& filename);
+protected:
+	void Write (std::ofstream& file, const void* data, std::size_t size);
+	void WriteString (std::ofstream& file, const std::string& value);
+	void WriteCount (std::ofstream& file, std::size_t count);
+	void Align (std::ofstream& file);
+};
+
+#endif
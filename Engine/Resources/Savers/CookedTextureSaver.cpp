@@ -0,0 +1,91 @@
+#include "CookedTextureSaver.h"
+
+#include <filesystem>
+#include <algorithm>
+#include <fstream>
+#include <cstdint>
+
+#include "Renderer/Render/Texture/Texture.h"
+
+#include "Utils/Compression/BlockCompression.h"
+
+#include "Core/Console/Console.h"
+
+void CookedTextureSaver::SetHeader (const CookedTextureHeader& header)
+{
+	_header = header;
+}
+
+bool CookedTextureSaver::Save (const Object* object, const std::string& filename)
+{
+	const Texture* texture = dynamic_cast<const Texture*> (object);
+
+	if (texture == nullptr) {
+		Console::LogError ("Could not save \"" + filename + "\" cooked texture!");
+		return false;
+	}
+
+	/*
+	 * Write in a temporary file first, so that an interrupted save never
+	 * leaves a truncated cooked texture behind
+	*/
+
+	std::filesystem::path path (filename);
+	std::filesystem::path temporaryPath (filename + ".tmp");
+
+	std::error_code error;
+
+	if (path.has_parent_path ()) {
+		std::filesystem::create_directories (path.parent_path (), error);
+	}
+
+	std::ofstream file (temporaryPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not save \"" + filename + "\" cooked texture!");
+		return false;
+	}
+
+	Size size = texture->GetSize ();
+
+	std::uint32_t description [4] = {
+		(std::uint32_t) texture->GetCompressionType (),
+		(std::uint32_t) size.width,
+		(std::uint32_t) size.height,
+		(std::uint32_t) texture->GetMipMapLevels ()
+	};
+
+	file.write ((const char*) &_header, sizeof (CookedTextureHeader));
+	file.write ((const char*) description, sizeof (description));
+
+	for (std::size_t level = 0; level < texture->GetMipMapLevels (); level ++) {
+		std::size_t width = std::max<std::size_t> (1, size.width >> level);
+		std::size_t height = std::max<std::size_t> (1, size.height >> level);
+
+		std::uint64_t levelSize = texture->GetCompressionType () == COMPRESS_NONE ? width * height * 4 :
+			BlockCompression::GetCompressedSize (width, height, texture->GetCompressionType ());
+
+		file.write ((const char*) &levelSize, sizeof (std::uint64_t));
+		file.write ((const char*) texture->GetMipmapLevel (level), levelSize);
+	}
+
+	file.close ();
+
+	if (file.fail ()) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked texture!");
+		return false;
+	}
+
+	std::filesystem::rename (temporaryPath, path, error);
+
+	if (error) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" cooked texture!");
+		return false;
+	}
+
+	return true;
+}
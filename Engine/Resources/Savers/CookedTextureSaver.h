@@ -0,0 +1,19 @@
+#ifndef COOKEDTEXTURESAVER_H
+#define COOKEDTEXTURESAVER_H
+
+#include "Resources/ResourceSaver.h"
+
+#include "Renderer/Render/Texture/CookedTexture.h"
+
+class CookedTextureSaver : public ResourceSaver
+{
+protected:
+	CookedTextureHeader _header;
+
+public:
+	void SetHeader (const CookedTextureHeader& header);
+
+	bool Save (const Object* object, const std::string& filename);
+};
+
+#endif
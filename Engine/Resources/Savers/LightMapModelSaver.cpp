@@ -0,0 +1,142 @@
+#include "LightMapModelSaver.h"
+
+#include <filesystem>
+#include <cstdint>
+#include <vector>
+
+#include "Core/Console/Console.h"
+
+bool LightMapModelSaver::Save (const Object* object, const std::string& filename)
+{
+	const LightMapModel* model = dynamic_cast<const LightMapModel*> (object);
+
+	if (model == nullptr) {
+		Console::LogError ("Could not save \"" + filename + "\" light map model!");
+		return false;
+	}
+
+	std::filesystem::path path (filename);
+	std::filesystem::path temporaryPath (filename + ".tmp");
+
+	std::error_code error;
+
+	if (path.has_parent_path ()) {
+		std::filesystem::create_directories (path.parent_path (), error);
+	}
+
+	std::ofstream file (temporaryPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not save \"" + filename + "\" light map model!");
+		return false;
+	}
+
+	std::uint32_t header [2] = { LIGHTMAP_MODEL_MAGIC, LIGHTMAP_MODEL_VERSION };
+
+	Write (file, header, sizeof (header));
+
+	WriteString (file, model->GetMaterialLibrary ());
+	WriteString (file, model->GetLightMap () != nullptr ? model->GetLightMap ().GetPath () : "");
+
+	WriteCount (file, model->VertexCount ());
+	for (std::size_t i=0;i<model->VertexCount ();i++) {
+		glm::vec3 vertex = model->GetVertex (i);
+		Write (file, &vertex, sizeof (glm::vec3));
+	}
+
+	WriteCount (file, model->NormalsCount ());
+	for (std::size_t i=0;i<model->NormalsCount ();i++) {
+		glm::vec3 normal = model->GetNormal (i);
+		Write (file, &normal, sizeof (glm::vec3));
+	}
+
+	/*
+	 * Light map texcoords share the indices of the texcoords
+	*/
+
+	WriteCount (file, model->TexcoordsCount ());
+	for (std::size_t i=0;i<model->TexcoordsCount ();i++) {
+		glm::vec2 texcoord = model->GetTexcoord (i);
+		glm::vec2 lmTexcoord = model->GetLightMapTexcoord (i);
+
+		Write (file, &texcoord, sizeof (glm::vec2));
+		Write (file, &lmTexcoord, sizeof (glm::vec2));
+	}
+
+	WriteCount (file, model->ObjectsCount ());
+
+	for_each_type (ObjectModel*, objModel, *model) {
+		WriteString (file, objModel->GetName ());
+
+		std::vector<PolygonGroup*> polyGroups (objModel->begin (), objModel->end ());
+
+		WriteCount (file, polyGroups.size ());
+
+		for (PolygonGroup* polyGroup : polyGroups) {
+			Resource<Material> material = polyGroup->GetMaterial ();
+
+			WriteString (file, polyGroup->GetName ());
+			WriteString (file, material != nullptr ? material->name : "");
+
+			std::vector<Polygon*> polygons (polyGroup->begin (), polyGroup->end ());
+
+			WriteCount (file, polygons.size ());
+
+			for (Polygon* polygon : polygons) {
+				std::uint8_t polygonInfo [2] = {
+					(std::uint8_t) polygon->VertexCount (),
+					(std::uint8_t) polygon->HaveNormals ()
+				};
+
+				Write (file, polygonInfo, sizeof (polygonInfo));
+
+				for (std::size_t j=0;j<polygon->VertexCount ();j++) {
+					std::int32_t indices [3] = {
+						polygon->GetVertex (j),
+						polygon->HaveNormals () ? polygon->GetNormal (j) : 0,
+						polygon->GetTexcoord (j)
+					};
+
+					Write (file, indices, sizeof (indices));
+				}
+			}
+		}
+	}
+
+	file.close ();
+
+	if (file.fail ()) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" light map model!");
+		return false;
+	}
+
+	std::filesystem::rename (temporaryPath, path, error);
+
+	if (error) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" light map model!");
+		return false;
+	}
+
+	return true;
+}
+
+void LightMapModelSaver::Write (std::ofstream& file, const void* data, std::size_t size)
+{
+	file.write ((const char*) data, size);
+}
+
+void LightMapModelSaver::WriteString (std::ofstream& file, const std::string& value)
+{
+	WriteCount (file, value.size ());
+	Write (file, value.data (), value.size ());
+}
+
+void LightMapModelSaver::WriteCount (std::ofstream& file, std::size_t count)
+{
+	std::uint64_t value = count;
+	Write (file, &value, sizeof (std::uint64_t));
+}
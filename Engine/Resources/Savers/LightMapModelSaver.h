@@ -0,0 +1,26 @@
+#ifndef LIGHTMAPMODELSAVER_H
+#define LIGHTMAPMODELSAVER_H
+
+#include "Resources/ResourceSaver.h"
+
+#include <fstream>
+#include <string>
+
+#include "Renderer/Render/Mesh/LightMapModel.h"
+
+/*
+ * Writes a baked light map model. The light map itself is saved apart as
+ * an image, only its path is kept in the model.
+*/
+
+class LightMapModelSaver : public ResourceSaver
+{
+public:
+	bool Save (const Object* object, const std::string& filename);
+protected:
+	void Write (std::ofstream& file, const void* data, std::size_t size);
+	void WriteString (std::ofstream& file, const std::string& value);
+	void WriteCount (std::ofstream& file, std::size_t count);
+};
+
+#endif
@@ -0,0 +1,69 @@
+#include "ShaderBinarySaver.h"
+
+#include <filesystem>
+#include <fstream>
+#include <cstdint>
+
+#include "Core/Console/Console.h"
+
+void ShaderBinarySaver::SetHeader (const ShaderBinaryHeader& header)
+{
+	_header = header;
+}
+
+bool ShaderBinarySaver::Save (const Object* object, const std::string& filename)
+{
+	const ShaderBinary* shaderBinary = dynamic_cast<const ShaderBinary*> (object);
+
+	if (shaderBinary == nullptr || shaderBinary->GetSize () == 0) {
+		Console::LogError ("Could not save \"" + filename + "\" program binary!");
+		return false;
+	}
+
+	/*
+	 * Write in a temporary file first, a truncated binary could still
+	 * be accepted by some drivers
+	*/
+
+	std::filesystem::path path (filename);
+	std::filesystem::path temporaryPath (filename + ".tmp");
+
+	std::error_code error;
+
+	if (path.has_parent_path ()) {
+		std::filesystem::create_directories (path.parent_path (), error);
+	}
+
+	std::ofstream file (temporaryPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open ()) {
+		Console::LogError ("Could not save \"" + filename + "\" program binary!");
+		return false;
+	}
+
+	std::uint32_t format = shaderBinary->GetFormat ();
+
+	file.write ((const char*) &_header, sizeof (ShaderBinaryHeader));
+	file.write ((const char*) &format, sizeof (std::uint32_t));
+	file.write ((const char*) shaderBinary->GetData (), shaderBinary->GetSize ());
+
+	file.close ();
+
+	if (file.fail ()) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" program binary!");
+		return false;
+	}
+
+	std::filesystem::rename (temporaryPath, path, error);
+
+	if (error) {
+		std::filesystem::remove (temporaryPath, error);
+
+		Console::LogError ("Could not save \"" + filename + "\" program binary!");
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,19 @@
+#ifndef SHADERBINARYSAVER_H
+#define SHADERBINARYSAVER_H
+
+#include "Resources/ResourceSaver.h"
+
+#include "Renderer/Render/Shader/ShaderBinary.h"
+
+class ShaderBinarySaver : public ResourceSaver
+{
+protected:
+	ShaderBinaryHeader _header;
+
+public:
+	void SetHeader (const ShaderBinaryHeader& header);
+
+	bool Save (const Object* object, const std::string& filename);
+};
+
+#endif
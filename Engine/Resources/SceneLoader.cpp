@@ -1,5 +1,7 @@
 #include "SceneLoader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 
 #include "Core/Resources/Resource.h"
@@ -11,9 +13,14 @@
 #include "Systems/Components/PersistentComponent.h"
 
 #include "Resources/Resources.h"
+#include "Resources/CookedSceneLoader.h"
+#include "Resources/CookedSceneSaver.h"
+
+#include "Systems/Settings/SettingsManager.h"
 
 #include "Utils/Extensions/StringExtend.h"
 #include "Utils/Extensions/MathExtend.h"
+#include "Utils/Files/FileSystem.h"
 
 #include "Core/Console/Console.h"
 
@@ -31,6 +38,37 @@ SceneLoader& SceneLoader::Instance ()
 
 Scene* SceneLoader::Load (const std::string& filename)
 {
+	auto startTime = std::chrono::high_resolution_clock::now ();
+
+	/*
+	 * Cooked scenes skip the XML parsing and the string dispatch of the
+	 * components
+	*/
+
+	bool cookScenes = SettingsManager::Instance ()->GetValue<bool> ("Resources", "cook_scenes", true);
+
+	CookedSceneHeader cookedHeader;
+	std::string cookedFilename;
+
+	if (cookScenes) {
+		cookedHeader.sourceHash = FileSystem::GetFileHash (filename);
+
+		cookedFilename = Resources::GetCookedFilename (cookedHeader.sourceHash, ".cscene");
+
+		Scene* cookedScene = CookedSceneLoader::Instance ().Load (cookedFilename, cookedHeader);
+
+		if (cookedScene != nullptr) {
+			cookedScene->SetPath (filename);
+
+			std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+			Console::Log ("Scene \"" + filename + "\" loaded from cooked file in " +
+				std::to_string (loadTime.count ()) + " ms");
+
+			return cookedScene;
+		}
+	}
+
 	TiXmlDocument doc;
 	if(!doc.LoadFile(filename.c_str ())) {
 		Console::LogError (filename + " has error in its syntax. Could not preceed further.");
@@ -68,11 +106,57 @@ Scene* SceneLoader::Load (const std::string& filename)
 		content = content->NextSiblingElement ();
 	}
 
+	std::chrono::duration<float, std::milli> loadTime = std::chrono::high_resolution_clock::now () - startTime;
+
+	Console::Log ("Scene \"" + filename + "\" loaded from source in " +
+		std::to_string (loadTime.count ()) + " ms");
+
+	if (!cookedFilename.empty () && cookedHeader.sourceHash != 0) {
+		CookedSceneSaver::Instance ().Save (root, cookedFilename, cookedHeader);
+	}
+
 	doc.Clear ();
 
 	return scene;
 }
 
+std::vector<std::string> SceneLoader::GetModelPaths (const std::string& filename)
+{
+	std::vector<std::string> paths;
+
+	bool cookScenes = SettingsManager::Instance ()->GetValue<bool> ("Resources", "cook_scenes", true);
+
+	if (cookScenes) {
+		CookedSceneHeader cookedHeader;
+		cookedHeader.sourceHash = FileSystem::GetFileHash (filename);
+
+		std::string cookedFilename = Resources::GetCookedFilename (cookedHeader.sourceHash, ".cscene");
+
+		paths = CookedSceneLoader::Instance ().GetModelPaths (cookedFilename, cookedHeader);
+
+		if (!paths.empty ()) {
+			return paths;
+		}
+	}
+
+	TiXmlDocument doc;
+	if(!doc.LoadFile(filename.c_str ())) {
+		return paths;
+	}
+
+	TiXmlElement* root = doc.FirstChildElement ("Scene");
+
+	if (root == NULL) {
+		return paths;
+	}
+
+	ProcessModelPaths (root, paths);
+
+	doc.Clear ();
+
+	return paths;
+}
+
 void SceneLoader::ProcessSkybox (TiXmlElement* xmlElem, Scene* scene)
 {
 	std::string skyboxPath = xmlElem->Attribute ("path");
@@ -273,3 +357,27 @@ void SceneLoader::ProcessComponent (TiXmlElement* xmlElem, SceneObject* sceneObj
 
 	sceneObject->AttachComponent (component);
 }
+
+void SceneLoader::ProcessModelPaths (TiXmlElement* xmlElem, std::vector<std::string>& paths)
+{
+	TiXmlElement* content = xmlElem->FirstChildElement ();
+
+	while (content) {
+		std::string name = content->Value ();
+		const char* path = content->Attribute ("path");
+
+		/*
+		 * Animated models are loaded through their own loader
+		*/
+
+		if (name == "model" && path != NULL && FileSystem::GetExtension (path) != ".anim") {
+			if (std::find (paths.begin (), paths.end (), path) == paths.end ()) {
+				paths.push_back (path);
+			}
+		}
+
+		ProcessModelPaths (content, paths);
+
+		content = content->NextSiblingElement ();
+	}
+}
@@ -3,6 +3,7 @@
 
 #include <glm/vec3.hpp>
 #include <string>
+#include <vector>
 
 #include "Core/Parsers/XML/TinyXml/tinyxml.h"
 
@@ -15,6 +16,8 @@ public:
 	static SceneLoader& Instance ();
 
 	Scene* Load (const std::string& filename);
+
+	std::vector<std::string> GetModelPaths (const std::string& filename);
 private:
 	SceneLoader ();
 
@@ -29,6 +32,8 @@ private:
 
 	void ProcessComponents (TiXmlElement* xmlElem, SceneObject* sceneObject);
 	void ProcessComponent (TiXmlElement* xmlElem, SceneObject* sceneObject);
+
+	void ProcessModelPaths (TiXmlElement* xmlElem, std::vector<std::string>& paths);
 };
 
 #endif
\ No newline at end of file
@@ -12,7 +12,8 @@ Scene::Scene () :
 	_sceneRoot (new SceneRoot ()),
 	_name (""),
 	_skybox (nullptr),
-	_boundingBox ()
+	_boundingBox (),
+	_nextInstanceID (1)
 {
 
 }
@@ -48,6 +49,13 @@ void Scene::AttachObject (SceneObject* object)
 
 	object->OnAttachedToScene ();
 
+	/*
+	 * Loaded objects keep their instance ID, new ones are allocated after them
+	*/
+
+	_instances [object->GetInstanceID ()] = object;
+	_nextInstanceID = std::max (_nextInstanceID, object->GetInstanceID () + 1);
+
 	/*
 	 * Update scene bounding box
 	*/
@@ -77,6 +85,12 @@ SceneObject* Scene::GetObject (const std::string& name) const
 
 SceneObject* Scene::GetObject (std::size_t instanceID) const
 {
+	auto it = _instances.find (instanceID);
+
+	if (it != _instances.end () && it->second->GetInstanceID () == instanceID) {
+		return it->second;
+	}
+
 	for (SceneObject* sceneObject : *this) {
 		if (sceneObject->GetInstanceID () == instanceID) {
 			return sceneObject;
@@ -88,6 +102,11 @@ SceneObject* Scene::GetObject (std::size_t instanceID) const
 	return nullptr;
 }
 
+std::size_t Scene::AllocateInstanceID ()
+{
+	return _nextInstanceID ++;
+}
+
 const AABBVolume& Scene::GetBoundingBox () const
 {
 	return _boundingBox;
@@ -170,6 +189,11 @@ void Scene::Clear (SceneObject* object)
 	object->GetTransform ()->DetachParent ();
 	object->OnDetachedFromScene ();
 
+	auto it = _instances.find (object->GetInstanceID ());
+	if (it != _instances.end () && it->second == object) {
+		_instances.erase (it);
+	}
+
 	delete object;
 }
 
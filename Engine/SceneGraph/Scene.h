@@ -4,6 +4,7 @@
 #include "Core/Interfaces/Object.h"
 
 #include <string>
+#include <unordered_map>
 
 #include "SceneObject.h"
 #include "Skybox/Skybox.h"
@@ -26,6 +27,9 @@ protected:
 
 	std::vector<SceneObject*> _needRemoveObjects;
 
+	std::unordered_map<std::size_t, SceneObject*> _instances;
+	std::size_t _nextInstanceID;
+
 public:
 	Scene ();
 	virtual ~Scene ();
@@ -47,6 +51,8 @@ public:
 	SceneObject* GetObject (const std::string& name) const;
 	SceneObject* GetObject (std::size_t instanceID) const;
 
+	std::size_t AllocateInstanceID ();
+
 	const AABBVolume& GetBoundingBox () const;
 
 	SceneIterator begin () const;
@@ -4,6 +4,7 @@
 #include "SceneNodes/SceneLayer.h"
 
 SceneObject::SceneObject () :
+	_instanceID (0),
 	_transform (new Transform (this)),
 	_sceneLayers ((int) SceneLayer::STATIC),
 	_isActive (true)
@@ -1,6 +1,9 @@
 #include "Transform.h"
 
 #include <glm/gtx/matrix_decompose.hpp>
+#include <atomic>
+
+static std::atomic<std::size_t> _hierarchyVersion (0);
 
 Transform* Transform::Default ()
 {
@@ -9,6 +12,11 @@ Transform* Transform::Default ()
 	return defaultTransform;
 }
 
+std::size_t Transform::GetHierarchyVersion ()
+{
+	return _hierarchyVersion.load ();
+}
+
 Transform::Transform (SceneObject* sceneObject) :
 	_sceneObject (sceneObject),
 	_localPosition (0.0f),
@@ -45,6 +53,8 @@ void Transform::SetParent (Transform* parent)
 		_parent->AttachChild (this);
 	}
 
+	_hierarchyVersion ++;
+
 	_localPosition = GetLocalPosition (_position);
 	_localRotation = GetLocalRotation (_rotation);
 	_localScale = GetLocalScale (_scale);
@@ -62,6 +72,8 @@ void Transform::DetachParent ()
 
 	_parent = nullptr;
 
+	_hierarchyVersion ++;
+
 	UpdateChildren ();
 }
 
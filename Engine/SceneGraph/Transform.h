@@ -40,6 +40,12 @@ public:
 
 	static Transform* Default ();
 
+	/*
+	 * Changes every time a transform is attached to or detached from a parent
+	*/
+
+	static std::size_t GetHierarchyVersion ();
+
 	void SetParent (Transform* parent);
 	void DetachParent ();
 
@@ -8,6 +8,7 @@
 #include "Systems/Cursor/Cursor.h"
 #include "Systems/Time/Time.h"
 #include "Systems/GUI/Gizmo/Gizmo.h"
+#include "Systems/Settings/SettingsManager.h"
 
 #include "Wrappers/OpenGL/GL.h"
 
@@ -76,6 +77,14 @@ void GUI::Init ()
 	*/
 
 	io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+	/*
+	 * Limit the lines gizmos could submit every frame
+	*/
+
+	std::size_t linesBudget = SettingsManager::Instance ()->GetValue<int> ("Gizmo", "lines_budget", 65536);
+
+	Gizmo::SetLinesBudget (linesBudget);
 }
 
 void GUI::Update ()
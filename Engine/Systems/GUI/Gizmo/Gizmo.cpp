@@ -1,14 +1,31 @@
 #include "Gizmo.h"
 
+/*
+ * Zero means that the lines are not limited
+*/
+
 std::vector<GizmoLine> Gizmo::_lines;
+std::size_t Gizmo::_linesBudget (0);
+std::size_t Gizmo::_droppedLinesCount (0);
 
 void Gizmo::NewFrame ()
 {
 	_lines.clear ();
+
+	_droppedLinesCount = 0;
 }
 
 void Gizmo::DrawLine (const glm::vec3& first, const glm::vec3& last, const Color& color, bool depthTest)
 {
+	/*
+	 * Lines over the frame budget are counted but never stored
+	*/
+
+	if (_linesBudget != 0 && _lines.size () >= _linesBudget) {
+		++ _droppedLinesCount;
+		return;
+	}
+
 	GizmoLine line;
 
 	line.first = first;
@@ -23,3 +40,22 @@ const std::vector<GizmoLine>& Gizmo::GetLines ()
 {
 	return _lines;
 }
+
+void Gizmo::SetLinesBudget (std::size_t linesBudget)
+{
+	_linesBudget = linesBudget;
+
+	if (_linesBudget != 0) {
+		_lines.reserve (_linesBudget);
+	}
+}
+
+std::size_t Gizmo::GetLinesBudget ()
+{
+	return _linesBudget;
+}
+
+std::size_t Gizmo::GetDroppedLinesCount ()
+{
+	return _droppedLinesCount;
+}
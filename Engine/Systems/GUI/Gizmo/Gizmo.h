@@ -11,6 +11,8 @@ class ENGINE_API Gizmo
 {
 private:
 	static std::vector<GizmoLine> _lines;
+	static std::size_t _linesBudget;
+	static std::size_t _droppedLinesCount;
 
 public:
 	static void NewFrame ();
@@ -18,6 +20,10 @@ public:
 	static void DrawLine (const glm::vec3& first, const glm::vec3& last, const Color& color, bool depthTest = false);
 
 	static const std::vector<GizmoLine>& GetLines ();
+
+	static void SetLinesBudget (std::size_t linesBudget);
+	static std::size_t GetLinesBudget ();
+	static std::size_t GetDroppedLinesCount ();
 };
 
-#endif
\ No newline at end of file
+#endif
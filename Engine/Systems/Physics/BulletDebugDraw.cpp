@@ -2,17 +2,27 @@
 
 #include "Systems/GUI/Gizmo/Gizmo.h"
 
+BulletDebugDraw::BulletDebugDraw (int debugMode) :
+	_debugMode (debugMode)
+{
+
+}
+
 void BulletDebugDraw::drawLine (const btVector3& first,const btVector3& last, const btVector3& color)
 {
 	Gizmo::DrawLine (
 		glm::vec3 (first.x (), first.y (), first.z ()),
 		glm::vec3 (last.x (), last.y (), last.z ()),
-		Color::Green
-		// Color (color.x () * 255, color.y () * 255, color.z () * 255)
+		Color (color.x () * 255, color.y () * 255, color.z () * 255)
 	);
 }
 
+void BulletDebugDraw::setDebugMode (int debugMode)
+{
+	_debugMode = debugMode;
+}
+
 int BulletDebugDraw::getDebugMode () const
 {
-	return btIDebugDraw::DBG_DrawWireframe;
+	return _debugMode;
 }
@@ -4,7 +4,9 @@
 
 #include "BulletDebugDraw.h"
 
+#include "Managers/CameraManager.h"
 #include "Systems/Time/Time.h"
+#include "Systems/Settings/SettingsManager.h"
 
 /*
  * TODO: Change this to somewhere else
@@ -12,8 +14,43 @@
 
 #define GRAVITATIONAL_ACCELERATION 2.0f
 
+/*
+ * Draws the triangles of a concave collider that are reported by
+ * the query, so a large mesh collider is drawn only around the camera
+*/
+
+class DebugDrawTriangleCallback : public btTriangleCallback
+{
+protected:
+	btIDebugDraw* _debugDraw;
+	btTransform _worldTransform;
+	btVector3 _color;
+
+public:
+	DebugDrawTriangleCallback (btIDebugDraw* debugDraw, const btTransform& worldTransform, const btVector3& color) :
+		_debugDraw (debugDraw),
+		_worldTransform (worldTransform),
+		_color (color)
+	{
+
+	}
+
+	void processTriangle (btVector3* triangle, int partId, int triangleIndex)
+	{
+		btVector3 first = _worldTransform * triangle [0];
+		btVector3 second = _worldTransform * triangle [1];
+		btVector3 third = _worldTransform * triangle [2];
+
+		_debugDraw->drawLine (first, second, _color);
+		_debugDraw->drawLine (second, third, _color);
+		_debugDraw->drawLine (third, first, _color);
+	}
+};
+
 PhysicsManager::PhysicsManager () :
-	_dynamicsWorld (nullptr)
+	_dynamicsWorld (nullptr),
+	_debugDraw (nullptr),
+	_debugDrawDistance (0.0f)
 {
 
 }
@@ -69,10 +106,14 @@ void PhysicsManager::Init ()
 	_dynamicsWorld->setGravity (btVector3 (0.0f, -GRAVITATIONAL_ACCELERATION, 0.0f));
 
 	/*
-	 * Initialize debug mode
+	 * Initialize debug mode, only the colliders closer than the
+	 * debug distance to the camera are drawn
 	*/
 
-	_debugDraw = new BulletDebugDraw ();
+	int debugMode = SettingsManager::Instance ()->GetValue<int> ("Physics", "debug_draw_mode", btIDebugDraw::DBG_DrawWireframe);
+	_debugDrawDistance = SettingsManager::Instance ()->GetValue<float> ("Physics", "debug_draw_distance", 50.0f);
+
+	_debugDraw = new BulletDebugDraw (debugMode);
 	_dynamicsWorld->setDebugDrawer (_debugDraw);
 }
 
@@ -166,5 +207,101 @@ void PhysicsManager::Update ()
 
 	_dynamicsWorld->stepSimulation (dt);
 
-	_dynamicsWorld->debugDrawWorld ();
+	/*
+	 * Draw colliders around the camera
+	*/
+
+	DebugDraw ();
+}
+
+void PhysicsManager::SetDebugDrawMode (int debugMode)
+{
+	_debugDraw->setDebugMode (debugMode);
+}
+
+void PhysicsManager::SetDebugDrawDistance (float distance)
+{
+	_debugDrawDistance = distance;
+}
+
+void PhysicsManager::DebugDraw ()
+{
+	int debugMode = _debugDraw->getDebugMode ();
+
+	if (debugMode == btIDebugDraw::DBG_NoDebug) {
+		return;
+	}
+
+	Camera* camera = CameraManager::Instance ()->GetActive ();
+
+	if (camera == nullptr) {
+		return;
+	}
+
+	glm::vec3 position = camera->GetPosition ();
+	btVector3 cameraPosition (position.x, position.y, position.z);
+
+	if (debugMode & (btIDebugDraw::DBG_DrawWireframe | btIDebugDraw::DBG_DrawAabb)) {
+		const btCollisionObjectArray& collisionObjects = _dynamicsWorld->getCollisionObjectArray ();
+
+		for (int index = 0; index < collisionObjects.size (); index ++) {
+			DebugDrawObject (collisionObjects [index], cameraPosition);
+		}
+	}
+
+	if (debugMode & (btIDebugDraw::DBG_DrawConstraints | btIDebugDraw::DBG_DrawConstraintLimits)) {
+		for (int index = 0; index < _dynamicsWorld->getNumConstraints (); index ++) {
+			_dynamicsWorld->debugDrawConstraint (_dynamicsWorld->getConstraint (index));
+		}
+	}
+}
+
+void PhysicsManager::DebugDrawObject (const btCollisionObject* collisionObject, const btVector3& cameraPosition)
+{
+	const btTransform& worldTransform = collisionObject->getWorldTransform ();
+	const btCollisionShape* shape = collisionObject->getCollisionShape ();
+
+	btVector3 aabbMin, aabbMax;
+	shape->getAabb (worldTransform, aabbMin, aabbMax);
+
+	/*
+	 * Skip colliders whose bounding box is too far from the camera
+	*/
+
+	if (_debugDrawDistance > 0.0f) {
+		btVector3 closestPoint = cameraPosition;
+		closestPoint.setMax (aabbMin);
+		closestPoint.setMin (aabbMax);
+
+		if (closestPoint.distance2 (cameraPosition) > _debugDrawDistance * _debugDrawDistance) {
+			return;
+		}
+	}
+
+	int debugMode = _debugDraw->getDebugMode ();
+	btVector3 color (0.0f, 1.0f, 0.0f);
+
+	if (debugMode & btIDebugDraw::DBG_DrawWireframe) {
+
+		/*
+		 * Concave colliders are queried only around the camera, a box
+		 * is used since the query sphere does not depend on rotation
+		*/
+
+		if (shape->isConcave () && _debugDrawDistance > 0.0f) {
+			btVector3 localPosition = worldTransform.invXform (cameraPosition);
+			btVector3 extents (_debugDrawDistance, _debugDrawDistance, _debugDrawDistance);
+
+			DebugDrawTriangleCallback callback (_debugDraw, worldTransform, color);
+
+			((const btConcaveShape*) shape)->processAllTriangles (&callback,
+				localPosition - extents, localPosition + extents);
+		} else {
+			_dynamicsWorld->debugDrawObject (worldTransform, shape, color);
+		}
+	}
+
+	if (debugMode & btIDebugDraw::DBG_DrawAabb) {
+		_debugDraw->drawAabb (aabbMin, aabbMax, btVector3 (1.0f, 0.0f, 0.0f));
+	}
 }
@@ -20,6 +20,7 @@ private:
 	btSequentialImpulseConstraintSolver* _solver;
 	btDiscreteDynamicsWorld* _dynamicsWorld;
 	btIDebugDraw* _debugDraw;
+	float _debugDrawDistance;
 
 public:
 	void Init ();
@@ -35,8 +36,14 @@ public:
 
 	void Update ();
 
+	void SetDebugDrawMode (int debugMode);
+	void SetDebugDrawDistance (float distance);
+
 	void Clear ();
 private:
+	void DebugDraw ();
+	void DebugDrawObject (const btCollisionObject* collisionObject, const btVector3& cameraPosition);
+
 	PhysicsManager ();
 	~PhysicsManager ();
 	PhysicsManager (const PhysicsManager&);
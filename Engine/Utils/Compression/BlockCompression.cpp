@@ -0,0 +1,497 @@
+#include "BlockCompression.h"
+
+#include <glm/geometric.hpp>
+#include <glm/common.hpp>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+
+std::vector<unsigned char> BlockCompression::Compress (const unsigned char* pixels, std::size_t width,
+	std::size_t height, TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	std::size_t blockSize = GetBlockSize (compressionType);
+
+	std::size_t blocksX = (width + 3) / 4;
+	std::size_t blocksY = (height + 3) / 4;
+
+	std::vector<unsigned char> output (blocksX * blocksY * blockSize, 0);
+
+	glm::vec4 block [16];
+
+	for (std::size_t blockY = 0; blockY < blocksY; blockY ++) {
+		for (std::size_t blockX = 0; blockX < blocksX; blockX ++) {
+			FetchBlock (pixels, width, height, blockX * 4, blockY * 4, block);
+
+			unsigned char* blockOutput = &output [(blockY * blocksX + blockX) * blockSize];
+
+			switch (compressionType) {
+				case COMPRESS_BC1:
+					CompressBC1Block (block, blockOutput);
+					break;
+				case COMPRESS_BC3:
+					CompressBC3Block (block, blockOutput);
+					break;
+				case COMPRESS_BC5:
+					CompressBC5Block (block, blockOutput);
+					break;
+				case COMPRESS_BC7:
+					CompressBC7Block (block, blockOutput);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	return output;
+}
+
+std::size_t BlockCompression::GetCompressedSize (std::size_t width, std::size_t height, TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	return ((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize (compressionType);
+}
+
+std::size_t BlockCompression::GetBlockSize (TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	if (compressionType == COMPRESS_BC1 || compressionType == COMPRESS_BC4) {
+		return 8;
+	}
+
+	return 16;
+}
+
+void BlockCompression::FetchBlock (const unsigned char* pixels, std::size_t width, std::size_t height,
+	std::size_t x, std::size_t y, glm::vec4* block)
+{
+	/*
+	 * Blocks on the right and bottom borders repeat the last pixel
+	*/
+
+	for (std::size_t i=0;i<16;i++) {
+		std::size_t pixelX = std::min (x + i % 4, width - 1);
+		std::size_t pixelY = std::min (y + i / 4, height - 1);
+
+		const unsigned char* pixel = &pixels [(pixelY * width + pixelX) * 4];
+
+		block [i] = glm::vec4 (pixel [0], pixel [1], pixel [2], pixel [3]);
+	}
+}
+
+void BlockCompression::CompressBC1Block (const glm::vec4* block, unsigned char* output)
+{
+	glm::vec4 start, end;
+	GetEndpoints (block, glm::vec4 (1.0f, 1.0f, 1.0f, 0.0f), start, end);
+
+	float weights [16];
+	float error = EncodeBC1Colors (block, start, end, output, weights);
+
+	/*
+	 * Refine the endpoints once for the chosen indices
+	*/
+
+	if (FitEndpoints (block, weights, start, end)) {
+		unsigned char refined [8];
+
+		if (EncodeBC1Colors (block, start, end, refined, weights) < error) {
+			std::memcpy (output, refined, 8);
+		}
+	}
+}
+
+void BlockCompression::CompressBC3Block (const glm::vec4* block, unsigned char* output)
+{
+	float alphas [16];
+
+	for (std::size_t i=0;i<16;i++) {
+		alphas [i] = block [i].a;
+	}
+
+	CompressBC4Block (alphas, output);
+	CompressBC1Block (block, output + 8);
+}
+
+void BlockCompression::CompressBC4Block (const float* values, unsigned char* output)
+{
+	float maxValue = *std::max_element (values, values + 16);
+	float minValue = *std::min_element (values, values + 16);
+
+	unsigned char alpha0 = (unsigned char) std::round (maxValue);
+	unsigned char alpha1 = (unsigned char) std::round (minValue);
+
+	output [0] = alpha0;
+	output [1] = alpha1;
+
+	std::uint64_t indices = 0;
+
+	/*
+	 * With alpha0 > alpha1 the palette has six interpolated values,
+	 * index 0 is alpha0 and index 1 is alpha1
+	*/
+
+	if (alpha0 > alpha1) {
+		for (std::size_t i=0;i<16;i++) {
+			int step = (int) std::round ((alpha0 - values [i]) * 7.0f / (alpha0 - alpha1));
+			step = glm::clamp (step, 0, 7);
+
+			std::uint64_t index = step == 0 ? 0 : (step == 7 ? 1 : step + 1);
+
+			indices |= index << (3 * i);
+		}
+	}
+
+	for (std::size_t i=0;i<6;i++) {
+		output [2 + i] = (unsigned char) ((indices >> (8 * i)) & 0xFF);
+	}
+}
+
+void BlockCompression::CompressBC5Block (const glm::vec4* block, unsigned char* output)
+{
+	float reds [16];
+	float greens [16];
+
+	for (std::size_t i=0;i<16;i++) {
+		reds [i] = block [i].r;
+		greens [i] = block [i].g;
+	}
+
+	CompressBC4Block (reds, output);
+	CompressBC4Block (greens, output + 8);
+}
+
+void BlockCompression::CompressBC7Block (const glm::vec4* block, unsigned char* output)
+{
+	static const float bc7Weights [16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	glm::vec4 start, end;
+	GetEndpoints (block, glm::vec4 (1.0f), start, end);
+
+	glm::ivec4 bestEndpoints [2] = { glm::ivec4 (0), glm::ivec4 (0) };
+	unsigned int bestPBits [2] = { 0, 0 };
+	unsigned char bestIndices [16] = { 0 };
+	float bestError = std::numeric_limits<float>::max ();
+
+	for (std::size_t iteration = 0; iteration < 2; iteration ++) {
+		glm::ivec4 endpoints [2];
+		unsigned int pbits [2];
+
+		QuantizeBC7Endpoint (start, endpoints [0], pbits [0]);
+		QuantizeBC7Endpoint (end, endpoints [1], pbits [1]);
+
+		unsigned char indices [16];
+
+		float error = GetBC7Indices (block, endpoints [0] * 2 + (int) pbits [0],
+			endpoints [1] * 2 + (int) pbits [1], indices);
+
+		/*
+		 * The first candidate is always kept, a block with NaN texels
+		 * never compares below the best error
+		*/
+
+		if (iteration == 0 || error < bestError) {
+			bestError = error;
+
+			for (std::size_t k=0;k<2;k++) {
+				bestEndpoints [k] = endpoints [k];
+				bestPBits [k] = pbits [k];
+			}
+
+			std::memcpy (bestIndices, indices, 16);
+		}
+
+		float weights [16];
+
+		for (std::size_t i=0;i<16;i++) {
+			weights [i] = bc7Weights [indices [i]] / 64.0f;
+		}
+
+		if (!FitEndpoints (block, weights, start, end)) {
+			break;
+		}
+	}
+
+	/*
+	 * The most significant bit of the first index is implicit, so the
+	 * endpoints are swapped when it would be set
+	*/
+
+	if (bestIndices [0] >= 8) {
+		std::swap (bestEndpoints [0], bestEndpoints [1]);
+		std::swap (bestPBits [0], bestPBits [1]);
+
+		for (std::size_t i=0;i<16;i++) {
+			bestIndices [i] = 15 - bestIndices [i];
+		}
+	}
+
+	std::memset (output, 0, 16);
+
+	std::size_t position = 0;
+
+	auto writeBits = [&] (unsigned int value, std::size_t count) {
+		for (std::size_t bit=0;bit<count;bit++, position++) {
+			if ((value >> bit) & 1) {
+				output [position >> 3] |= (unsigned char) (1 << (position & 7));
+			}
+		}
+	};
+
+	writeBits (1 << 6, 7);
+
+	for (std::size_t channel=0;channel<4;channel++) {
+		writeBits (bestEndpoints [0][channel], 7);
+		writeBits (bestEndpoints [1][channel], 7);
+	}
+
+	writeBits (bestPBits [0], 1);
+	writeBits (bestPBits [1], 1);
+
+	for (std::size_t i=0;i<16;i++) {
+		writeBits (bestIndices [i], i == 0 ? 3 : 4);
+	}
+}
+
+void BlockCompression::GetEndpoints (const glm::vec4* block, const glm::vec4& mask, glm::vec4& start, glm::vec4& end)
+{
+	glm::vec4 mean (0.0f);
+	glm::vec4 minColor (255.0f);
+	glm::vec4 maxColor (0.0f);
+
+	for (std::size_t i=0;i<16;i++) {
+		mean += block [i];
+		minColor = glm::min (minColor, block [i]);
+		maxColor = glm::max (maxColor, block [i]);
+	}
+
+	mean /= 16.0f;
+
+	/*
+	 * Principal axis of the block by power iteration on its covariance
+	*/
+
+	float covariance [4][4] = {};
+
+	for (std::size_t i=0;i<16;i++) {
+		glm::vec4 delta = (block [i] - mean) * mask;
+
+		for (std::size_t row=0;row<4;row++) {
+			for (std::size_t column=0;column<4;column++) {
+				covariance [row][column] += delta [row] * delta [column];
+			}
+		}
+	}
+
+	glm::vec4 axis = (maxColor - minColor) * mask;
+
+	for (std::size_t iteration=0;iteration<8;iteration++) {
+		glm::vec4 next (0.0f);
+
+		for (std::size_t row=0;row<4;row++) {
+			for (std::size_t column=0;column<4;column++) {
+				next [row] += covariance [row][column] * axis [column];
+			}
+		}
+
+		float length = glm::length (next);
+
+		if (length < 1e-6f) {
+			break;
+		}
+
+		axis = next / length;
+	}
+
+	float axisLength = glm::length (axis);
+
+	if (axisLength < 1e-6f) {
+		start = end = mean;
+		return;
+	}
+
+	axis /= axisLength;
+
+	float minProjection = std::numeric_limits<float>::max ();
+	float maxProjection = -std::numeric_limits<float>::max ();
+
+	for (std::size_t i=0;i<16;i++) {
+		float projection = glm::dot ((block [i] - mean) * mask, axis);
+
+		minProjection = std::min (minProjection, projection);
+		maxProjection = std::max (maxProjection, projection);
+	}
+
+	start = glm::clamp (mean + axis * maxProjection, 0.0f, 255.0f);
+	end = glm::clamp (mean + axis * minProjection, 0.0f, 255.0f);
+}
+
+bool BlockCompression::FitEndpoints (const glm::vec4* block, const float* weights, glm::vec4& start, glm::vec4& end)
+{
+	/*
+	 * Least squares endpoints for fixed interpolation weights
+	*/
+
+	float a = 0.0f, b = 0.0f, c = 0.0f;
+	glm::vec4 startSum (0.0f), endSum (0.0f);
+
+	for (std::size_t i=0;i<16;i++) {
+		float weight = weights [i];
+
+		a += (1.0f - weight) * (1.0f - weight);
+		b += (1.0f - weight) * weight;
+		c += weight * weight;
+
+		startSum += (1.0f - weight) * block [i];
+		endSum += weight * block [i];
+	}
+
+	float determinant = a * c - b * b;
+
+	if (std::abs (determinant) < 1e-6f) {
+		return false;
+	}
+
+	start = glm::clamp ((c * startSum - b * endSum) / determinant, 0.0f, 255.0f);
+	end = glm::clamp ((a * endSum - b * startSum) / determinant, 0.0f, 255.0f);
+
+	return true;
+}
+
+float BlockCompression::EncodeBC1Colors (const glm::vec4* block, const glm::vec4& start, const glm::vec4& end,
+	unsigned char* output, float* weights)
+{
+	static const float paletteWeights [4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+	unsigned short color0 = PackColor (start);
+	unsigned short color1 = PackColor (end);
+
+	/*
+	 * color0 > color1 selects the four color mode
+	*/
+
+	if (color0 < color1) {
+		std::swap (color0, color1);
+	}
+
+	glm::vec4 palette [4];
+
+	palette [0] = UnpackColor (color0);
+	palette [1] = UnpackColor (color1);
+	palette [2] = (2.0f * palette [0] + palette [1]) / 3.0f;
+	palette [3] = (palette [0] + 2.0f * palette [1]) / 3.0f;
+
+	std::size_t paletteSize = color0 == color1 ? 1 : 4;
+
+	std::uint32_t indices = 0;
+	float error = 0.0f;
+
+	for (std::size_t i=0;i<16;i++) {
+		std::size_t bestIndex = 0;
+		float bestDistance = std::numeric_limits<float>::max ();
+
+		for (std::size_t k=0;k<paletteSize;k++) {
+			glm::vec3 delta = glm::vec3 (block [i]) - glm::vec3 (palette [k]);
+			float distance = glm::dot (delta, delta);
+
+			if (distance < bestDistance) {
+				bestDistance = distance;
+				bestIndex = k;
+			}
+		}
+
+		indices |= (std::uint32_t) bestIndex << (2 * i);
+		error += bestDistance;
+
+		weights [i] = paletteWeights [bestIndex];
+	}
+
+	output [0] = (unsigned char) (color0 & 0xFF);
+	output [1] = (unsigned char) (color0 >> 8);
+	output [2] = (unsigned char) (color1 & 0xFF);
+	output [3] = (unsigned char) (color1 >> 8);
+
+	for (std::size_t i=0;i<4;i++) {
+		output [4 + i] = (unsigned char) ((indices >> (8 * i)) & 0xFF);
+	}
+
+	return error;
+}
+
+unsigned short BlockCompression::PackColor (const glm::vec4& color)
+{
+	unsigned short red = (unsigned short) std::round (glm::clamp (color.r, 0.0f, 255.0f) * 31.0f / 255.0f);
+	unsigned short green = (unsigned short) std::round (glm::clamp (color.g, 0.0f, 255.0f) * 63.0f / 255.0f);
+	unsigned short blue = (unsigned short) std::round (glm::clamp (color.b, 0.0f, 255.0f) * 31.0f / 255.0f);
+
+	return (unsigned short) ((red << 11) | (green << 5) | blue);
+}
+
+glm::vec4 BlockCompression::UnpackColor (unsigned short color)
+{
+	unsigned int red = (color >> 11) & 0x1F;
+	unsigned int green = (color >> 5) & 0x3F;
+	unsigned int blue = color & 0x1F;
+
+	return glm::vec4 ((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2), 255.0f);
+}
+
+void BlockCompression::QuantizeBC7Endpoint (const glm::vec4& endpoint, glm::ivec4& quantized, unsigned int& pbit)
+{
+	float bestError = std::numeric_limits<float>::max ();
+
+	/*
+	 * Both channels share the parity bit, keep the one closer to the endpoint
+	*/
+
+	for (unsigned int candidate=0;candidate<2;candidate++) {
+		glm::ivec4 value;
+		float error = 0.0f;
+
+		for (std::size_t channel=0;channel<4;channel++) {
+			value [channel] = glm::clamp ((int) std::round ((endpoint [channel] - candidate) / 2.0f), 0, 127);
+
+			float delta = (value [channel] * 2 + candidate) - endpoint [channel];
+			error += delta * delta;
+		}
+
+		if (error < bestError) {
+			bestError = error;
+			quantized = value;
+			pbit = candidate;
+		}
+	}
+}
+
+float BlockCompression::GetBC7Indices (const glm::vec4* block, const glm::ivec4& start, const glm::ivec4& end,
+	unsigned char* indices)
+{
+	static const int bc7Weights [16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	glm::vec4 palette [16];
+
+	for (std::size_t k=0;k<16;k++) {
+		glm::ivec4 color = ((64 - bc7Weights [k]) * start + bc7Weights [k] * end + 32) >> 6;
+
+		palette [k] = glm::vec4 (color);
+	}
+
+	float error = 0.0f;
+
+	for (std::size_t i=0;i<16;i++) {
+		float bestDistance = std::numeric_limits<float>::max ();
+
+		for (std::size_t k=0;k<16;k++) {
+			glm::vec4 delta = block [i] - palette [k];
+			float distance = glm::dot (delta, delta);
+
+			if (distance < bestDistance) {
+				bestDistance = distance;
+				indices [i] = (unsigned char) k;
+			}
+		}
+
+		error += bestDistance;
+	}
+
+	return error;
+}
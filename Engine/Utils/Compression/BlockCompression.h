@@ -0,0 +1,48 @@
+#ifndef BLOCKCOMPRESSION_H
+#define BLOCKCOMPRESSION_H
+
+#include <vector>
+#include <glm/vec4.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+#include "Renderer/Render/Texture/TextureMode.h"
+
+/*
+ * CPU encoders for the block compressed formats. Every 4x4 block of RGBA8
+ * pixels is fitted along its principal axis and refined once with least
+ * squares. BC7 only uses mode 6 (one subset, RGBA endpoints, 4 bit
+ * indices), which is enough for the textures the engine loads.
+*/
+
+class BlockCompression
+{
+public:
+	static std::vector<unsigned char> Compress (const unsigned char* pixels, std::size_t width,
+		std::size_t height, TEXTURE_COMPRESSION_TYPE compressionType);
+
+	static std::size_t GetCompressedSize (std::size_t width, std::size_t height, TEXTURE_COMPRESSION_TYPE compressionType);
+	static std::size_t GetBlockSize (TEXTURE_COMPRESSION_TYPE compressionType);
+protected:
+	static void FetchBlock (const unsigned char* pixels, std::size_t width, std::size_t height,
+		std::size_t x, std::size_t y, glm::vec4* block);
+
+	static void CompressBC1Block (const glm::vec4* block, unsigned char* output);
+	static void CompressBC3Block (const glm::vec4* block, unsigned char* output);
+	static void CompressBC4Block (const float* values, unsigned char* output);
+	static void CompressBC5Block (const glm::vec4* block, unsigned char* output);
+	static void CompressBC7Block (const glm::vec4* block, unsigned char* output);
+
+	static void GetEndpoints (const glm::vec4* block, const glm::vec4& mask, glm::vec4& start, glm::vec4& end);
+	static bool FitEndpoints (const glm::vec4* block, const float* weights, glm::vec4& start, glm::vec4& end);
+
+	static float EncodeBC1Colors (const glm::vec4* block, const glm::vec4& start, const glm::vec4& end,
+		unsigned char* output, float* weights);
+	static unsigned short PackColor (const glm::vec4& color);
+	static glm::vec4 UnpackColor (unsigned short color);
+
+	static void QuantizeBC7Endpoint (const glm::vec4& endpoint, glm::ivec4& quantized, unsigned int& pbit);
+	static float GetBC7Indices (const glm::vec4* block, const glm::ivec4& start, const glm::ivec4& end,
+		unsigned char* indices);
+};
+
+#endif
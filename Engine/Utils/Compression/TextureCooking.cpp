@@ -0,0 +1,184 @@
+#include "TextureCooking.h"
+
+#include <glm/geometric.hpp>
+#include <glm/vec3.hpp>
+#include <algorithm>
+#include <cmath>
+
+#include "BlockCompression.h"
+
+Texture* TextureCooking::Cook (const Texture* texture, TEXTURE_COOK_MODE cookMode, TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	compressionType = GetCompressionType (texture, cookMode, compressionType);
+
+	Size size = texture->GetSize ();
+
+	Texture* cookedTexture = new Texture (texture->GetName ());
+
+	cookedTexture->SetSize (size);
+	cookedTexture->SetWrapMode (texture->GetWrapMode ());
+	cookedTexture->SetMinFilter (texture->GetMinFilter ());
+	cookedTexture->SetMagFilter (texture->GetMagFilter ());
+	cookedTexture->SetAnisotropicFiltering (texture->HasAnisotropicFiltering ());
+	cookedTexture->SetCompressionType (compressionType);
+	cookedTexture->SetMipmapGeneration (false);
+
+	std::vector<unsigned char> pixels (texture->GetPixels (), texture->GetPixels () + size.width * size.height * 4);
+
+	std::size_t width = size.width;
+	std::size_t height = size.height;
+
+	for (std::size_t level = 0; level < MAX_TEXTURE_MIPMAP_LEVEL; level ++) {
+		std::vector<unsigned char> levelData = pixels;
+
+		if (compressionType != COMPRESS_NONE) {
+			levelData = BlockCompression::Compress (pixels.data (), width, height, compressionType);
+		}
+
+		if (level == 0) {
+			cookedTexture->SetPixels (levelData.data (), levelData.size ());
+		} else {
+			cookedTexture->AddMipmapLevel (levelData.data (), levelData.size ());
+		}
+
+		if (width == 1 && height == 1) {
+			break;
+		}
+
+		pixels = Downsample (pixels, width, height, cookMode);
+
+		width = std::max<std::size_t> (1, width / 2);
+		height = std::max<std::size_t> (1, height / 2);
+	}
+
+	return cookedTexture;
+}
+
+TEXTURE_COMPRESSION_TYPE TextureCooking::GetCompressionType (const Texture* texture, TEXTURE_COOK_MODE cookMode,
+	TEXTURE_COMPRESSION_TYPE compressionType)
+{
+	if (compressionType == COMPRESS_NONE) {
+		return COMPRESS_NONE;
+	}
+
+	/*
+	 * Normal maps only keep two channels, the third is rebuilt in shader
+	*/
+
+	if (cookMode == COOK_NORMAL_MAP) {
+		return COMPRESS_BC5;
+	}
+
+	if (compressionType == COMPRESS_BC7) {
+		return COMPRESS_BC7;
+	}
+
+	return HasAlpha (texture) ? COMPRESS_BC3 : COMPRESS_BC1;
+}
+
+std::vector<unsigned char> TextureCooking::Downsample (const std::vector<unsigned char>& pixels, std::size_t width,
+	std::size_t height, TEXTURE_COOK_MODE cookMode)
+{
+	std::size_t levelWidth = std::max<std::size_t> (1, width / 2);
+	std::size_t levelHeight = std::max<std::size_t> (1, height / 2);
+
+	std::vector<unsigned char> level (levelWidth * levelHeight * 4);
+
+	for (std::size_t y=0;y<levelHeight;y++) {
+		for (std::size_t x=0;x<levelWidth;x++) {
+
+			/*
+			 * Box filter over the 2x2 footprint, clamped on odd sizes
+			*/
+
+			std::size_t x0 = std::min (x * 2, width - 1), x1 = std::min (x * 2 + 1, width - 1);
+			std::size_t y0 = std::min (y * 2, height - 1), y1 = std::min (y * 2 + 1, height - 1);
+
+			const unsigned char* samples [4] = {
+				&pixels [(y0 * width + x0) * 4], &pixels [(y0 * width + x1) * 4],
+				&pixels [(y1 * width + x0) * 4], &pixels [(y1 * width + x1) * 4]
+			};
+
+			unsigned char* output = &level [(y * levelWidth + x) * 4];
+
+			float alpha = 0.0f;
+
+			for (std::size_t k=0;k<4;k++) {
+				alpha += samples [k][3] / 4.0f;
+			}
+
+			output [3] = (unsigned char) std::round (alpha);
+
+			if (cookMode == COOK_NORMAL_MAP) {
+				glm::vec3 normal (0.0f);
+
+				for (std::size_t k=0;k<4;k++) {
+					normal += glm::vec3 (samples [k][0], samples [k][1], samples [k][2]) / 127.5f - 1.0f;
+				}
+
+				normal = glm::length (normal) > 0.0f ? glm::normalize (normal) : glm::vec3 (0.0f, 0.0f, 1.0f);
+
+				for (std::size_t channel=0;channel<3;channel++) {
+					output [channel] = (unsigned char) std::round ((normal [channel] + 1.0f) * 127.5f);
+				}
+
+				continue;
+			}
+
+			/*
+			 * Color textures are stored in sRGB, average them in linear space
+			*/
+
+			for (std::size_t channel=0;channel<3;channel++) {
+				float color = 0.0f;
+
+				for (std::size_t k=0;k<4;k++) {
+					color += ToLinear (samples [k][channel]) / 4.0f;
+				}
+
+				output [channel] = ToSRGB (color);
+			}
+		}
+	}
+
+	return level;
+}
+
+bool TextureCooking::HasAlpha (const Texture* texture)
+{
+	Size size = texture->GetSize ();
+	const unsigned char* pixels = texture->GetPixels ();
+
+	for (std::size_t i=0;i<size.width * size.height;i++) {
+		if (pixels [i * 4 + 3] != 255) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+float TextureCooking::ToLinear (unsigned char value)
+{
+	static float linearTable [256];
+	static bool isInitialized = false;
+
+	if (!isInitialized) {
+		for (std::size_t i=0;i<256;i++) {
+			float color = i / 255.0f;
+
+			linearTable [i] = color <= 0.04045f ? color / 12.92f : std::pow ((color + 0.055f) / 1.055f, 2.4f);
+		}
+
+		isInitialized = true;
+	}
+
+	return linearTable [value];
+}
+
+unsigned char TextureCooking::ToSRGB (float value)
+{
+	float color = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow (value, 1.0f / 2.4f) - 0.055f;
+
+	return (unsigned char) std::round (glm::clamp (color, 0.0f, 1.0f) * 255.0f);
+}
@@ -0,0 +1,32 @@
+#ifndef TEXTURECOOKING_H
+#define TEXTURECOOKING_H
+
+#include <vector>
+
+#include "Renderer/Render/Texture/Texture.h"
+
+/*
+ * Builds the full mip chain of a RGBA8 texture on the CPU and block
+ * compresses every level. Color textures are filtered in linear space,
+ * normal maps are renormalized after every reduction and keep only their
+ * X and Y channels.
+*/
+
+class TextureCooking
+{
+public:
+	static Texture* Cook (const Texture* texture, TEXTURE_COOK_MODE cookMode, TEXTURE_COMPRESSION_TYPE compressionType);
+
+	static TEXTURE_COMPRESSION_TYPE GetCompressionType (const Texture* texture, TEXTURE_COOK_MODE cookMode,
+		TEXTURE_COMPRESSION_TYPE compressionType);
+protected:
+	static std::vector<unsigned char> Downsample (const std::vector<unsigned char>& pixels, std::size_t width,
+		std::size_t height, TEXTURE_COOK_MODE cookMode);
+
+	static bool HasAlpha (const Texture* texture);
+
+	static float ToLinear (unsigned char value);
+	static unsigned char ToSRGB (float value);
+};
+
+#endif
@@ -159,3 +159,17 @@ std::string StringExtend::Lower (const std::string& source)
 
     return result;
 }
+
+/*
+ * FNV-1a, the previous hash may be passed to chain several strings
+*/
+
+std::uint64_t StringExtend::Hash (const std::string& source, std::uint64_t hash)
+{
+	for (char ch : source) {
+		hash ^= (unsigned char) ch;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
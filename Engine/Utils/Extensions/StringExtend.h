@@ -1,6 +1,7 @@
 #ifndef STRINGEXTEND_H
 #define STRINGEXTEND_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -25,6 +26,8 @@ public:
 	static void ToUpper (std::string&);
 	static std::string Lower (const std::string&);
 	static void ToLower (std::string&);
+
+	static std::uint64_t Hash (const std::string&, std::uint64_t hash = 14695981039346656037ull);
 };
 
 }
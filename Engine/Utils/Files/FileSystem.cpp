@@ -1,6 +1,7 @@
 #include "FileSystem.h"
 
 #include <string>
+#include <fstream>
 #include <algorithm>
 
 #include "Utils/Extensions/StringExtend.h"
@@ -68,6 +69,32 @@ std::string FileSystem::Relative (const std::string& filename, const std::string
 	return formated;
 }
 
+/*
+ * FNV-1a over the content of the file, 0 when it can't be read
+*/
+
+std::uint64_t FileSystem::GetFileHash (const std::string& filename)
+{
+	std::ifstream file (filename, std::ios::binary);
+
+	if (!file.is_open ()) {
+		return 0;
+	}
+
+	std::uint64_t hash = 14695981039346656037ull;
+
+	char buffer [65536];
+
+	while (file.read (buffer, sizeof (buffer)) || file.gcount () > 0) {
+		for (std::streamsize i=0;i<file.gcount ();i++) {
+			hash ^= (unsigned char) buffer [i];
+			hash *= 1099511628211ull;
+		}
+	}
+
+	return hash;
+}
+
 // TODO: Implement this
 std::string FileSystem::SwitchSlashesWindows (const std::string& filename)
 {
@@ -1,6 +1,7 @@
 #ifndef FILESYSTEM_H
 #define FILESYSTEM_H
 
+#include <cstdint>
 #include <string>
 
 class ENGINE_API FileSystem
@@ -14,6 +15,8 @@ public:
 	static std::string FormatFilename (const std::string& filename);
 
 	static std::string Relative (const std::string& filename, const std::string& relatedPath);
+
+	static std::uint64_t GetFileHash (const std::string& filename);
 private:
 	// TODO: reimplement this when implement platforming
 	static std::string SwitchSlashesWindows (const std::string& filename);
@@ -0,0 +1,143 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+MappedFile::MappedFile () :
+	_data (nullptr),
+	_size (0),
+#ifdef _WIN32
+	_file (INVALID_HANDLE_VALUE),
+	_mapping (nullptr)
+#else
+	_file (-1)
+#endif
+{
+
+}
+
+MappedFile::~MappedFile ()
+{
+	Close ();
+}
+
+bool MappedFile::Open (const std::string& filename)
+{
+	Close ();
+
+#ifdef _WIN32
+	_file = CreateFileA (filename.c_str (), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (_file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx (_file, &size) || size.QuadPart == 0) {
+		Close ();
+		return false;
+	}
+
+	_mapping = CreateFileMappingA (_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (_mapping == nullptr) {
+		Close ();
+		return false;
+	}
+
+	_data = (const unsigned char*) MapViewOfFile (_mapping, FILE_MAP_READ, 0, 0, 0);
+	_size = (std::size_t) size.QuadPart;
+#else
+	_file = open (filename.c_str (), O_RDONLY);
+
+	if (_file == -1) {
+		return false;
+	}
+
+	struct stat fileStat;
+
+	if (fstat (_file, &fileStat) == -1 || fileStat.st_size == 0) {
+		Close ();
+		return false;
+	}
+
+	void* data = mmap (nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, _file, 0);
+
+	if (data == MAP_FAILED) {
+		Close ();
+		return false;
+	}
+
+	/*
+	 * The whole file is consumed right after mapping, so read it ahead
+	*/
+
+	madvise (data, fileStat.st_size, MADV_WILLNEED);
+
+	_data = (const unsigned char*) data;
+	_size = (std::size_t) fileStat.st_size;
+#endif
+
+	if (_data == nullptr) {
+		Close ();
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::Close ()
+{
+#ifdef _WIN32
+	if (_data != nullptr) {
+		UnmapViewOfFile (_data);
+	}
+
+	if (_mapping != nullptr) {
+		CloseHandle (_mapping);
+	}
+
+	if (_file != INVALID_HANDLE_VALUE) {
+		CloseHandle (_file);
+	}
+
+	_file = INVALID_HANDLE_VALUE;
+	_mapping = nullptr;
+#else
+	if (_data != nullptr) {
+		munmap ((void*) _data, _size);
+	}
+
+	if (_file != -1) {
+		close (_file);
+	}
+
+	_file = -1;
+#endif
+
+	_data = nullptr;
+	_size = 0;
+}
+
+bool MappedFile::IsOpen () const
+{
+	return _data != nullptr;
+}
+
+const unsigned char* MappedFile::GetData () const
+{
+	return _data;
+}
+
+std::size_t MappedFile::GetSize () const
+{
+	return _size;
+}
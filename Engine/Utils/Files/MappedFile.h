@@ -0,0 +1,38 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+
+/*
+ * Read only view of a whole file mapped in memory. Pages are brought in
+ * by the operating system on first access, so nothing is copied up front.
+*/
+
+class ENGINE_API MappedFile
+{
+protected:
+	const unsigned char* _data;
+	std::size_t _size;
+
+#ifdef _WIN32
+	void* _file;
+	void* _mapping;
+#else
+	int _file;
+#endif
+
+public:
+	MappedFile ();
+	MappedFile (const MappedFile& other) = delete;
+	~MappedFile ();
+
+	bool Open (const std::string& filename);
+	void Close ();
+
+	bool IsOpen () const;
+
+	const unsigned char* GetData () const;
+	std::size_t GetSize () const;
+};
+
+#endif
@@ -0,0 +1,227 @@
+#include "LightMapBVH.h"
+
+#include <glm/geometric.hpp>
+#include <glm/common.hpp>
+#include <algorithm>
+#include <limits>
+
+#define LIGHTMAP_BVH_LEAF_SIZE 4
+#define LIGHTMAP_BVH_STACK_SIZE 64
+
+LightMapBVH::LightMapBVH () :
+	_triangles (nullptr)
+{
+
+}
+
+void LightMapBVH::Build (const std::vector<LightMapTriangle>& triangles)
+{
+	_triangles = &triangles;
+
+	_indices.resize (triangles.size ());
+	_nodes.clear ();
+
+	for (std::size_t i=0;i<triangles.size ();i++) {
+		_indices [i] = i;
+	}
+
+	if (!triangles.empty ()) {
+		BuildNode (0, triangles.size ());
+	}
+}
+
+bool LightMapBVH::Intersect (const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Hit& hit) const
+{
+	return Traverse (origin, direction, maxDistance, false, hit);
+}
+
+bool LightMapBVH::IsOccluded (const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const
+{
+	Hit hit;
+
+	return Traverse (origin, direction, maxDistance, true, hit);
+}
+
+std::size_t LightMapBVH::BuildNode (std::size_t begin, std::size_t end)
+{
+	std::size_t nodeIndex = _nodes.size ();
+	_nodes.push_back (Node ());
+
+	Node node;
+	node.minPosition = glm::vec3 (std::numeric_limits<float>::max ());
+	node.maxPosition = glm::vec3 (-std::numeric_limits<float>::max ());
+
+	glm::vec3 minCentroid = node.minPosition;
+	glm::vec3 maxCentroid = node.maxPosition;
+
+	for (std::size_t i=begin;i<end;i++) {
+		const LightMapTriangle& triangle = (*_triangles) [_indices [i]];
+
+		for (std::size_t k=0;k<3;k++) {
+			node.minPosition = glm::min (node.minPosition, triangle.positions [k]);
+			node.maxPosition = glm::max (node.maxPosition, triangle.positions [k]);
+		}
+
+		glm::vec3 centroid = (triangle.positions [0] + triangle.positions [1] + triangle.positions [2]) / 3.0f;
+
+		minCentroid = glm::min (minCentroid, centroid);
+		maxCentroid = glm::max (maxCentroid, centroid);
+	}
+
+	if (end - begin <= LIGHTMAP_BVH_LEAF_SIZE) {
+		node.first = begin;
+		node.right = 0;
+		node.count = end - begin;
+
+		_nodes [nodeIndex] = node;
+
+		return nodeIndex;
+	}
+
+	/*
+	 * Median split on the longest axis of the centroids
+	*/
+
+	glm::vec3 extent = maxCentroid - minCentroid;
+
+	int axis = 0;
+
+	if (extent.y > extent [axis]) {
+		axis = 1;
+	}
+
+	if (extent.z > extent [axis]) {
+		axis = 2;
+	}
+
+	std::size_t middle = (begin + end) / 2;
+
+	std::nth_element (_indices.begin () + begin, _indices.begin () + middle, _indices.begin () + end,
+		[this, axis] (std::size_t a, std::size_t b) {
+			const LightMapTriangle& first = (*_triangles) [a];
+			const LightMapTriangle& second = (*_triangles) [b];
+
+			return first.positions [0][axis] + first.positions [1][axis] + first.positions [2][axis] <
+				second.positions [0][axis] + second.positions [1][axis] + second.positions [2][axis];
+		});
+
+	node.count = 0;
+	node.first = BuildNode (begin, middle);
+	node.right = BuildNode (middle, end);
+
+	_nodes [nodeIndex] = node;
+
+	return nodeIndex;
+}
+
+bool LightMapBVH::Traverse (const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+	bool anyHit, Hit& hit) const
+{
+	if (_nodes.empty ()) {
+		return false;
+	}
+
+	glm::vec3 inverseDirection = 1.0f / direction;
+
+	std::size_t stack [LIGHTMAP_BVH_STACK_SIZE];
+	std::size_t stackSize = 0;
+
+	stack [stackSize ++] = 0;
+
+	bool isHit = false;
+	hit.distance = maxDistance;
+
+	while (stackSize > 0) {
+		const Node& node = _nodes [stack [-- stackSize]];
+
+		if (!IntersectBox (node, origin, inverseDirection, hit.distance)) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			stack [stackSize ++] = node.first;
+			stack [stackSize ++] = node.right;
+
+			continue;
+		}
+
+		for (std::size_t i=node.first;i<node.first + node.count;i++) {
+			float distance;
+			glm::vec2 barycentric;
+
+			if (!IntersectTriangle ((*_triangles) [_indices [i]], origin, direction, distance, barycentric)) {
+				continue;
+			}
+
+			if (distance >= hit.distance) {
+				continue;
+			}
+
+			hit.triangle = _indices [i];
+			hit.distance = distance;
+			hit.barycentric = barycentric;
+
+			isHit = true;
+
+			if (anyHit) {
+				return true;
+			}
+		}
+	}
+
+	return isHit;
+}
+
+bool LightMapBVH::IntersectBox (const Node& node, const glm::vec3& origin, const glm::vec3& inverseDirection,
+	float maxDistance) const
+{
+	glm::vec3 t0 = (node.minPosition - origin) * inverseDirection;
+	glm::vec3 t1 = (node.maxPosition - origin) * inverseDirection;
+
+	glm::vec3 tMin = glm::min (t0, t1);
+	glm::vec3 tMax = glm::max (t0, t1);
+
+	float enter = std::max (std::max (tMin.x, tMin.y), std::max (tMin.z, 0.0f));
+	float exit = std::min (std::min (tMax.x, tMax.y), std::min (tMax.z, maxDistance));
+
+	return enter <= exit;
+}
+
+bool LightMapBVH::IntersectTriangle (const LightMapTriangle& triangle, const glm::vec3& origin, const glm::vec3& direction,
+	float& distance, glm::vec2& barycentric) const
+{
+	/*
+	 * Moller-Trumbore, both faces are hit
+	*/
+
+	glm::vec3 edge1 = triangle.positions [1] - triangle.positions [0];
+	glm::vec3 edge2 = triangle.positions [2] - triangle.positions [0];
+
+	glm::vec3 p = glm::cross (direction, edge2);
+	float determinant = glm::dot (edge1, p);
+
+	if (std::abs (determinant) < 1e-10f) {
+		return false;
+	}
+
+	float inverseDeterminant = 1.0f / determinant;
+
+	glm::vec3 t = origin - triangle.positions [0];
+	float u = glm::dot (t, p) * inverseDeterminant;
+
+	if (u < 0.0f || u > 1.0f) {
+		return false;
+	}
+
+	glm::vec3 q = glm::cross (t, edge1);
+	float v = glm::dot (direction, q) * inverseDeterminant;
+
+	if (v < 0.0f || u + v > 1.0f) {
+		return false;
+	}
+
+	distance = glm::dot (edge2, q) * inverseDeterminant;
+	barycentric = glm::vec2 (u, v);
+
+	return distance > 0.0f;
+}
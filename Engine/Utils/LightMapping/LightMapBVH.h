@@ -0,0 +1,59 @@
+#ifndef LIGHTMAPBVH_H
+#define LIGHTMAPBVH_H
+
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "LightMapTriangle.h"
+
+/*
+ * Bounding volume hierarchy over the world space triangles of the baked
+ * scene. It is read only after it's built, so every baking thread can
+ * trace against the same tree.
+*/
+
+class LightMapBVH
+{
+public:
+	struct Hit
+	{
+		std::size_t triangle;
+		float distance;
+		glm::vec2 barycentric;
+	};
+
+protected:
+	struct Node
+	{
+		glm::vec3 minPosition;
+		glm::vec3 maxPosition;
+		std::size_t first;
+		std::size_t right;
+		std::size_t count;
+	};
+
+	const std::vector<LightMapTriangle>* _triangles;
+
+	std::vector<std::size_t> _indices;
+	std::vector<Node> _nodes;
+
+public:
+	LightMapBVH ();
+
+	void Build (const std::vector<LightMapTriangle>& triangles);
+
+	bool Intersect (const glm::vec3& origin, const glm::vec3& direction, float maxDistance, Hit& hit) const;
+	bool IsOccluded (const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const;
+protected:
+	std::size_t BuildNode (std::size_t begin, std::size_t end);
+
+	bool Traverse (const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+		bool anyHit, Hit& hit) const;
+	bool IntersectBox (const Node& node, const glm::vec3& origin, const glm::vec3& inverseDirection,
+		float maxDistance) const;
+	bool IntersectTriangle (const LightMapTriangle& triangle, const glm::vec3& origin, const glm::vec3& direction,
+		float& distance, glm::vec2& barycentric) const;
+};
+
+#endif
@@ -0,0 +1,566 @@
+#include "LightMapBaker.h"
+
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+#include <glm/common.hpp>
+#include <algorithm>
+#include <limits>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cmath>
+
+#include "LightMapCharts.h"
+
+#include "Core/Console/Console.h"
+
+#define LIGHTMAP_PI 3.14159265358979f
+
+LightMapBakeSettings::LightMapBakeSettings () :
+	texelsPerUnit (16.0f),
+	maxResolution (2048),
+	padding (2),
+	samplesCount (128),
+	bouncesCount (2),
+	threadsCount (0),
+	skyColor (0.0f),
+	rayBias (0.0f)
+{
+
+}
+
+std::vector<LightMapBakeResult> LightMapBaker::Bake (const std::vector<LightMapBakeObject>& objects,
+	const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings)
+{
+	auto startTime = std::chrono::high_resolution_clock::now ();
+
+	std::vector<LightMapBakeResult> results;
+
+	/*
+	 * Gather the triangles of all objects in world space, each object
+	 * owns a contiguous range
+	*/
+
+	std::vector<LightMapTriangle> triangles;
+	std::vector<std::size_t> ranges (1, 0);
+
+	for (std::size_t i=0;i<objects.size ();i++) {
+		GetTriangles (objects [i], i, triangles);
+
+		ranges.push_back (triangles.size ());
+	}
+
+	std::vector<glm::ivec2> sizes;
+
+	for (std::size_t i=0;i<objects.size ();i++) {
+		sizes.push_back (LightMapCharts::Generate (triangles, ranges [i], ranges [i + 1],
+			settings.texelsPerUnit, settings.padding, settings.maxResolution));
+	}
+
+	LightMapBVH bvh;
+	bvh.Build (triangles);
+
+	/*
+	 * Offset the rays relative to the size of the scene
+	*/
+
+	LightMapBakeSettings bakeSettings = settings;
+
+	if (bakeSettings.rayBias <= 0.0f) {
+		glm::vec3 minPosition (std::numeric_limits<float>::max ());
+		glm::vec3 maxPosition (-std::numeric_limits<float>::max ());
+
+		for (const LightMapTriangle& triangle : triangles) {
+			for (std::size_t k=0;k<3;k++) {
+				minPosition = glm::min (minPosition, triangle.positions [k]);
+				maxPosition = glm::max (maxPosition, triangle.positions [k]);
+			}
+		}
+
+		bakeSettings.rayBias = triangles.empty () ? 0.001f :
+			std::max (glm::length (maxPosition - minPosition) * 1e-4f, 1e-5f);
+	}
+
+	if (bakeSettings.threadsCount == 0) {
+		bakeSettings.threadsCount = std::max (1u, std::thread::hardware_concurrency ());
+	}
+
+	for (std::size_t i=0;i<objects.size ();i++) {
+		if (sizes [i].x == 0 || ranges [i] == ranges [i + 1]) {
+			continue;
+		}
+
+		std::vector<Texel> texels = Rasterize (triangles, ranges [i], ranges [i + 1], sizes [i]);
+		std::vector<glm::vec3> irradiance = Trace (bvh, triangles, lights, bakeSettings, texels, sizes [i], i);
+
+		Dilate (irradiance, texels, sizes [i], bakeSettings.padding);
+
+		LightMapBakeResult result;
+		result.object = i;
+		result.model = BuildModel (objects [i], triangles, ranges [i], ranges [i + 1]);
+		result.lightMap = BuildLightMap (objects [i], irradiance, sizes [i]);
+
+		results.push_back (result);
+
+		Console::Log ("Baked " + std::to_string (sizes [i].x) + "x" + std::to_string (sizes [i].y) +
+			" light map for \"" + objects [i].name + "\"");
+	}
+
+	std::chrono::duration<float> bakeTime = std::chrono::high_resolution_clock::now () - startTime;
+
+	Console::Log ("Light maps baked in " + std::to_string (bakeTime.count ()) + " s on " +
+		std::to_string (bakeSettings.threadsCount) + " threads");
+
+	return results;
+}
+
+void LightMapBaker::GetTriangles (const LightMapBakeObject& object, std::size_t objectIndex,
+	std::vector<LightMapTriangle>& triangles)
+{
+	const Resource<Model>& model = object.model;
+
+	glm::mat3 normalMatrix = glm::transpose (glm::inverse (glm::mat3 (object.modelMatrix)));
+
+	for_each_type (ObjectModel*, objModel, *model) {
+		for (PolygonGroup* polyGroup : *objModel) {
+			for (Polygon* polygon : *polyGroup) {
+				for (std::size_t i=2;i<polygon->VertexCount ();i++) {
+					std::size_t corners [3] = { 0, i - 1, i };
+
+					LightMapTriangle triangle;
+
+					triangle.haveNormals = polygon->HaveNormals ();
+					triangle.haveUV = polygon->HaveUV ();
+					triangle.material = polyGroup->GetMaterial ();
+					triangle.objModel = objModel;
+					triangle.polyGroup = polyGroup;
+					triangle.object = objectIndex;
+
+					for (std::size_t k=0;k<3;k++) {
+						triangle.vertices [k] = polygon->GetVertex (corners [k]);
+						triangle.normalIndices [k] = triangle.haveNormals ? polygon->GetNormal (corners [k]) : 0;
+
+						triangle.positions [k] = glm::vec3 (object.modelMatrix *
+							glm::vec4 (model->GetVertex (triangle.vertices [k]), 1.0f));
+						triangle.texcoords [k] = triangle.haveUV ?
+							model->GetTexcoord (polygon->GetTexcoord (corners [k])) : glm::vec2 (0.0f);
+						triangle.lmTexcoords [k] = glm::vec2 (0.0f);
+					}
+
+					glm::vec3 faceNormal = glm::cross (triangle.positions [1] - triangle.positions [0],
+						triangle.positions [2] - triangle.positions [0]);
+
+					if (glm::length (faceNormal) > 0.0f) {
+						faceNormal = glm::normalize (faceNormal);
+					}
+
+					for (std::size_t k=0;k<3;k++) {
+						triangle.normals [k] = faceNormal;
+
+						if (triangle.haveNormals) {
+							glm::vec3 normal = normalMatrix * model->GetNormal (triangle.normalIndices [k]);
+
+							if (glm::length (normal) > 0.0f) {
+								triangle.normals [k] = glm::normalize (normal);
+							}
+						}
+					}
+
+					triangles.push_back (triangle);
+				}
+			}
+		}
+	}
+}
+
+std::vector<LightMapBaker::Texel> LightMapBaker::Rasterize (const std::vector<LightMapTriangle>& triangles,
+	std::size_t begin, std::size_t end, const glm::ivec2& size)
+{
+	Texel emptyTexel;
+	emptyTexel.isValid = false;
+
+	std::vector<Texel> texels (size.x * size.y, emptyTexel);
+
+	for (std::size_t i=begin;i<end;i++) {
+		const LightMapTriangle& triangle = triangles [i];
+
+		glm::vec2 p0 = triangle.lmTexcoords [0] * glm::vec2 (size);
+		glm::vec2 p1 = triangle.lmTexcoords [1] * glm::vec2 (size);
+		glm::vec2 p2 = triangle.lmTexcoords [2] * glm::vec2 (size);
+
+		float area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+
+		if (area == 0.0f) {
+			continue;
+		}
+
+		glm::ivec2 minTexel = glm::max (glm::ivec2 (glm::floor (glm::min (p0, glm::min (p1, p2)))), glm::ivec2 (0));
+		glm::ivec2 maxTexel = glm::min (glm::ivec2 (glm::ceil (glm::max (p0, glm::max (p1, p2)))), size - 1);
+
+		/*
+		 * Only the texels with the center inside the triangle are traced,
+		 * the ones on the chart borders are filled by the dilation
+		*/
+
+		for (int y=minTexel.y;y<=maxTexel.y;y++) {
+			for (int x=minTexel.x;x<=maxTexel.x;x++) {
+				glm::vec2 center = glm::vec2 (x + 0.5f, y + 0.5f);
+
+				float w0 = ((p1.x - center.x) * (p2.y - center.y) - (p2.x - center.x) * (p1.y - center.y)) / area;
+				float w1 = ((p2.x - center.x) * (p0.y - center.y) - (p0.x - center.x) * (p2.y - center.y)) / area;
+				float w2 = 1.0f - w0 - w1;
+
+				if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+					continue;
+				}
+
+				Texel& texel = texels [y * size.x + x];
+
+				texel.position = w0 * triangle.positions [0] + w1 * triangle.positions [1] + w2 * triangle.positions [2];
+				texel.normal = glm::normalize (w0 * triangle.normals [0] + w1 * triangle.normals [1] + w2 * triangle.normals [2]);
+				texel.isValid = true;
+			}
+		}
+	}
+
+	return texels;
+}
+
+std::vector<glm::vec3> LightMapBaker::Trace (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+	const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+	const std::vector<Texel>& texels, const glm::ivec2& size, std::size_t seed)
+{
+	std::vector<glm::vec3> irradiance (texels.size (), glm::vec3 (0.0f));
+
+	/*
+	 * Rows are handed out one at a time, every row has its own random
+	 * sequence, so the result doesn't depend on the number of threads
+	*/
+
+	std::atomic<std::size_t> nextRow (0);
+
+	auto traceRows = [&] () {
+		for (std::size_t row = nextRow ++;row < (std::size_t) size.y;row = nextRow ++) {
+			TraceRow (bvh, triangles, lights, settings, texels, irradiance, size.x, row, seed * size.y + row);
+		}
+	};
+
+	std::vector<std::thread> workers;
+
+	for (std::size_t i=1;i<settings.threadsCount;i++) {
+		workers.push_back (std::thread (traceRows));
+	}
+
+	traceRows ();
+
+	for (std::thread& worker : workers) {
+		worker.join ();
+	}
+
+	return irradiance;
+}
+
+void LightMapBaker::TraceRow (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+	const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+	const std::vector<Texel>& texels, std::vector<glm::vec3>& irradiance,
+	std::size_t width, std::size_t row, std::size_t seed)
+{
+	std::mt19937 generator ((std::mt19937::result_type) seed);
+
+	for (std::size_t x=0;x<width;x++) {
+		const Texel& texel = texels [row * width + x];
+
+		if (!texel.isValid) {
+			continue;
+		}
+
+		glm::vec3 position = texel.position + texel.normal * settings.rayBias;
+
+		glm::vec3 indirectLight (0.0f);
+
+		for (std::size_t i=0;i<settings.samplesCount;i++) {
+			indirectLight += GetIndirectLight (bvh, triangles, lights, settings, position, texel.normal, generator);
+		}
+
+		if (settings.samplesCount > 0) {
+			indirectLight /= (float) settings.samplesCount;
+		}
+
+		irradiance [row * width + x] = GetDirectLight (bvh, lights, settings, position, texel.normal) + indirectLight;
+	}
+}
+
+glm::vec3 LightMapBaker::GetDirectLight (const LightMapBVH& bvh, const std::vector<LightMapBakeLight>& lights,
+	const LightMapBakeSettings& settings, const glm::vec3& position, const glm::vec3& normal)
+{
+	glm::vec3 directLight (0.0f);
+
+	for (const LightMapBakeLight& light : lights) {
+		glm::vec3 lightDirection = -light.direction;
+
+		float cosine = glm::dot (normal, lightDirection);
+
+		if (cosine <= 0.0f) {
+			continue;
+		}
+
+		if (bvh.IsOccluded (position, lightDirection, std::numeric_limits<float>::max ())) {
+			continue;
+		}
+
+		directLight += light.radiance * cosine;
+	}
+
+	return directLight;
+}
+
+glm::vec3 LightMapBaker::GetIndirectLight (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+	const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+	glm::vec3 position, glm::vec3 normal, std::mt19937& generator)
+{
+	/*
+	 * Directions are drawn proportional to the cosine, so the cosine and
+	 * the 1/pi of the diffuse surfaces cancel out along the path
+	*/
+
+	glm::vec3 light (0.0f);
+	glm::vec3 throughput (1.0f);
+
+	for (std::size_t bounce=0;bounce<settings.bouncesCount;bounce++) {
+		glm::vec3 direction = GetCosineDirection (normal, generator);
+
+		LightMapBVH::Hit hit;
+
+		if (!bvh.Intersect (position, direction, std::numeric_limits<float>::max (), hit)) {
+			light += throughput * settings.skyColor;
+			break;
+		}
+
+		const LightMapTriangle& triangle = triangles [hit.triangle];
+
+		float w1 = hit.barycentric.x;
+		float w2 = hit.barycentric.y;
+		float w0 = 1.0f - w1 - w2;
+
+		glm::vec3 hitNormal = glm::normalize (w0 * triangle.normals [0] + w1 * triangle.normals [1] + w2 * triangle.normals [2]);
+
+		/*
+		 * Back faces are the inside of closed geometry, they give no light
+		*/
+
+		if (glm::dot (hitNormal, direction) > 0.0f) {
+			break;
+		}
+
+		if (triangle.material != nullptr) {
+			light += throughput * triangle.material->emissiveColor;
+		}
+
+		throughput *= GetAlbedo (triangle, hit.barycentric);
+
+		position = position + direction * hit.distance + hitNormal * settings.rayBias;
+		normal = hitNormal;
+
+		light += throughput * GetDirectLight (bvh, lights, settings, position, normal);
+	}
+
+	return light;
+}
+
+glm::vec3 LightMapBaker::GetAlbedo (const LightMapTriangle& triangle, const glm::vec2& barycentric)
+{
+	if (triangle.material == nullptr) {
+		return glm::vec3 (0.8f);
+	}
+
+	glm::vec3 albedo = triangle.material->diffuseColor;
+
+	const Resource<Texture>& texture = triangle.material->diffuseTexture;
+
+	/*
+	 * Only plain 8 bit textures can be read on the CPU
+	*/
+
+	if (texture == nullptr || !triangle.haveUV || texture->GetPixels () == nullptr ||
+		texture->GetCompressionType () != COMPRESS_NONE ||
+		texture->GetInternalFormat () != FORMAT_RGBA ||
+		texture->GetChannelType () != CHANNEL_UNSIGNED_BYTE) {
+		return albedo;
+	}
+
+	glm::vec2 texcoord = (1.0f - barycentric.x - barycentric.y) * triangle.texcoords [0] +
+		barycentric.x * triangle.texcoords [1] + barycentric.y * triangle.texcoords [2];
+
+	texcoord = glm::fract (texcoord);
+
+	Size size = texture->GetSize ();
+
+	std::size_t x = std::min ((std::size_t) (texcoord.x * size.width), size.width - 1);
+	std::size_t y = std::min ((std::size_t) (texcoord.y * size.height), size.height - 1);
+
+	const unsigned char* pixel = texture->GetPixels () + (y * size.width + x) * 4;
+
+	return albedo * glm::vec3 (pixel [0], pixel [1], pixel [2]) / 255.0f;
+}
+
+glm::vec3 LightMapBaker::GetCosineDirection (const glm::vec3& normal, std::mt19937& generator)
+{
+	std::uniform_real_distribution<float> distribution (0.0f, 1.0f);
+
+	float u1 = distribution (generator);
+	float u2 = distribution (generator);
+
+	float radius = std::sqrt (u1);
+	float angle = 2.0f * LIGHTMAP_PI * u2;
+
+	glm::vec3 up = std::abs (normal.y) < 0.99f ? glm::vec3 (0.0f, 1.0f, 0.0f) : glm::vec3 (1.0f, 0.0f, 0.0f);
+
+	glm::vec3 tangent = glm::normalize (glm::cross (up, normal));
+	glm::vec3 bitangent = glm::cross (normal, tangent);
+
+	return glm::normalize (tangent * (radius * std::cos (angle)) + bitangent * (radius * std::sin (angle)) +
+		normal * std::sqrt (std::max (0.0f, 1.0f - u1)));
+}
+
+void LightMapBaker::Dilate (std::vector<glm::vec3>& irradiance, std::vector<Texel>& texels,
+	const glm::ivec2& size, std::size_t padding)
+{
+	/*
+	 * Grow the charts in their padding, so bilinear filtering never
+	 * reads the black background
+	*/
+
+	for (std::size_t iteration=0;iteration<padding + 1;iteration++) {
+		std::vector<Texel> previousTexels = texels;
+
+		for (int y=0;y<size.y;y++) {
+			for (int x=0;x<size.x;x++) {
+				if (previousTexels [y * size.x + x].isValid) {
+					continue;
+				}
+
+				glm::vec3 sum (0.0f);
+				std::size_t count = 0;
+
+				for (int dy=-1;dy<=1;dy++) {
+					for (int dx=-1;dx<=1;dx++) {
+						int nx = x + dx, ny = y + dy;
+
+						if (nx < 0 || ny < 0 || nx >= size.x || ny >= size.y) {
+							continue;
+						}
+
+						if (!previousTexels [ny * size.x + nx].isValid) {
+							continue;
+						}
+
+						sum += irradiance [ny * size.x + nx];
+						count ++;
+					}
+				}
+
+				if (count == 0) {
+					continue;
+				}
+
+				irradiance [y * size.x + x] = sum / (float) count;
+				texels [y * size.x + x].isValid = true;
+			}
+		}
+	}
+}
+
+LightMapModel* LightMapBaker::BuildModel (const LightMapBakeObject& object, const std::vector<LightMapTriangle>& triangles,
+	std::size_t begin, std::size_t end)
+{
+	const Resource<Model>& source = object.model;
+
+	LightMapModel* model = new LightMapModel ();
+
+	model->SetName (object.name);
+	model->SetMaterialLibrary (source->GetMaterialLibrary ());
+
+	for (std::size_t i=0;i<source->VertexCount ();i++) {
+		model->AddVertex (source->GetVertex (i));
+	}
+
+	for (std::size_t i=0;i<source->NormalsCount ();i++) {
+		model->AddNormal (source->GetNormal (i));
+	}
+
+	/*
+	 * Every corner gets its own texcoord, so the light map texcoords can
+	 * be indexed the same way
+	*/
+
+	ObjectModel* objModel = nullptr;
+	PolygonGroup* polyGroup = nullptr;
+
+	const ObjectModel* currentObjModel = nullptr;
+	const PolygonGroup* currentPolyGroup = nullptr;
+
+	for (std::size_t i=begin;i<end;i++) {
+		const LightMapTriangle& triangle = triangles [i];
+
+		if (triangle.objModel != currentObjModel) {
+			currentObjModel = triangle.objModel;
+			currentPolyGroup = nullptr;
+
+			objModel = new ObjectModel (triangle.objModel->GetName ());
+			model->AddObjectModel (objModel);
+		}
+
+		if (triangle.polyGroup != currentPolyGroup) {
+			currentPolyGroup = triangle.polyGroup;
+
+			polyGroup = new PolygonGroup (triangle.polyGroup->GetName ());
+			polyGroup->SetMaterial (triangle.material);
+
+			objModel->AddPolygonGroup (polyGroup);
+		}
+
+		Polygon* polygon = new Polygon ();
+
+		for (std::size_t k=0;k<3;k++) {
+			polygon->AddVertex (triangle.vertices [k]);
+
+			if (triangle.haveNormals) {
+				polygon->AddNormal (triangle.normalIndices [k]);
+			}
+
+			polygon->AddTexcoord ((int) model->TexcoordsCount ());
+
+			model->AddTexcoord (triangle.texcoords [k]);
+			model->AddLightMapTexcoord (triangle.lmTexcoords [k]);
+		}
+
+		polyGroup->AddPolygon (polygon);
+	}
+
+	return model;
+}
+
+Texture* LightMapBaker::BuildLightMap (const LightMapBakeObject& object, const std::vector<glm::vec3>& irradiance,
+	const glm::ivec2& size)
+{
+	std::vector<unsigned char> pixels (size.x * size.y * 4);
+
+	for (std::size_t i=0;i<irradiance.size ();i++) {
+		glm::vec3 color = glm::clamp (irradiance [i], glm::vec3 (0.0f), glm::vec3 (1.0f));
+
+		pixels [i * 4 + 0] = (unsigned char) (color.r * 255.0f + 0.5f);
+		pixels [i * 4 + 1] = (unsigned char) (color.g * 255.0f + 0.5f);
+		pixels [i * 4 + 2] = (unsigned char) (color.b * 255.0f + 0.5f);
+		pixels [i * 4 + 3] = 255;
+	}
+
+	Texture* lightMap = new Texture (object.name);
+
+	lightMap->SetSize (Size (size.x, size.y));
+	lightMap->SetMipmapGeneration (false);
+	lightMap->SetMinFilter (FILTER_LINEAR);
+	lightMap->SetWrapMode (WRAP_CLAMP_EDGE);
+	lightMap->SetPixels (pixels.data (), pixels.size ());
+
+	return lightMap;
+}
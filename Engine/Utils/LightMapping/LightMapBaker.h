@@ -0,0 +1,100 @@
+#ifndef LIGHTMAPBAKER_H
+#define LIGHTMAPBAKER_H
+
+#include <vector>
+#include <random>
+#include <string>
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+
+#include "LightMapBVH.h"
+#include "LightMapTriangle.h"
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Mesh/Model.h"
+#include "Renderer/Render/Mesh/LightMapModel.h"
+#include "Renderer/Render/Texture/Texture.h"
+
+struct ENGINE_API LightMapBakeObject
+{
+	Resource<Model> model;
+	glm::mat4 modelMatrix;
+	std::string name;
+};
+
+struct ENGINE_API LightMapBakeLight
+{
+	glm::vec3 direction;
+	glm::vec3 radiance;
+};
+
+struct ENGINE_API LightMapBakeSettings
+{
+	float texelsPerUnit;
+	std::size_t maxResolution;
+	std::size_t padding;
+	std::size_t samplesCount;
+	std::size_t bouncesCount;
+	std::size_t threadsCount;
+	glm::vec3 skyColor;
+	float rayBias;
+
+	LightMapBakeSettings ();
+};
+
+struct ENGINE_API LightMapBakeResult
+{
+	std::size_t object;
+	LightMapModel* model;
+	Texture* lightMap;
+};
+
+/*
+ * Bakes the irradiance of static objects on the CPU. Every object gets its
+ * own light map, the texels are path traced against all the objects, so
+ * they occlude and bounce light on each other. Values are stored the same
+ * way the deferred shading reads them, the light map is multiplied by the
+ * diffuse color of the surface.
+*/
+
+class ENGINE_API LightMapBaker
+{
+protected:
+	struct Texel
+	{
+		glm::vec3 position;
+		glm::vec3 normal;
+		bool isValid;
+	};
+
+public:
+	static std::vector<LightMapBakeResult> Bake (const std::vector<LightMapBakeObject>& objects,
+		const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings);
+protected:
+	static void GetTriangles (const LightMapBakeObject& object, std::size_t objectIndex,
+		std::vector<LightMapTriangle>& triangles);
+	static std::vector<Texel> Rasterize (const std::vector<LightMapTriangle>& triangles,
+		std::size_t begin, std::size_t end, const glm::ivec2& size);
+	static std::vector<glm::vec3> Trace (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+		const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+		const std::vector<Texel>& texels, const glm::ivec2& size, std::size_t seed);
+	static void TraceRow (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+		const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+		const std::vector<Texel>& texels, std::vector<glm::vec3>& irradiance,
+		std::size_t width, std::size_t row, std::size_t seed);
+	static glm::vec3 GetDirectLight (const LightMapBVH& bvh, const std::vector<LightMapBakeLight>& lights,
+		const LightMapBakeSettings& settings, const glm::vec3& position, const glm::vec3& normal);
+	static glm::vec3 GetIndirectLight (const LightMapBVH& bvh, const std::vector<LightMapTriangle>& triangles,
+		const std::vector<LightMapBakeLight>& lights, const LightMapBakeSettings& settings,
+		glm::vec3 position, glm::vec3 normal, std::mt19937& generator);
+	static glm::vec3 GetAlbedo (const LightMapTriangle& triangle, const glm::vec2& barycentric);
+	static glm::vec3 GetCosineDirection (const glm::vec3& normal, std::mt19937& generator);
+	static void Dilate (std::vector<glm::vec3>& irradiance, std::vector<Texel>& texels,
+		const glm::ivec2& size, std::size_t padding);
+	static LightMapModel* BuildModel (const LightMapBakeObject& object, const std::vector<LightMapTriangle>& triangles,
+		std::size_t begin, std::size_t end);
+	static Texture* BuildLightMap (const LightMapBakeObject& object, const std::vector<glm::vec3>& irradiance,
+		const glm::ivec2& size);
+};
+
+#endif
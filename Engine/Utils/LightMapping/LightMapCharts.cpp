@@ -0,0 +1,266 @@
+#include "LightMapCharts.h"
+
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <cmath>
+#include <map>
+
+#include "Core/Console/Console.h"
+
+/*
+ * Neighbours are joined while they stay inside ~25 degrees of the chart
+ * normal, so the projection on the chart plane never flips a triangle
+*/
+
+#define LIGHTMAP_CHART_NORMAL_THRESHOLD 0.9f
+#define LIGHTMAP_MIN_TEXELS_PER_UNIT 0.01f
+
+glm::ivec2 LightMapCharts::Generate (std::vector<LightMapTriangle>& triangles, std::size_t begin,
+	std::size_t end, float texelsPerUnit, std::size_t padding, std::size_t maxResolution)
+{
+	std::vector<Chart> charts = GetCharts (triangles, begin, end);
+
+	glm::ivec2 atlasSize (0);
+
+	/*
+	 * Lower the texel density until all the charts fit in the biggest
+	 * light map that is allowed
+	*/
+
+	bool isPacked = false;
+
+	while (!isPacked && texelsPerUnit >= LIGHTMAP_MIN_TEXELS_PER_UNIT) {
+		float area = 0.0f;
+		float maxWidth = 0.0f;
+
+		for (Chart& chart : charts) {
+			Project (triangles, chart, texelsPerUnit);
+
+			float width = std::ceil (chart.size.x) + 2.0f * padding;
+			float height = std::ceil (chart.size.y) + 2.0f * padding;
+
+			area += width * height;
+			maxWidth = std::max (maxWidth, width);
+		}
+
+		std::size_t width = 1;
+
+		while (width * width < area || width < maxWidth) {
+			width *= 2;
+		}
+
+		for (;width <= maxResolution && !isPacked;width *= 2) {
+			isPacked = Pack (charts, padding, width, maxResolution, atlasSize);
+		}
+
+		if (!isPacked) {
+			texelsPerUnit *= 0.75f;
+		}
+	}
+
+	if (!isPacked) {
+		Console::LogWarning ("Light map charts don't fit in a " + std::to_string (maxResolution) +
+			" light map, the object is skipped");
+
+		return glm::ivec2 (0);
+	}
+
+	for (const Chart& chart : charts) {
+		glm::vec2 offset = glm::vec2 (chart.offset) - chart.minPosition;
+
+		for (std::size_t triangleIndex : chart.triangles) {
+			LightMapTriangle& triangle = triangles [triangleIndex];
+
+			for (std::size_t k=0;k<3;k++) {
+				triangle.lmTexcoords [k] = (triangle.lmTexcoords [k] + offset) / glm::vec2 (atlasSize);
+			}
+		}
+	}
+
+	return atlasSize;
+}
+
+std::vector<LightMapCharts::Chart> LightMapCharts::GetCharts (std::vector<LightMapTriangle>& triangles,
+	std::size_t begin, std::size_t end)
+{
+	std::vector<Chart> charts;
+
+	/*
+	 * Triangles are neighbours when they share an edge of the source model
+	*/
+
+	std::map<std::pair<int, int>, std::vector<std::size_t>> edges;
+
+	for (std::size_t i=begin;i<end;i++) {
+		const LightMapTriangle& triangle = triangles [i];
+
+		for (std::size_t k=0;k<3;k++) {
+			int a = triangle.vertices [k];
+			int b = triangle.vertices [(k + 1) % 3];
+
+			edges [std::make_pair (std::min (a, b), std::max (a, b))].push_back (i);
+		}
+	}
+
+	std::vector<bool> visited (end - begin, false);
+
+	for (std::size_t seed=begin;seed<end;seed++) {
+		if (visited [seed - begin]) {
+			continue;
+		}
+
+		Chart chart;
+
+		glm::vec3 chartNormal = GetFaceNormal (triangles [seed]);
+
+		std::queue<std::size_t> front;
+		front.push (seed);
+		visited [seed - begin] = true;
+
+		while (!front.empty ()) {
+			std::size_t current = front.front ();
+			front.pop ();
+
+			chart.triangles.push_back (current);
+
+			const LightMapTriangle& triangle = triangles [current];
+
+			for (std::size_t k=0;k<3;k++) {
+				int a = triangle.vertices [k];
+				int b = triangle.vertices [(k + 1) % 3];
+
+				for (std::size_t neighbour : edges [std::make_pair (std::min (a, b), std::max (a, b))]) {
+					if (visited [neighbour - begin]) {
+						continue;
+					}
+
+					/*
+					 * Degenerated triangles go in any chart, they take no space
+					*/
+
+					glm::vec3 normal = GetFaceNormal (triangles [neighbour]);
+
+					if (normal != glm::vec3 (0.0f) && glm::dot (normal, chartNormal) < LIGHTMAP_CHART_NORMAL_THRESHOLD) {
+						continue;
+					}
+
+					visited [neighbour - begin] = true;
+					front.push (neighbour);
+				}
+			}
+		}
+
+		charts.push_back (chart);
+	}
+
+	return charts;
+}
+
+void LightMapCharts::Project (std::vector<LightMapTriangle>& triangles, Chart& chart, float texelsPerUnit)
+{
+	/*
+	 * Project on the plane of the first triangle of the chart
+	*/
+
+	glm::vec3 normal = GetFaceNormal (triangles [chart.triangles [0]]);
+
+	if (normal == glm::vec3 (0.0f)) {
+		normal = glm::vec3 (0.0f, 1.0f, 0.0f);
+	}
+
+	glm::vec3 up = std::abs (normal.y) < 0.99f ? glm::vec3 (0.0f, 1.0f, 0.0f) : glm::vec3 (1.0f, 0.0f, 0.0f);
+
+	glm::vec3 tangent = glm::normalize (glm::cross (up, normal));
+	glm::vec3 bitangent = glm::cross (normal, tangent);
+
+	glm::vec2 minPosition (std::numeric_limits<float>::max ());
+	glm::vec2 maxPosition (-std::numeric_limits<float>::max ());
+
+	for (std::size_t triangleIndex : chart.triangles) {
+		LightMapTriangle& triangle = triangles [triangleIndex];
+
+		for (std::size_t k=0;k<3;k++) {
+			glm::vec2 position = glm::vec2 (glm::dot (triangle.positions [k], tangent),
+				glm::dot (triangle.positions [k], bitangent)) * texelsPerUnit;
+
+			triangle.lmTexcoords [k] = position;
+
+			minPosition = glm::min (minPosition, position);
+			maxPosition = glm::max (maxPosition, position);
+		}
+	}
+
+	chart.minPosition = minPosition;
+	chart.size = maxPosition - minPosition;
+}
+
+bool LightMapCharts::Pack (std::vector<Chart>& charts, std::size_t padding, std::size_t width, std::size_t maxResolution,
+	glm::ivec2& atlasSize)
+{
+	/*
+	 * Taller charts first, so the shelves are filled evenly
+	*/
+
+	std::vector<Chart*> sortedCharts;
+
+	for (Chart& chart : charts) {
+		sortedCharts.push_back (&chart);
+	}
+
+	std::sort (sortedCharts.begin (), sortedCharts.end (), [] (const Chart* a, const Chart* b) {
+		return a->size.y > b->size.y;
+	});
+
+	std::size_t x = 0, y = 0;
+	std::size_t shelfHeight = 0;
+
+	for (Chart* chart : sortedCharts) {
+		std::size_t chartWidth = (std::size_t) std::ceil (chart->size.x) + 2 * padding;
+		std::size_t chartHeight = (std::size_t) std::ceil (chart->size.y) + 2 * padding;
+
+		if (chartWidth > width) {
+			return false;
+		}
+
+		if (x + chartWidth > width) {
+			y += shelfHeight;
+			x = 0;
+			shelfHeight = 0;
+		}
+
+		chart->offset = glm::ivec2 (x + padding, y + padding);
+
+		x += chartWidth;
+		shelfHeight = std::max (shelfHeight, chartHeight);
+	}
+
+	std::size_t height = 1;
+
+	while (height < y + shelfHeight) {
+		height *= 2;
+	}
+
+	if (height > maxResolution) {
+		return false;
+	}
+
+	atlasSize = glm::ivec2 (width, height);
+
+	return true;
+}
+
+glm::vec3 LightMapCharts::GetFaceNormal (const LightMapTriangle& triangle)
+{
+	glm::vec3 normal = glm::cross (triangle.positions [1] - triangle.positions [0],
+		triangle.positions [2] - triangle.positions [0]);
+
+	float length = glm::length (normal);
+
+	if (length == 0.0f) {
+		return glm::vec3 (0.0f);
+	}
+
+	return normal / length;
+}
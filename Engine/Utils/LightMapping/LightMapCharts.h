@@ -0,0 +1,39 @@
+#ifndef LIGHTMAPCHARTS_H
+#define LIGHTMAPCHARTS_H
+
+#include <vector>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "LightMapTriangle.h"
+
+/*
+ * Splits the triangles of an object in charts of neighbours that face about
+ * the same way, flattens every chart on its plane and packs the charts in
+ * shelves. Charts never share texels, a border of padding texels is kept
+ * around each of them for filtering and dilation.
+*/
+
+class LightMapCharts
+{
+protected:
+	struct Chart
+	{
+		std::vector<std::size_t> triangles;
+		glm::vec2 minPosition;
+		glm::vec2 size;
+		glm::ivec2 offset;
+	};
+
+public:
+	static glm::ivec2 Generate (std::vector<LightMapTriangle>& triangles, std::size_t begin,
+		std::size_t end, float texelsPerUnit, std::size_t padding, std::size_t maxResolution);
+protected:
+	static std::vector<Chart> GetCharts (std::vector<LightMapTriangle>& triangles, std::size_t begin, std::size_t end);
+	static void Project (std::vector<LightMapTriangle>& triangles, Chart& chart, float texelsPerUnit);
+	static bool Pack (std::vector<Chart>& charts, std::size_t padding, std::size_t width, std::size_t maxResolution,
+		glm::ivec2& atlasSize);
+	static glm::vec3 GetFaceNormal (const LightMapTriangle& triangle);
+};
+
+#endif
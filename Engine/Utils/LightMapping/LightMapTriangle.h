@@ -0,0 +1,32 @@
+#ifndef LIGHTMAPTRIANGLE_H
+#define LIGHTMAPTRIANGLE_H
+
+#include <glm/vec3.hpp>
+#include <glm/vec2.hpp>
+
+#include "Core/Resources/Resource.h"
+#include "Renderer/Render/Material/Material.h"
+#include "Renderer/Render/Mesh/ObjectModel.h"
+
+/*
+ * World space triangle of a baked object. The source indices and groups
+ * are kept to grow the charts and to rebuild the model afterwards.
+*/
+
+struct LightMapTriangle
+{
+	glm::vec3 positions [3];
+	glm::vec3 normals [3];
+	glm::vec2 texcoords [3];
+	glm::vec2 lmTexcoords [3];
+	int vertices [3];
+	int normalIndices [3];
+	bool haveNormals;
+	bool haveUV;
+	Resource<Material> material;
+	ObjectModel* objModel;
+	PolygonGroup* polyGroup;
+	std::size_t object;
+};
+
+#endif
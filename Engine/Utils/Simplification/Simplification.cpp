@@ -0,0 +1,475 @@
+#include "Simplification.h"
+
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <cmath>
+#include <map>
+
+#include "Core/Console/Console.h"
+
+bool Simplification::Collapse::operator > (const Collapse& other) const
+{
+	return error > other.error;
+}
+
+void Simplification::QuadricEdgeCollapse (Model* model, std::size_t levelsCount,
+	float reduction, std::size_t minPolygonsCount)
+{
+	for_each_type (ObjectModel*, objModel, *model) {
+		objModel->ClearLevelsOfDetail ();
+
+		std::vector<ObjectModel*> levelsOfDetail = QuadricEdgeCollapse (model, objModel,
+			levelsCount, reduction, minPolygonsCount);
+
+		for (ObjectModel* levelOfDetail : levelsOfDetail) {
+			objModel->AddLevelOfDetail (levelOfDetail);
+		}
+	}
+
+	Console::Log ("Generated " + std::to_string (model->LevelsOfDetailCount ()) +
+		" levels of detail for \"" + model->GetName () + "\"");
+}
+
+std::vector<ObjectModel*> Simplification::QuadricEdgeCollapse (Model* model, ObjectModel* objModel,
+	std::size_t levelsCount, float reduction, std::size_t minPolygonsCount)
+{
+	std::vector<ObjectModel*> levelsOfDetail;
+
+	std::vector<PolygonGroup*> polyGroups;
+	std::vector<Triangle> triangles = GetTriangles (objModel, polyGroups);
+
+	std::size_t trianglesCount = triangles.size ();
+
+	if (trianglesCount <= minPolygonsCount) {
+		return levelsOfDetail;
+	}
+
+	std::size_t verticesCount = model->VertexCount ();
+
+	/*
+	 * Accumulate the planes of the adjacent triangles in a quadric per vertex
+	*/
+
+	std::vector<glm::dmat4> quadrics (verticesCount, glm::dmat4 (0.0));
+	std::vector<std::vector<std::size_t>> vertexTriangles (verticesCount);
+
+	for (std::size_t i=0;i<triangles.size ();i++) {
+		const Triangle& triangle = triangles [i];
+
+		glm::dvec3 v0 = glm::dvec3 (model->GetVertex (triangle.vertices [0]));
+		glm::dvec3 v1 = glm::dvec3 (model->GetVertex (triangle.vertices [1]));
+		glm::dvec3 v2 = glm::dvec3 (model->GetVertex (triangle.vertices [2]));
+
+		glm::dvec3 normal = glm::cross (v1 - v0, v2 - v0);
+		double length = glm::length (normal);
+
+		for (std::size_t k=0;k<3;k++) {
+			vertexTriangles [triangle.vertices [k]].push_back (i);
+		}
+
+		if (length == 0.0) {
+			continue;
+		}
+
+		normal /= length;
+
+		glm::dvec4 plane = glm::dvec4 (normal, -glm::dot (normal, v0));
+		glm::dmat4 quadric = glm::outerProduct (plane, plane);
+
+		for (std::size_t k=0;k<3;k++) {
+			quadrics [triangle.vertices [k]] += quadric;
+		}
+	}
+
+	/*
+	 * Lock vertices on open or non-manifold edges, so that holes and cracks
+	 * between material groups don't appear
+	*/
+
+	std::map<std::pair<int, int>, std::size_t> edges;
+
+	for (const Triangle& triangle : triangles) {
+		for (std::size_t k=0;k<3;k++) {
+			int a = triangle.vertices [k];
+			int b = triangle.vertices [(k + 1) % 3];
+
+			edges [std::make_pair (std::min (a, b), std::max (a, b))] ++;
+		}
+	}
+
+	std::vector<bool> locked (verticesCount, false);
+
+	for (auto& edge : edges) {
+		if (edge.second != 2) {
+			locked [edge.first.first] = true;
+			locked [edge.first.second] = true;
+		}
+	}
+
+	/*
+	 * Lock the vertices on texture seams as well, their corners use more
+	 * than one texcoord and moving them would stretch the texture across
+	 * the seam
+	*/
+
+	std::vector<int> vertexTexcoords (verticesCount, -1);
+
+	for (const Triangle& triangle : triangles) {
+		if (!triangle.haveUV) {
+			continue;
+		}
+
+		for (std::size_t k=0;k<3;k++) {
+			int& texcoord = vertexTexcoords [triangle.vertices [k]];
+
+			if (texcoord == -1) {
+				texcoord = triangle.texcoords [k];
+			}
+
+			if (texcoord != triangle.texcoords [k]) {
+				locked [triangle.vertices [k]] = true;
+			}
+		}
+	}
+
+	/*
+	 * Candidates are invalidated lazily, every collapse bumps the version
+	 * of both its vertices
+	*/
+
+	std::vector<std::size_t> versions (verticesCount, 0);
+	std::vector<bool> collapsed (verticesCount, false);
+
+	std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> collapses;
+
+	auto pushCollapses = [&] (int vertex) {
+		for (std::size_t triangleIndex : vertexTriangles [vertex]) {
+			const Triangle& triangle = triangles [triangleIndex];
+
+			if (triangle.removed) {
+				continue;
+			}
+
+			for (std::size_t k=0;k<3;k++) {
+				int other = triangle.vertices [k];
+
+				if (other == vertex || (locked [vertex] && locked [other])) {
+					continue;
+				}
+
+				glm::dmat4 quadric = quadrics [vertex] + quadrics [other];
+
+				Collapse collapse;
+				collapse.error = std::numeric_limits<double>::infinity ();
+
+				if (!locked [vertex]) {
+					collapse.error = GetError (quadric, model->GetVertex (other));
+					collapse.from = vertex;
+					collapse.to = other;
+				}
+
+				if (!locked [other]) {
+					double error = GetError (quadric, model->GetVertex (vertex));
+
+					if (error < collapse.error) {
+						collapse.error = error;
+						collapse.from = other;
+						collapse.to = vertex;
+					}
+				}
+
+				collapse.fromVersion = versions [collapse.from];
+				collapse.toVersion = versions [collapse.to];
+
+				collapses.push (collapse);
+			}
+		}
+	};
+
+	for (std::size_t i=0;i<verticesCount;i++) {
+		if (!vertexTriangles [i].empty ()) {
+			pushCollapses ((int) i);
+		}
+	}
+
+	double maxError = 0.0;
+
+	for (std::size_t level=1;level<levelsCount;level++) {
+		std::size_t previousCount = trianglesCount;
+		std::size_t targetCount = std::max (minPolygonsCount,
+			(std::size_t) (previousCount * reduction));
+
+		while (trianglesCount > targetCount && !collapses.empty ()) {
+			Collapse collapse = collapses.top ();
+			collapses.pop ();
+
+			if (collapsed [collapse.from] || collapsed [collapse.to]) {
+				continue;
+			}
+
+			if (versions [collapse.from] != collapse.fromVersion ||
+				versions [collapse.to] != collapse.toVersion) {
+				continue;
+			}
+
+			/*
+			 * Reject collapses that would fold a triangle over itself
+			*/
+
+			bool isValid = true;
+
+			for (std::size_t triangleIndex : vertexTriangles [collapse.from]) {
+				const Triangle& triangle = triangles [triangleIndex];
+
+				if (triangle.removed) {
+					continue;
+				}
+
+				if (IsFlipped (model, triangle, collapse.from, collapse.to)) {
+					isValid = false;
+					break;
+				}
+			}
+
+			if (!isValid) {
+				continue;
+			}
+
+			/*
+			 * The moved corners take the texcoord the collapsed edge uses on
+			 * the other end, so they stay on the same side of a seam
+			*/
+
+			int toTexcoord = -1;
+
+			for (std::size_t triangleIndex : vertexTriangles [collapse.from]) {
+				const Triangle& triangle = triangles [triangleIndex];
+
+				if (triangle.removed || !triangle.haveUV) {
+					continue;
+				}
+
+				for (std::size_t k=0;k<3;k++) {
+					if (triangle.vertices [k] == collapse.to) {
+						toTexcoord = triangle.texcoords [k];
+					}
+				}
+
+				if (toTexcoord != -1) {
+					break;
+				}
+			}
+
+			/*
+			 * Collapse edge
+			*/
+
+			for (std::size_t triangleIndex : vertexTriangles [collapse.from]) {
+				Triangle& triangle = triangles [triangleIndex];
+
+				if (triangle.removed) {
+					continue;
+				}
+
+				bool isAdjacent = false;
+				bool isShared = false;
+
+				for (std::size_t k=0;k<3;k++) {
+					isAdjacent |= triangle.vertices [k] == collapse.from;
+					isShared |= triangle.vertices [k] == collapse.to;
+				}
+
+				/*
+				 * The same triangle may be listed more than once
+				*/
+
+				if (!isAdjacent) {
+					continue;
+				}
+
+				if (isShared) {
+					triangle.removed = true;
+					trianglesCount --;
+
+					continue;
+				}
+
+				for (std::size_t k=0;k<3;k++) {
+					if (triangle.vertices [k] != collapse.from) {
+						continue;
+					}
+
+					triangle.vertices [k] = collapse.to;
+
+					if (triangle.haveUV && toTexcoord != -1) {
+						triangle.texcoords [k] = toTexcoord;
+					}
+
+					/*
+					 * Smooth normals are indexed the same as vertices
+					*/
+
+					if (triangle.haveNormals && triangle.normals [k] == collapse.from) {
+						triangle.normals [k] = collapse.to;
+					}
+				}
+
+				vertexTriangles [collapse.to].push_back (triangleIndex);
+			}
+
+			vertexTriangles [collapse.from].clear ();
+
+			quadrics [collapse.to] += quadrics [collapse.from];
+			collapsed [collapse.from] = true;
+
+			versions [collapse.from] ++;
+			versions [collapse.to] ++;
+
+			maxError = std::max (maxError, collapse.error);
+
+			pushCollapses (collapse.to);
+		}
+
+		/*
+		 * Stop the chain when the mesh can't be reduced any more
+		*/
+
+		if (trianglesCount == 0 || trianglesCount > previousCount * 0.95f) {
+			break;
+		}
+
+		ObjectModel* levelOfDetail = BuildLevelOfDetail (objModel, polyGroups, triangles);
+		levelOfDetail->SetGeometricError ((float) std::sqrt (maxError));
+
+		levelsOfDetail.push_back (levelOfDetail);
+
+		if (trianglesCount <= minPolygonsCount) {
+			break;
+		}
+	}
+
+	return levelsOfDetail;
+}
+
+std::vector<Simplification::Triangle> Simplification::GetTriangles (ObjectModel* objModel, std::vector<PolygonGroup*>& polyGroups)
+{
+	std::vector<Triangle> triangles;
+
+	for (PolygonGroup* polyGroup : *objModel) {
+		for (Polygon* polygon : *polyGroup) {
+
+			/*
+			 * Convex polygons are split in a fan of triangles
+			*/
+
+			for (std::size_t i=2;i<polygon->VertexCount ();i++) {
+				std::size_t corners [3] = { 0, i - 1, i };
+
+				Triangle triangle;
+
+				triangle.polyGroup = polyGroups.size ();
+				triangle.haveNormals = polygon->HaveNormals ();
+				triangle.haveUV = polygon->HaveUV ();
+				triangle.removed = false;
+
+				for (std::size_t k=0;k<3;k++) {
+					triangle.vertices [k] = polygon->GetVertex (corners [k]);
+					triangle.normals [k] = triangle.haveNormals ? polygon->GetNormal (corners [k]) : 0;
+					triangle.texcoords [k] = polygon->GetTexcoord (corners [k]);
+				}
+
+				/*
+				 * Skip degenerated triangles
+				*/
+
+				if (triangle.vertices [0] == triangle.vertices [1] ||
+					triangle.vertices [1] == triangle.vertices [2] ||
+					triangle.vertices [2] == triangle.vertices [0]) {
+					continue;
+				}
+
+				triangles.push_back (triangle);
+			}
+		}
+
+		polyGroups.push_back (polyGroup);
+	}
+
+	return triangles;
+}
+
+double Simplification::GetError (const glm::dmat4& quadric, const glm::vec3& vertex)
+{
+	glm::dvec4 position = glm::dvec4 (glm::dvec3 (vertex), 1.0);
+
+	return std::max (0.0, glm::dot (position, quadric * position));
+}
+
+bool Simplification::IsFlipped (Model* model, const Triangle& triangle, int from, int to)
+{
+	glm::vec3 oldVertices [3];
+	glm::vec3 newVertices [3];
+
+	for (std::size_t k=0;k<3;k++) {
+
+		/*
+		 * Triangles that contain the whole edge are removed by the collapse
+		*/
+
+		if (triangle.vertices [k] == to) {
+			return false;
+		}
+
+		oldVertices [k] = model->GetVertex (triangle.vertices [k]);
+		newVertices [k] = model->GetVertex (triangle.vertices [k] == from ? to : triangle.vertices [k]);
+	}
+
+	glm::vec3 oldNormal = glm::cross (oldVertices [1] - oldVertices [0], oldVertices [2] - oldVertices [0]);
+	glm::vec3 newNormal = glm::cross (newVertices [1] - newVertices [0], newVertices [2] - newVertices [0]);
+
+	return glm::dot (oldNormal, newNormal) <= 0.0f;
+}
+
+ObjectModel* Simplification::BuildLevelOfDetail (ObjectModel* objModel, const std::vector<PolygonGroup*>& polyGroups,
+	const std::vector<Triangle>& triangles)
+{
+	ObjectModel* levelOfDetail = new ObjectModel (objModel->GetName ());
+
+	std::vector<PolygonGroup*> levelPolyGroups;
+
+	for (PolygonGroup* polyGroup : polyGroups) {
+		PolygonGroup* levelPolyGroup = new PolygonGroup (polyGroup->GetName ());
+		levelPolyGroup->SetMaterial (polyGroup->GetMaterial ());
+
+		levelOfDetail->AddPolygonGroup (levelPolyGroup);
+		levelPolyGroups.push_back (levelPolyGroup);
+	}
+
+	for (const Triangle& triangle : triangles) {
+		if (triangle.removed) {
+			continue;
+		}
+
+		Polygon* polygon = new Polygon ();
+
+		for (std::size_t k=0;k<3;k++) {
+			polygon->AddVertex (triangle.vertices [k]);
+
+			if (triangle.haveNormals) {
+				polygon->AddNormal (triangle.normals [k]);
+			}
+
+			if (triangle.haveUV) {
+				polygon->AddTexcoord (triangle.texcoords [k]);
+			}
+		}
+
+		levelPolyGroups [triangle.polyGroup]->AddPolygon (polygon);
+	}
+
+	return levelOfDetail;
+}
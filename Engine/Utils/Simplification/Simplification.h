@@ -0,0 +1,54 @@
+#ifndef SIMPLIFICATION_H
+#define SIMPLIFICATION_H
+
+#include <vector>
+#include <glm/mat4x4.hpp>
+
+#include "Renderer/Render/Mesh/Model.h"
+#include "Renderer/Render/Mesh/ObjectModel.h"
+
+/*
+ * Quadric error metric edge collapse. The vertex that is removed is always
+ * collapsed onto the other end of the edge, so every level of detail keeps
+ * referencing the vertices of the source model.
+*/
+
+class Simplification
+{
+protected:
+	struct Triangle
+	{
+		int vertices [3];
+		int normals [3];
+		int texcoords [3];
+		std::size_t polyGroup;
+		bool haveNormals;
+		bool haveUV;
+		bool removed;
+	};
+
+	struct Collapse
+	{
+		double error;
+		int from;
+		int to;
+		std::size_t fromVersion;
+		std::size_t toVersion;
+
+		bool operator > (const Collapse& other) const;
+	};
+
+public:
+	static void QuadricEdgeCollapse (Model* model, std::size_t levelsCount,
+		float reduction, std::size_t minPolygonsCount);
+	static std::vector<ObjectModel*> QuadricEdgeCollapse (Model* model, ObjectModel* objModel,
+		std::size_t levelsCount, float reduction, std::size_t minPolygonsCount);
+protected:
+	static std::vector<Triangle> GetTriangles (ObjectModel* objModel, std::vector<PolygonGroup*>& polyGroups);
+	static double GetError (const glm::dmat4& quadric, const glm::vec3& vertex);
+	static bool IsFlipped (Model* model, const Triangle& triangle, int from, int to);
+	static ObjectModel* BuildLevelOfDetail (ObjectModel* objModel, const std::vector<PolygonGroup*>& polyGroups,
+		const std::vector<Triangle>& triangles);
+};
+
+#endif
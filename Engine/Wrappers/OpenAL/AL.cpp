@@ -98,6 +98,13 @@ void AL::GenSources(ALsizei n, ALuint *sources)
 	ErrorCheck ("alGenSources");
 }
 
+void AL::DeleteSources(ALsizei n, ALuint *sources)
+{
+	alDeleteSources (n, sources);
+
+	ErrorCheck ("alDeleteSources");
+}
+
 void AL::Sourcef(ALuint source, ALenum param, ALfloat value)
 {
 	alSourcef (source, param, value);
@@ -140,6 +147,38 @@ void AL::SourceStop(ALuint source)
 	ErrorCheck ("alSourceStop");
 }
 
+void AL::SourceQueueBuffers(ALuint source, ALsizei n, const ALuint *buffers)
+{
+	alSourceQueueBuffers (source, n, buffers);
+
+	ErrorCheck ("alSourceQueueBuffers");
+}
+
+void AL::SourceUnqueueBuffers(ALuint source, ALsizei n, ALuint *buffers)
+{
+	alSourceUnqueueBuffers (source, n, buffers);
+
+	ErrorCheck ("alSourceUnqueueBuffers");
+}
+
+/*
+ * Listener
+*/
+
+void AL::Listener3f(ALenum param, ALfloat v1, ALfloat v2, ALfloat v3)
+{
+	alListener3f (param, v1, v2, v3);
+
+	ErrorCheck ("alListener3f");
+}
+
+void AL::Listenerfv(ALenum param, const ALfloat *values)
+{
+	alListenerfv (param, values);
+
+	ErrorCheck ("alListenerfv");
+}
+
 void AL::GetSourcei(ALuint source, ALenum pname, ALint *value)
 {
 	alGetSourcei (source, pname, value);
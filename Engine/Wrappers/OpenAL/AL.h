@@ -38,12 +38,22 @@ public:
 	*/
 
 	static void GenSources(ALsizei n, ALuint *sources);
+	static void DeleteSources(ALsizei n, ALuint *sources);
 	static void Sourcef(ALuint source, ALenum param, ALfloat value);
 	static void Source3f(ALuint source, ALenum param, ALfloat v1, ALfloat v2, ALfloat v3);
 	static void Sourcei(ALuint source, ALenum param, ALint value);
 	static void SourcePlay(ALuint source);
 	static void SourcePause(ALuint source);
 	static void SourceStop(ALuint source);
+	static void SourceQueueBuffers(ALuint source, ALsizei n, const ALuint *buffers);
+	static void SourceUnqueueBuffers(ALuint source, ALsizei n, ALuint *buffers);
+
+	/*
+	 * Listener
+	*/
+
+	static void Listener3f(ALenum param, ALfloat v1, ALfloat v2, ALfloat v3);
+	static void Listenerfv(ALenum param, const ALfloat *values);
 
 	/*
 	 * Getters
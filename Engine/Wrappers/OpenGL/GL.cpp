@@ -202,6 +202,24 @@ void GL::GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void
 	ErrorCheck ("glGetBufferSubData");
 }
 
+void* GL::MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void* data = glMapBufferRange (target, offset, length, access);
+
+	ErrorCheck ("glMapBufferRange");
+
+	return data;
+}
+
+GLboolean GL::UnmapBuffer (GLenum target)
+{
+	GLboolean result = glUnmapBuffer (target);
+
+	ErrorCheck ("glUnmapBuffer");
+
+	return result;
+}
+
 /*
  * Vertex Attributes
 */
@@ -735,6 +753,35 @@ void GL::GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params)
 	ErrorCheck ("glGetQueryObjectui64v");
 }
 
+/*
+ * Sync Objects
+*/
+
+GLsync GL::FenceSync(GLenum condition, GLbitfield flags)
+{
+	GLsync sync = glFenceSync(condition, flags);
+
+	ErrorCheck ("glFenceSync");
+
+	return sync;
+}
+
+GLenum GL::ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	GLenum result = glClientWaitSync(sync, flags, timeout);
+
+	ErrorCheck ("glClientWaitSync");
+
+	return result;
+}
+
+void GL::DeleteSync(GLsync sync)
+{
+	glDeleteSync(sync);
+
+	ErrorCheck ("glDeleteSync");
+}
+
 /*
  * Capabilities
 */
@@ -807,6 +854,15 @@ void GL::TexImage3D(GLenum target, GLint level, GLint internalFormat,
 	ErrorCheck ("glTexImage3D");
 }
 
+void GL::CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width,
+	GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+	glCompressedTexImage2D (target, level, internalformat, width, height,
+		border, imageSize, data);
+
+	ErrorCheck ("glCompressedTexImage2D");
+}
+
 void GL::TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
 	glTexStorage2D (target, levels, internalformat, width, height);
@@ -877,6 +933,24 @@ void GL::GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint
 	ErrorCheck ("glGetTexLevelParameteriv");
 }
 
+void GL::ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+	GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data)
+{
+	glClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+
+	ErrorCheck ("glClearTexSubImage");
+}
+
+void GL::CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ,
+	GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ,
+	GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	glCopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
+		dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+
+	ErrorCheck ("glCopyImageSubData");
+}
+
 /*
  * Pixels
 */
@@ -977,6 +1051,48 @@ void GL::LinkProgram(GLuint program)
 	ErrorCheck ("glLinkProgram");
 }
 
+void GL::GetProgramiv(GLuint program, GLenum pname, GLint *params)
+{
+	glGetProgramiv (program, pname, params);
+
+	ErrorCheck ("glGetProgramiv");
+}
+
+void GL::GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei *length, GLchar *infoLog)
+{
+	glGetProgramInfoLog (program, maxLength, length, infoLog);
+
+	ErrorCheck ("glGetProgramInfoLog");
+}
+
+void GL::ProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	glProgramParameteri (program, pname, value);
+
+	ErrorCheck ("glProgramParameteri");
+}
+
+void GL::GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary)
+{
+	glGetProgramBinary (program, bufSize, length, binaryFormat, binary);
+
+	ErrorCheck ("glGetProgramBinary");
+}
+
+void GL::ProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+	glProgramBinary (program, binaryFormat, binary, length);
+
+	ErrorCheck ("glProgramBinary");
+}
+
+void GL::MaxShaderCompilerThreads(GLuint count)
+{
+	glMaxShaderCompilerThreadsARB (count);
+
+	ErrorCheck ("glMaxShaderCompilerThreadsARB");
+}
+
 void GL::AttachShader(GLuint program, GLuint shader)
 {
 	glAttachShader(program, shader);
@@ -1058,6 +1174,15 @@ void GL::GetIntegerv(GLenum pname, GLint * params)
 	ErrorCheck ("glGetIntegerv");
 }
 
+const GLubyte* GL::GetString(GLenum name)
+{
+	const GLubyte* result = glGetString (name);
+
+	ErrorCheck ("glGetString");
+
+	return result;
+}
+
 /*
  * Cleaning
 */
@@ -74,6 +74,8 @@ public:
 	static void BufferData (GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage);
 	static void BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data);
 	static void GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data);
+	static void* MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+	static GLboolean UnmapBuffer (GLenum target);
 
 	/*
 	 * Vertex Attributes
@@ -139,6 +141,9 @@ public:
 	static void TexImage3D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, 
 		GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * data);
 
+	static void CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width,
+		GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data);
+
 	static void TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
 
 	static void TexEnvi(GLenum target,  GLenum pname,  GLint param);
@@ -150,6 +155,11 @@ public:
 	static void GenerateMipmap(GLenum target);
 	static void GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels);
 	static void GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params);
+	static void ClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+		GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * data);
+	static void CopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ,
+		GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ,
+		GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth);
 
 	/*
 	 * Pixels
@@ -178,6 +188,12 @@ public:
 	static void DeleteProgram(GLuint program);
 	static void UseProgram (GLuint program);
 	static void LinkProgram(GLuint program);
+	static void GetProgramiv(GLuint program, GLenum pname, GLint *params);
+	static void GetProgramInfoLog(GLuint program, GLsizei maxLength, GLsizei *length, GLchar *infoLog);
+	static void ProgramParameteri(GLuint program, GLenum pname, GLint value);
+	static void GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+	static void ProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+	static void MaxShaderCompilerThreads(GLuint count);
 
 	static void AttachShader(GLuint program, GLuint shader);
 	static void DetachShader(GLuint program, GLuint shader);
@@ -241,6 +257,14 @@ public:
 	static void GetQueryObjectiv(GLuint id, GLenum pname, GLint * params);
 	static void GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params);
 
+	/*
+	 * Sync Objects
+	*/
+
+	static GLsync FenceSync(GLenum condition, GLbitfield flags);
+	static GLenum ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+	static void DeleteSync(GLsync sync);
+
 	/*
 	 * Capabilities
 	*/
@@ -257,6 +281,7 @@ public:
 	static void GetFixedv(GLenum pname, GLfixed * params); 
 	static void GetFloatv(GLenum pname, GLfloat * params); 
 	static void GetIntegerv(GLenum pname, GLint * params);
+	static const GLubyte* GetString(GLenum name);
 
 	/*
 	 * Cleaning 
@@ -70,9 +70,10 @@ void StatsView::ShowStatisticsWindow ()
 		std::size_t drawnVerticesCount = renderStatisticsObject->DrawnVerticesCount;
 		std::size_t drawnPolygonsCount = renderStatisticsObject->DrawnPolygonsCount;
 		std::size_t drawnObjectsCount = renderStatisticsObject->DrawnObjectsCount;
+		std::size_t drawCallsCount = renderStatisticsObject->DrawCallsCount;
 
 		ImGui::Text ("Vertices: %lu Triangles: %lu", drawnVerticesCount, drawnPolygonsCount);
-		ImGui::Text ("Objects: %lu", drawnObjectsCount);
+		ImGui::Text ("Objects: %lu Draw Calls: %lu", drawnObjectsCount, drawCallsCount);
 
 		ImGui::Spacing ();
 